@@ -53,6 +53,8 @@ HYPRE_IJMatrixCreate( MPI_Comm        comm,
    hypre_IJMatrixAssembleFlag(ijmatrix)   = 0;
    hypre_IJMatrixPrintLevel(ijmatrix)     = 0;
    hypre_IJMatrixOMPFlag(ijmatrix)        = 0;
+   hypre_IJMatrixAssemblyPlanFlag(ijmatrix) = 0;
+   hypre_IJMatrixAssemblyPlan(ijmatrix)   = NULL;
 
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm, &myid);
@@ -831,6 +833,67 @@ HYPRE_IJMatrixAssemble( HYPRE_IJMatrix matrix )
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixAssembleCOO( HYPRE_IJMatrix       matrix,
+                           HYPRE_Int            nnz,
+                           const HYPRE_BigInt  *rows,
+                           const HYPRE_BigInt  *cols,
+                           const HYPRE_Complex *values )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+   HYPRE_MemoryLocation memory_location;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (nnz < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !rows)
+   {
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !cols)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   if (nnz && !values)
+   {
+      hypre_error_in_arg(5);
+      return hypre_error_flag;
+   }
+
+   if ( hypre_IJMatrixObjectType(ijmatrix) != HYPRE_PARCSR )
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   /* the ParCSR object is created here if Initialize has not been called */
+   memory_location = hypre_IJMatrixObject(ijmatrix) ? hypre_IJMatrixMemoryLocation(ijmatrix) :
+                     hypre_HandleMemoryLocation(hypre_handle());
+   if ( hypre_GetExecPolicy1(memory_location) != HYPRE_EXEC_HOST )
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "COO assembly is only available on the host\n");
+      return hypre_error_flag;
+   }
+
+   return( hypre_IJMatrixAssembleCOOParCSR( ijmatrix, nnz, rows, cols, values ) );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1332,3 +1395,23 @@ HYPRE_IJMatrixSetOMPFlag( HYPRE_IJMatrix matrix,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_IJMatrixSetAssemblyPlan( HYPRE_IJMatrix matrix,
+                               HYPRE_Int      plan_flag )
+{
+   hypre_IJMatrix *ijmatrix = (hypre_IJMatrix *) matrix;
+
+   if (!ijmatrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_IJMatrixAssemblyPlanFlag(ijmatrix) = plan_flag;
+
+   return hypre_error_flag;
+}
+
@@ -199,6 +199,28 @@ HYPRE_Int HYPRE_IJMatrixAddToValues2(HYPRE_IJMatrix       matrix,
  **/
 HYPRE_Int HYPRE_IJMatrixAssemble(HYPRE_IJMatrix matrix);
 
+/**
+ * Sets and assembles the matrix from \e nnz coordinate (COO) triplets
+ * (\e rows[k], \e cols[k], \e values[k]) in one collective call, as an
+ * alternative to the Initialize, AddToValues and Assemble sequence.  Each
+ * process may pass any number of entries of any row; entries with the same
+ * row and column are summed, and only values given in this call are kept.
+ * The triplets are redistributed to their owners in one exchange and
+ * compressed directly into the ParCSR storage, without the per-row
+ * auxiliary structures used by AddToValues.  Only available for host
+ * memory.
+ *
+ * The matrix must not have been assembled yet, unless it was assembled by
+ * this routine with an assembly plan (see \Ref{HYPRE_IJMatrixSetAssemblyPlan}).
+ * In that case the call only updates the values, and \e rows and \e cols
+ * must be the same, in the same order, as in the first call.
+ **/
+HYPRE_Int HYPRE_IJMatrixAssembleCOO(HYPRE_IJMatrix       matrix,
+                                    HYPRE_Int            nnz,
+                                    const HYPRE_BigInt  *rows,
+                                    const HYPRE_BigInt  *cols,
+                                    const HYPRE_Complex *values);
+
 /**
  * Gets number of nonzeros elements for \e nrows rows specified in \e rows
  * and returns them in \e ncols, which needs to be allocated by the
@@ -323,6 +345,27 @@ HYPRE_Int HYPRE_IJMatrixSetPrintLevel(HYPRE_IJMatrix matrix,
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag(HYPRE_IJMatrix matrix,
                                    HYPRE_Int      omp_flag);
 
+/**
+ * (Optional) If \e plan_flag is 1, \Ref{HYPRE_IJMatrixAssembleCOO} records
+ * an assembly plan when it assembles the matrix: where each triplet ends up
+ * in the ParCSR storage and which processes exchange values.  Later calls to
+ * \Ref{HYPRE_IJMatrixAssembleCOO} with the same triplet pattern then reduce
+ * to a scatter-add of the values and one exchange with the neighbors, as
+ * needed when the values are updated every time step.  The plan costs about
+ * one integer per triplet.  The default is 0.
+ *
+ * The flag also applies to \Ref{HYPRE_IJMatrixAssemble} on a matrix that is
+ * already assembled.  Values set or added in local rows of such a matrix are
+ * written in place; the first such assembly with values for rows of other
+ * processes records the exchange of these values, and later assemblies with
+ * the same off-processor rows and columns, passed in the same order, only
+ * exchange the values.  This is recorded in the default (assumed partition)
+ * build, for host memory.  A matrix keeps one plan, of the last kind
+ * recorded.  The flag must be the same on all processes.
+ **/
+HYPRE_Int HYPRE_IJMatrixSetAssemblyPlan(HYPRE_IJMatrix matrix,
+                                        HYPRE_Int      plan_flag);
+
 /**
  * Read the matrix from file.  This is mainly for debugging purposes.
  **/
@@ -747,6 +747,11 @@ hypre_IJMatrixSetValuesParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+
+   /* values change in place, drop the SELL shadow of the matvec */
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(par_matrix));
+
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
@@ -1134,6 +1139,9 @@ hypre_IJMatrixSetConstantValuesParCSRHost( hypre_IJMatrix *matrix,
    HYPRE_Int           nnz_offd   = hypre_CSRMatrixNumNonzeros(offd);
    HYPRE_Int           ii;
 
+   hypre_CSRMatrixClearSELL(diag);
+   hypre_CSRMatrixClearSELL(offd);
+
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(ii) HYPRE_SMP_SCHEDULE
 #endif
@@ -1238,6 +1246,11 @@ hypre_IJMatrixAddToValuesParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_size(comm, &num_procs);
    hypre_MPI_Comm_rank(comm, &my_id);
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+
+   /* values change in place, drop the SELL shadow of the matvec */
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(par_matrix));
+
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 #ifdef HYPRE_NO_GLOBAL_PARTITION
@@ -1721,6 +1734,7 @@ hypre_IJMatrixDestroyParCSR(hypre_IJMatrix *matrix)
 {
    hypre_ParCSRMatrixDestroy((hypre_ParCSRMatrix *)hypre_IJMatrixObject(matrix));
    hypre_AuxParCSRMatrixDestroy((hypre_AuxParCSRMatrix*)hypre_IJMatrixTranslator(matrix));
+   hypre_IJMatrixDestroyAssemblyPlanParCSR(matrix);
 
    return hypre_error_flag;
 }
@@ -2014,6 +2028,66 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
 #else
 
+/*--------------------------------------------------------------------
+ * hypre_IJMatrixValuePositionParCSR
+ *
+ * Position of the local entry (row, col) of an assembled matrix in the
+ * diag data, or the number of diag nonzeros plus its position in the offd
+ * data, located as in hypre_IJMatrixAddToValuesParCSR.  Returns -1 if the
+ * entry does not exist.
+ *--------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_IJMatrixValuePositionParCSR( hypre_IJMatrix *matrix,
+                                   HYPRE_BigInt    row,
+                                   HYPRE_BigInt    col )
+{
+   hypre_ParCSRMatrix *par_matrix    = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix    *diag          = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix    *offd          = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Int          *diag_i        = hypre_CSRMatrixI(diag);
+   HYPRE_Int          *diag_j        = hypre_CSRMatrixJ(diag);
+   HYPRE_Int          *offd_i        = hypre_CSRMatrixI(offd);
+   HYPRE_Int          *offd_j        = hypre_CSRMatrixJ(offd);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_BigInt       *col_map_offd  = hypre_ParCSRMatrixColMapOffd(par_matrix);
+   HYPRE_BigInt        row_0         = hypre_IJMatrixRowPartitioning(matrix)[0];
+   HYPRE_BigInt        col_0         = hypre_IJMatrixColPartitioning(matrix)[0];
+   HYPRE_BigInt        col_n         = hypre_IJMatrixColPartitioning(matrix)[1] - 1;
+   HYPRE_BigInt        first         = hypre_IJMatrixGlobalFirstCol(matrix);
+   HYPRE_Int           row_local, j, j_offd;
+
+   if (row < row_0 || row >= hypre_IJMatrixRowPartitioning(matrix)[1])
+   {
+      return -1;
+   }
+   row_local = (HYPRE_Int)(row - row_0);
+
+   if (col < col_0 || col > col_n)
+   {
+      j_offd = hypre_BigBinarySearch(col_map_offd, col - first, num_cols_offd);
+      for (j = offd_i[row_local]; j_offd > -1 && j < offd_i[row_local+1]; j++)
+      {
+         if (offd_j[j] == j_offd)
+         {
+            return hypre_CSRMatrixNumNonzeros(diag) + j;
+         }
+      }
+   }
+   else
+   {
+      for (j = diag_i[row_local]; j < diag_i[row_local+1]; j++)
+      {
+         if (diag_j[j] == (HYPRE_Int)(col - col_0))
+         {
+            return j;
+         }
+      }
+   }
+
+   return -1;
+}
+
 /* assumed partition version */
 
 HYPRE_Int
@@ -2082,7 +2156,17 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
    hypre_IJAssumedPart   *apart;
 
+   /* assembly plan of these values, see hypre_IJMatrixRecordOffProcPlanParCSR */
+   HYPRE_Int  record_plan;
+   HYPRE_Int  plan_num_recv = 0;
+   HYPRE_Int *plan_send_procs = NULL, *plan_send_starts = NULL, *plan_send_next = NULL;
+   HYPRE_Int *plan_send_slots = NULL, *plan_recv_procs = NULL, *plan_recv_starts = NULL;
+   HYPRE_Int *plan_position = NULL;
+
    hypre_MPI_Comm_rank(comm, &myid);
+   record_plan = hypre_IJMatrixAssemblyPlanFlag(matrix) &&
+                 hypre_IJMatrixAssembleFlag(matrix) &&
+                 memory_location == HYPRE_MEMORY_HOST;
    global_num_cols = hypre_IJMatrixGlobalNumCols(matrix);
    global_first_col = hypre_IJMatrixGlobalFirstCol(matrix);
    global_first_row = hypre_IJMatrixGlobalFirstRow(matrix);
@@ -2340,6 +2424,21 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       ex_contact_vec_starts[i+1] = -storage-1; /* need negative for next loop */
    }
 
+   if (record_plan)
+   {
+      plan_send_procs  = hypre_TAlloc(HYPRE_Int, num_real_procs, HYPRE_MEMORY_HOST);
+      plan_send_starts = hypre_TAlloc(HYPRE_Int, num_real_procs + 1, HYPRE_MEMORY_HOST);
+      plan_send_next   = hypre_TAlloc(HYPRE_Int, num_real_procs, HYPRE_MEMORY_HOST);
+      plan_send_slots  = hypre_TAlloc(HYPRE_Int, current_num_elmts, HYPRE_MEMORY_HOST);
+      plan_send_starts[0] = 0;
+      for (i = 0; i < num_real_procs; i++)
+      {
+         plan_send_procs[i]    = ex_contact_procs[i];
+         plan_send_next[i]     = plan_send_starts[i];
+         plan_send_starts[i+1] = plan_send_starts[i] + num_elements_total[i];
+      }
+   }
+
    hypre_TFree(num_elements_total, HYPRE_MEMORY_HOST);
 
    /*void_contact_buf = hypre_MAlloc(storage*obj_size_bytes);*/
@@ -2400,6 +2499,10 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
       for (j=0; j< num_elements; j++)
       {
          tmp_big_int = off_proc_j[counter+j]; /* col number */
+         if (record_plan)
+         {
+            plan_send_slots[plan_send_next[indx]++] = counter + j;
+         }
 
          hypre_TMemcpy( index_ptr,  &tmp_big_int, HYPRE_BigInt, 1, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
          index_ptr = (void *) ((char *) index_ptr + obj_size_bytes);
@@ -2500,6 +2603,14 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
    recv_data_ptr = send_proc_obj.v_elements;
    recv_starts = send_proc_obj.vec_starts;
 
+   if (record_plan)
+   {
+      plan_recv_procs  = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      plan_recv_starts = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      plan_position    = hypre_TAlloc(HYPRE_Int, recv_starts[num_recvs], HYPRE_MEMORY_HOST);
+      plan_recv_starts[0] = 0;
+   }
+
    for (i=0; i < num_recvs; i++)
    {
 
@@ -2572,6 +2683,11 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
          if (memory_location == HYPRE_MEMORY_HOST)
          {
             hypre_IJMatrixAddToValuesParCSR(matrix, 1, &num_elements, &row, &row_index, col_ptr, col_data_ptr);
+            for (k = 0; record_plan && k < num_elements; k++)
+            {
+               plan_position[plan_num_recv++] =
+                  hypre_IJMatrixValuePositionParCSR(matrix, row, col_ptr[k]);
+            }
          }
          else
          {
@@ -2600,6 +2716,26 @@ hypre_IJMatrixAssembleOffProcValsParCSR( hypre_IJMatrix       *matrix,
 
          indx += (num_elements*2);
       }
+
+      if (record_plan)
+      {
+         plan_recv_procs[i]    = send_proc_obj.id[i];
+         plan_recv_starts[i+1] = plan_num_recv;
+      }
+   }
+
+   if (record_plan)
+   {
+      hypre_IJMatrixRecordOffProcPlanParCSR(matrix, off_proc_i_indx, current_num_elmts,
+                                            off_proc_i, off_proc_j,
+                                            num_real_procs, plan_send_procs, plan_send_starts,
+                                            plan_send_slots, num_recvs, plan_recv_procs,
+                                            plan_recv_starts, plan_position);
+      hypre_TFree(plan_send_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan_send_starts, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan_send_next, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan_recv_procs, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan_recv_starts, HYPRE_MEMORY_HOST);
    }
 
    if (memory_location == HYPRE_MEMORY_DEVICE)
@@ -2822,6 +2958,7 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    //HYPRE_Int row_len;
    HYPRE_Int max_num_threads;
    HYPRE_Int aux_flag, aux_flag_global;
+   HYPRE_Int replayed = 0;
 
    max_num_threads = hypre_NumThreads();
 
@@ -2899,10 +3036,21 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
          off_proc_i=hypre_AuxParCSRMatrixOffProcI(aux_matrix);
          off_proc_j=hypre_AuxParCSRMatrixOffProcJ(aux_matrix);
          off_proc_data=hypre_AuxParCSRMatrixOffProcData(aux_matrix);
-         hypre_IJMatrixAssembleOffProcValsParCSR(
-            matrix,off_proc_i_indx, max_off_proc_elmts, current_num_elmts,
-            HYPRE_MEMORY_HOST,
-            off_proc_i, off_proc_j, off_proc_data);
+         /* an assembled matrix with an off-processor assembly plan only
+            needs the values exchanged (see IJMatrix_parcsr_coo.c) */
+         if (hypre_IJMatrixAssembleFlag(matrix) && hypre_IJMatrixAssemblyPlanFlag(matrix))
+         {
+            hypre_IJMatrixReplayOffProcPlanParCSR(matrix, off_proc_i_indx, current_num_elmts,
+                                                  off_proc_i, off_proc_j, off_proc_data,
+                                                  &replayed);
+         }
+         if (!replayed)
+         {
+            hypre_IJMatrixAssembleOffProcValsParCSR(
+               matrix,off_proc_i_indx, max_off_proc_elmts, current_num_elmts,
+               HYPRE_MEMORY_HOST,
+               off_proc_i, off_proc_j, off_proc_data);
+         }
       }
    }
 
@@ -3153,6 +3301,10 @@ hypre_IJMatrixAssembleParCSR(hypre_IJMatrix *matrix)
    hypre_AuxParCSRMatrixDestroy(aux_matrix);
    hypre_IJMatrixTranslator(matrix) = NULL;
 
+   /* values may have changed in place since the last assembly */
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(par_matrix));
+
    return hypre_error_flag;
 }
 
@@ -3224,6 +3376,11 @@ hypre_IJMatrixSetValuesOMPParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_rank(comm, &my_id);
    //max_num_threads = hypre_NumThreads();
    par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject( matrix );
+
+   /* values change in place, drop the SELL shadow of the matvec */
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(par_matrix));
+
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
@@ -3867,6 +4024,11 @@ hypre_IJMatrixAddToValuesOMPParCSR( hypre_IJMatrix       *matrix,
    hypre_MPI_Comm_rank(comm, &my_id);
    max_num_threads = hypre_NumThreads();
    par_matrix = (hypre_ParCSRMatrix*) hypre_IJMatrixObject( matrix );
+
+   /* values change in place, drop the SELL shadow of the matvec */
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(par_matrix));
+
    row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
    col_partitioning = hypre_IJMatrixColPartitioning(matrix);
 
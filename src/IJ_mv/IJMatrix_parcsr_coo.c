@@ -0,0 +1,873 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Bulk assembly of an IJMatrix_ParCSR from COO triplets
+ *
+ * The triplets are bucketed by owner in one counting pass and exchanged in a
+ * single all-to-all step (counts through hypre_MPI_Alltoall, then one
+ * message pair per nonempty neighbor).  The rows owned by this process are
+ * then grouped with a counting sort and compressed directly into the diag and
+ * offd CSR arrays, with duplicates summed.  No auxiliary matrix is built, and
+ * the only comparison sort is the one over the off-processor columns needed
+ * for col_map_offd.
+ *
+ * If hypre_IJMatrixAssemblyPlanFlag is set, the first assembly also records
+ * an assembly plan: the position in the diag/offd data of every triplet
+ * passed or received, and the value exchange as persistent requests.  Later
+ * calls with the same triplet pattern then only scatter-add the values.
+ *
+ * The same kind of plan is recorded for the off-processor values of
+ * HYPRE_IJMatrixAssemble on an assembled matrix (see
+ * hypre_IJMatrixAssembleParCSR); the values set in local rows of an
+ * assembled matrix are already written in place.
+ *
+ *****************************************************************************/
+
+#include "_hypre_IJ_mv.h"
+#include "_hypre_parcsr_mv.h"
+
+#include "../HYPRE.h"
+
+typedef struct
+{
+   HYPRE_Int           nnz;            /* number of triplets passed */
+   HYPRE_Int           num_recv;       /* number of triplets received */
+   HYPRE_Int           nnz_diag;
+   HYPRE_Int          *position;       /* nnz + num_recv entries: position in
+                                          diag data, nnz_diag + position in
+                                          offd data, or -1 if sent away */
+   HYPRE_Int           num_send;
+   HYPRE_Int          *send_slots;     /* triplet index of each sent value */
+   HYPRE_Complex      *send_data;
+   HYPRE_Complex      *recv_data;
+   HYPRE_Int           num_requests;
+   hypre_MPI_Request  *requests;       /* persistent, receives first */
+
+   /* plan of the off-processor values of hypre_IJMatrixAssembleParCSR: nnz
+      off-processor values passed, position has only num_recv entries, and
+      the rows and columns passed are kept to check later assemblies */
+   HYPRE_Int           off_proc;
+   HYPRE_Int           off_proc_i_indx;
+   HYPRE_BigInt       *off_proc_i;
+   HYPRE_BigInt       *off_proc_j;
+
+} hypre_IJAssemblyPlan;
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixDestroyAssemblyPlanParCSR
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixDestroyAssemblyPlanParCSR( hypre_IJMatrix *matrix )
+{
+   hypre_IJAssemblyPlan *plan = (hypre_IJAssemblyPlan *) hypre_IJMatrixAssemblyPlan(matrix);
+   HYPRE_Int             i;
+
+   if (plan)
+   {
+      for (i = 0; i < plan->num_requests; i++)
+      {
+         hypre_MPI_Request_free(&plan->requests[i]);
+      }
+      hypre_TFree(plan->requests, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->position, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->send_slots, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->recv_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->off_proc_i, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan->off_proc_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(plan, HYPRE_MEMORY_HOST);
+      hypre_IJMatrixAssemblyPlan(matrix) = NULL;
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixUpdateCOOParCSR
+ *
+ * Replaces the values of a matrix assembled with an assembly plan by the sums
+ * of the new triplet values.  Only the values travel.
+ *
+ *****************************************************************************/
+
+static HYPRE_Int
+hypre_IJMatrixUpdateCOOParCSR( hypre_IJMatrix      *matrix,
+                               const HYPRE_Complex *values )
+{
+   hypre_IJAssemblyPlan *plan       = (hypre_IJAssemblyPlan *) hypre_IJMatrixAssemblyPlan(matrix);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_CSRMatrix      *diag       = hypre_ParCSRMatrixDiag(par_matrix);
+   hypre_CSRMatrix      *offd       = hypre_ParCSRMatrixOffd(par_matrix);
+   HYPRE_Complex        *diag_data  = hypre_CSRMatrixData(diag);
+   HYPRE_Complex        *offd_data  = hypre_CSRMatrixData(offd);
+   HYPRE_Int             nnz_diag   = plan->nnz_diag;
+   HYPRE_Int            *position   = plan->position;
+   HYPRE_Int             nnz        = plan->nnz;
+   HYPRE_Int             k, pos;
+   hypre_MPI_Status     *status;
+
+   for (k = 0; k < plan->num_send; k++)
+   {
+      plan->send_data[k] = values[plan->send_slots[k]];
+   }
+   if (plan->num_requests)
+   {
+      hypre_MPI_Startall(plan->num_requests, plan->requests);
+   }
+
+   for (k = 0; k < hypre_CSRMatrixNumNonzeros(diag); k++)
+   {
+      diag_data[k] = 0.0;
+   }
+   for (k = 0; k < hypre_CSRMatrixNumNonzeros(offd); k++)
+   {
+      offd_data[k] = 0.0;
+   }
+
+   for (k = 0; k < nnz; k++)
+   {
+      pos = position[k];
+      if (pos >= nnz_diag)
+      {
+         offd_data[pos - nnz_diag] += values[k];
+      }
+      else if (pos >= 0)
+      {
+         diag_data[pos] += values[k];
+      }
+   }
+
+   if (plan->num_requests)
+   {
+      status = hypre_CTAlloc(hypre_MPI_Status, plan->num_requests, HYPRE_MEMORY_HOST);
+      hypre_MPI_Waitall(plan->num_requests, plan->requests, status);
+      hypre_TFree(status, HYPRE_MEMORY_HOST);
+   }
+
+   for (k = 0; k < plan->num_recv; k++)
+   {
+      pos = position[nnz + k];
+      if (pos >= nnz_diag)
+      {
+         offd_data[pos - nnz_diag] += plan->recv_data[k];
+      }
+      else
+      {
+         diag_data[pos] += plan->recv_data[k];
+      }
+   }
+
+   /* values changed in place */
+   hypre_CSRMatrixClearSELL(diag);
+   hypre_CSRMatrixClearSELL(offd);
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixRecordOffProcPlanParCSR
+ *
+ * Keeps the off-processor value exchange of an assembly of an assembled
+ * matrix (hypre_IJMatrixAssembleOffProcValsParCSR) as an assembly plan.  The
+ * current_num_elmts values passed in off_proc_i/j go to send_procs, in the
+ * order send_slots, with send_starts[num_sends] = current_num_elmts; the
+ * values received from recv_procs go to position (diag position, or nnz_diag
+ * + offd position).  If a received value has no position (-1), no plan is
+ * kept.  Takes ownership of send_slots and position.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixRecordOffProcPlanParCSR( hypre_IJMatrix *matrix,
+                                       HYPRE_Int       off_proc_i_indx,
+                                       HYPRE_Int       current_num_elmts,
+                                       HYPRE_BigInt   *off_proc_i,
+                                       HYPRE_BigInt   *off_proc_j,
+                                       HYPRE_Int       num_sends,
+                                       HYPRE_Int      *send_procs,
+                                       HYPRE_Int      *send_starts,
+                                       HYPRE_Int      *send_slots,
+                                       HYPRE_Int       num_recvs,
+                                       HYPRE_Int      *recv_procs,
+                                       HYPRE_Int      *recv_starts,
+                                       HYPRE_Int      *position )
+{
+   MPI_Comm              comm       = hypre_IJMatrixComm(matrix);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   hypre_IJAssemblyPlan *plan;
+   HYPRE_Int             num_recv   = recv_starts[num_recvs];
+   HYPRE_Int             i, k;
+
+   hypre_IJMatrixDestroyAssemblyPlanParCSR(matrix);
+
+   for (k = 0; k < num_recv; k++)
+   {
+      if (position[k] < 0)
+      {
+         hypre_TFree(send_slots, HYPRE_MEMORY_HOST);
+         hypre_TFree(position, HYPRE_MEMORY_HOST);
+         return hypre_error_flag;
+      }
+   }
+
+   plan = hypre_CTAlloc(hypre_IJAssemblyPlan, 1, HYPRE_MEMORY_HOST);
+   plan->off_proc        = 1;
+   plan->nnz             = current_num_elmts;
+   plan->num_recv        = num_recv;
+   plan->nnz_diag        = hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(par_matrix));
+   plan->position        = position;
+   plan->num_send        = send_starts[num_sends];
+   plan->send_slots      = send_slots;
+   plan->send_data       = hypre_CTAlloc(HYPRE_Complex, plan->num_send, HYPRE_MEMORY_HOST);
+   plan->recv_data       = hypre_CTAlloc(HYPRE_Complex, num_recv, HYPRE_MEMORY_HOST);
+   plan->off_proc_i_indx = off_proc_i_indx;
+   plan->off_proc_i      = hypre_TAlloc(HYPRE_BigInt, off_proc_i_indx, HYPRE_MEMORY_HOST);
+   plan->off_proc_j      = hypre_TAlloc(HYPRE_BigInt, current_num_elmts, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan->off_proc_i, off_proc_i, HYPRE_BigInt, off_proc_i_indx,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+   hypre_TMemcpy(plan->off_proc_j, off_proc_j, HYPRE_BigInt, current_num_elmts,
+                 HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+   plan->num_requests = num_sends + num_recvs;
+   plan->requests     = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_recvs; i++)
+   {
+      hypre_MPI_Recv_init(&plan->recv_data[recv_starts[i]], recv_starts[i+1] - recv_starts[i],
+                          HYPRE_MPI_COMPLEX, recv_procs[i], 4, comm, &plan->requests[i]);
+   }
+   for (i = 0; i < num_sends; i++)
+   {
+      hypre_MPI_Send_init(&plan->send_data[send_starts[i]], send_starts[i+1] - send_starts[i],
+                          HYPRE_MPI_COMPLEX, send_procs[i], 4, comm,
+                          &plan->requests[num_recvs + i]);
+   }
+
+   hypre_IJMatrixAssemblyPlan(matrix) = plan;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixReplayOffProcPlanParCSR
+ *
+ * Adds the off-processor values of an assembly of an assembled matrix with
+ * its off-processor assembly plan, if every process has a plan recorded for
+ * the same rows and columns, in the same order.  Otherwise, drops the plan
+ * and sets replayed to 0, and the caller does the full exchange.  Collective.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixReplayOffProcPlanParCSR( hypre_IJMatrix *matrix,
+                                       HYPRE_Int       off_proc_i_indx,
+                                       HYPRE_Int       current_num_elmts,
+                                       HYPRE_BigInt   *off_proc_i,
+                                       HYPRE_BigInt   *off_proc_j,
+                                       HYPRE_Complex  *off_proc_data,
+                                       HYPRE_Int      *replayed )
+{
+   MPI_Comm              comm       = hypre_IJMatrixComm(matrix);
+   hypre_IJAssemblyPlan *plan       = (hypre_IJAssemblyPlan *) hypre_IJMatrixAssemblyPlan(matrix);
+   hypre_ParCSRMatrix   *par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+   HYPRE_Complex        *diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(par_matrix));
+   HYPRE_Complex        *offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(par_matrix));
+   HYPRE_Int             match, all_match;
+   HYPRE_Int             k, pos;
+   hypre_MPI_Status     *status;
+
+   match = plan && plan->off_proc &&
+           plan->nnz == current_num_elmts &&
+           plan->off_proc_i_indx == off_proc_i_indx;
+   for (k = 0; match && k < off_proc_i_indx; k++)
+   {
+      match = (plan->off_proc_i[k] == off_proc_i[k]);
+   }
+   for (k = 0; match && k < current_num_elmts; k++)
+   {
+      match = (plan->off_proc_j[k] == off_proc_j[k]);
+   }
+   hypre_MPI_Allreduce(&match, &all_match, 1, HYPRE_MPI_INT, hypre_MPI_MIN, comm);
+
+   *replayed = all_match;
+   if (!all_match)
+   {
+      hypre_IJMatrixDestroyAssemblyPlanParCSR(matrix);
+      return hypre_error_flag;
+   }
+
+   for (k = 0; k < plan->num_send; k++)
+   {
+      plan->send_data[k] = off_proc_data[plan->send_slots[k]];
+   }
+   if (plan->num_requests)
+   {
+      status = hypre_CTAlloc(hypre_MPI_Status, plan->num_requests, HYPRE_MEMORY_HOST);
+      hypre_MPI_Startall(plan->num_requests, plan->requests);
+      hypre_MPI_Waitall(plan->num_requests, plan->requests, status);
+      hypre_TFree(status, HYPRE_MEMORY_HOST);
+   }
+
+   for (k = 0; k < plan->num_recv; k++)
+   {
+      pos = plan->position[k];
+      if (pos >= plan->nnz_diag)
+      {
+         offd_data[pos - plan->nnz_diag] += plan->recv_data[k];
+      }
+      else
+      {
+         diag_data[pos] += plan->recv_data[k];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre_IJMatrixAssembleCOOParCSR
+ *
+ * Builds and assembles the ParCSR matrix from nnz (rows[k], cols[k],
+ * values[k]) triplets.  Any process may pass entries of any row; entries with
+ * the same (row, col) are summed.  Collective.  Replaces the Initialize /
+ * SetValues / AddToValues / Assemble sequence (values set by earlier calls
+ * are discarded).  On an assembled matrix, only allowed if it was assembled
+ * with an assembly plan and the triplets have the same rows and columns, in
+ * the same order, as in that assembly.
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+hypre_IJMatrixAssembleCOOParCSR( hypre_IJMatrix      *matrix,
+                                 HYPRE_Int            nnz,
+                                 const HYPRE_BigInt  *rows,
+                                 const HYPRE_BigInt  *cols,
+                                 const HYPRE_Complex *values )
+{
+   MPI_Comm               comm             = hypre_IJMatrixComm(matrix);
+   HYPRE_BigInt          *row_partitioning = hypre_IJMatrixRowPartitioning(matrix);
+   HYPRE_BigInt          *col_partitioning = hypre_IJMatrixColPartitioning(matrix);
+   hypre_AuxParCSRMatrix *aux_matrix       = (hypre_AuxParCSRMatrix *) hypre_IJMatrixTranslator(matrix);
+   hypre_IJAssemblyPlan  *plan             = (hypre_IJAssemblyPlan *) hypre_IJMatrixAssemblyPlan(matrix);
+   HYPRE_Int              keep_plan        = hypre_IJMatrixAssemblyPlanFlag(matrix);
+   hypre_ParCSRMatrix    *par_matrix;
+   hypre_CSRMatrix       *diag, *offd;
+
+   HYPRE_Int              num_procs, my_id;
+   HYPRE_BigInt          *partitioning;
+   HYPRE_BigInt           first_row, col_0, col_n, base;
+   HYPRE_Int              num_rows, num_cols_diag, num_cols_offd;
+
+   HYPRE_Int             *owner;
+   HYPRE_Int             *send_counts, *recv_counts;
+   HYPRE_Int             *send_starts, *recv_starts, *send_pos;
+   HYPRE_BigInt          *send_ij, *recv_ij;
+   HYPRE_Complex         *send_data, *recv_data;
+   HYPRE_Int              num_local, num_sends, num_recvs, total_recv;
+   hypre_MPI_Request     *requests;
+   hypre_MPI_Status      *status;
+
+   HYPRE_Int             *row_starts, *sorted_col, *sorted_slot;
+   HYPRE_Int             *position, *send_slots;
+   HYPRE_Complex         *sorted_data;
+   HYPRE_BigInt          *offd_cols, *col_map_offd;
+   HYPRE_Int             *marker;
+   HYPRE_Int             *diag_i, *diag_j, *offd_i, *offd_j;
+   HYPRE_Complex         *diag_data, *offd_data;
+   HYPRE_Int              nnz_local, nnz_diag, nnz_offd, num_offd_cols;
+
+   HYPRE_BigInt           row, col;
+   HYPRE_Int              i, j, k, p, c, pos;
+   HYPRE_Complex          temp;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   if (hypre_IJMatrixAssembleFlag(matrix))
+   {
+      if (!plan || plan->off_proc || plan->nnz != nnz)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "COO assembly of an assembled IJMatrix without a matching assembly plan\n");
+         return hypre_error_flag;
+      }
+
+      return hypre_IJMatrixUpdateCOOParCSR(matrix, values);
+   }
+   hypre_IJMatrixDestroyAssemblyPlanParCSR(matrix);
+   plan = NULL;
+
+   /*-----------------------------------------------------------------------
+    * Global row partitioning and the local row and column ranges
+    *-----------------------------------------------------------------------*/
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   partitioning = hypre_TAlloc(HYPRE_BigInt, num_procs+1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Allgather(&row_partitioning[0], 1, HYPRE_MPI_BIG_INT,
+                       partitioning, 1, HYPRE_MPI_BIG_INT, comm);
+   partitioning[num_procs] = hypre_IJMatrixGlobalFirstRow(matrix) +
+                             hypre_IJMatrixGlobalNumRows(matrix);
+   col_0 = col_partitioning[0];
+   col_n = col_partitioning[1] - 1;
+   base  = hypre_IJMatrixGlobalFirstCol(matrix);
+#else
+   partitioning = row_partitioning;
+   col_0 = col_partitioning[my_id];
+   col_n = col_partitioning[my_id+1] - 1;
+   base  = col_partitioning[0];
+#endif
+   first_row     = partitioning[my_id];
+   num_rows      = (HYPRE_Int) (partitioning[my_id+1] - first_row);
+   num_cols_diag = (HYPRE_Int) (col_n - col_0 + 1);
+
+   /*-----------------------------------------------------------------------
+    * Bucket the triplets by owner
+    *-----------------------------------------------------------------------*/
+
+   owner       = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+   send_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   recv_counts = hypre_CTAlloc(HYPRE_Int, num_procs, HYPRE_MEMORY_HOST);
+   num_local   = 0;
+
+   for (k = 0; k < nnz; k++)
+   {
+      row = rows[k];
+      if (row >= first_row && row < first_row + num_rows)
+      {
+         owner[k] = my_id;
+         num_local++;
+      }
+      else
+      {
+         p = hypre_FindProc(partitioning, row, num_procs);
+         owner[k] = p;
+         if (p < 0)
+         {
+            /* keep going: the exchange below is collective */
+            hypre_error_w_msg(HYPRE_ERROR_GENERIC, "COO row index out of range\n");
+         }
+         else
+         {
+            send_counts[p]++;
+         }
+      }
+   }
+
+   hypre_MPI_Alltoall(send_counts, 1, HYPRE_MPI_INT, recv_counts, 1, HYPRE_MPI_INT, comm);
+
+   send_starts = hypre_TAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+   recv_starts = hypre_TAlloc(HYPRE_Int, num_procs+1, HYPRE_MEMORY_HOST);
+   send_starts[0] = 0;
+   recv_starts[0] = 0;
+   num_sends = 0;
+   num_recvs = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      send_starts[p+1] = send_starts[p] + send_counts[p];
+      recv_starts[p+1] = recv_starts[p] + recv_counts[p];
+      if (send_counts[p]) { num_sends++; }
+      if (recv_counts[p]) { num_recvs++; }
+   }
+   total_recv = recv_starts[num_procs];
+
+   /* pack in owner order (counting sort on the owner) */
+   send_ij   = hypre_TAlloc(HYPRE_BigInt,  2*send_starts[num_procs], HYPRE_MEMORY_HOST);
+   send_data = hypre_TAlloc(HYPRE_Complex, send_starts[num_procs],   HYPRE_MEMORY_HOST);
+   send_pos  = hypre_TAlloc(HYPRE_Int,     num_procs,                HYPRE_MEMORY_HOST);
+   send_slots = keep_plan ? hypre_TAlloc(HYPRE_Int, send_starts[num_procs], HYPRE_MEMORY_HOST) : NULL;
+   for (p = 0; p < num_procs; p++)
+   {
+      send_pos[p] = send_starts[p];
+   }
+   for (k = 0; k < nnz; k++)
+   {
+      p = owner[k];
+      if (p >= 0 && p != my_id)
+      {
+         pos = send_pos[p]++;
+         send_ij[2*pos]   = rows[k];
+         send_ij[2*pos+1] = cols[k];
+         send_data[pos]   = values[k];
+         if (send_slots)
+         {
+            send_slots[pos] = k;
+         }
+      }
+   }
+   hypre_TFree(send_pos, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Exchange the off-processor triplets
+    *-----------------------------------------------------------------------*/
+
+   recv_ij   = hypre_TAlloc(HYPRE_BigInt,  2*total_recv, HYPRE_MEMORY_HOST);
+   recv_data = hypre_TAlloc(HYPRE_Complex, total_recv,   HYPRE_MEMORY_HOST);
+   requests  = hypre_CTAlloc(hypre_MPI_Request, 2*(num_sends+num_recvs), HYPRE_MEMORY_HOST);
+   status    = hypre_CTAlloc(hypre_MPI_Status,  2*(num_sends+num_recvs), HYPRE_MEMORY_HOST);
+
+   j = 0;
+   for (p = 0; p < num_procs; p++)
+   {
+      if (recv_counts[p])
+      {
+         hypre_MPI_Irecv(&recv_ij[2*recv_starts[p]], 2*recv_counts[p], HYPRE_MPI_BIG_INT,
+                         p, 1, comm, &requests[j++]);
+         hypre_MPI_Irecv(&recv_data[recv_starts[p]], recv_counts[p], HYPRE_MPI_COMPLEX,
+                         p, 2, comm, &requests[j++]);
+      }
+   }
+   for (p = 0; p < num_procs; p++)
+   {
+      if (send_counts[p])
+      {
+         hypre_MPI_Isend(&send_ij[2*send_starts[p]], 2*send_counts[p], HYPRE_MPI_BIG_INT,
+                         p, 1, comm, &requests[j++]);
+         hypre_MPI_Isend(&send_data[send_starts[p]], send_counts[p], HYPRE_MPI_COMPLEX,
+                         p, 2, comm, &requests[j++]);
+      }
+   }
+   hypre_MPI_Waitall(j, requests, status);
+
+   hypre_TFree(requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(status, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_ij, HYPRE_MEMORY_HOST);
+
+   if (keep_plan)
+   {
+      /* later value exchanges reuse the buffers and the neighbors */
+      plan = hypre_CTAlloc(hypre_IJAssemblyPlan, 1, HYPRE_MEMORY_HOST);
+      plan->nnz          = nnz;
+      plan->num_recv     = total_recv;
+      plan->num_send     = send_starts[num_procs];
+      plan->send_slots   = send_slots;
+      plan->send_data    = send_data;
+      plan->recv_data    = recv_data;
+      plan->num_requests = num_sends + num_recvs;
+      plan->requests     = hypre_CTAlloc(hypre_MPI_Request, num_sends + num_recvs, HYPRE_MEMORY_HOST);
+      j = 0;
+      for (p = 0; p < num_procs; p++)
+      {
+         if (recv_counts[p])
+         {
+            hypre_MPI_Recv_init(&recv_data[recv_starts[p]], recv_counts[p], HYPRE_MPI_COMPLEX,
+                                p, 3, comm, &plan->requests[j++]);
+         }
+      }
+      for (p = 0; p < num_procs; p++)
+      {
+         if (send_counts[p])
+         {
+            hypre_MPI_Send_init(&send_data[send_starts[p]], send_counts[p], HYPRE_MPI_COMPLEX,
+                                p, 3, comm, &plan->requests[j++]);
+         }
+      }
+   }
+   else
+   {
+      hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+   }
+   hypre_TFree(send_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_counts, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_starts, HYPRE_MEMORY_HOST);
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+   hypre_TFree(partitioning, HYPRE_MEMORY_HOST);
+#endif
+
+   /*-----------------------------------------------------------------------
+    * Group the local triplets by row (counting sort).  The columns are
+    * stored as local indices: i >= 0 for diag, -1-(offd position) for offd.
+    * The triplets are numbered 0..nnz-1 for the ones passed and nnz.. for
+    * the ones received; sorted_slot keeps that number for the plan.
+    *-----------------------------------------------------------------------*/
+
+   nnz_local  = num_local + total_recv;
+   row_starts = hypre_CTAlloc(HYPRE_Int, num_rows+1, HYPRE_MEMORY_HOST);
+   for (k = 0; k < nnz; k++)
+   {
+      if (owner[k] == my_id)
+      {
+         row_starts[rows[k] - first_row + 1]++;
+      }
+   }
+   for (k = 0; k < total_recv; k++)
+   {
+      row_starts[recv_ij[2*k] - first_row + 1]++;
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      row_starts[i+1] += row_starts[i];
+   }
+
+   /* collect the offd columns for col_map_offd */
+   nnz_offd = 0;
+   for (k = 0; k < nnz; k++)
+   {
+      if (owner[k] == my_id && (cols[k] < col_0 || cols[k] > col_n))
+      {
+         nnz_offd++;
+      }
+   }
+   for (k = 0; k < total_recv; k++)
+   {
+      if (recv_ij[2*k+1] < col_0 || recv_ij[2*k+1] > col_n)
+      {
+         nnz_offd++;
+      }
+   }
+   offd_cols = hypre_TAlloc(HYPRE_BigInt, nnz_offd, HYPRE_MEMORY_HOST);
+   j = 0;
+   for (k = 0; k < nnz; k++)
+   {
+      if (owner[k] == my_id && (cols[k] < col_0 || cols[k] > col_n))
+      {
+         offd_cols[j++] = cols[k];
+      }
+   }
+   for (k = 0; k < total_recv; k++)
+   {
+      if (recv_ij[2*k+1] < col_0 || recv_ij[2*k+1] > col_n)
+      {
+         offd_cols[j++] = recv_ij[2*k+1];
+      }
+   }
+   num_cols_offd = 0;
+   if (nnz_offd)
+   {
+      hypre_BigQsort0(offd_cols, 0, nnz_offd-1);
+      num_cols_offd = 1;
+      for (k = 1; k < nnz_offd; k++)
+      {
+         if (offd_cols[k] > offd_cols[num_cols_offd-1])
+         {
+            offd_cols[num_cols_offd++] = offd_cols[k];
+         }
+      }
+   }
+   col_map_offd = hypre_TAlloc(HYPRE_BigInt, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_offd; k++)
+   {
+      col_map_offd[k] = offd_cols[k];
+   }
+   hypre_TFree(offd_cols, HYPRE_MEMORY_HOST);
+
+   sorted_col  = hypre_TAlloc(HYPRE_Int,     nnz_local, HYPRE_MEMORY_HOST);
+   sorted_data = hypre_TAlloc(HYPRE_Complex, nnz_local, HYPRE_MEMORY_HOST);
+   sorted_slot = plan ? hypre_TAlloc(HYPRE_Int, nnz_local, HYPRE_MEMORY_HOST) : NULL;
+   for (k = 0; k < nnz + total_recv; k++)
+   {
+      if (k < nnz)
+      {
+         if (owner[k] != my_id)
+         {
+            continue;
+         }
+         row  = rows[k];
+         col  = cols[k];
+         temp = values[k];
+      }
+      else
+      {
+         row  = recv_ij[2*(k-nnz)];
+         col  = recv_ij[2*(k-nnz)+1];
+         temp = recv_data[k-nnz];
+      }
+
+      if (col < col_0 || col > col_n)
+      {
+         c = -1 - hypre_BigBinarySearch(col_map_offd, col, num_cols_offd);
+      }
+      else
+      {
+         c = (HYPRE_Int) (col - col_0);
+      }
+
+      /* row_starts[i] is the next free slot of row i-1 until the shift below */
+      pos = row_starts[row - first_row]++;
+      sorted_col[pos]  = c;
+      sorted_data[pos] = temp;
+      if (sorted_slot)
+      {
+         sorted_slot[pos] = k;
+      }
+   }
+   for (i = num_rows; i > 0; i--)
+   {
+      row_starts[i] = row_starts[i-1];
+   }
+   row_starts[0] = 0;
+
+   hypre_TFree(owner, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_ij, HYPRE_MEMORY_HOST);
+   if (!plan)
+   {
+      hypre_TFree(recv_data, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Compress each row into diag and offd, summing duplicates.  The marker
+    * holds the position of a column in the row being built; positions from
+    * earlier rows are below the start of the current row.  The diagonal
+    * element, if present, gets the first space of its row.
+    *-----------------------------------------------------------------------*/
+
+   nnz_diag = nnz_local - nnz_offd;
+   diag_i    = hypre_CTAlloc(HYPRE_Int,     num_rows+1, HYPRE_MEMORY_HOST);
+   offd_i    = hypre_CTAlloc(HYPRE_Int,     num_rows+1, HYPRE_MEMORY_HOST);
+   diag_j    = hypre_TAlloc(HYPRE_Int,      nnz_diag,   HYPRE_MEMORY_HOST);
+   diag_data = hypre_TAlloc(HYPRE_Complex,  nnz_diag,   HYPRE_MEMORY_HOST);
+   offd_j    = hypre_TAlloc(HYPRE_Int,      nnz_offd,   HYPRE_MEMORY_HOST);
+   offd_data = hypre_TAlloc(HYPRE_Complex,  nnz_offd,   HYPRE_MEMORY_HOST);
+   marker    = hypre_TAlloc(HYPRE_Int, num_cols_diag + num_cols_offd, HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_cols_diag + num_cols_offd; k++)
+   {
+      marker[k] = -1;
+   }
+
+   /* offd positions are stored as -2-pos until nnz_diag is known */
+   position = NULL;
+   if (plan)
+   {
+      position = hypre_TAlloc(HYPRE_Int, nnz + total_recv, HYPRE_MEMORY_HOST);
+      for (k = 0; k < nnz; k++)
+      {
+         position[k] = -1;
+      }
+   }
+
+   nnz_diag = 0;
+   num_offd_cols = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = row_starts[i]; k < row_starts[i+1]; k++)
+      {
+         if (sorted_col[k] == i)
+         {
+            marker[i] = nnz_diag;
+            diag_j[nnz_diag]      = i;
+            diag_data[nnz_diag++] = 0.0;
+            break;
+         }
+      }
+
+      for (k = row_starts[i]; k < row_starts[i+1]; k++)
+      {
+         c = sorted_col[k];
+         if (c >= 0)
+         {
+            if (marker[c] < diag_i[i])
+            {
+               marker[c] = nnz_diag;
+               diag_j[nnz_diag]      = c;
+               diag_data[nnz_diag++] = sorted_data[k];
+            }
+            else
+            {
+               diag_data[marker[c]] += sorted_data[k];
+            }
+            pos = marker[c];
+         }
+         else
+         {
+            c = -1 - c;
+            if (marker[num_cols_diag + c] < offd_i[i])
+            {
+               marker[num_cols_diag + c] = num_offd_cols;
+               offd_j[num_offd_cols]      = c;
+               offd_data[num_offd_cols++] = sorted_data[k];
+            }
+            else
+            {
+               offd_data[marker[num_cols_diag + c]] += sorted_data[k];
+            }
+            pos = -2 - marker[num_cols_diag + c];
+         }
+         if (position)
+         {
+            position[sorted_slot[k]] = pos;
+         }
+      }
+      diag_i[i+1] = nnz_diag;
+      offd_i[i+1] = num_offd_cols;
+   }
+   nnz_offd = num_offd_cols;
+
+   if (plan)
+   {
+      for (k = 0; k < nnz + total_recv; k++)
+      {
+         if (position[k] < -1)
+         {
+            position[k] = nnz_diag - 2 - position[k];
+         }
+      }
+      plan->nnz_diag = nnz_diag;
+      plan->position = position;
+      hypre_IJMatrixAssemblyPlan(matrix) = plan;
+   }
+
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_starts, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_data, HYPRE_MEMORY_HOST);
+   hypre_TFree(sorted_slot, HYPRE_MEMORY_HOST);
+
+   if (base)
+   {
+      for (k = 0; k < num_cols_offd; k++)
+      {
+         col_map_offd[k] -= base;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Hand the arrays to the ParCSR matrix
+    *-----------------------------------------------------------------------*/
+
+   if (!hypre_IJMatrixObject(matrix))
+   {
+      hypre_IJMatrixCreateParCSR(matrix);
+   }
+   par_matrix = (hypre_ParCSRMatrix *) hypre_IJMatrixObject(matrix);
+
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiag(par_matrix));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffd(par_matrix));
+   hypre_TFree(hypre_ParCSRMatrixColMapOffd(par_matrix), HYPRE_MEMORY_HOST);
+
+   diag = hypre_CSRMatrixCreate(num_rows, num_cols_diag, nnz_diag);
+   hypre_CSRMatrixI(diag)    = diag_i;
+   hypre_CSRMatrixJ(diag)    = diag_j;
+   hypre_CSRMatrixData(diag) = diag_data;
+   hypre_CSRMatrixMemoryLocation(diag) = HYPRE_MEMORY_HOST;
+
+   offd = hypre_CSRMatrixCreate(num_rows, num_cols_offd, nnz_offd);
+   hypre_CSRMatrixI(offd)    = offd_i;
+   hypre_CSRMatrixJ(offd)    = offd_j;
+   hypre_CSRMatrixData(offd) = offd_data;
+   hypre_CSRMatrixMemoryLocation(offd) = HYPRE_MEMORY_HOST;
+
+   hypre_CSRMatrixSetRownnz(diag);
+   hypre_CSRMatrixSetRownnz(offd);
+
+   hypre_ParCSRMatrixDiag(par_matrix)       = diag;
+   hypre_ParCSRMatrixOffd(par_matrix)       = offd;
+   hypre_ParCSRMatrixColMapOffd(par_matrix) = col_map_offd;
+
+   hypre_AuxParCSRMatrixDestroy(aux_matrix);
+   hypre_IJMatrixTranslator(matrix) = NULL;
+   hypre_IJMatrixAssembleFlag(matrix) = 1;
+
+   return hypre_error_flag;
+}
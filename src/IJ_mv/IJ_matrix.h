@@ -42,6 +42,9 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
 
+   HYPRE_Int     assembly_plan_flag;  /* record assembly plans (COO, off-proc) */
+   void         *assembly_plan;       /* reused by later assemblies          */
+
 } hypre_IJMatrix;
 
 /*--------------------------------------------------------------------------
@@ -67,6 +70,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)       ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)             ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixAssemblyPlanFlag(matrix) ((matrix) -> assembly_plan_flag)
+#define hypre_IJMatrixAssemblyPlan(matrix)     ((matrix) -> assembly_plan)
 
 /*--------------------------------------------------------------------------
  * prototypes for operations on local objects
@@ -230,6 +230,9 @@ typedef struct hypre_IJMatrix_struct
    HYPRE_Int     omp_flag;
    HYPRE_Int     print_level;
 
+   HYPRE_Int     assembly_plan_flag;  /* record assembly plans (COO, off-proc) */
+   void         *assembly_plan;       /* reused by later assemblies          */
+
 } hypre_IJMatrix;
 
 /*--------------------------------------------------------------------------
@@ -253,6 +256,8 @@ typedef struct hypre_IJMatrix_struct
 #define hypre_IJMatrixGlobalNumCols(matrix)    ((matrix) -> global_num_cols)
 #define hypre_IJMatrixOMPFlag(matrix)          ((matrix) -> omp_flag)
 #define hypre_IJMatrixPrintLevel(matrix)       ((matrix) -> print_level)
+#define hypre_IJMatrixAssemblyPlanFlag(matrix) ((matrix) -> assembly_plan_flag)
+#define hypre_IJMatrixAssemblyPlan(matrix)     ((matrix) -> assembly_plan)
 
 static inline HYPRE_MemoryLocation
 hypre_IJMatrixMemoryLocation(hypre_IJMatrix *matrix)
@@ -410,6 +415,12 @@ HYPRE_Int hypre_IJMatrixAssembleParCSRDevice(hypre_IJMatrix *matrix);
 HYPRE_Int hypre_IJMatrixInitializeParCSR_v2(hypre_IJMatrix *matrix, HYPRE_MemoryLocation memory_location);
 HYPRE_Int hypre_IJMatrixSetConstantValuesParCSRDevice( hypre_IJMatrix *matrix, HYPRE_Complex value );
 
+/* IJMatrix_parcsr_coo.c */
+HYPRE_Int hypre_IJMatrixDestroyAssemblyPlanParCSR ( hypre_IJMatrix *matrix );
+HYPRE_Int hypre_IJMatrixRecordOffProcPlanParCSR ( hypre_IJMatrix *matrix , HYPRE_Int off_proc_i_indx , HYPRE_Int current_num_elmts , HYPRE_BigInt *off_proc_i , HYPRE_BigInt *off_proc_j , HYPRE_Int num_sends , HYPRE_Int *send_procs , HYPRE_Int *send_starts , HYPRE_Int *send_slots , HYPRE_Int num_recvs , HYPRE_Int *recv_procs , HYPRE_Int *recv_starts , HYPRE_Int *position );
+HYPRE_Int hypre_IJMatrixReplayOffProcPlanParCSR ( hypre_IJMatrix *matrix , HYPRE_Int off_proc_i_indx , HYPRE_Int current_num_elmts , HYPRE_BigInt *off_proc_i , HYPRE_BigInt *off_proc_j , HYPRE_Complex *off_proc_data , HYPRE_Int *replayed );
+HYPRE_Int hypre_IJMatrixAssembleCOOParCSR ( hypre_IJMatrix *matrix , HYPRE_Int nnz , const HYPRE_BigInt *rows , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
+
 /* IJMatrix_petsc.c */
 HYPRE_Int hypre_IJMatrixSetLocalSizePETSc ( hypre_IJMatrix *matrix , HYPRE_Int local_m , HYPRE_Int local_n );
 HYPRE_Int hypre_IJMatrixCreatePETSc ( hypre_IJMatrix *matrix );
@@ -456,6 +467,7 @@ HYPRE_Int HYPRE_IJMatrixSetValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HY
 HYPRE_Int HYPRE_IJMatrixSetConstantValues ( HYPRE_IJMatrix matrix , HYPRE_Complex value );
 HYPRE_Int HYPRE_IJMatrixAddToValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *ncols , const HYPRE_BigInt *rows , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixAssemble ( HYPRE_IJMatrix matrix );
+HYPRE_Int HYPRE_IJMatrixAssembleCOO ( HYPRE_IJMatrix matrix , HYPRE_Int nnz , const HYPRE_BigInt *rows , const HYPRE_BigInt *cols , const HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixGetRowCounts ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_BigInt *rows , HYPRE_Int *ncols );
 HYPRE_Int HYPRE_IJMatrixGetValues ( HYPRE_IJMatrix matrix , HYPRE_Int nrows , HYPRE_Int *ncols , HYPRE_BigInt *rows , HYPRE_BigInt *cols , HYPRE_Complex *values );
 HYPRE_Int HYPRE_IJMatrixSetObjectType ( HYPRE_IJMatrix matrix , HYPRE_Int type );
@@ -468,6 +480,7 @@ HYPRE_Int HYPRE_IJMatrixSetMaxOffProcElmts ( HYPRE_IJMatrix matrix , HYPRE_Int m
 HYPRE_Int HYPRE_IJMatrixRead ( const char *filename , MPI_Comm comm , HYPRE_Int type , HYPRE_IJMatrix *matrix_ptr );
 HYPRE_Int HYPRE_IJMatrixPrint ( HYPRE_IJMatrix matrix , const char *filename );
 HYPRE_Int HYPRE_IJMatrixSetOMPFlag ( HYPRE_IJMatrix matrix , HYPRE_Int omp_flag );
+HYPRE_Int HYPRE_IJMatrixSetAssemblyPlan ( HYPRE_IJMatrix matrix , HYPRE_Int plan_flag );
 
 /* HYPRE_IJVector.c */
 HYPRE_Int HYPRE_IJVectorCreate ( MPI_Comm comm , HYPRE_BigInt jlower , HYPRE_BigInt jupper , HYPRE_IJVector *vector );
@@ -178,6 +178,17 @@ HYPRE_Int HYPRE_PCGSetRecomputeResidual(HYPRE_Solver solver,
 HYPRE_Int HYPRE_PCGSetRecomputeResidualP(HYPRE_Solver solver,
                                          HYPRE_Int    recompute_residual_p);
 
+/**
+ * (Optional) Use the pipelined (communication-hiding) variant of PCG.  The
+ * inner products of an iteration are combined into one non-blocking
+ * reduction that overlaps with the preconditioner and the matvec.  This
+ * costs six additional vectors and is ignored when the relative change,
+ * residual recomputation, residual tolerance, or convergence factor
+ * tolerance options are used.
+ **/
+HYPRE_Int HYPRE_PCGSetPipelined(HYPRE_Solver solver,
+                                HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -259,6 +270,11 @@ HYPRE_Int HYPRE_PCGGetTwoNorm(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_PCGGetRelChange(HYPRE_Solver  solver,
                                 HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_PCGGetPipelined(HYPRE_Solver  solver,
+                                HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck(HYPRE_Solver solver,
@@ -376,6 +392,17 @@ HYPRE_Int HYPRE_GMRESSetRelChange(HYPRE_Solver solver,
 HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck(HYPRE_Solver solver,
                                               HYPRE_Int    skip_real_r_check);
 
+/**
+ * (Optional) Use the pipelined (communication-hiding) variant of GMRES,
+ * p(1)-GMRES.  The orthogonalization of each Arnoldi step is done with
+ * classical Gram-Schmidt in one non-blocking reduction, which overlaps with
+ * the preconditioner and the matvec of the next step.  This costs k_dim+1
+ * additional vectors and is ignored when the relative change or convergence
+ * factor tolerance options are used.
+ **/
+HYPRE_Int HYPRE_GMRESSetPipelined(HYPRE_Solver solver,
+                                  HYPRE_Int    pipelined);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -457,6 +484,11 @@ HYPRE_Int HYPRE_GMRESGetKDim(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_GMRESGetRelChange(HYPRE_Solver  solver,
                                   HYPRE_Int    *rel_change);
 
+/**
+ **/
+HYPRE_Int HYPRE_GMRESGetPipelined(HYPRE_Solver  solver,
+                                  HYPRE_Int    *pipelined);
+
 /**
  **/
 HYPRE_Int HYPRE_GMRESGetPrecond(HYPRE_Solver  solver,
@@ -896,6 +928,16 @@ HYPRE_Int HYPRE_COGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_COGMRESSetCGS(HYPRE_Solver solver,
                               HYPRE_Int    cgs);
 
+/**
+ * (Optional) Build the Krylov basis in blocks of {\tt s\_step} vectors
+ * (s-step GMRES).  Each block is generated with a Chebyshev basis and
+ * orthogonalized with two global reductions instead of one or two per
+ * vector.  Values larger than one are effective only without relative
+ * change and convergence factor tests.  Default: 1.
+ **/
+HYPRE_Int HYPRE_COGMRESSetSStep(HYPRE_Solver solver,
+                                HYPRE_Int    s_step);
+
 /**
  * (Optional) Set the preconditioner to use.
  **/
@@ -977,6 +1019,11 @@ HYPRE_Int HYPRE_COGMRESGetUnroll(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_COGMRESGetCGS(HYPRE_Solver  solver,
                               HYPRE_Int    *cgs);
 
+/**
+ **/
+HYPRE_Int HYPRE_COGMRESGetSStep(HYPRE_Solver  solver,
+                                HYPRE_Int    *s_step);
+
 /**
  **/
 HYPRE_Int HYPRE_COGMRESGetPrecond(HYPRE_Solver  solver,
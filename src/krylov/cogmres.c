@@ -32,6 +32,8 @@ hypre_COGMRESFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*MassInnerProd) (void *x, void **y, HYPRE_Int k, HYPRE_Int unroll, void *result),
    HYPRE_Int    (*MassDotpTwo)   (void *x, void *y, void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
@@ -57,6 +59,7 @@ hypre_COGMRESFunctionsCreate(
    cogmres_functions->Matvec            = Matvec;
    cogmres_functions->MatvecDestroy     = MatvecDestroy;
    cogmres_functions->InnerProd         = InnerProd;
+   cogmres_functions->InnerProdStart    = InnerProdStart;
    cogmres_functions->MassInnerProd     = MassInnerProd;
    cogmres_functions->MassDotpTwo       = MassDotpTwo;
    cogmres_functions->CopyVector        = CopyVector;
@@ -87,6 +90,7 @@ hypre_COGMRESCreate( hypre_COGMRESFunctions *cogmres_functions )
    /* set defaults */
    (cogmres_data -> k_dim)          = 5;
    (cogmres_data -> cgs)            = 1; /* if 2 performs reorthogonalization */
+   (cogmres_data -> s_step)         = 1; /* if > 1 uses hypre_COGMRESSolveSStep */
    (cogmres_data -> tol)            = 1.0e-06; /* relative residual tol */
    (cogmres_data -> cf_tol)         = 0.0;
    (cogmres_data -> a_tol)          = 0.0; /* abs. residual tol */
@@ -300,6 +304,11 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((cogmres_data -> s_step) > 1 && !rel_change && cf_tol == 0.0)
+   {
+      return hypre_COGMRESSolveSStep(cogmres_vdata, A, b, x);
+   }
+
    (cogmres_data -> converged) = 0;
    /*-----------------------------------------------------------------------
     * With relative change convergence test on, it is possible to attempt
@@ -840,6 +849,682 @@ hypre_COGMRESSolve(void  *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESInnerProds
+ *
+ * result[k] = <x[k],y[k]>, k < n, in a single global reduction.  Interfaces
+ * without an InnerProdStart function get one blocking inner product each.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESInnerProds( hypre_COGMRESFunctions *cogmres_functions,
+                         HYPRE_Int               n,
+                         void                  **x,
+                         void                  **y,
+                         HYPRE_Real             *local_result,
+                         HYPRE_Real             *result )
+{
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+   HYPRE_Int         k;
+
+   if (cogmres_functions->InnerProdStart)
+   {
+      (*(cogmres_functions->InnerProdStart))(n, x, y, local_result, result, &request);
+      hypre_MPI_Wait(&request, &status);
+   }
+   else
+   {
+      for (k = 0; k < n; k++)
+      {
+         result[k] = (*(cogmres_functions->InnerProd))(x[k], y[k]);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESBlockOrthogonalize
+ *
+ * Orthonormalizes p[nq], ..., p[nq+nv-1] in place against the orthonormal
+ * vectors p[0], ..., p[nq-1] and among themselves, with one global
+ * reduction: the inner products with the old vectors (C) and the Gram
+ * matrix G of the new ones are reduced together, and the Cholesky factor R
+ * of the projected vectors follows from G - C^T C.  On return
+ *
+ *    p[nq+k] = (V_k - sum_r C(r,k) p[r] - sum_{l<k} R(l,k) p[nq+l]) / R(k,k)
+ *
+ * Returns the number of vectors orthonormalized.  If it is k < nv, V_k was
+ * found numerically in the span of the others: column k of C and R is still
+ * set, with R(k,k) = 0, and the vectors from p[nq+k] on are left untouched.
+ *
+ * C and R are stored by columns.  work needs room for 2*n reals and xy for
+ * 2*n pointers, n = nq*nv + nv*(nv+1)/2.  The vectors p[0], ..., p[nq+nv-1]
+ * must be contiguous as required by MassAxpy.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESBlockOrthogonalize( hypre_COGMRESFunctions *cogmres_functions,
+                                 void                  **p,
+                                 HYPRE_Int               nq,
+                                 HYPRE_Int               nv,
+                                 HYPRE_Int               unroll,
+                                 HYPRE_Real             *C,
+                                 HYPRE_Int               ldc,
+                                 HYPRE_Real             *R,
+                                 HYPRE_Int               ldr,
+                                 HYPRE_Real             *work,
+                                 void                  **xy )
+{
+   HYPRE_Int    n     = nq*nv + nv*(nv+1)/2;
+   HYPRE_Real  *dot   = work;
+   HYPRE_Real  *local = work + n;
+   void       **x     = xy;
+   void       **y     = xy + n;
+
+   HYPRE_Int    k, l, q, r, m, off, off_l, nv_ok;
+   HYPRE_Real   g;
+
+   /* for each new vector: <p[r],V_k>, r < nq + k + 1 */
+   m = 0;
+   for (k = 0; k < nv; k++)
+   {
+      for (r = 0; r < nq+k+1; r++)
+      {
+         x[m] = p[r];
+         y[m] = p[nq+k];
+         m++;
+      }
+   }
+   hypre_COGMRESInnerProds(cogmres_functions, n, x, y, local, dot);
+
+   nv_ok = nv;
+   for (k = 0; k < nv && nv_ok == nv; k++)
+   {
+      off = k*nq + k*(k+1)/2;
+      for (r = 0; r < nq; r++)
+      {
+         C[k*ldc+r] = dot[off+r];
+      }
+      for (l = 0; l <= k; l++)
+      {
+         /* entry (l,k) of the Gram matrix of the projected vectors */
+         off_l = l*nq + l*(l+1)/2;
+         g = dot[off+nq+l];
+         for (r = 0; r < nq; r++)
+         {
+            g -= dot[off_l+r]*dot[off+r];
+         }
+         for (q = 0; q < l; q++)
+         {
+            g -= R[l*ldr+q]*R[k*ldr+q];
+         }
+
+         if (l < k)
+         {
+            R[k*ldr+l] = g / R[l*ldr+l];
+         }
+         else if (g > 1.0e-12*dot[off+nq+k])
+         {
+            R[k*ldr+k] = sqrt(g);
+         }
+         else
+         {
+            R[k*ldr+k] = 0.0;
+            nv_ok = k;
+         }
+      }
+   }
+
+   for (k = 0; k < nv_ok; k++)
+   {
+      for (r = 0; r < nq; r++)
+      {
+         local[r] = -C[k*ldc+r];
+      }
+      for (l = 0; l < k; l++)
+      {
+         local[nq+l] = -R[k*ldr+l];
+      }
+      (*(cogmres_functions->MassAxpy))(local, p, p[nq+k], nq+k, unroll);
+      (*(cogmres_functions->ScaleVector))(1.0/R[k*ldr+k], p[nq+k]);
+   }
+
+   return nv_ok;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESChebyshevInterval
+ *
+ * Estimates an interval [c-d,c+d] containing the real parts of the spectrum
+ * of the preconditioned operator from the union of the Gershgorin discs of
+ * the symmetric part of the n x n Hessenberg matrix hu (stored by columns).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_COGMRESChebyshevInterval( HYPRE_Real *hu,
+                                HYPRE_Int   ld,
+                                HYPRE_Int   n,
+                                HYPRE_Real *center,
+                                HYPRE_Real *half_width )
+{
+   HYPRE_Int  r, j;
+   HYPRE_Real lo, hi, radius;
+
+   lo = hu[0];
+   hi = hu[0];
+   for (r = 0; r < n; r++)
+   {
+      radius = 0.0;
+      for (j = 0; j < n; j++)
+      {
+         if (j != r)
+         {
+            radius += 0.5*fabs(hu[j*ld+r] + hu[r*ld+j]);
+         }
+      }
+      lo = hypre_min(lo, hu[r*ld+r] - radius);
+      hi = hypre_max(hi, hu[r*ld+r] + radius);
+   }
+
+   *center     = 0.5*(lo + hi);
+   *half_width = 0.5*(hi - lo);
+   if (*half_width <= 0.0)
+   {
+      *half_width = (*center != 0.0) ? fabs(*center) : 1.0;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSolveSStep
+ *--------------------------------------------------------------------------
+ *
+ * s-step (communication-avoiding) variant of hypre_COGMRESSolve.  Each
+ * restart cycle builds the basis in blocks: starting from the last
+ * orthonormal vector W_0 = p[j0], the s vectors
+ *
+ *       W_1 = (A*C - c) W_0 / d,   W_{m+1} = 2 (A*C - c) W_m / d - W_{m-1}
+ *
+ * of a Chebyshev basis are generated without any inner products, then
+ * orthonormalized against p[0], ..., p[j0] and among themselves by two
+ * passes of hypre_COGMRESBlockOrthogonalize (block CGS2), i.e. with two
+ * global reductions for s basis vectors.  The corresponding s columns of
+ * the Hessenberg matrix follow from the change of basis, after which the
+ * Givens rotations and the convergence check proceed one column at a time
+ * as in hypre_COGMRESSolve.
+ *
+ * The interval [c-d,c+d] comes from the Hessenberg matrix of the previous
+ * cycle (see hypre_COGMRESChebyshevInterval); the first s steps of the
+ * first cycle are taken one vector at a time to provide it.  A block that
+ * turns out to be numerically rank deficient is cut short, and every cycle
+ * restarts from the true residual.
+ *
+ * Called by hypre_COGMRESSolve when s_step > 1 and neither the rel_change
+ * nor the cf_tol option is set.
+ *
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSolveSStep(void  *cogmres_vdata,
+                        void  *A,
+                        void  *b,
+                        void  *x)
+{
+   hypre_COGMRESData      *cogmres_data      = (hypre_COGMRESData *)cogmres_vdata;
+   hypre_COGMRESFunctions *cogmres_functions = cogmres_data->functions;
+   HYPRE_Int     k_dim             = (cogmres_data -> k_dim);
+   HYPRE_Int     s_step            = (cogmres_data -> s_step);
+   HYPRE_Int     unroll            = (cogmres_data -> unroll);
+   HYPRE_Int     min_iter          = (cogmres_data -> min_iter);
+   HYPRE_Int     max_iter          = (cogmres_data -> max_iter);
+   HYPRE_Int     skip_real_r_check = (cogmres_data -> skip_real_r_check);
+   HYPRE_Real    r_tol             = (cogmres_data -> tol);
+   HYPRE_Real    a_tol             = (cogmres_data -> a_tol);
+   void         *matvec_data       = (cogmres_data -> matvec_data);
+
+   void         *r                 = (cogmres_data -> r);
+   void         *w                 = (cogmres_data -> w);
+   void        **p                 = (cogmres_data -> p);
+
+   HYPRE_Int (*precond)(void*,void*,void*,void*) = (cogmres_functions -> precond);
+   HYPRE_Int  *precond_data       = (HYPRE_Int*)(cogmres_data -> precond_data);
+
+   HYPRE_Int print_level = (cogmres_data -> print_level);
+   HYPRE_Int logging     = (cogmres_data -> logging);
+
+   HYPRE_Real     *norms          = (cogmres_data -> norms);
+
+   HYPRE_Int   ld = k_dim+1;
+   HYPRE_Int   n_max;
+   HYPRE_Int   i, j, k, l, m, q, row, itmp;
+   HYPRE_Int   j0, s_cur, nv1, nv, ncol, nrow, have_interval, done;
+   HYPRE_Real *rs, *hh, *hu, *hc, *c, *s;
+   HYPRE_Real *rw, *C1, *C2, *R1, *R2, *work;
+   void      **xy;
+   HYPRE_Int   iter;
+   HYPRE_Int   my_id, num_procs;
+   HYPRE_Real  epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real  cheb_c, cheb_d;
+   HYPRE_Real  dot[2], dot_local[2];
+   void       *dot_x[2], *dot_y[2];
+
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_Real real_r_norm_old, real_r_norm_new;
+
+   (cogmres_data -> converged) = 0;
+
+   (*(cogmres_functions->CommInfo))(A,&my_id,&num_procs);
+   if ( logging>0 || print_level>0 )
+   {
+      norms          = (cogmres_data -> norms);
+   }
+
+   s_step = hypre_min(s_step, k_dim);
+   n_max  = ld*s_step + s_step*(s_step+1)/2;
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,cogmres_functions, HYPRE_MEMORY_HOST);
+   c  = hypre_CTAllocF(HYPRE_Real,k_dim,cogmres_functions, HYPRE_MEMORY_HOST);
+   s  = hypre_CTAllocF(HYPRE_Real,k_dim,cogmres_functions, HYPRE_MEMORY_HOST);
+   hh = hypre_CTAllocF(HYPRE_Real, ld*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   hu = hypre_CTAllocF(HYPRE_Real, ld*k_dim, cogmres_functions, HYPRE_MEMORY_HOST);
+   rw = hypre_CTAllocF(HYPRE_Real, ld*(s_step+1), cogmres_functions, HYPRE_MEMORY_HOST);
+   C1 = hypre_CTAllocF(HYPRE_Real, ld*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   C2 = hypre_CTAllocF(HYPRE_Real, ld*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   R1 = hypre_CTAllocF(HYPRE_Real, s_step*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   R2 = hypre_CTAllocF(HYPRE_Real, s_step*s_step, cogmres_functions, HYPRE_MEMORY_HOST);
+   work = hypre_CTAllocF(HYPRE_Real, 2*n_max, cogmres_functions, HYPRE_MEMORY_HOST);
+   xy = hypre_CTAllocF(void*, 2*n_max, cogmres_functions, HYPRE_MEMORY_HOST);
+
+   (*(cogmres_functions->CopyVector))(b,p[0]);
+
+   /* compute initial residual */
+   (*(cogmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+
+   /* <b,b> and <r,r> in one reduction */
+   dot_x[0] = b;    dot_y[0] = b;
+   dot_x[1] = p[0]; dot_y[1] = p[0];
+   hypre_COGMRESInnerProds(cogmres_functions, 2, dot_x, dot_y, dot_local, dot);
+
+   b_norm = sqrt(dot[0]);
+   r_norm = sqrt(dot[1]);
+   real_r_norm_old = b_norm;
+
+   if (b_norm != 0.) ieee_check = b_norm/b_norm; /* INF -> NaN conversion */
+   if (r_norm != 0. && ieee_check == ieee_check) ieee_check = r_norm/r_norm;
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_COGMRESSolveSStep: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      r_norm = 0.0;
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   if (b_norm > 0.0)
+   {
+      /* convergence criterion |r_i|/|b| <= accuracy if |b| > 0 */
+      den_norm = b_norm;
+   }
+   else
+   {
+      /* convergence criterion |r_i|/|r0| <= accuracy if |b| = 0 */
+      den_norm = r_norm;
+   };
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm) */
+   epsilon = hypre_max(a_tol,r_tol*den_norm);
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      };
+   }
+
+   /* the first s_step steps use blocks of one vector */
+   have_interval = 0;
+   cheb_c = 0.0;
+   cheb_d = 1.0;
+
+   while (iter < max_iter)
+   {
+      /* initialize first term of hessenberg system */
+      rs[0] = r_norm;
+      if (r_norm == 0.0)
+      {
+         break;
+      }
+
+      /* see if we are already converged and
+         should print the final norm and exit */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         (*(cogmres_functions->CopyVector))(b,r);
+         (*(cogmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+         r_norm = sqrt((*(cogmres_functions->InnerProd))(r,r));
+         if (r_norm  <= epsilon)
+         {
+            if ( print_level>1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            break;
+         }
+         else if ( print_level>0 && my_id == 0)
+            hypre_printf("false convergence 1\n");
+      }
+
+      t = 1.0 / r_norm;
+      (*(cogmres_functions->ScaleVector))(t,p[0]);
+      i = 0;
+      done = 0;
+      /***RESTART CYCLE (right-preconditioning) ***/
+      while (i < k_dim && iter < max_iter && !done)
+      {
+         j0 = i;
+         if (!have_interval && i >= s_step)
+         {
+            hypre_COGMRESChebyshevInterval(hu, ld, i, &cheb_c, &cheb_d);
+            have_interval = 1;
+         }
+         s_cur = have_interval ? s_step : 1;
+         s_cur = hypre_min(s_cur, k_dim - j0);
+         s_cur = hypre_min(s_cur, max_iter - iter);
+
+         /* basis vectors W_1, ..., W_s in p[j0+1], ..., p[j0+s] */
+         for (m = 0; m < s_cur; m++)
+         {
+            (*(cogmres_functions->ClearVector))(r);
+            precond(precond_data, A, p[j0+m], r);
+            (*(cogmres_functions->Matvec))(matvec_data, 1.0, A, r, 0.0, p[j0+m+1]);
+            (*(cogmres_functions->Axpy))(-cheb_c, p[j0+m], p[j0+m+1]);
+            if (m == 0)
+            {
+               (*(cogmres_functions->ScaleVector))(1.0/cheb_d, p[j0+1]);
+            }
+            else
+            {
+               (*(cogmres_functions->ScaleVector))(2.0/cheb_d, p[j0+m+1]);
+               (*(cogmres_functions->Axpy))(-1.0, p[j0+m-1], p[j0+m+1]);
+            }
+         }
+
+         /* block CGS2 */
+         for (k = 0; k < s_step*s_step; k++)
+         {
+            R1[k] = 0.0;
+            R2[k] = 0.0;
+         }
+         nv1 = hypre_COGMRESBlockOrthogonalize(cogmres_functions, p, j0+1, s_cur, unroll,
+                                               C1, ld, R1, s_step, work, xy);
+         nv = 0;
+         if (nv1 > 0)
+         {
+            nv = hypre_COGMRESBlockOrthogonalize(cogmres_functions, p, j0+1, nv1, unroll,
+                                                 C2, ld, R2, s_step, work, xy);
+         }
+
+         /* column m of rw: W_m in terms of p[0], ..., p[j0+s], combining
+            both passes.  A rank deficient block is cut after its last
+            independent vector; if there is none, W_1 lies in the span of
+            the basis (lucky breakdown) and the cycle ends */
+         ncol = (nv > 0) ? nv : 1;
+         for (k = 0; k < ld*(ncol+1); k++)
+         {
+            rw[k] = 0.0;
+         }
+         rw[j0] = 1.0;
+         for (m = 1; m <= ncol; m++)
+         {
+            k = m-1;
+            for (row = 0; row <= j0; row++)
+            {
+               t = C1[k*ld+row];
+               for (q = 0; q <= hypre_min(k, nv1-1); q++)
+               {
+                  t += C2[q*ld+row]*R1[k*s_step+q];
+               }
+               rw[m*ld+row] = t;
+            }
+            for (l = 0; l <= hypre_min(k, nv-1); l++)
+            {
+               t = 0.0;
+               for (q = l; q <= hypre_min(k, nv1-1); q++)
+               {
+                  t += R2[q*s_step+l]*R1[k*s_step+q];
+               }
+               rw[m*ld+j0+1+l] = t;
+            }
+         }
+
+         for (m = 0; m < ncol; m++)
+         {
+            i++;
+            iter++;
+            itmp = (i-1)*ld;
+            nrow = i+1;
+
+            /* Hessenberg column i-1 from A*C W_m = W B(:,m) */
+            hc = &hu[itmp];
+            t = (m == 0) ? cheb_d : 0.5*cheb_d;
+            for (row = 0; row < nrow; row++)
+            {
+               hc[row] = t*rw[(m+1)*ld+row] + cheb_c*rw[m*ld+row];
+               if (m > 0)
+               {
+                  hc[row] += 0.5*cheb_d*rw[(m-1)*ld+row];
+               }
+            }
+            for (row = nrow; row < ld; row++)
+            {
+               hc[row] = 0.0;
+            }
+            /* minus the known columns, then solve with the triangular block
+               of rw belonging to p[j0], ..., p[j0+s-1] */
+            for (q = 0; q < i-1; q++)
+            {
+               t = rw[m*ld+q];
+               if (t != 0.0)
+               {
+                  for (row = 0; row <= q+1; row++)
+                  {
+                     hc[row] -= t*hu[q*ld+row];
+                  }
+               }
+            }
+            t = 1.0/rw[m*ld+i-1];
+            for (row = 0; row < nrow; row++)
+            {
+               hc[row] *= t;
+               hh[itmp+row] = hc[row];
+            }
+
+            /* update factorization of hh */
+            for (j = 1; j < i; j++)
+            {
+               t = hh[itmp+j-1];
+               hh[itmp+j-1] = s[j-1]*hh[itmp+j] + c[j-1]*t;
+               hh[itmp+j] = -s[j-1]*t + c[j-1]*hh[itmp+j];
+            }
+            t= hh[itmp+i]*hh[itmp+i];
+            t+= hh[itmp+i-1]*hh[itmp+i-1];
+            gamma = sqrt(t);
+            if (gamma == 0.0) gamma = epsmac;
+            c[i-1] = hh[itmp+i-1]/gamma;
+            s[i-1] = hh[itmp+i]/gamma;
+            rs[i] = -hh[itmp+i]*rs[i-1];
+            rs[i] /=  gamma;
+            rs[i-1] = c[i-1]*rs[i-1];
+            // determine residual norm
+            hh[itmp+i-1] = s[i-1]*hh[itmp+i] + c[i-1]*hh[itmp+i-1];
+            r_norm = fabs(rs[i]);
+            if ( print_level>0 )
+            {
+               norms[iter] = r_norm;
+               if ( print_level>1 && my_id == 0 )
+               {
+                  if (b_norm > 0.0)
+                     hypre_printf("% 5d    %e    %f   %e\n", iter,
+                        norms[iter],norms[iter]/norms[iter-1],
+                        norms[iter]/b_norm);
+                  else
+                     hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                        norms[iter]/norms[iter-1]);
+               }
+            }
+            /* should we exit the restart cycle? (conv. check) */
+            if (r_norm <= epsilon && iter >= min_iter)
+            {
+               done = 1;
+               break;
+            }
+         }
+         if (nv == 0)
+         {
+            done = 1;
+         }
+      } /*** end of restart cycle ***/
+
+      /* Chebyshev interval for the next cycle */
+      hypre_COGMRESChebyshevInterval(hu, ld, i, &cheb_c, &cheb_d);
+      have_interval = 1;
+
+      /* now compute solution, first solve upper triangular system */
+      itmp = (i-1)*ld;
+      rs[i-1] = rs[i-1]/hh[itmp+i-1];
+      for (k = i-2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k+1; j < i; j++)
+         {
+            t -= hh[j*ld+k]*rs[j];
+         }
+         t+= rs[k];
+         rs[k] = t/hh[k*ld+k];
+      }
+
+      (*(cogmres_functions->CopyVector))(p[i-1],w);
+      (*(cogmres_functions->ScaleVector))(rs[i-1],w);
+      for (j = i-2; j >=0; j--)
+         (*(cogmres_functions->Axpy))(rs[j], p[j], w);
+
+      (*(cogmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(cogmres_functions->Axpy))(1.0,r,x);
+
+      /* the true residual is needed both for the convergence check and for
+         the restart */
+      (*(cogmres_functions->CopyVector))(b,p[0]);
+      (*(cogmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,p[0]);
+
+      /* check for convergence by evaluating the actual residual */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         if (skip_real_r_check)
+         {
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+
+         real_r_norm_new = r_norm = sqrt( (*(cogmres_functions->InnerProd))(p[0],p[0]) );
+
+         if (r_norm <= epsilon)
+         {
+            if ( print_level>1 && my_id == 0 )
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (cogmres_data -> converged) = 1;
+            break;
+         }
+         else /* conv. has not occurred, according to true residual */
+         {
+            /* exit if the real residual norm has not decreased */
+            if (real_r_norm_new >= real_r_norm_old)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n");
+                  hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+               }
+               (cogmres_data -> converged) = 1;
+               break;
+            }
+            /* report discrepancy between real/COGMRES residuals and restart */
+            if ( print_level>0 && my_id == 0)
+               hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+            real_r_norm_old = real_r_norm_new;
+         }
+      } /* end of convergence check */
+      else
+      {
+         r_norm = sqrt( (*(cogmres_functions->InnerProd))(p[0],p[0]) );
+      }
+   } /* END of iteration while loop */
+
+   (cogmres_data -> num_iterations) = iter;
+   if (b_norm > 0.0)
+      (cogmres_data -> rel_residual_norm) = r_norm/b_norm;
+   if (b_norm == 0.0)
+      (cogmres_data -> rel_residual_norm) = r_norm;
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0) hypre_error(HYPRE_ERROR_CONV);
+
+   hypre_TFreeF(c,cogmres_functions);
+   hypre_TFreeF(s,cogmres_functions);
+   hypre_TFreeF(rs,cogmres_functions);
+   hypre_TFreeF(hh,cogmres_functions);
+   hypre_TFreeF(hu,cogmres_functions);
+   hypre_TFreeF(rw,cogmres_functions);
+   hypre_TFreeF(C1,cogmres_functions);
+   hypre_TFreeF(C2,cogmres_functions);
+   hypre_TFreeF(R1,cogmres_functions);
+   hypre_TFreeF(R2,cogmres_functions);
+   hypre_TFreeF(work,cogmres_functions);
+   hypre_TFreeF(xy,cogmres_functions);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetKDim, hypre_COGMRESGetKDim
  *--------------------------------------------------------------------------*/
@@ -906,6 +1591,28 @@ hypre_COGMRESGetCGS( void   *cogmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_COGMRESSetSStep, hypre_COGMRESGetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_COGMRESSetSStep( void   *cogmres_vdata,
+        HYPRE_Int   s_step )
+{
+   hypre_COGMRESData *cogmres_data =(hypre_COGMRESData *) cogmres_vdata;
+   (cogmres_data -> s_step) = s_step;
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_COGMRESGetSStep( void   *cogmres_vdata,
+        HYPRE_Int * s_step )
+{
+   hypre_COGMRESData *cogmres_data = (hypre_COGMRESData *)cogmres_vdata;
+   *s_step = (cogmres_data -> s_step);
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_COGMRESSetTol, hypre_COGMRESGetTol
  *--------------------------------------------------------------------------*/
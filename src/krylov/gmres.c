@@ -32,6 +32,8 @@ hypre_GMRESFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -54,6 +56,7 @@ hypre_GMRESFunctionsCreate(
    gmres_functions->Matvec = Matvec;
    gmres_functions->MatvecDestroy = MatvecDestroy;
    gmres_functions->InnerProd = InnerProd;
+   gmres_functions->InnerProdStart = InnerProdStart;
    gmres_functions->CopyVector = CopyVector;
    gmres_functions->ClearVector = ClearVector;
    gmres_functions->ScaleVector = ScaleVector;
@@ -90,10 +93,12 @@ hypre_GMRESCreate( hypre_GMRESFunctions *gmres_functions )
    (gmres_data -> stop_crit)      = 0; /* rel. residual norm  - this is obsolete!*/
    (gmres_data -> converged)      = 0;
    (gmres_data -> hybrid)         = 0;
+   (gmres_data -> pipelined)      = 0;
    (gmres_data -> precond_data)   = NULL;
    (gmres_data -> print_level)    = 0;
    (gmres_data -> logging)        = 0;
    (gmres_data -> p)              = NULL;
+   (gmres_data -> z)              = NULL;
    (gmres_data -> r)              = NULL;
    (gmres_data -> w)              = NULL;
    (gmres_data -> w_2)            = NULL;
@@ -145,6 +150,17 @@ hypre_GMRESDestroy( void *gmres_vdata )
          }
          hypre_TFreeF( gmres_data->p, gmres_functions );
       }
+      if ( (gmres_data -> z) != NULL )
+      {
+         for (i = 0; i < (gmres_data -> k_dim+1); i++)
+         {
+            if ( (gmres_data -> z)[i] != NULL )
+            {
+               (*(gmres_functions->DestroyVector))( (gmres_data -> z) [i]);
+            }
+         }
+         hypre_TFreeF( gmres_data->z, gmres_functions );
+      }
       hypre_TFreeF( gmres_data, gmres_functions );
       hypre_TFreeF( gmres_functions, gmres_functions );
    }
@@ -202,6 +218,8 @@ hypre_GMRESSetup( void *gmres_vdata,
       (gmres_data -> r) = (*(gmres_functions->CreateVector))(b);
    if ((gmres_data -> w) == NULL)
       (gmres_data -> w) = (*(gmres_functions->CreateVector))(b);
+   if ((gmres_data -> pipelined) && (gmres_data -> z) == NULL)
+      (gmres_data -> z) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim+1,x);
  
    if (rel_change)
    {  
@@ -236,6 +254,39 @@ hypre_GMRESSetup( void *gmres_vdata,
    return hypre_error_flag;
 }
  
+/*--------------------------------------------------------------------------
+ * hypre_GMRESInnerProdStart
+ *
+ * Starts the reduction of result[k] = <x[k],y[k]>, k < n.  Interfaces
+ * without an InnerProdStart function get blocking inner products and a null
+ * request.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_GMRESInnerProdStart( hypre_GMRESFunctions *gmres_functions,
+                           HYPRE_Int             n,
+                           void                **x,
+                           void                **y,
+                           HYPRE_Real           *local_result,
+                           HYPRE_Real           *result,
+                           hypre_MPI_Request    *request )
+{
+   HYPRE_Int k;
+
+   if (gmres_functions->InnerProdStart)
+   {
+      return (*(gmres_functions->InnerProdStart))(n, x, y, local_result, result, request);
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = (*(gmres_functions->InnerProd))(x[k], y[k]);
+   }
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSolve
  *-------------------------------------------------------------------------*/
@@ -298,6 +349,11 @@ hypre_GMRESSolve(void  *gmres_vdata,
 
    HYPRE_Real real_r_norm_old, real_r_norm_new;
 
+   if ((gmres_data -> pipelined) && !rel_change && cf_tol == 0.0)
+   {
+      return hypre_GMRESSolvePipelined(gmres_vdata, A, b, x);
+   }
+
    (gmres_data -> converged) = 0;
    /*-----------------------------------------------------------------------
     * With relative change convergence test on, it is possible to attempt
@@ -881,6 +937,485 @@ hypre_GMRESSolve(void  *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSolvePipelined
+ *--------------------------------------------------------------------------
+ *
+ * Pipelined GMRES, p(1)-GMRES of Ghysels, Ashby, Meerbergen and Vanroose
+ * (SIAM J. Sci. Comput. 35, 2013), with right preconditioning as in
+ * hypre_GMRESSolve.  Each Arnoldi step uses classical Gram-Schmidt: the
+ * inner products <q,p[j]> and <q,q> of the new direction q = A*C*p[i-1] go
+ * into one non-blocking reduction, and the preconditioner and matvec for
+ * the next step are applied to q while it is in flight.  The basis of the
+ * Krylov space is kept twice, as p[i] and z[i] = A*C*p[i], so that the next
+ * direction follows from the same recurrence as p[i] itself:
+ *
+ *       p[i] = (z[i-1] - sum_j h(j,i-1) p[j]) / h(i,i-1)
+ *       z[i] = (A*C*z[i-1] - sum_j h(j,i-1) z[j]) / h(i,i-1)
+ *
+ * The norm h(i,i-1) is computed from <q,q> - sum_j h(j,i-1)^2, or with an
+ * extra (blocking) inner product when that difference suffers from too much
+ * cancellation.
+ *
+ * Called by hypre_GMRESSolve when the pipelined option is on and neither the
+ * rel_change nor the cf_tol option is set.
+ *
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSolvePipelined(void  *gmres_vdata,
+                          void  *A,
+                          void  *b,
+                          void  *x)
+{
+   hypre_GMRESData      *gmres_data         = (hypre_GMRESData *)gmres_vdata;
+   hypre_GMRESFunctions *gmres_functions    = gmres_data->functions;
+   HYPRE_Int             k_dim              = (gmres_data -> k_dim);
+   HYPRE_Int             min_iter           = (gmres_data -> min_iter);
+   HYPRE_Int             max_iter           = (gmres_data -> max_iter);
+   HYPRE_Int             skip_real_r_check  = (gmres_data -> skip_real_r_check);
+   HYPRE_Int             hybrid             = (gmres_data -> hybrid);
+   HYPRE_Real            r_tol              = (gmres_data -> tol);
+   HYPRE_Real            a_tol              = (gmres_data -> a_tol);
+   void                 *matvec_data        = (gmres_data -> matvec_data);
+   void                 *r                  = (gmres_data -> r);
+   void                 *w                  = (gmres_data -> w);
+   void                **p                  = (gmres_data -> p);
+   void                **z;
+
+   HYPRE_Int           (*precond)(void*,void*,void*,void*) = (gmres_functions -> precond);
+   HYPRE_Int            *precond_data = (HYPRE_Int*) (gmres_data -> precond_data);
+
+   HYPRE_Int             print_level        = (gmres_data -> print_level);
+   HYPRE_Int             logging            = (gmres_data -> logging);
+
+   HYPRE_Real           *norms              = (gmres_data -> norms);
+
+   void                **dot_x, **dot_y;
+   HYPRE_Real           *dot_local, *dot;
+   hypre_MPI_Request     request;
+   hypre_MPI_Status      status;
+
+   HYPRE_Int        i, j, k;
+   HYPRE_Real *rs, **hh, *c, *s;
+   HYPRE_Int        iter;
+   HYPRE_Int        my_id, num_procs;
+   HYPRE_Real epsilon, gamma, t, r_norm, b_norm, den_norm;
+   HYPRE_Real r_norm_cycle, drift;
+
+   HYPRE_Real epsmac = 1.e-16;
+   HYPRE_Real ieee_check = 0.;
+
+   HYPRE_Real real_r_norm_old, real_r_norm_new;
+
+   (gmres_data -> converged) = 0;
+
+   (*(gmres_functions->CommInfo))(A,&my_id,&num_procs);
+   if ( logging>0 || print_level>0 )
+   {
+      norms = (gmres_data -> norms);
+   }
+
+   if ((gmres_data -> z) == NULL)
+   {
+      (gmres_data -> z) = (void**)(*(gmres_functions->CreateVectorArray))(k_dim+1,x);
+   }
+   z = (gmres_data -> z);
+
+   /* initialize work arrays */
+   rs = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   c = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   s = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   hh = hypre_CTAllocF(HYPRE_Real*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   for (i=0; i < k_dim+1; i++)
+   {
+      hh[i] = hypre_CTAllocF(HYPRE_Real,k_dim,gmres_functions, HYPRE_MEMORY_HOST);
+   }
+   dot_x = hypre_CTAllocF(void*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   dot_y = hypre_CTAllocF(void*,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   dot_local = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+   dot = hypre_CTAllocF(HYPRE_Real,k_dim+1,gmres_functions, HYPRE_MEMORY_HOST);
+
+   (*(gmres_functions->CopyVector))(b,p[0]);
+
+   /* compute initial residual */
+   (*(gmres_functions->Matvec))(matvec_data,-1.0, A, x, 1.0, p[0]);
+
+   /* <b,b> and <r,r> in one reduction */
+   dot_x[0] = b;    dot_y[0] = b;
+   dot_x[1] = p[0]; dot_y[1] = p[0];
+   hypre_GMRESInnerProdStart(gmres_functions, 2, dot_x, dot_y, dot_local, dot, &request);
+   hypre_MPI_Wait(&request, &status);
+
+   b_norm = sqrt(dot[0]);
+   r_norm = sqrt(dot[1]);
+   real_r_norm_old = b_norm;
+
+   if (b_norm != 0.)
+   {
+      ieee_check = b_norm/b_norm; /* INF -> NaN conversion */
+   }
+   if (r_norm != 0. && ieee_check == ieee_check)
+   {
+      ieee_check = r_norm/r_norm; /* INF -> NaN conversion */
+   }
+   if (ieee_check != ieee_check)
+   {
+      if (logging > 0 || print_level > 0)
+      {
+         hypre_printf("\n\nERROR detected by Hypre ... BEGIN\n");
+         hypre_printf("ERROR -- hypre_GMRESSolvePipelined: INFs and/or NaNs detected in input.\n");
+         hypre_printf("User probably placed non-numerics in supplied A, b or x_0.\n");
+         hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+         hypre_printf("ERROR detected by Hypre ... END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      r_norm = 0.0;
+   }
+
+   if ( logging>0 || print_level > 0)
+   {
+      norms[0] = r_norm;
+      if ( print_level>1 && my_id == 0 )
+      {
+         hypre_printf("L2 norm of b: %e\n", b_norm);
+         if (b_norm == 0.0)
+         {
+            hypre_printf("Rel_resid_norm actually contains the residual norm\n");
+         }
+         hypre_printf("Initial L2 norm of residual: %e\n", r_norm);
+      }
+   }
+   iter = 0;
+
+   if (b_norm > 0.0)
+   {
+      /* convergence criterion |r_i|/|b| <= accuracy if |b| > 0 */
+      den_norm= b_norm;
+   }
+   else
+   {
+      /* convergence criterion |r_i|/|r0| <= accuracy if |b| = 0 */
+      den_norm= r_norm;
+   }
+
+   /* convergence criteria: |r_i| <= max( a_tol, r_tol * den_norm) */
+   epsilon = hypre_max(a_tol,r_tol*den_norm);
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      if (b_norm > 0.0)
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate  rel.res.norm\n");
+         hypre_printf("-----    ------------    ---------- ------------\n");
+      }
+      else
+      {
+         hypre_printf("=============================================\n\n");
+         hypre_printf("Iters     resid.norm     conv.rate\n");
+         hypre_printf("-----    ------------    ----------\n");
+      }
+   }
+
+   /* outer iteration cycle */
+   while (iter < max_iter)
+   {
+      /* initialize first term of hessenberg system */
+
+      rs[0] = r_norm;
+      if (r_norm == 0.0)
+      {
+         break;
+      }
+
+      /* see if we are already converged and
+         should print the final norm and exit */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         (*(gmres_functions->CopyVector))(b,r);
+         (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+         r_norm = sqrt((*(gmres_functions->InnerProd))(r,r));
+         if (r_norm  <= epsilon)
+         {
+            if ( print_level>1 && my_id == 0)
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            break;
+         }
+         else
+         {
+            if ( print_level>0 && my_id == 0)
+            {
+               hypre_printf("false convergence 1\n");
+            }
+         }
+      }
+
+      t = 1.0 / r_norm;
+      (*(gmres_functions->ScaleVector))(t,p[0]);
+
+      /* z[0] = A*C*p[0] */
+      (*(gmres_functions->ClearVector))(w);
+      precond(precond_data, A, p[0], w);
+      (*(gmres_functions->Matvec))(matvec_data, 1.0, A, w, 0.0, z[0]);
+      i = 0;
+      r_norm_cycle = r_norm;
+      drift = 1.0;
+
+      /***RESTART CYCLE (right-preconditioning) ***/
+      while (i < k_dim && iter < max_iter)
+      {
+         i++;
+         iter++;
+
+         /* start <z[i-1],p[j]>, j < i, and <z[i-1],z[i-1]> */
+         for (j = 0; j < i; j++)
+         {
+            dot_x[j] = z[i-1];
+            dot_y[j] = p[j];
+         }
+         dot_x[i] = z[i-1];
+         dot_y[i] = z[i-1];
+         hypre_GMRESInnerProdStart(gmres_functions, i+1, dot_x, dot_y,
+                                   dot_local, dot, &request);
+
+         /* z[i] = A*C*z[i-1] while the reduction is in flight; it is not
+            needed in the last step of the cycle */
+         if (i < k_dim && iter < max_iter)
+         {
+            (*(gmres_functions->ClearVector))(w);
+            precond(precond_data, A, z[i-1], w);
+            (*(gmres_functions->Matvec))(matvec_data, 1.0, A, w, 0.0, z[i]);
+         }
+
+         hypre_MPI_Wait(&request, &status);
+
+         /* classical Gram-Schmidt */
+         t = dot[i];
+         (*(gmres_functions->CopyVector))(z[i-1],p[i]);
+         for (j=0; j < i; j++)
+         {
+            hh[j][i-1] = dot[j];
+            t -= dot[j]*dot[j];
+            (*(gmres_functions->Axpy))(-hh[j][i-1],p[j],p[i]);
+         }
+         /* if most of the digits of <q,q> cancel, the norm of the new
+            direction has to be computed explicitly */
+         if (t > 1.e-8*dot[i])
+         {
+            t = sqrt(t);
+         }
+         else
+         {
+            t = sqrt((*(gmres_functions->InnerProd))(p[i],p[i]));
+         }
+         hh[i][i-1] = t;
+         if (t != 0.0)
+         {
+            /* rounding errors in z[i] grow by about |q|/h(i,i-1) per step */
+            drift *= sqrt(dot[i]) / t;
+            t = 1.0/t;
+            (*(gmres_functions->ScaleVector))(t,p[i]);
+            if (i < k_dim && iter < max_iter)
+            {
+               for (j=0; j < i; j++)
+               {
+                  (*(gmres_functions->Axpy))(-hh[j][i-1],z[j],z[i]);
+               }
+               (*(gmres_functions->ScaleVector))(t,z[i]);
+            }
+         }
+         /* done with the Arnoldi step.
+            update factorization of hh */
+         for (j = 1; j < i; j++)
+         {
+            t = hh[j-1][i-1];
+            hh[j-1][i-1] = s[j-1]*hh[j][i-1] + c[j-1]*t;
+            hh[j][i-1] = -s[j-1]*t + c[j-1]*hh[j][i-1];
+         }
+         t= hh[i][i-1]*hh[i][i-1];
+         t+= hh[i-1][i-1]*hh[i-1][i-1];
+         gamma = sqrt(t);
+         if (gamma == 0.0)
+         {
+            gamma = epsmac;
+         }
+         c[i-1] = hh[i-1][i-1]/gamma;
+         s[i-1] = hh[i][i-1]/gamma;
+         rs[i] = -hh[i][i-1]*rs[i-1];
+         rs[i]/=  gamma;
+         rs[i-1] = c[i-1]*rs[i-1];
+         /* determine residual norm */
+         hh[i-1][i-1] = s[i-1]*hh[i][i-1] + c[i-1]*hh[i-1][i-1];
+         r_norm = fabs(rs[i]);
+
+         /* print ? */
+         if ( print_level>0 )
+         {
+            norms[iter] = r_norm;
+            if ( print_level>1 && my_id == 0 )
+            {
+               if (b_norm > 0.0)
+               {
+                  hypre_printf("% 5d    %e    %f   %e\n", iter,
+                               norms[iter],norms[iter]/norms[iter-1],
+                               norms[iter]/b_norm);
+               }
+               else
+               {
+                  hypre_printf("% 5d    %e    %f\n", iter, norms[iter],
+                               norms[iter]/norms[iter-1]);
+               }
+            }
+         }
+         /* should we exit the restart cycle? (conv. check) */
+         if (r_norm <= epsilon && iter >= min_iter)
+         {
+            break;
+         }
+         /* the cycle cannot continue after a lucky breakdown */
+         if (hh[i][i-1] == 0.0 && i < k_dim)
+         {
+            break;
+         }
+         /* restart early once the accumulated error in z could be felt in
+            the residual */
+         if (epsmac*drift > 1.e-2*r_norm/r_norm_cycle)
+         {
+            break;
+         }
+      } /*** end of restart cycle ***/
+
+      /* now compute solution, first solve upper triangular system */
+
+      rs[i-1] = rs[i-1]/hh[i-1][i-1];
+      for (k = i-2; k >= 0; k--)
+      {
+         t = 0.0;
+         for (j = k+1; j < i; j++)
+         {
+            t -= hh[k][j]*rs[j];
+         }
+         t += rs[k];
+         rs[k] = t/hh[k][k];
+      }
+
+      (*(gmres_functions->CopyVector))(p[i-1],w);
+      (*(gmres_functions->ScaleVector))(rs[i-1],w);
+      for (j = i-2; j >=0; j--)
+         (*(gmres_functions->Axpy))(rs[j], p[j], w);
+
+      (*(gmres_functions->ClearVector))(r);
+      /* find correction (in r) */
+      precond(precond_data, A, w, r);
+
+      /* update current solution x (in x) */
+      (*(gmres_functions->Axpy))(1.0,r,x);
+
+      /* check for convergence by evaluating the actual residual */
+      if (r_norm  <= epsilon && iter >= min_iter)
+      {
+         if (skip_real_r_check)
+         {
+            (gmres_data -> converged) = 1;
+            break;
+         }
+
+         /* calculate actual residual norm*/
+         (*(gmres_functions->CopyVector))(b,r);
+         (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,r);
+         real_r_norm_new = r_norm = sqrt( (*(gmres_functions->InnerProd))(r,r) );
+
+         if (r_norm <= epsilon)
+         {
+            if ( print_level>1 && my_id == 0 )
+            {
+               hypre_printf("\n\n");
+               hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+            }
+            (gmres_data -> converged) = 1;
+            break;
+         }
+         else /* conv. has not occurred, according to true residual */
+         {
+            /* exit if the real residual norm has not decreased */
+            if (real_r_norm_new >= real_r_norm_old)
+            {
+               if (print_level > 1 && my_id == 0)
+               {
+                  hypre_printf("\n\n");
+                  hypre_printf("Final L2 norm of residual: %e\n\n", r_norm);
+               }
+               (gmres_data -> converged) = 1;
+               break;
+            }
+
+            /* report discrepancy between real/GMRES residuals and restart */
+            if ( print_level>0 && my_id == 0)
+            {
+               hypre_printf("false convergence 2, L2 norm of residual: %e\n", r_norm);
+            }
+            (*(gmres_functions->CopyVector))(r,p[0]);
+            i = 0;
+            real_r_norm_old = real_r_norm_new;
+         }
+      } /* end of convergence check */
+
+      /* restart with the true residual; unlike in hypre_GMRESSolve it is
+         not updated from the basis, which is only approximately an Arnoldi
+         basis here */
+      if (i)
+      {
+         (*(gmres_functions->CopyVector))(b,p[0]);
+         (*(gmres_functions->Matvec))(matvec_data,-1.0,A,x,1.0,p[0]);
+         r_norm = sqrt((*(gmres_functions->InnerProd))(p[0],p[0]));
+      }
+   } /* END of iteration while loop */
+
+
+   if ( print_level>1 && my_id == 0 )
+   {
+      hypre_printf("\n\n");
+   }
+
+   (gmres_data -> num_iterations) = iter;
+
+   if (b_norm > 0.0)
+   {
+      (gmres_data -> rel_residual_norm) = r_norm/b_norm;
+   }
+
+   if (b_norm == 0.0)
+   {
+      (gmres_data -> rel_residual_norm) = r_norm;
+   }
+
+   if (iter >= max_iter && r_norm > epsilon && epsilon > 0 && hybrid != -1)
+   {
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_TFreeF(c, gmres_functions);
+   hypre_TFreeF(s, gmres_functions);
+   hypre_TFreeF(rs, gmres_functions);
+
+   for (i=0; i < k_dim+1; i++)
+   {
+      hypre_TFreeF(hh[i],gmres_functions);
+   }
+
+   hypre_TFreeF(hh, gmres_functions);
+   hypre_TFreeF(dot_x, gmres_functions);
+   hypre_TFreeF(dot_y, gmres_functions);
+   hypre_TFreeF(dot_local, gmres_functions);
+   hypre_TFreeF(dot, gmres_functions);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESSetKDim, hypre_GMRESGetKDim
  *--------------------------------------------------------------------------*/
@@ -1234,6 +1769,32 @@ hypre_GMRESSetHybrid( void *gmres_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_GMRESSetPipelined, hypre_GMRESGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_GMRESSetPipelined( void     *gmres_vdata,
+                         HYPRE_Int pipelined )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   (gmres_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_GMRESGetPipelined( void      *gmres_vdata,
+                         HYPRE_Int *pipelined )
+{
+   hypre_GMRESData *gmres_data = (hypre_GMRESData *)gmres_vdata;
+
+   *pipelined = (gmres_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_GMRESGetNumIterations
  *--------------------------------------------------------------------------*/
@@ -407,6 +407,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -431,6 +433,7 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
     HYPRE_Real   tol;
     HYPRE_Real   cf_tol;
     HYPRE_Real   a_tol;
@@ -441,6 +444,7 @@ extern "C" {
     void  *w;
     void  *w_2;
     void  **p;
+    void  **z; /* A*M^{-1}*p[i], pipelined iteration only */
 
     void    *matvec_data;
     void    *precond_data;
@@ -490,6 +494,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                           HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -568,6 +574,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result);
     HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y);
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
@@ -592,6 +600,7 @@ extern "C" {
     HYPRE_Int      k_dim;
     HYPRE_Int      unroll;
     HYPRE_Int      cgs;
+    HYPRE_Int      s_step;   /* basis vectors per block orthogonalization */
     HYPRE_Int      min_iter;
     HYPRE_Int      max_iter;
     HYPRE_Int      rel_change;
@@ -654,6 +663,8 @@ extern "C" {
           HYPRE_Int    (*Matvec)        ( void *matvec_data, HYPRE_Complex alpha, void *A, void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                           HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*MassInnerProd) ( void *x, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result),
           HYPRE_Int    (*MassDotpTwo)   ( void *x, void *y, void **p, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
@@ -1057,6 +1068,8 @@ extern "C" {
         void *x, HYPRE_Complex beta, void *y );
     HYPRE_Int    (*MatvecDestroy) ( void *matvec_data );
     HYPRE_Real   (*InnerProd)     ( void *x, void *y );
+    HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                     HYPRE_Real *result, hypre_MPI_Request *request );
     HYPRE_Int    (*CopyVector)    ( void *x, void *y );
     HYPRE_Int    (*ClearVector)   ( void *x );
     HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x );
@@ -1117,12 +1130,20 @@ extern "C" {
     HYPRE_Int      stop_crit;
     HYPRE_Int      converged;
     HYPRE_Int      hybrid;
+    HYPRE_Int      pipelined;
 
     void    *A;
     void    *p;
     void    *s;
     void    *r; /* ...contains the residual.  This is currently kept permanently.
                    If that is ever changed, it still must be kept if logging>1 */
+    /* extra vectors of the pipelined iteration, created on demand */
+    void    *u;
+    void    *w;
+    void    *m;
+    void    *n;
+    void    *z;
+    void    *q;
 
     HYPRE_Int      owns_matvec_data;  /* normally 1; if 0, don't delete it */
     void    *matvec_data;
@@ -1174,6 +1195,8 @@ extern "C" {
             void *x, HYPRE_Complex beta, void *y ),
           HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
           HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+          HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                           HYPRE_Real *result, hypre_MPI_Request *request ),
           HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
           HYPRE_Int    (*ClearVector)   ( void *x ),
           HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -1239,6 +1262,7 @@ extern "C" {
   HYPRE_Int hypre_GMRESGetResidual ( void *gmres_vdata , void **residual );
   HYPRE_Int hypre_GMRESSetup ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_GMRESSolve ( void *gmres_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_GMRESSolvePipelined ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_GMRESSetKDim ( void *gmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_GMRESGetKDim ( void *gmres_vdata , HYPRE_Int *k_dim );
   HYPRE_Int hypre_GMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
@@ -1264,6 +1288,8 @@ extern "C" {
   HYPRE_Int hypre_GMRESSetLogging ( void *gmres_vdata , HYPRE_Int level );
   HYPRE_Int hypre_GMRESGetLogging ( void *gmres_vdata , HYPRE_Int *level );
   HYPRE_Int hypre_GMRESSetHybrid ( void *gmres_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_GMRESSetPipelined ( void *gmres_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_GMRESGetPipelined ( void *gmres_vdata , HYPRE_Int *pipelined );
   HYPRE_Int hypre_GMRESGetNumIterations ( void *gmres_vdata , HYPRE_Int *num_iterations );
   HYPRE_Int hypre_GMRESGetConverged ( void *gmres_vdata , HYPRE_Int *converged );
   HYPRE_Int hypre_GMRESGetFinalRelativeResidualNorm ( void *gmres_vdata , HYPRE_Real *relative_residual_norm );
@@ -1274,12 +1300,15 @@ extern "C" {
   HYPRE_Int hypre_COGMRESGetResidual ( void *gmres_vdata , void **residual );
   HYPRE_Int hypre_COGMRESSetup ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_COGMRESSolve ( void *gmres_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_COGMRESSolveSStep ( void *gmres_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_COGMRESSetKDim ( void *gmres_vdata , HYPRE_Int k_dim );
   HYPRE_Int hypre_COGMRESGetKDim ( void *gmres_vdata , HYPRE_Int *k_dim );
   HYPRE_Int hypre_COGMRESSetUnroll ( void *gmres_vdata , HYPRE_Int unroll );
   HYPRE_Int hypre_COGMRESGetUnroll ( void *gmres_vdata , HYPRE_Int *unroll );
   HYPRE_Int hypre_COGMRESSetCGS ( void *gmres_vdata , HYPRE_Int cgs );
   HYPRE_Int hypre_COGMRESGetCGS ( void *gmres_vdata , HYPRE_Int *cgs );
+  HYPRE_Int hypre_COGMRESSetSStep ( void *gmres_vdata , HYPRE_Int s_step );
+  HYPRE_Int hypre_COGMRESGetSStep ( void *gmres_vdata , HYPRE_Int *s_step );
   HYPRE_Int hypre_COGMRESSetTol ( void *gmres_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_COGMRESGetTol ( void *gmres_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_COGMRESSetAbsoluteTol ( void *gmres_vdata , HYPRE_Real a_tol );
@@ -1424,6 +1453,8 @@ extern "C" {
   HYPRE_Int HYPRE_GMRESGetRelChange ( HYPRE_Solver solver , HYPRE_Int *rel_change );
   HYPRE_Int HYPRE_GMRESSetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int skip_real_r_check );
   HYPRE_Int HYPRE_GMRESGetSkipRealResidualCheck ( HYPRE_Solver solver , HYPRE_Int *skip_real_r_check );
+  HYPRE_Int HYPRE_GMRESSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_GMRESGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
   HYPRE_Int HYPRE_GMRESSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_GMRESGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_GMRESSetPrintLevel ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1444,6 +1475,8 @@ extern "C" {
   HYPRE_Int HYPRE_COGMRESGetUnroll ( HYPRE_Solver solver , HYPRE_Int *unroll );
   HYPRE_Int HYPRE_COGMRESSetCGS ( HYPRE_Solver solver , HYPRE_Int cgs );
   HYPRE_Int HYPRE_COGMRESGetCGS ( HYPRE_Solver solver , HYPRE_Int *cgs );
+  HYPRE_Int HYPRE_COGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
+  HYPRE_Int HYPRE_COGMRESGetSStep ( HYPRE_Solver solver , HYPRE_Int *s_step );
   HYPRE_Int HYPRE_COGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
   HYPRE_Int HYPRE_COGMRESGetTol ( HYPRE_Solver solver , HYPRE_Real *tol );
   HYPRE_Int HYPRE_COGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
@@ -1549,6 +1582,8 @@ extern "C" {
   HYPRE_Int HYPRE_PCGGetRecomputeResidual ( HYPRE_Solver solver , HYPRE_Int *recompute_residual );
   HYPRE_Int HYPRE_PCGSetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int recompute_residual_p );
   HYPRE_Int HYPRE_PCGGetRecomputeResidualP ( HYPRE_Solver solver , HYPRE_Int *recompute_residual_p );
+  HYPRE_Int HYPRE_PCGSetPipelined ( HYPRE_Solver solver , HYPRE_Int pipelined );
+  HYPRE_Int HYPRE_PCGGetPipelined ( HYPRE_Solver solver , HYPRE_Int *pipelined );
   HYPRE_Int HYPRE_PCGSetPrecond ( HYPRE_Solver solver , HYPRE_PtrToSolverFcn precond , HYPRE_PtrToSolverFcn precond_setup , HYPRE_Solver precond_solver );
   HYPRE_Int HYPRE_PCGGetPrecond ( HYPRE_Solver solver , HYPRE_Solver *precond_data_ptr );
   HYPRE_Int HYPRE_PCGSetLogging ( HYPRE_Solver solver , HYPRE_Int level );
@@ -1566,6 +1601,7 @@ extern "C" {
   HYPRE_Int hypre_PCGGetResidual ( void *pcg_vdata , void **residual );
   HYPRE_Int hypre_PCGSetup ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSolve ( void *pcg_vdata , void *A , void *b , void *x );
+  HYPRE_Int hypre_PCGSolvePipelined ( void *pcg_vdata , void *A , void *b , void *x );
   HYPRE_Int hypre_PCGSetTol ( void *pcg_vdata , HYPRE_Real tol );
   HYPRE_Int hypre_PCGGetTol ( void *pcg_vdata , HYPRE_Real *tol );
   HYPRE_Int hypre_PCGSetAbsoluteTol ( void *pcg_vdata , HYPRE_Real a_tol );
@@ -1595,6 +1631,8 @@ extern "C" {
   HYPRE_Int hypre_PCGSetLogging ( void *pcg_vdata , HYPRE_Int level );
   HYPRE_Int hypre_PCGGetLogging ( void *pcg_vdata , HYPRE_Int *level );
   HYPRE_Int hypre_PCGSetHybrid ( void *pcg_vdata , HYPRE_Int level );
+  HYPRE_Int hypre_PCGSetPipelined ( void *pcg_vdata , HYPRE_Int pipelined );
+  HYPRE_Int hypre_PCGGetPipelined ( void *pcg_vdata , HYPRE_Int *pipelined );
   HYPRE_Int hypre_PCGGetNumIterations ( void *pcg_vdata , HYPRE_Int *num_iterations );
   HYPRE_Int hypre_PCGGetConverged ( void *pcg_vdata , HYPRE_Int *converged );
   HYPRE_Int hypre_PCGPrintLogging ( void *pcg_vdata , HYPRE_Int myid );
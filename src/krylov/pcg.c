@@ -40,6 +40,8 @@ hypre_PCGFunctionsCreate(
                                    void *x, HYPRE_Complex beta, void *y ),
    HYPRE_Int    (*MatvecDestroy) ( void *matvec_data ),
    HYPRE_Real   (*InnerProd)     ( void *x, void *y ),
+   HYPRE_Int    (*InnerProdStart)( HYPRE_Int n, void **x, void **y, HYPRE_Real *local_result,
+                                   HYPRE_Real *result, hypre_MPI_Request *request ),
    HYPRE_Int    (*CopyVector)    ( void *x, void *y ),
    HYPRE_Int    (*ClearVector)   ( void *x ),
    HYPRE_Int    (*ScaleVector)   ( HYPRE_Complex alpha, void *x ),
@@ -61,6 +63,7 @@ hypre_PCGFunctionsCreate(
    pcg_functions->Matvec = Matvec;
    pcg_functions->MatvecDestroy = MatvecDestroy;
    pcg_functions->InnerProd = InnerProd;
+   pcg_functions->InnerProdStart = InnerProdStart;
    pcg_functions->CopyVector = CopyVector;
    pcg_functions->ClearVector = ClearVector;
    pcg_functions->ScaleVector = ScaleVector;
@@ -99,6 +102,7 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> stop_crit)    = 0;
    (pcg_data -> converged)    = 0;
    (pcg_data -> hybrid)       = 0;
+   (pcg_data -> pipelined)    = 0;
    (pcg_data -> owns_matvec_data ) = 1;
    (pcg_data -> matvec_data)  = NULL;
    (pcg_data -> precond_data) = NULL;
@@ -109,10 +113,106 @@ hypre_PCGCreate( hypre_PCGFunctions *pcg_functions )
    (pcg_data -> p)            = NULL;
    (pcg_data -> s)            = NULL;
    (pcg_data -> r)            = NULL;
+   (pcg_data -> u)            = NULL;
+   (pcg_data -> w)            = NULL;
+   (pcg_data -> m)            = NULL;
+   (pcg_data -> n)            = NULL;
+   (pcg_data -> z)            = NULL;
+   (pcg_data -> q)            = NULL;
 
    return (void *) pcg_data;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGCreatePipelinedVectors, hypre_PCGDestroyPipelinedVectors
+ *
+ * The pipelined iteration needs six vectors on top of p, s and r.  They are
+ * only created when it is used.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGCreatePipelinedVectors( hypre_PCGData *pcg_data,
+                                 void          *x )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   if ( pcg_data -> u == NULL )
+      (pcg_data -> u) = (*(pcg_functions->CreateVector))(x);
+   if ( pcg_data -> w == NULL )
+      (pcg_data -> w) = (*(pcg_functions->CreateVector))(x);
+   if ( pcg_data -> m == NULL )
+      (pcg_data -> m) = (*(pcg_functions->CreateVector))(x);
+   if ( pcg_data -> n == NULL )
+      (pcg_data -> n) = (*(pcg_functions->CreateVector))(x);
+   if ( pcg_data -> z == NULL )
+      (pcg_data -> z) = (*(pcg_functions->CreateVector))(x);
+   if ( pcg_data -> q == NULL )
+      (pcg_data -> q) = (*(pcg_functions->CreateVector))(x);
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+hypre_PCGDestroyPipelinedVectors( hypre_PCGData *pcg_data )
+{
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   if ( pcg_data -> u != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> u);
+   if ( pcg_data -> w != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> w);
+   if ( pcg_data -> m != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> m);
+   if ( pcg_data -> n != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> n);
+   if ( pcg_data -> z != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> z);
+   if ( pcg_data -> q != NULL )
+      (*(pcg_functions->DestroyVector))(pcg_data -> q);
+
+   (pcg_data -> u) = NULL;
+   (pcg_data -> w) = NULL;
+   (pcg_data -> m) = NULL;
+   (pcg_data -> n) = NULL;
+   (pcg_data -> z) = NULL;
+   (pcg_data -> q) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_PCGInnerProdStart
+ *
+ * Starts the reduction of result[k] = <x[k],y[k]>, k < n.  Interfaces
+ * without an InnerProdStart function get blocking inner products and a null
+ * request.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PCGInnerProdStart( hypre_PCGFunctions *pcg_functions,
+                         HYPRE_Int           n,
+                         void              **x,
+                         void              **y,
+                         HYPRE_Real         *local_result,
+                         HYPRE_Real         *result,
+                         hypre_MPI_Request  *request )
+{
+   HYPRE_Int k;
+
+   if (pcg_functions->InnerProdStart)
+   {
+      return (*(pcg_functions->InnerProdStart))(n, x, y, local_result, result, request);
+   }
+
+   for (k = 0; k < n; k++)
+   {
+      result[k] = (*(pcg_functions->InnerProd))(x[k], y[k]);
+   }
+   *request = hypre_MPI_REQUEST_NULL;
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGDestroy
  *--------------------------------------------------------------------------*/
@@ -155,6 +255,7 @@ hypre_PCGDestroy( void *pcg_vdata )
          (*(pcg_functions->DestroyVector))(pcg_data -> r);
          pcg_data -> r = NULL;
       }
+      hypre_PCGDestroyPipelinedVectors( pcg_data );
       hypre_TFreeF( pcg_data, pcg_functions );
       hypre_TFreeF( pcg_functions, pcg_functions );
    }
@@ -212,6 +313,12 @@ hypre_PCGSetup( void *pcg_vdata,
       (*(pcg_functions->DestroyVector))(pcg_data -> r);
    (pcg_data -> r) = (*(pcg_functions->CreateVector))(b);
 
+   hypre_PCGDestroyPipelinedVectors(pcg_data);
+   if (pcg_data -> pipelined)
+   {
+      hypre_PCGCreatePipelinedVectors(pcg_data, x);
+   }
+
    if ( pcg_data -> matvec_data != NULL && pcg_data->owns_matvec_data )
       (*(pcg_functions->MatvecDestroy))(pcg_data -> matvec_data);
    (pcg_data -> matvec_data) = (*(pcg_functions->MatvecCreate))(A, x);
@@ -311,6 +418,12 @@ hypre_PCGSolve( void *pcg_vdata,
    HYPRE_Int       i = 0;
    HYPRE_Int       my_id, num_procs;
 
+   if ( (pcg_data -> pipelined) && !rel_change && !recompute_residual &&
+        !recompute_residual_p && rtol == 0.0 && cf_tol == 0.0 )
+   {
+      return hypre_PCGSolvePipelined(pcg_vdata, A, b, x);
+   }
+
    (pcg_data -> converged) = 0;
 
    (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
@@ -742,6 +855,335 @@ hypre_PCGSolve( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSolvePipelined
+ *--------------------------------------------------------------------------
+ *
+ * Pipelined PCG (Ghysels and Vanroose, Parallel Computing 40, 2014).  The
+ * inner products of an iteration are merged into a single non-blocking
+ * reduction, which overlaps with the preconditioner application and the
+ * matvec of the same iteration.  Besides p, s and r the iteration keeps
+ *
+ *       u = C*r,  w = A*u,  q = C*s,  z = A*q
+ *
+ * and computes m = C*w, n = A*m while the reduction is in flight.  The
+ * convergence test is the one of hypre_PCGSolve.  In exact arithmetic the
+ * iterates are those of the standard algorithm; in floating point the
+ * recursively updated residual may drift a little further from b - A*x.
+ *
+ * Called by hypre_PCGSolve when the pipelined option is on.  The rel_change,
+ * recompute_residual, rtol and cf_tol options need the standard iteration and
+ * disable the pipelined one.
+ *
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSolvePipelined( void *pcg_vdata,
+                         void *A,
+                         void *b,
+                         void *x         )
+{
+   hypre_PCGData  *pcg_data     =  (hypre_PCGData *)pcg_vdata;
+   hypre_PCGFunctions *pcg_functions = pcg_data->functions;
+
+   HYPRE_Real      r_tol        = (pcg_data -> tol);
+   HYPRE_Real      a_tol        = (pcg_data -> a_tol);
+   HYPRE_Real      atolf        = (pcg_data -> atolf);
+   HYPRE_Int       max_iter     = (pcg_data -> max_iter);
+   HYPRE_Int       two_norm     = (pcg_data -> two_norm);
+   HYPRE_Int       stop_crit    = (pcg_data -> stop_crit);
+   HYPRE_Int       hybrid       = (pcg_data -> hybrid);
+   void           *matvec_data  = (pcg_data -> matvec_data);
+   HYPRE_Int     (*precond)(void*,void*,void*,void*)   = (pcg_functions -> precond);
+   void           *precond_data = (pcg_data -> precond_data);
+   HYPRE_Int       print_level  = (pcg_data -> print_level);
+   HYPRE_Int       logging      = (pcg_data -> logging);
+   HYPRE_Real     *norms        = (pcg_data -> norms);
+   HYPRE_Real     *rel_norms    = (pcg_data -> rel_norms);
+
+   void           *p, *s, *r, *u, *w, *m, *n, *z, *q;
+
+   void           *dot_x[3], *dot_y[3];
+   HYPRE_Real      dot_local[3], dot[3];
+   HYPRE_Int       num_dots;
+   hypre_MPI_Request request;
+   hypre_MPI_Status  status;
+
+   HYPRE_Real      alpha = 0.0, beta;
+   HYPRE_Real      gamma, gamma_old = 0.0, delta, denom;
+   HYPRE_Real      bi_prod, eps;
+   HYPRE_Real      i_prod = 0.0;
+   HYPRE_Real      ieee_check = 0.;
+
+   HYPRE_Int       i = 0;
+   HYPRE_Int       my_id, num_procs;
+
+   (pcg_data -> converged) = 0;
+
+   (*(pcg_functions->CommInfo))(A,&my_id,&num_procs);
+
+   hypre_PCGCreatePipelinedVectors(pcg_data, x);
+
+   p = (pcg_data -> p);
+   s = (pcg_data -> s);
+   r = (pcg_data -> r);
+   u = (pcg_data -> u);
+   w = (pcg_data -> w);
+   m = (pcg_data -> m);
+   n = (pcg_data -> n);
+   z = (pcg_data -> z);
+   q = (pcg_data -> q);
+
+   /* compute eps */
+   if (two_norm)
+   {
+      /* bi_prod = <b,b> */
+      bi_prod = (*(pcg_functions->InnerProd))(b, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<b,b>: %e\n",bi_prod);
+   }
+   else
+   {
+      /* bi_prod = <C*b,b> */
+      (*(pcg_functions->ClearVector))(p);
+      precond(precond_data, A, b, p);
+      bi_prod = (*(pcg_functions->InnerProd))(p, b);
+      if (print_level > 1 && my_id == 0)
+          hypre_printf("<C*b,b>: %e\n",bi_prod);
+   };
+
+   if (bi_prod != 0.) ieee_check = bi_prod/bi_prod; /* INF -> NaN conversion */
+   if (ieee_check != ieee_check)
+   {
+      if (print_level > 0 || logging > 0)
+      {
+        hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+        hypre_printf("ERROR -- hypre_PCGSolvePipelined: INFs and/or NaNs detected in input.\n");
+        hypre_printf("User probably placed non-numerics in supplied b.\n");
+        hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+        hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+      }
+      hypre_error(HYPRE_ERROR_GENERIC);
+      return hypre_error_flag;
+   }
+
+   eps = r_tol*r_tol; /* note: this may be re-assigned below */
+   if ( bi_prod > 0.0 )
+   {
+      if ( stop_crit && atolf<=0 )  /* pure absolute tolerance */
+      {
+         eps = eps / bi_prod;
+      }
+      else if ( atolf>0 )  /* mixed relative and absolute tolerance */
+      {
+         bi_prod += atolf;
+      }
+      else /* DEFAULT: <C*r,r>  <= max( a_tol^2, r_tol^2 * <C*b,b> ) */
+      {
+         eps = hypre_max(r_tol*r_tol, a_tol*a_tol/bi_prod);
+      }
+   }
+   else    /* bi_prod==0.0: the rhs vector b is zero */
+   {
+      /* Set x equal to zero and return */
+      (*(pcg_functions->CopyVector))(b, x);
+      if (logging>0 || print_level>0)
+      {
+         norms[0]     = 0.0;
+         rel_norms[i] = 0.0;
+      }
+
+      return hypre_error_flag;
+   };
+
+   /* r = b - Ax */
+   (*(pcg_functions->CopyVector))(b, r);
+   (*(pcg_functions->Matvec))(matvec_data, -1.0, A, x, 1.0, r);
+
+   /* u = C*r, w = A*u */
+   (*(pcg_functions->ClearVector))(u);
+   precond(precond_data, A, r, u);
+   (*(pcg_functions->Matvec))(matvec_data, 1.0, A, u, 0.0, w);
+
+   if ( print_level > 1 && my_id==0 )
+   {
+      hypre_printf("\n\n");
+      if (two_norm)
+      {
+         if ( stop_crit && atolf==0 )  /* pure absolute tolerance */
+         {
+            hypre_printf("Iters       ||r||_2     conv.rate\n");
+            hypre_printf("-----    ------------   ---------\n");
+         }
+         else
+         {
+            hypre_printf("Iters       ||r||_2     conv.rate  ||r||_2/||b||_2\n");
+            hypre_printf("-----    ------------   ---------  ------------ \n");
+         }
+      }
+      else  /* !two_norm */
+      {
+         hypre_printf("Iters       ||r||_C     conv.rate  ||r||_C/||b||_C\n");
+         hypre_printf("-----    ------------    ---------  ------------ \n");
+      }
+   }
+
+   /* gamma = <r,u>, delta = <w,u> and, for the two-norm test, <r,r> */
+   dot_x[0] = r;  dot_y[0] = u;
+   dot_x[1] = w;  dot_y[1] = u;
+   dot_x[2] = r;  dot_y[2] = r;
+   num_dots = two_norm ? 3 : 2;
+
+   while (1)
+   {
+      hypre_PCGInnerProdStart(pcg_functions, num_dots, dot_x, dot_y,
+                              dot_local, dot, &request);
+
+      /* m = C*w, n = A*m while the reduction is in flight */
+      if (i < max_iter)
+      {
+         (*(pcg_functions->ClearVector))(m);
+         precond(precond_data, A, w, m);
+         (*(pcg_functions->Matvec))(matvec_data, 1.0, A, m, 0.0, n);
+      }
+
+      hypre_MPI_Wait(&request, &status);
+
+      gamma  = dot[0];
+      delta  = dot[1];
+      i_prod = two_norm ? dot[2] : gamma;
+
+      if (i == 0)
+      {
+         if (gamma != 0.) ieee_check = gamma/gamma; /* INF -> NaN conversion */
+         if (ieee_check != ieee_check)
+         {
+            if (print_level > 0 || logging > 0)
+            {
+              hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+              hypre_printf("ERROR -- hypre_PCGSolvePipelined: INFs and/or NaNs detected in input.\n");
+              hypre_printf("User probably placed non-numerics in supplied A or x_0.\n");
+              hypre_printf("Returning error flag += 101.  Program not terminated.\n");
+              hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            return hypre_error_flag;
+         }
+
+         if ( logging>0 || print_level>0 ) norms[0] = sqrt(i_prod);
+      }
+      else
+      {
+         /* print norm info */
+         if ( logging>0 || print_level>0 )
+         {
+            norms[i]     = sqrt(i_prod);
+            rel_norms[i] = bi_prod ? sqrt(i_prod/bi_prod) : 0;
+         }
+         if ( print_level > 1 && my_id==0 )
+         {
+            if ( two_norm && stop_crit && atolf==0 )  /* pure absolute tolerance */
+            {
+               hypre_printf("% 5d    %e    %f\n", i, norms[i],
+                      norms[i]/norms[i-1] );
+            }
+            else
+            {
+               hypre_printf("% 5d    %e    %f    %e\n", i, norms[i],
+                      norms[i]/norms[i-1], rel_norms[i] );
+            }
+         }
+      }
+
+      /* check for convergence */
+      if (i_prod / bi_prod < eps)
+      {
+         (pcg_data -> converged) = 1;
+         break;
+      }
+
+      if (i == max_iter)
+      {
+         break;
+      }
+
+      if (! (gamma > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal gamma value in PCG");
+         break;
+      }
+
+      /* alpha = gamma / (delta - beta*gamma/alpha_old) */
+      if (i == 0)
+      {
+         beta  = 0.0;
+         denom = delta;
+      }
+      else
+      {
+         beta  = gamma / gamma_old;
+         denom = delta - beta * gamma / alpha;
+      }
+      if ( denom==0.0 )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Zero sdotp value in PCG");
+         break;
+      }
+      alpha = gamma / denom;
+      if (! (alpha > HYPRE_REAL_MIN) )
+      {
+         hypre_error_w_msg(HYPRE_ERROR_CONV, "Subnormal alpha value in PCG");
+         break;
+      }
+      gamma_old = gamma;
+
+      /* z = n + beta z, q = m + beta q, s = w + beta s, p = u + beta p */
+      if (i == 0)
+      {
+         (*(pcg_functions->CopyVector))(n, z);
+         (*(pcg_functions->CopyVector))(m, q);
+         (*(pcg_functions->CopyVector))(w, s);
+         (*(pcg_functions->CopyVector))(u, p);
+      }
+      else
+      {
+         (*(pcg_functions->ScaleVector))(beta, z);
+         (*(pcg_functions->Axpy))(1.0, n, z);
+         (*(pcg_functions->ScaleVector))(beta, q);
+         (*(pcg_functions->Axpy))(1.0, m, q);
+         (*(pcg_functions->ScaleVector))(beta, s);
+         (*(pcg_functions->Axpy))(1.0, w, s);
+         (*(pcg_functions->ScaleVector))(beta, p);
+         (*(pcg_functions->Axpy))(1.0, u, p);
+      }
+
+      /* x = x + alpha p, r = r - alpha s, u = u - alpha q, w = w - alpha z */
+      (*(pcg_functions->Axpy))( alpha, p, x);
+      (*(pcg_functions->Axpy))(-alpha, s, r);
+      (*(pcg_functions->Axpy))(-alpha, q, u);
+      (*(pcg_functions->Axpy))(-alpha, z, w);
+
+      i++;
+   }
+
+   /*--------------------------------------------------------------------
+    * Finish up with some outputs.
+    *--------------------------------------------------------------------*/
+
+   if ( print_level > 1 && my_id==0 )
+      hypre_printf("\n\n");
+
+   if (i >= max_iter && (i_prod/bi_prod) >= eps && eps > 0 && hybrid != -1)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_CONV, "Reached max iterations in PCG before convergence");
+   }
+
+   (pcg_data -> num_iterations) = i;
+   (pcg_data -> rel_residual_norm) = sqrt(i_prod/bi_prod);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGSetTol, hypre_PCGGetTol
  *--------------------------------------------------------------------------*/
@@ -1138,6 +1580,32 @@ hypre_PCGSetHybrid( void *pcg_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_PCGSetPipelined, hypre_PCGGetPipelined
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PCGSetPipelined( void *pcg_vdata,
+                       HYPRE_Int   pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   (pcg_data -> pipelined) = pipelined;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_PCGGetPipelined( void *pcg_vdata,
+                       HYPRE_Int * pipelined )
+{
+   hypre_PCGData *pcg_data = (hypre_PCGData *)pcg_vdata;
+
+   *pipelined = (pcg_data -> pipelined);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_PCGGetNumIterations
  *--------------------------------------------------------------------------*/
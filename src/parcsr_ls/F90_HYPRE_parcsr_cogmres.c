@@ -136,6 +136,22 @@ hypre_F90_IFACE(hypre_parcsrcogmressetcgs, HYPRE_PARCSRCOGMRESSETCGS)
            hypre_F90_PassInt (cgs)    ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCOGMRESSetSStep
+ *--------------------------------------------------------------------------*/
+
+void
+hypre_F90_IFACE(hypre_parcsrcogmressetsstep, HYPRE_PARCSRCOGMRESSETSSTEP)
+   ( hypre_F90_Obj *solver,
+     hypre_F90_Int *s_step,
+     hypre_F90_Int *ierr    )
+{
+   *ierr = (hypre_F90_Int)
+      ( HYPRE_ParCSRCOGMRESSetSStep(
+           hypre_F90_PassObj (HYPRE_Solver, solver),
+           hypre_F90_PassInt (s_step)    ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRCOGMRESSetTol
  *--------------------------------------------------------------------------*/
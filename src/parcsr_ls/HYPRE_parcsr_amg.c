@@ -68,6 +68,22 @@ HYPRE_BoomerAMGSolve( HYPRE_Solver solver,
                                  (hypre_ParVector *) x ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGMultiSolve
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGMultiSolve( HYPRE_Solver solver,
+                           HYPRE_ParCSRMatrix A,
+                           HYPRE_ParVector b,
+                           HYPRE_ParVector x      )
+{
+   return( hypre_BoomerAMGMultiSolve( (void *) solver,
+                                      (hypre_ParCSRMatrix *) A,
+                                      (hypre_ParVector *) b,
+                                      (hypre_ParVector *) x ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSolveT
  *--------------------------------------------------------------------------*/
@@ -209,6 +225,42 @@ HYPRE_BoomerAMGGetRedundant( HYPRE_Solver solver,
    return( hypre_BoomerAMGGetRedundant( (void *) solver, redundant ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAgglomThreshold, HYPRE_BoomerAMGGetAgglomThreshold
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAgglomThreshold( HYPRE_Solver solver,
+                                   HYPRE_Int          agglom_threshold  )
+{
+   return( hypre_BoomerAMGSetAgglomThreshold( (void *) solver, agglom_threshold ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetAgglomThreshold( HYPRE_Solver solver,
+                                   HYPRE_Int        * agglom_threshold  )
+{
+   return( hypre_BoomerAMGGetAgglomThreshold( (void *) solver, agglom_threshold ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetAgglomFactor, HYPRE_BoomerAMGGetAgglomFactor
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetAgglomFactor( HYPRE_Solver solver,
+                                HYPRE_Int          agglom_factor  )
+{
+   return( hypre_BoomerAMGSetAgglomFactor( (void *) solver, agglom_factor ) );
+}
+
+HYPRE_Int
+HYPRE_BoomerAMGGetAgglomFactor( HYPRE_Solver solver,
+                                HYPRE_Int        * agglom_factor  )
+{
+   return( hypre_BoomerAMGGetAgglomFactor( (void *) solver, agglom_factor ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetRedundant, HYPRE_BoomerAMGGetRedundant
  *--------------------------------------------------------------------------*/
@@ -774,6 +826,61 @@ HYPRE_BoomerAMGSetRelaxOrder( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetRelaxOrder( (void *) solver, relax_order ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetRelaxOverlap
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetRelaxOverlap( HYPRE_Solver  solver,
+                                HYPRE_Int           relax_overlap)
+{
+   return( hypre_BoomerAMGSetRelaxOverlap( (void *) solver, relax_overlap ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetMixedPrecisionLevel
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetMixedPrecisionLevel( HYPRE_Solver  solver,
+                                       HYPRE_Int           mixed_precision_level)
+{
+   return( hypre_BoomerAMGSetMixedPrecisionLevel( (void *) solver, mixed_precision_level ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetCompressColumns
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetCompressColumns( HYPRE_Solver  solver,
+                                   HYPRE_Int           compress_columns)
+{
+   return( hypre_BoomerAMGSetCompressColumns( (void *) solver, compress_columns ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFusedCycle
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFusedCycle( HYPRE_Solver  solver,
+                              HYPRE_Int           fused_cycle)
+{
+   return( hypre_BoomerAMGSetFusedCycle( (void *) solver, fused_cycle ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetCycleMinRowsPerThread
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetCycleMinRowsPerThread( HYPRE_Solver  solver,
+                                         HYPRE_Int           cycle_min_rows_per_thread)
+{
+   return( hypre_BoomerAMGSetCycleMinRowsPerThread( (void *) solver, cycle_min_rows_per_thread ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetGridRelaxPoints
  * DEPRECATED.  There are memory management problems associated with the
@@ -1645,6 +1752,61 @@ HYPRE_BoomerAMGSetChebyEigEst( HYPRE_Solver  solver,
    return( hypre_BoomerAMGSetChebyEigEst( (void *) solver, eig_est ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIAlgoType
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIAlgoType( HYPRE_Solver  solver,
+                                HYPRE_Int     algo_type )
+{
+   return( hypre_BoomerAMGSetFSAIAlgoType( (void *) solver, algo_type ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIMaxSteps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIMaxSteps( HYPRE_Solver  solver,
+                                HYPRE_Int     max_steps )
+{
+   return( hypre_BoomerAMGSetFSAIMaxSteps( (void *) solver, max_steps ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIMaxStepSize
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIMaxStepSize( HYPRE_Solver  solver,
+                                   HYPRE_Int     max_step_size )
+{
+   return( hypre_BoomerAMGSetFSAIMaxStepSize( (void *) solver, max_step_size ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIKapTolerance
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIKapTolerance( HYPRE_Solver  solver,
+                                    HYPRE_Real    kap_tolerance )
+{
+   return( hypre_BoomerAMGSetFSAIKapTolerance( (void *) solver, kap_tolerance ) );
+}
+
+/*--------------------------------------------------------------------------
+ * HYPRE_BoomerAMGSetFSAIEigMaxIters
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_BoomerAMGSetFSAIEigMaxIters( HYPRE_Solver  solver,
+                                   HYPRE_Int     eig_max_iters )
+{
+   return( hypre_BoomerAMGSetFSAIEigMaxIters( (void *) solver, eig_max_iters ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_BoomerAMGSetInterpVectors
  *--------------------------------------------------------------------------*/
@@ -28,7 +28,8 @@ HYPRE_ParCSRCOGMRESCreate( MPI_Comm comm, HYPRE_Solver *solver )
          hypre_ParKrylovCreateVectorArray,
          hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
          hypre_ParKrylovMatvec, hypre_ParKrylovMatvecDestroy,
-         hypre_ParKrylovInnerProd, hypre_ParKrylovMassInnerProd, 
+         hypre_ParKrylovInnerProd, hypre_ParKrylovInnerProdStart,
+         hypre_ParKrylovMassInnerProd, 
          hypre_ParKrylovMassDotpTwo, hypre_ParKrylovCopyVector,
          //hypre_ParKrylovCopyVector,
          hypre_ParKrylovClearVector,
@@ -114,6 +115,17 @@ HYPRE_ParCSRCOGMRESSetCGS( HYPRE_Solver solver,
    return( HYPRE_COGMRESSetCGS( solver, cgs ) );
 }
 
+/*--------------------------------------------------------------------------
+ * HYPRE_ParCSRCOGMRESSetSStep
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_ParCSRCOGMRESSetSStep( HYPRE_Solver solver,
+                          HYPRE_Int             s_step    )
+{
+   return( HYPRE_COGMRESSetSStep( solver, s_step ) );
+}
+
 /*--------------------------------------------------------------------------
  * HYPRE_ParCSRCOGMRESSetTol
  *--------------------------------------------------------------------------*/
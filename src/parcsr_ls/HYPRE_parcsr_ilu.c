@@ -185,3 +185,11 @@ HYPRE_ILUSetLocalReordering(  HYPRE_Solver solver, HYPRE_Int ordering_type )
 {
    return hypre_ILUSetLocalReordering(solver, ordering_type);
 }
+/*--------------------------------------------------------------------------
+ * HYPRE_ILUSetLevelScheduling
+ *--------------------------------------------------------------------------*/
+HYPRE_Int
+HYPRE_ILUSetLevelScheduling(  HYPRE_Solver solver, HYPRE_Int level_scheduling )
+{
+   return hypre_ILUSetLevelScheduling(solver, level_scheduling);
+}
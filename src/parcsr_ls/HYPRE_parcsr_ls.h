@@ -117,6 +117,33 @@ HYPRE_Int HYPRE_BoomerAMGSolve(HYPRE_Solver       solver,
                                HYPRE_ParVector    b,
                                HYPRE_ParVector    x);
 
+/**
+ * Solve the system for several right-hand sides at once.
+ * The vectors \e b and \e x are multivectors with the same number of
+ * vectors (see \e HYPRE_ParMultiVectorCreate). All right-hand sides are
+ * cycled together, so that each matrix traversal and each halo exchange
+ * serves all of them. The stopping test is applied to the largest relative
+ * residual over the columns: all columns are cycled until every one of them
+ * is below the tolerance, so columns that converge earlier receive extra
+ * cycles. The number of iterations and the final relative residual norm
+ * returned by the Get functions are the maxima over the columns. Options
+ * not supported by the combined cycle are handled by solving one column at
+ * a time.
+ *
+ * The combined cycle splits the local rows into the same thread blocks as
+ * the single-vector smoothers, so each column follows the iterates of
+ * \e HYPRE_BoomerAMGSolve for the same number of cycles, up to rounding.
+ *
+ * @param solver [IN] solver object to be applied.
+ * @param A [IN] ParCSR matrix, matrix of the linear system to be solved
+ * @param b [IN] right hand sides of the linear systems to be solved
+ * @param x [OUT] approximated solutions of the linear systems to be solved
+ **/
+HYPRE_Int HYPRE_BoomerAMGMultiSolve(HYPRE_Solver       solver,
+                                    HYPRE_ParCSRMatrix A,
+                                    HYPRE_ParVector    b,
+                                    HYPRE_ParVector    x);
+
 /**
  * Solve the transpose system \f$A^T x = b\f$ or apply AMG as a preconditioner
  * to the transpose system . Note that this function should only be used
@@ -161,6 +188,30 @@ HYPRE_Int HYPRE_BoomerAMGGetNumIterations(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGGetFinalRelativeResidualNorm(HYPRE_Solver  solver,
                                                       HYPRE_Real   *rel_resid_norm);
 
+/**
+ * (Optional) Defines what a call to HYPRE_BoomerAMGSetup does.
+ * There are the following options for \e setup_type:
+ *
+ *    - 0  : no setup, the hierarchy of the previous setup is kept
+ *    - 1  : full setup
+ *    - 2  : numeric-only resetup; the coarse grids and the sparsity of the
+ *           interpolation operators of the previous setup are kept, and only
+ *           the interpolation weights (extended+i formula on the kept
+ *           sparsity), the coarse-grid operators and the smoothers are
+ *           recomputed for the new matrix values
+ *
+ * Option 2 falls back to a full setup if there is no previous setup, if the
+ * sparsity pattern of the matrix on any process has changed, or if the
+ * previous setup used
+ * nodal or aggressive coarsening, GSMG, interpolation vectors, approximate
+ * ideal restriction, non-Galerkin coarse grids, dropping in A, additive cycles,
+ * or an interp_type other than 0, 2-9, 12-18 (and 19 for scalar problems).
+ *
+ * The default is 1.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetSetupType(HYPRE_Solver solver,
+                                      HYPRE_Int    setup_type);
+
 /**
  * (Optional) Sets the size of the system of PDEs, if using the systems version.
  * The default is 1, i.e. a scalar system.
@@ -673,6 +724,28 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold(HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetRedundant(HYPRE_Solver solver,
                                       HYPRE_Int    redundant);
 
+/**
+ * (Optional) Enables multi-stage agglomeration of the coarse levels. When
+ * the average number of rows per process of a coarse level falls below
+ * agglom\_threshold, the coarsening stops, and the level is moved onto one
+ * process out of every agglom\_factor (see HYPRE\_BoomerAMGSetAgglomFactor),
+ * where a new BoomerAMG hierarchy is built on a subcommunicator with the
+ * same parameters. That hierarchy agglomerates again when its own levels
+ * become too small, and may end in the redundant coarse grid solve of
+ * HYPRE\_BoomerAMGSetSeqThreshold. The other processes are idle on these
+ * levels. Not used with block matrices or additive cycles. Default is 0,
+ * i.e. no agglomeration.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold(HYPRE_Solver solver,
+                                            HYPRE_Int    agglom_threshold);
+
+/**
+ * (Optional) Sets the number of processes agglomerated onto one, see
+ * HYPRE\_BoomerAMGSetAgglomThreshold. Must be at least 2. Default is 8.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetAgglomFactor(HYPRE_Solver solver,
+                                         HYPRE_Int    agglom_factor);
+
 /**
  * (Optional) Defines the number of sweeps for the fine and coarse grid,
  * the up and down cycle.
@@ -731,6 +804,8 @@ HYPRE_Int HYPRE_BoomerAMGSetGridRelaxType(HYPRE_Solver  solver,
  *    - 6  : hybrid symmetric Gauss-Seidel or SSOR
  *    - 8  : \f$\ell_1\f$-scaled hybrid symmetric Gauss-Seidel
  *    - 9  : Gaussian elimination (only on coarsest level)
+ *    - 12 : factorized sparse approximate inverse (FSAI), see
+ *           HYPRE_BoomerAMGSetFSAIAlgoType
  *    - 13 : \f$\ell_1\f$ Gauss-Seidel, forward solve
  *    - 14 : \f$\ell_1\f$ Gauss-Seidel, backward solve
  *    - 15 : CG (warning - not a fixed smoother - may require FGMRES)
@@ -770,6 +845,75 @@ HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType(HYPRE_Solver  solver,
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder(HYPRE_Solver  solver,
                                        HYPRE_Int     relax_order);
 
+/**
+ * (Optional) If set to 1, the hybrid Gauss-Seidel smoothers (relax types
+ * 3, 6, 8, 13 and 14 with unit weights and a single thread) relax the rows
+ * without off-processor couplings while the halo exchange is in flight,
+ * followed by the remaining rows. This changes the on-processor ordering
+ * of the sweep. The row splitting is computed for each level during setup.
+ *
+ * The default is 0.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap(HYPRE_Solver  solver,
+                                         HYPRE_Int     relax_overlap);
+
+/**
+ * (Optional) If set to k > 0, the values of the level matrices A of levels
+ * k and coarser, and of the interpolation and restriction operators between
+ * them, are stored in single precision after setup. This reduces the memory
+ * traffic and footprint of these levels in the cycle. Vectors, residuals and
+ * the outer Krylov iteration keep double precision. The finest level and the
+ * coarsest level stay in full precision. A level is converted only if it is
+ * relaxed on the host with Jacobi (0) or one of the hybrid Gauss-Seidel
+ * smoothers 3, 4, 6, 8, 13 and 14 with unit weights, and is not smoothed
+ * by a complex smoother. Has no effect in single-precision and complex
+ * builds.
+ *
+ * The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel(HYPRE_Solver  solver,
+                                                HYPRE_Int     mixed_precision_level);
+
+/**
+ * (Optional) If compress\_columns is nonzero, the column indices of the
+ * interpolation and restriction operators and of the level matrices A
+ * between the finest and the coarsest level are stored after setup as a
+ * per-row base and 8-bit or 16-bit offsets, whichever fits all rows of a
+ * matrix. The matrices are then read-only: this only affects the solve
+ * phase, and a new setup restores them. As with
+ * HYPRE\_BoomerAMGSetMixedPrecisionLevel, a level matrix is only compressed
+ * if the level is relaxed on the host with Jacobi (0) or one of the hybrid
+ * Gauss-Seidel smoothers 3, 4, 6, 8, 13 and 14 with unit weights. Matrices
+ * with a row spanning more than 65536 columns are left unchanged.
+ *
+ * The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetCompressColumns(HYPRE_Solver  solver,
+                                            HYPRE_Int     compress_columns);
+
+/**
+ * (Optional) If fused\_cycle is nonzero, the cycle computes the residual and
+ * restricts it to the next coarser level in a single pass over the rows of
+ * the level matrix and the interpolation operator, without storing the
+ * residual. Only used on levels that are on the host, in full precision, not
+ * in block mode, and restricted with the transpose of interpolation.
+ *
+ * The default is 0 (off).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFusedCycle(HYPRE_Solver  solver,
+                                       HYPRE_Int     fused_cycle);
+
+/**
+ * (Optional) If set to k > 0, the cycle uses at most one OpenMP thread per k
+ * local rows of a level, so that coarse levels with little work run on
+ * fewer threads. The number of threads in effect before the cycle is the
+ * upper bound and is restored afterwards. Has no effect without OpenMP.
+ *
+ * The default is 0 (all threads on all levels).
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetCycleMinRowsPerThread(HYPRE_Solver  solver,
+                                                  HYPRE_Int     cycle_min_rows_per_thread);
+
 /**
  * (Optional) Defines in which order the points are relaxed.
  *
@@ -889,6 +1033,48 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyVariant (HYPRE_Solver solver,
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst (HYPRE_Solver solver,
                                            HYPRE_Int   eig_est);
 
+/**
+ * (Optional) Defines how the pattern of the FSAI smoother (relax_type 12)
+ * is chosen.  The smoother is u = u + omega G^T G (f - A u), where the
+ * sparse lower triangular G is computed row by row on the local diagonal
+ * block of A, which needs to be symmetric positive definite.
+ *
+ *    - 0 : the pattern of the strictly lower part of A
+ *    - 1 : adaptive pattern, see HYPRE_BoomerAMGSetFSAIMaxSteps (default)
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIAlgoType (HYPRE_Solver solver,
+                                          HYPRE_Int    algo_type);
+
+/**
+ * (Optional) Defines the maximum number of pattern extension steps per row
+ * of the adaptive FSAI smoother.  The default is 3.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIMaxSteps (HYPRE_Solver solver,
+                                          HYPRE_Int    max_steps);
+
+/**
+ * (Optional) Defines the maximum number of entries added to a row of the
+ * adaptive FSAI smoother in each step.  The default is 5.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIMaxStepSize (HYPRE_Solver solver,
+                                             HYPRE_Int    max_step_size);
+
+/**
+ * (Optional) Defines the tolerance for the relative decrease of the Kaporin
+ * number below which the adaptive FSAI smoother stops extending a row.
+ * The default is 1.0e-3.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIKapTolerance (HYPRE_Solver solver,
+                                              HYPRE_Real   kap_tolerance);
+
+/**
+ * (Optional) Defines the number of power iterations used to estimate the
+ * largest eigenvalue of G A G^T, whose inverse is the FSAI smoother weight
+ * omega.  If 0, omega is 1.  The default is 5.
+ **/
+HYPRE_Int HYPRE_BoomerAMGSetFSAIEigMaxIters (HYPRE_Solver solver,
+                                             HYPRE_Int    eig_max_iters);
+
 /**
  * (Optional) Enables the use of more complex smoothers.
  * The following options exist for \e smooth_type:
@@ -2430,6 +2616,9 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetUnroll(HYPRE_Solver solver,
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS(HYPRE_Solver solver,
                                    HYPRE_Int    cgs);
 
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep(HYPRE_Solver solver,
+                                   HYPRE_Int    s_step);
+
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol(HYPRE_Solver solver,
                                   HYPRE_Real   tol);
 
@@ -3882,10 +4071,28 @@ HYPRE_ILUSetType( HYPRE_Solver solver, HYPRE_Int ilu_type );
  * Options for \e reordering_type are:
  *    - 0 : No reordering
  *    - 1 : RCM (default)
+ *    - 2 : Multicoloring
+ *
+ * Multicoloring orders the local rows color by color, which shortens the
+ * dependency chains of the triangular solves at some cost in convergence
+ * (see HYPRE_ILUSetLevelScheduling).
  **/
 HYPRE_Int
 HYPRE_ILUSetLocalReordering( HYPRE_Solver solver, HYPRE_Int reordering_type );
 
+/**
+ * (Optional) Use level scheduling in the triangular solves with the local
+ * L and U factors.  The rows of each factor are grouped into level sets at
+ * setup, and the rows of one level set are eliminated in parallel with
+ * OpenMP.  The result is the same as with the sequential solve.  Not used
+ * with the RAS variants (ilu_type 30, 31).
+ *
+ *    - 0 : sequential solves (default)
+ *    - 1 : level scheduled solves
+ **/
+HYPRE_Int
+HYPRE_ILUSetLevelScheduling( HYPRE_Solver solver, HYPRE_Int level_scheduling );
+
 /**
  * (Optional) Set the print level to print setup and solve information.
  *
@@ -56,6 +56,10 @@ typedef struct
    HYPRE_Int      A_drop_type;
    HYPRE_Int      measure_type;
    HYPRE_Int      setup_type;
+   HYPRE_Int      setup_diag_nnz;
+   HYPRE_Int      setup_offd_nnz;
+   hypre_ulonglongint setup_pattern_key;
+   hypre_ParCSRRAPHandle **rap_handles;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
    HYPRE_Int      interp_type;
@@ -78,6 +82,8 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      agglom_factor;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -89,6 +95,11 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_overlap;
+   HYPRE_Int      mixed_precision_level;
+   HYPRE_Int      compress_columns;
+   HYPRE_Int      fused_cycle;
+   HYPRE_Int      cycle_min_rows_per_thread;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -162,6 +173,15 @@ typedef struct
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   HYPRE_Int            fsai_algo_type;
+   HYPRE_Int            fsai_max_steps;
+   HYPRE_Int            fsai_max_step_size;
+   HYPRE_Real           fsai_kap_tolerance;
+   HYPRE_Int            fsai_eig_max_iters;
+   hypre_CSRMatrix    **fsai_G;
+   hypre_CSRMatrix    **fsai_GT;
+   HYPRE_Real          *fsai_omega;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -177,6 +197,18 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* halo and work buffers of the multi-vector solve, kept between calls */
+   HYPRE_Complex     *multi_send_buf;
+   HYPRE_Complex     *multi_recv_buf;
+   HYPRE_Complex     *multi_work_buf;
+   HYPRE_Int          multi_send_buf_size;
+   HYPRE_Int          multi_recv_buf_size;
+   HYPRE_Int          multi_work_buf_size;
+
+   /* work buffer of the fused residual and restriction */
+   HYPRE_Complex     *fused_buf;
+   HYPRE_Int          fused_buf_size;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -223,6 +255,11 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
+   /* agglomeration of the coarsest level onto fewer processors */
+   HYPRE_Int            agglomerated;
+   MPI_Comm             agglom_comm;
+   HYPRE_Int           *agglom_counts;
+
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
@@ -299,6 +336,10 @@ typedef struct
 #define hypre_ParAMGDataCoarsenType(amg_data)          ((amg_data) -> coarsen_type)
 #define hypre_ParAMGDataMeasureType(amg_data)          ((amg_data) -> measure_type)
 #define hypre_ParAMGDataSetupType(amg_data)            ((amg_data) -> setup_type)
+#define hypre_ParAMGDataSetupDiagNnz(amg_data)         ((amg_data) -> setup_diag_nnz)
+#define hypre_ParAMGDataSetupOffdNnz(amg_data)         ((amg_data) -> setup_offd_nnz)
+#define hypre_ParAMGDataSetupPatternKey(amg_data)      ((amg_data) -> setup_pattern_key)
+#define hypre_ParAMGDataRAPHandles(amg_data)           ((amg_data) -> rap_handles)
 #define hypre_ParAMGDataPMaxElmts(amg_data)            ((amg_data) -> P_max_elmts)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data)         ((amg_data) -> agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
@@ -317,6 +358,8 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataAgglomThreshold(amg_data)      ((amg_data) -> agglom_threshold)
+#define hypre_ParAMGDataAgglomFactor(amg_data)         ((amg_data) -> agglom_factor)
 
 /* solve params */
 
@@ -334,6 +377,11 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataMixedPrecisionLevel(amg_data) ((amg_data)->mixed_precision_level)
+#define hypre_ParAMGDataCompressColumns(amg_data) ((amg_data)->compress_columns)
+#define hypre_ParAMGDataFusedCycle(amg_data) ((amg_data)->fused_cycle)
+#define hypre_ParAMGDataCycleMinRowsPerThread(amg_data) ((amg_data)->cycle_min_rows_per_thread)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -395,6 +443,15 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataFSAIAlgoType(amg_data) ((amg_data)->fsai_algo_type)
+#define hypre_ParAMGDataFSAIMaxSteps(amg_data) ((amg_data)->fsai_max_steps)
+#define hypre_ParAMGDataFSAIMaxStepSize(amg_data) ((amg_data)->fsai_max_step_size)
+#define hypre_ParAMGDataFSAIKapTolerance(amg_data) ((amg_data)->fsai_kap_tolerance)
+#define hypre_ParAMGDataFSAIEigMaxIters(amg_data) ((amg_data)->fsai_eig_max_iters)
+#define hypre_ParAMGDataFSAIG(amg_data) ((amg_data)->fsai_G)
+#define hypre_ParAMGDataFSAIGT(amg_data) ((amg_data)->fsai_GT)
+#define hypre_ParAMGDataFSAIOmega(amg_data) ((amg_data)->fsai_omega)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -411,6 +468,14 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMultiSendBuf(amg_data) ((amg_data)->multi_send_buf)
+#define hypre_ParAMGDataMultiRecvBuf(amg_data) ((amg_data)->multi_recv_buf)
+#define hypre_ParAMGDataMultiWorkBuf(amg_data) ((amg_data)->multi_work_buf)
+#define hypre_ParAMGDataMultiSendBufSize(amg_data) ((amg_data)->multi_send_buf_size)
+#define hypre_ParAMGDataMultiRecvBufSize(amg_data) ((amg_data)->multi_recv_buf_size)
+#define hypre_ParAMGDataMultiWorkBufSize(amg_data) ((amg_data)->multi_work_buf_size)
+#define hypre_ParAMGDataFusedBuf(amg_data) ((amg_data)->fused_buf)
+#define hypre_ParAMGDataFusedBufSize(amg_data) ((amg_data)->fused_buf_size)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -458,6 +523,9 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomerated(amg_data) ((amg_data)->agglomerated)
+#define hypre_ParAMGDataAgglomComm(amg_data) ((amg_data)->agglom_comm)
+#define hypre_ParAMGDataAgglomCounts(amg_data) ((amg_data)->agglom_counts)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
@@ -781,6 +849,7 @@ HYPRE_Int HYPRE_BoomerAMGCreate ( HYPRE_Solver *solver );
 HYPRE_Int HYPRE_BoomerAMGDestroy ( HYPRE_Solver solver );
 HYPRE_Int HYPRE_BoomerAMGSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
+HYPRE_Int HYPRE_BoomerAMGMultiSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSolveT ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_BoomerAMGSetRestriction ( HYPRE_Solver solver , HYPRE_Int restr_par );
 HYPRE_Int HYPRE_BoomerAMGSetIsTriangular ( HYPRE_Solver solver , HYPRE_Int is_triangular );
@@ -795,6 +864,10 @@ HYPRE_Int HYPRE_BoomerAMGSetSeqThreshold ( HYPRE_Solver solver , HYPRE_Int seq_t
 HYPRE_Int HYPRE_BoomerAMGGetSeqThreshold ( HYPRE_Solver solver , HYPRE_Int *seq_threshold );
 HYPRE_Int HYPRE_BoomerAMGSetRedundant ( HYPRE_Solver solver , HYPRE_Int redundant );
 HYPRE_Int HYPRE_BoomerAMGGetRedundant ( HYPRE_Solver solver , HYPRE_Int *redundant );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomThreshold ( HYPRE_Solver solver , HYPRE_Int agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGGetAgglomThreshold ( HYPRE_Solver solver , HYPRE_Int *agglom_threshold );
+HYPRE_Int HYPRE_BoomerAMGSetAgglomFactor ( HYPRE_Solver solver , HYPRE_Int agglom_factor );
+HYPRE_Int HYPRE_BoomerAMGGetAgglomFactor ( HYPRE_Solver solver , HYPRE_Int *agglom_factor );
 HYPRE_Int HYPRE_BoomerAMGSetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGGetCoarsenCutFactor( HYPRE_Solver solver, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int HYPRE_BoomerAMGSetStrongThreshold ( HYPRE_Solver solver , HYPRE_Real strong_threshold );
@@ -845,6 +918,11 @@ HYPRE_Int HYPRE_BoomerAMGSetRelaxType ( HYPRE_Solver solver , HYPRE_Int relax_ty
 HYPRE_Int HYPRE_BoomerAMGSetCycleRelaxType ( HYPRE_Solver solver , HYPRE_Int relax_type , HYPRE_Int k );
 HYPRE_Int HYPRE_BoomerAMGGetCycleRelaxType ( HYPRE_Solver solver , HYPRE_Int *relax_type , HYPRE_Int k );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxOrder ( HYPRE_Solver solver , HYPRE_Int relax_order );
+HYPRE_Int HYPRE_BoomerAMGSetRelaxOverlap ( HYPRE_Solver solver , HYPRE_Int relax_overlap );
+HYPRE_Int HYPRE_BoomerAMGSetMixedPrecisionLevel ( HYPRE_Solver solver , HYPRE_Int mixed_precision_level );
+HYPRE_Int HYPRE_BoomerAMGSetCompressColumns ( HYPRE_Solver solver , HYPRE_Int compress_columns );
+HYPRE_Int HYPRE_BoomerAMGSetFusedCycle ( HYPRE_Solver solver , HYPRE_Int fused_cycle );
+HYPRE_Int HYPRE_BoomerAMGSetCycleMinRowsPerThread ( HYPRE_Solver solver , HYPRE_Int cycle_min_rows_per_thread );
 HYPRE_Int HYPRE_BoomerAMGSetGridRelaxPoints ( HYPRE_Solver solver , HYPRE_Int **grid_relax_points );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWeight ( HYPRE_Solver solver , HYPRE_Real *relax_weight );
 HYPRE_Int HYPRE_BoomerAMGSetRelaxWt ( HYPRE_Solver solver , HYPRE_Real relax_wt );
@@ -927,6 +1005,11 @@ HYPRE_Int HYPRE_BoomerAMGSetChebyFraction ( HYPRE_Solver solver , HYPRE_Real rat
 HYPRE_Int HYPRE_BoomerAMGSetChebyEigEst ( HYPRE_Solver solver , HYPRE_Int eig_est );
 HYPRE_Int HYPRE_BoomerAMGSetChebyVariant ( HYPRE_Solver solver , HYPRE_Int variant );
 HYPRE_Int HYPRE_BoomerAMGSetChebyScale ( HYPRE_Solver solver , HYPRE_Int scale );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIAlgoType ( HYPRE_Solver solver , HYPRE_Int algo_type );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIMaxSteps ( HYPRE_Solver solver , HYPRE_Int max_steps );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIMaxStepSize ( HYPRE_Solver solver , HYPRE_Int max_step_size );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIKapTolerance ( HYPRE_Solver solver , HYPRE_Real kap_tolerance );
+HYPRE_Int HYPRE_BoomerAMGSetFSAIEigMaxIters ( HYPRE_Solver solver , HYPRE_Int eig_max_iters );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVectors ( HYPRE_Solver solver , HYPRE_Int num_vectors , HYPRE_ParVector *vectors );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecVariant ( HYPRE_Solver solver , HYPRE_Int num );
 HYPRE_Int HYPRE_BoomerAMGSetInterpVecQMax ( HYPRE_Solver solver , HYPRE_Int q_max );
@@ -1060,6 +1143,7 @@ HYPRE_Int HYPRE_ParCSRCOGMRESSetup ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A
 HYPRE_Int HYPRE_ParCSRCOGMRESSolve ( HYPRE_Solver solver , HYPRE_ParCSRMatrix A , HYPRE_ParVector b , HYPRE_ParVector x );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetKDim ( HYPRE_Solver solver , HYPRE_Int k_dim );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetCGS2 ( HYPRE_Solver solver , HYPRE_Int cgs2 );
+HYPRE_Int HYPRE_ParCSRCOGMRESSetSStep ( HYPRE_Solver solver , HYPRE_Int s_step );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetTol ( HYPRE_Solver solver , HYPRE_Real tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetAbsoluteTol ( HYPRE_Solver solver , HYPRE_Real a_tol );
 HYPRE_Int HYPRE_ParCSRCOGMRESSetMinIter ( HYPRE_Solver solver , HYPRE_Int min_iter );
@@ -1249,6 +1333,13 @@ HYPRE_Int hypre_BoomerAMGAdditiveCycle ( void *amg_vdata );
 HYPRE_Int hypre_CreateLambda ( void *amg_vdata );
 HYPRE_Int hypre_CreateDinv ( void *amg_vdata );
 
+/* par_amg_agglomerate.c */
+HYPRE_Int hypre_BoomerAMGAgglomerateCheck ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_BigInt coarse_size , HYPRE_Int num_procs );
+HYPRE_Int hypre_BoomerAMGAgglomerateSetup ( hypre_ParAMGData *amg_data , HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGAgglomerateResetup ( hypre_ParAMGData *amg_data , HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGAgglomerateCycle ( hypre_ParAMGData *amg_data , HYPRE_Int level , hypre_ParVector **F_array , hypre_ParVector **U_array );
+HYPRE_Int hypre_BoomerAMGAgglomerateDestroy ( hypre_ParAMGData *amg_data );
+
 /* par_amg.c */
 void *hypre_BoomerAMGCreate ( void );
 HYPRE_Int hypre_BoomerAMGDestroy ( void *data );
@@ -1267,6 +1358,10 @@ HYPRE_Int hypre_BoomerAMGSetCoarsenCutFactor( void *data, HYPRE_Int coarsen_cut_
 HYPRE_Int hypre_BoomerAMGGetCoarsenCutFactor( void *data, HYPRE_Int *coarsen_cut_factor );
 HYPRE_Int hypre_BoomerAMGSetRedundant ( void *data , HYPRE_Int redundant );
 HYPRE_Int hypre_BoomerAMGGetRedundant ( void *data , HYPRE_Int *redundant );
+HYPRE_Int hypre_BoomerAMGSetAgglomThreshold ( void *data , HYPRE_Int agglom_threshold );
+HYPRE_Int hypre_BoomerAMGGetAgglomThreshold ( void *data , HYPRE_Int *agglom_threshold );
+HYPRE_Int hypre_BoomerAMGSetAgglomFactor ( void *data , HYPRE_Int agglom_factor );
+HYPRE_Int hypre_BoomerAMGGetAgglomFactor ( void *data , HYPRE_Int *agglom_factor );
 HYPRE_Int hypre_BoomerAMGSetStrongThreshold ( void *data , HYPRE_Real strong_threshold );
 HYPRE_Int hypre_BoomerAMGGetStrongThreshold ( void *data , HYPRE_Real *strong_threshold );
 HYPRE_Int hypre_BoomerAMGSetStrongThresholdR ( void *data , HYPRE_Real strong_threshold );
@@ -1317,6 +1412,11 @@ HYPRE_Int hypre_BoomerAMGSetCycleRelaxType ( void *data , HYPRE_Int relax_type ,
 HYPRE_Int hypre_BoomerAMGGetCycleRelaxType ( void *data , HYPRE_Int *relax_type , HYPRE_Int k );
 HYPRE_Int hypre_BoomerAMGSetRelaxOrder ( void *data , HYPRE_Int relax_order );
 HYPRE_Int hypre_BoomerAMGGetRelaxOrder ( void *data , HYPRE_Int *relax_order );
+HYPRE_Int hypre_BoomerAMGSetRelaxOverlap ( void *data , HYPRE_Int relax_overlap );
+HYPRE_Int hypre_BoomerAMGSetMixedPrecisionLevel ( void *data , HYPRE_Int mixed_precision_level );
+HYPRE_Int hypre_BoomerAMGSetCompressColumns ( void *data , HYPRE_Int compress_columns );
+HYPRE_Int hypre_BoomerAMGSetFusedCycle ( void *data , HYPRE_Int fused_cycle );
+HYPRE_Int hypre_BoomerAMGSetCycleMinRowsPerThread ( void *data , HYPRE_Int cycle_min_rows_per_thread );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxType ( void *data , HYPRE_Int *grid_relax_type );
 HYPRE_Int hypre_BoomerAMGGetGridRelaxType ( void *data , HYPRE_Int **grid_relax_type );
 HYPRE_Int hypre_BoomerAMGSetGridRelaxPoints ( void *data , HYPRE_Int **grid_relax_points );
@@ -1409,6 +1509,11 @@ HYPRE_Int hypre_BoomerAMGSetChebyFraction ( void *data , HYPRE_Real ratio );
 HYPRE_Int hypre_BoomerAMGSetChebyEigEst ( void *data , HYPRE_Int eig_est );
 HYPRE_Int hypre_BoomerAMGSetChebyVariant ( void *data , HYPRE_Int variant );
 HYPRE_Int hypre_BoomerAMGSetChebyScale ( void *data , HYPRE_Int scale );
+HYPRE_Int hypre_BoomerAMGSetFSAIAlgoType ( void *data , HYPRE_Int algo_type );
+HYPRE_Int hypre_BoomerAMGSetFSAIMaxSteps ( void *data , HYPRE_Int max_steps );
+HYPRE_Int hypre_BoomerAMGSetFSAIMaxStepSize ( void *data , HYPRE_Int max_step_size );
+HYPRE_Int hypre_BoomerAMGSetFSAIKapTolerance ( void *data , HYPRE_Real kap_tolerance );
+HYPRE_Int hypre_BoomerAMGSetFSAIEigMaxIters ( void *data , HYPRE_Int eig_max_iters );
 HYPRE_Int hypre_BoomerAMGSetInterpVectors ( void *solver , HYPRE_Int num_vectors , hypre_ParVector **interp_vectors );
 HYPRE_Int hypre_BoomerAMGSetInterpVecVariant ( void *solver , HYPRE_Int var );
 HYPRE_Int hypre_BoomerAMGSetInterpVecQMax ( void *data , HYPRE_Int q_max );
@@ -1438,6 +1543,19 @@ HYPRE_Int hypre_BoomerAMGSetFPoints( void *data, HYPRE_Int isolated, HYPRE_Int n
 /* par_amg_setup.c */
 HYPRE_Int hypre_BoomerAMGSetup ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
+/* par_amg_mixed.c */
+HYPRE_Int hypre_BoomerAMGReducedStorageSetup ( hypre_ParAMGData *amg_data );
+HYPRE_Int hypre_BoomerAMGReducedStorageRestore ( hypre_ParAMGData *amg_data );
+
+/* par_amg_multisolve.c */
+HYPRE_Int hypre_BoomerAMGMultiSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
+
+/* par_amg_resetup.c */
+hypre_ulonglongint hypre_BoomerAMGResetupPatternKey ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupCheck ( void *amg_vdata , hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_BoomerAMGResetupLevel ( void *amg_vdata , HYPRE_Int level );
+HYPRE_Int hypre_BoomerAMGResetupDestroyHandles ( void *amg_vdata );
+
 /* par_amg_solve.c */
 HYPRE_Int hypre_BoomerAMGSolve ( void *amg_vdata , hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_ParVector *u );
 
@@ -1502,9 +1620,22 @@ HYPRE_Int hypre_BoomerAMGCoarsenCR ( hypre_ParCSRMatrix *A , HYPRE_Int **CF_mark
 /* par_cycle.c */
 HYPRE_Int hypre_BoomerAMGCycle ( void *amg_vdata , hypre_ParVector **F_array , hypre_ParVector **U_array );
 
+/* par_cycle_fused.c */
+HYPRE_Int hypre_BoomerAMGCycleSetNumThreads ( hypre_ParAMGData *amg_data , HYPRE_Int local_size , HYPRE_Int max_num_threads );
+HYPRE_Int hypre_BoomerAMGFusedRestrictSupported ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGResidualRestrictBufferSize ( hypre_ParCSRMatrix *A , hypre_ParCSRMatrix *P , HYPRE_Int num_threads );
+HYPRE_Int hypre_BoomerAMGFusedCycleSetup ( hypre_ParAMGData *amg_data );
+HYPRE_Int hypre_BoomerAMGResidualRestrict ( hypre_ParAMGData *amg_data , hypre_ParCSRMatrix *A , hypre_ParVector *u , hypre_ParVector *f , hypre_ParCSRMatrix *P , hypre_ParVector *f_c );
+
 /* par_difconv.c */
 HYPRE_ParCSRMatrix GenerateDifConv ( MPI_Comm comm , HYPRE_BigInt nx , HYPRE_BigInt ny , HYPRE_BigInt nz , HYPRE_Int P , HYPRE_Int Q , HYPRE_Int R , HYPRE_Int p , HYPRE_Int q , HYPRE_Int r , HYPRE_Real *value );
 
+/* par_fsai.c */
+HYPRE_Int hypre_ParCSRRelax_FSAI_Setup ( hypre_ParCSRMatrix *A , HYPRE_Int algo_type , HYPRE_Int max_steps , HYPRE_Int max_step_size , HYPRE_Real kap_tolerance , HYPRE_Int eig_max_iters , hypre_CSRMatrix **G_ptr , hypre_CSRMatrix **GT_ptr , HYPRE_Real *omega_ptr );
+HYPRE_Int hypre_ParCSRRelax_FSAI_Apply ( hypre_CSRMatrix *G , HYPRE_Real *x_data , HYPRE_Real *y_data );
+HYPRE_Int hypre_ParCSRRelax_FSAI_Solve ( hypre_ParCSRMatrix *A , hypre_ParVector *f , hypre_CSRMatrix *G , hypre_CSRMatrix *GT , HYPRE_Real omega , hypre_ParVector *u , hypre_ParVector *v , hypre_ParVector *z );
+HYPRE_Int hypre_BoomerAMGFSAIDestroy ( hypre_ParAMGData *amg_data , HYPRE_Int num_levels );
+
 /* par_gsmg.c */
 HYPRE_Int hypre_ParCSRMatrixFillSmooth ( HYPRE_Int nsamples , HYPRE_Real *samples , hypre_ParCSRMatrix *S , hypre_ParCSRMatrix *A , HYPRE_Int num_functions , HYPRE_Int *dof_func );
 HYPRE_Real hypre_ParCSRMatrixChooseThresh ( hypre_ParCSRMatrix *S );
@@ -1616,6 +1747,8 @@ HYPRE_Int hypre_GenerateSendMapAndCommPkg ( MPI_Comm comm , HYPRE_Int num_sends
 
 /* par_relax.c */
 HYPRE_Int hypre_BoomerAMGRelax ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real omega , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp , hypre_ParVector *Ztemp );
+HYPRE_Int hypre_BoomerAMGRelaxHybridOverlap ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real *l1_norms , hypre_ParVector *u );
+HYPRE_Int hypre_BoomerAMGRelaxReducedStorage ( hypre_ParCSRMatrix *A , hypre_ParVector *f , HYPRE_Int *cf_marker , HYPRE_Int relax_type , HYPRE_Int relax_points , HYPRE_Real relax_weight , HYPRE_Real *l1_norms , hypre_ParVector *u , hypre_ParVector *Vtemp );
 HYPRE_Int hypre_GaussElimSetup ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 HYPRE_Int hypre_GaussElimSolve ( hypre_ParAMGData *amg_data , HYPRE_Int level , HYPRE_Int relax_type );
 
@@ -1721,6 +1854,7 @@ HYPRE_Int hypre_ParKrylovMatvec ( void *matvec_data , HYPRE_Complex alpha , void
 HYPRE_Int hypre_ParKrylovMatvecT ( void *matvec_data , HYPRE_Complex alpha , void *A , void *x , HYPRE_Complex beta , void *y );
 HYPRE_Int hypre_ParKrylovMatvecDestroy ( void *matvec_data );
 HYPRE_Real hypre_ParKrylovInnerProd ( void *x , void *y );
+HYPRE_Int hypre_ParKrylovInnerProdStart ( HYPRE_Int n , void **x , void **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_ParKrylovMassInnerProd ( void *x , void **y, HYPRE_Int k, HYPRE_Int unroll, void *result );
 HYPRE_Int hypre_ParKrylovMassDotpTwo ( void *x , void *y , void **z, HYPRE_Int k, HYPRE_Int unroll, void *result_x, void *result_y );
 HYPRE_Int hypre_ParKrylovMassAxpy( HYPRE_Complex *alpha, void **x, void *y, HYPRE_Int k, HYPRE_Int unroll);
@@ -1859,6 +1993,7 @@ HYPRE_Int hypre_ILUSolve( void *ilu_vdata, hypre_ParCSRMatrix *A, hypre_ParVecto
 HYPRE_Int hypre_ILUSetPrintLevel( void *ilu_vdata, HYPRE_Int print_level );
 HYPRE_Int hypre_ILUSetLogging( void *ilu_vdata, HYPRE_Int logging );
 HYPRE_Int hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type );
+HYPRE_Int hypre_ILUSetLevelScheduling( void *ilu_vdata, HYPRE_Int level_scheduling );
 HYPRE_Int hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim );
 HYPRE_Int hypre_ILUSetSchurSolverMaxIter( void *ilu_vdata, HYPRE_Int ss_max_iter );
 HYPRE_Int hypre_ILUSetSchurSolverTol( void *ilu_vdata, HYPRE_Real ss_tol );
@@ -1904,9 +2039,11 @@ HYPRE_Int hypre_ILUSetupILU0RAS(hypre_ParCSRMatrix *A, HYPRE_Int *perm, HYPRE_In
 HYPRE_Int hypre_ILUSetupILUKRASSymbolic(HYPRE_Int n, HYPRE_Int *A_diag_i, HYPRE_Int *A_diag_j, HYPRE_Int *A_offd_i, HYPRE_Int *A_offd_j, HYPRE_Int *E_i, HYPRE_Int *E_j, HYPRE_Int ext, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int *rperm, HYPRE_Int *iw, HYPRE_Int nLU, HYPRE_Int *L_diag_i, HYPRE_Int *U_diag_i, HYPRE_Int **L_diag_j, HYPRE_Int **U_diag_j);
 HYPRE_Int hypre_ILUSetupILUKRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
 HYPRE_Int hypre_ILUSetupILUTRAS(hypre_ParCSRMatrix *A, HYPRE_Int lfil, HYPRE_Real *tol, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix **Lptr, HYPRE_Real** Dptr, hypre_ParCSRMatrix **Uptr);
-HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp);
-HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
-HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end);
+HYPRE_Int hypre_ILUSolveLowerLevels(hypre_CSRMatrix *L_diag, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Real *f_data, HYPRE_Real *u_data, HYPRE_Int num_levels, HYPRE_Int *level_ptr, HYPRE_Int *level_rows);
+HYPRE_Int hypre_ILUSolveUpperLevels(hypre_CSRMatrix *U_diag, HYPRE_Int *u_end, HYPRE_Real *D, HYPRE_Int *qperm, HYPRE_Real *u_data, HYPRE_Int num_levels, HYPRE_Int *level_ptr, HYPRE_Int *level_rows);
+HYPRE_Int hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *utemp, hypre_ParVector *ftemp, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
+HYPRE_Int hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int *qperm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, HYPRE_Solver schur_precond, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
+HYPRE_Int hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, HYPRE_Int nLU, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParCSRMatrix *S, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Solver schur_solver, hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end, HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows, HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows);
 HYPRE_Int hypre_ILUSolveLURAS(hypre_ParCSRMatrix *A, hypre_ParVector *f, hypre_ParVector *u, HYPRE_Int *perm, hypre_ParCSRMatrix *L, HYPRE_Real* D, hypre_ParCSRMatrix *U, hypre_ParVector *ftemp, hypre_ParVector *utemp, HYPRE_Real *fext, HYPRE_Real *uext);
 HYPRE_Int hypre_ILUSetSchurNSHDropThreshold( void *ilu_vdata, HYPRE_Real threshold);
 HYPRE_Int hypre_ILUSetSchurNSHDropThresholdArray( void *ilu_vdata, HYPRE_Real *threshold);
@@ -1918,6 +2055,8 @@ HYPRE_Int hypre_ILULocalRCMOrder( hypre_CSRMatrix *A, HYPRE_Int *perm);
 HYPRE_Int hypre_ILULocalRCMBuildLevel(hypre_CSRMatrix *A, HYPRE_Int root, HYPRE_Int *marker, HYPRE_Int *level_i, HYPRE_Int *level_j, HYPRE_Int *nlevp);
 HYPRE_Int hypre_ILULocalRCMQsort(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end, HYPRE_Int *degree);
 HYPRE_Int hypre_ILULocalRCMReverse(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end);
+HYPRE_Int hypre_ILULocalMulticolor( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end, HYPRE_Int **permp, HYPRE_Int **qpermp);
+HYPRE_Int hypre_ILUBuildLevelSets( hypre_CSRMatrix *T, HYPRE_Int n, HYPRE_Int *T_end, HYPRE_Int lower, HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr, HYPRE_Int **level_rows_ptr);
 // Newton-Schultz-Hotelling (NSH) functions
 void * hypre_NSHCreate();
 HYPRE_Int hypre_NSHDestroy( void *data );
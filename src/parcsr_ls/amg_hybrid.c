@@ -1855,7 +1855,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
                   hypre_ParKrylovMatvec,
                   hypre_ParKrylovMatvecDestroy,
-                  hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+                  hypre_ParKrylovInnerProd, hypre_ParKrylovInnerProdStart,
+                  hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -1922,7 +1923,8 @@ hypre_AMGHybridSolve( void               *AMGhybrid_vdata,
                   hypre_ParKrylovDestroyVector, hypre_ParKrylovMatvecCreate,
                   hypre_ParKrylovMatvec,
                   hypre_ParKrylovMatvecDestroy,
-                  hypre_ParKrylovInnerProd, hypre_ParKrylovCopyVector,
+                  hypre_ParKrylovInnerProd, hypre_ParKrylovInnerProdStart,
+                  hypre_ParKrylovCopyVector,
                   hypre_ParKrylovClearVector,
                   hypre_ParKrylovScaleVector, hypre_ParKrylovAxpy,
                   hypre_ParKrylovIdentitySetup, hypre_ParKrylovIdentity );
@@ -65,6 +65,8 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    cgc_its;
    HYPRE_Int    seq_threshold;
    HYPRE_Int    redundant;
+   HYPRE_Int    agglom_threshold;
+   HYPRE_Int    agglom_factor;
 
    /* solve params */
    HYPRE_Int    min_iter;
@@ -80,6 +82,11 @@ hypre_BoomerAMGCreate()
    HYPRE_Int    relax_up;
    HYPRE_Int    relax_coarse;
    HYPRE_Int    relax_order;
+   HYPRE_Int    relax_overlap;
+   HYPRE_Int    mixed_precision_level;
+   HYPRE_Int    compress_columns;
+   HYPRE_Int    fused_cycle;
+   HYPRE_Int    cycle_min_rows_per_thread;
    HYPRE_Real   relax_wt;
    HYPRE_Real   outer_wt;
    HYPRE_Real   nongalerkin_tol;
@@ -103,6 +110,12 @@ hypre_BoomerAMGCreate()
    HYPRE_Int cheby_scale;
    HYPRE_Real cheby_eig_ratio;
 
+   HYPRE_Int fsai_algo_type;
+   HYPRE_Int fsai_max_steps;
+   HYPRE_Int fsai_max_step_size;
+   HYPRE_Real fsai_kap_tolerance;
+   HYPRE_Int fsai_eig_max_iters;
+
    HYPRE_Int block_mode;
 
    HYPRE_Int    additive;
@@ -137,6 +150,8 @@ hypre_BoomerAMGCreate()
    min_coarse_size = 0;
    seq_threshold = 0;
    redundant = 0;
+   agglom_threshold = 0;
+   agglom_factor = 8;
    coarsen_cut_factor = 0;
    strong_threshold = 0.25;
    strong_threshold_R = 0.25;
@@ -207,6 +222,11 @@ hypre_BoomerAMGCreate()
    relax_up = 14;
    relax_coarse = 9;
    relax_order = 0;
+   relax_overlap = 0;
+   mixed_precision_level = 0;
+   compress_columns = 0;
+   fused_cycle = 0;
+   cycle_min_rows_per_thread = 0;
    relax_wt = 1.0;
    outer_wt = 1.0;
 
@@ -216,6 +236,12 @@ hypre_BoomerAMGCreate()
    cheby_eig_est = 10;
    cheby_eig_ratio = .3;
 
+   fsai_algo_type = 1;
+   fsai_max_steps = 3;
+   fsai_max_step_size = 5;
+   fsai_kap_tolerance = 1.0e-3;
+   fsai_eig_max_iters = 5;
+
    block_mode = 0;
 
    additive = -1;
@@ -320,6 +346,11 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_up, 2);
    hypre_BoomerAMGSetCycleRelaxType(amg_data, relax_coarse, 3);
    hypre_BoomerAMGSetRelaxOrder(amg_data, relax_order);
+   hypre_BoomerAMGSetRelaxOverlap(amg_data, relax_overlap);
+   hypre_BoomerAMGSetMixedPrecisionLevel(amg_data, mixed_precision_level);
+   hypre_BoomerAMGSetCompressColumns(amg_data, compress_columns);
+   hypre_BoomerAMGSetFusedCycle(amg_data, fused_cycle);
+   hypre_BoomerAMGSetCycleMinRowsPerThread(amg_data, cycle_min_rows_per_thread);
    hypre_BoomerAMGSetRelaxWt(amg_data, relax_wt);
    hypre_BoomerAMGSetOuterWt(amg_data, outer_wt);
    hypre_BoomerAMGSetSmoothType(amg_data, smooth_type);
@@ -332,6 +363,12 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetChebyVariant(amg_data, cheby_variant);
    hypre_BoomerAMGSetChebyScale(amg_data, cheby_scale);
 
+   hypre_BoomerAMGSetFSAIAlgoType(amg_data, fsai_algo_type);
+   hypre_BoomerAMGSetFSAIMaxSteps(amg_data, fsai_max_steps);
+   hypre_BoomerAMGSetFSAIMaxStepSize(amg_data, fsai_max_step_size);
+   hypre_BoomerAMGSetFSAIKapTolerance(amg_data, fsai_kap_tolerance);
+   hypre_BoomerAMGSetFSAIEigMaxIters(amg_data, fsai_eig_max_iters);
+
    hypre_BoomerAMGSetNumIterations(amg_data, num_iterations);
 
    hypre_BoomerAMGSetAdditive(amg_data, additive);
@@ -362,6 +399,10 @@ hypre_BoomerAMGCreate()
    hypre_BoomerAMGSetNumSamples(amg_data, 0);
 
    hypre_ParAMGDataAArray(amg_data) = NULL;
+   hypre_ParAMGDataSetupDiagNnz(amg_data) = -1;
+   hypre_ParAMGDataSetupOffdNnz(amg_data) = -1;
+   hypre_ParAMGDataSetupPatternKey(amg_data) = 0;
+   hypre_ParAMGDataRAPHandles(amg_data) = NULL;
    hypre_ParAMGDataPArray(amg_data) = NULL;
    hypre_ParAMGDataRArray(amg_data) = NULL;
    hypre_ParAMGDataCFMarkerArray(amg_data) = NULL;
@@ -369,6 +410,14 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataRtemp(amg_data)  = NULL;
    hypre_ParAMGDataPtemp(amg_data)  = NULL;
    hypre_ParAMGDataZtemp(amg_data)  = NULL;
+   hypre_ParAMGDataMultiSendBuf(amg_data) = NULL;
+   hypre_ParAMGDataMultiRecvBuf(amg_data) = NULL;
+   hypre_ParAMGDataMultiWorkBuf(amg_data) = NULL;
+   hypre_ParAMGDataMultiSendBufSize(amg_data) = 0;
+   hypre_ParAMGDataMultiRecvBufSize(amg_data) = 0;
+   hypre_ParAMGDataMultiWorkBufSize(amg_data) = 0;
+   hypre_ParAMGDataFusedBuf(amg_data) = NULL;
+   hypre_ParAMGDataFusedBufSize(amg_data) = 0;
    hypre_ParAMGDataFArray(amg_data) = NULL;
    hypre_ParAMGDataUArray(amg_data) = NULL;
    hypre_ParAMGDataDofFunc(amg_data) = NULL;
@@ -392,6 +441,11 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataChebyDS(amg_data) = NULL;
    hypre_ParAMGDataChebyCoefs(amg_data) = NULL;
 
+   /* Stuff for FSAI smoothing */
+   hypre_ParAMGDataFSAIG(amg_data) = NULL;
+   hypre_ParAMGDataFSAIGT(amg_data) = NULL;
+   hypre_ParAMGDataFSAIOmega(amg_data) = NULL;
+
    /* BM Oct 22, 2006 */
    hypre_ParAMGDataPlotGrids(amg_data) = 0;
    hypre_BoomerAMGSetPlotFileName (amg_data, plot_file_name);
@@ -422,6 +476,13 @@ hypre_BoomerAMGCreate()
    hypre_ParAMGDataUCoarse(amg_data) = NULL;
    hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
 
+   /* for agglomeration of the coarsest level */
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+   hypre_ParAMGDataAgglomFactor(amg_data) = agglom_factor;
+   hypre_ParAMGDataAgglomerated(amg_data) = 0;
+   hypre_ParAMGDataAgglomComm(amg_data) = hypre_MPI_COMM_NULL;
+   hypre_ParAMGDataAgglomCounts(amg_data) = NULL;
+
    /* for Gaussian elimination coarse grid solve */
    hypre_ParAMGDataGSSetup(amg_data) = 0;
    hypre_ParAMGDataAMat(amg_data) = NULL;
@@ -629,6 +690,8 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_TFree(hypre_ParAMGDataChebyDS(amg_data), HYPRE_MEMORY_HOST);
    }
 
+   hypre_BoomerAMGFSAIDestroy(amg_data, num_levels);
+
    if (hypre_ParAMGDataDinv(amg_data))
       hypre_TFree(hypre_ParAMGDataDinv(amg_data), HYPRE_MEMORY_HOST);
 
@@ -643,6 +706,7 @@ hypre_BoomerAMGDestroy( void *data )
    {
       hypre_TFree(hypre_ParAMGDataCFMarkerArray(amg_data)[0], HYPRE_MEMORY_HOST);
    }
+   hypre_BoomerAMGResetupDestroyHandles(amg_data);
    hypre_ParVectorDestroy(hypre_ParAMGDataVtemp(amg_data));
    hypre_TFree(hypre_ParAMGDataFArray(amg_data), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_ParAMGDataUArray(amg_data), HYPRE_MEMORY_HOST);
@@ -658,6 +722,10 @@ hypre_BoomerAMGDestroy( void *data )
       hypre_ParVectorDestroy(hypre_ParAMGDataPtemp(amg_data));
    if (hypre_ParAMGDataZtemp(amg_data))
       hypre_ParVectorDestroy(hypre_ParAMGDataZtemp(amg_data));
+   hypre_TFree(hypre_ParAMGDataMultiSendBuf(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataMultiRecvBuf(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataMultiWorkBuf(amg_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataFusedBuf(amg_data), HYPRE_MEMORY_HOST);
 
    if (hypre_ParAMGDataDofFuncArray(amg_data))
    {
@@ -795,6 +863,7 @@ hypre_BoomerAMGDestroy( void *data )
    {
       hypre_MPI_Comm_free (&new_comm);
    }
+   hypre_BoomerAMGAgglomerateDestroy(amg_data);
    hypre_TFree(amg_data, HYPRE_MEMORY_HOST);
 
    HYPRE_ANNOTATION_END("BoomerAMG.destroy");
@@ -1103,6 +1172,86 @@ hypre_BoomerAMGGetRedundant( void *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetAgglomThreshold( void *data,
+                                   HYPRE_Int   agglom_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (agglom_threshold < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAgglomThreshold(amg_data) = agglom_threshold;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAgglomThreshold( void *data,
+                                   HYPRE_Int *  agglom_threshold )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *agglom_threshold = hypre_ParAMGDataAgglomThreshold(amg_data);
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetAgglomFactor( void *data,
+                                HYPRE_Int   agglom_factor )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   if (agglom_factor < 2)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+
+   hypre_ParAMGDataAgglomFactor(amg_data) = agglom_factor;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGGetAgglomFactor( void *data,
+                                HYPRE_Int *  agglom_factor )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   *agglom_factor = hypre_ParAMGDataAgglomFactor(amg_data);
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetCoarsenCutFactor( void       *data,
                                     HYPRE_Int   coarsen_cut_factor )
@@ -2191,6 +2340,91 @@ hypre_BoomerAMGGetRelaxOrder( void     *data,
    return hypre_error_flag;
 }
 
+HYPRE_Int
+hypre_BoomerAMGSetRelaxOverlap( void     *data,
+                                HYPRE_Int       relax_overlap)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataRelaxOverlap(amg_data) = relax_overlap;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetMixedPrecisionLevel( void     *data,
+                                       HYPRE_Int       mixed_precision_level)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataMixedPrecisionLevel(amg_data) = mixed_precision_level;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetCompressColumns( void     *data,
+                                   HYPRE_Int       compress_columns)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataCompressColumns(amg_data) = compress_columns;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetFusedCycle( void     *data,
+                              HYPRE_Int       fused_cycle)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFusedCycle(amg_data) = fused_cycle;
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_BoomerAMGSetCycleMinRowsPerThread( void     *data,
+                                         HYPRE_Int       cycle_min_rows_per_thread)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (cycle_min_rows_per_thread < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataCycleMinRowsPerThread(amg_data) = cycle_min_rows_per_thread;
+
+   return hypre_error_flag;
+}
+
 HYPRE_Int
 hypre_BoomerAMGSetGridRelaxType( void     *data,
                               HYPRE_Int      *grid_relax_type )
@@ -4069,6 +4303,106 @@ hypre_BoomerAMGSetChebyScale( void     *data,
 
    return hypre_error_flag;
 }
+HYPRE_Int
+hypre_BoomerAMGSetFSAIAlgoType( void     *data,
+                                HYPRE_Int  algo_type)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (algo_type < 0 || algo_type > 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIAlgoType(amg_data) = algo_type;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetFSAIMaxSteps( void     *data,
+                                HYPRE_Int  max_steps)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (max_steps < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIMaxSteps(amg_data) = max_steps;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetFSAIMaxStepSize( void     *data,
+                                   HYPRE_Int  max_step_size)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (max_step_size < 1)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIMaxStepSize(amg_data) = max_step_size;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetFSAIKapTolerance( void     *data,
+                                    HYPRE_Real kap_tolerance)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (kap_tolerance < 0.0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIKapTolerance(amg_data) = kap_tolerance;
+
+   return hypre_error_flag;
+}
+HYPRE_Int
+hypre_BoomerAMGSetFSAIEigMaxIters( void     *data,
+                                   HYPRE_Int  eig_max_iters)
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) data;
+
+   if (!amg_data)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+   if (eig_max_iters < 0)
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   hypre_ParAMGDataFSAIEigMaxIters(amg_data) = eig_max_iters;
+
+   return hypre_error_flag;
+}
 
 
 /*--------------------------------------------------------------------------
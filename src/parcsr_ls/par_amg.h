@@ -38,6 +38,10 @@ typedef struct
    HYPRE_Int      A_drop_type;
    HYPRE_Int      measure_type;
    HYPRE_Int      setup_type;
+   HYPRE_Int      setup_diag_nnz;
+   HYPRE_Int      setup_offd_nnz;
+   hypre_ulonglongint setup_pattern_key;
+   hypre_ParCSRRAPHandle **rap_handles;
    HYPRE_Int      coarsen_type;
    HYPRE_Int      P_max_elmts;
    HYPRE_Int      interp_type;
@@ -60,6 +64,8 @@ typedef struct
    HYPRE_Int      seq_threshold;
    HYPRE_Int      redundant;
    HYPRE_Int      participate;
+   HYPRE_Int      agglom_threshold;
+   HYPRE_Int      agglom_factor;
    HYPRE_Int      Sabs;
 
    /* solve params */
@@ -71,6 +77,11 @@ typedef struct
    HYPRE_Int     *grid_relax_type;
    HYPRE_Int    **grid_relax_points;
    HYPRE_Int      relax_order;
+   HYPRE_Int      relax_overlap;
+   HYPRE_Int      mixed_precision_level;
+   HYPRE_Int      compress_columns;
+   HYPRE_Int      fused_cycle;
+   HYPRE_Int      cycle_min_rows_per_thread;
    HYPRE_Int      user_coarse_relax_type;
    HYPRE_Int      user_relax_type;
    HYPRE_Int      user_num_sweeps;
@@ -144,6 +155,15 @@ typedef struct
    HYPRE_Real         **cheby_ds;
    HYPRE_Real         **cheby_coefs;
 
+   HYPRE_Int            fsai_algo_type;
+   HYPRE_Int            fsai_max_steps;
+   HYPRE_Int            fsai_max_step_size;
+   HYPRE_Real           fsai_kap_tolerance;
+   HYPRE_Int            fsai_eig_max_iters;
+   hypre_CSRMatrix    **fsai_G;
+   hypre_CSRMatrix    **fsai_GT;
+   HYPRE_Real          *fsai_omega;
+
    /* data needed for non-Galerkin option */
    HYPRE_Int           nongalerk_num_tol;
    HYPRE_Real         *nongalerk_tol;
@@ -159,6 +179,18 @@ typedef struct
    hypre_ParVector   *Ptemp;
    hypre_ParVector   *Ztemp;
 
+   /* halo and work buffers of the multi-vector solve, kept between calls */
+   HYPRE_Complex     *multi_send_buf;
+   HYPRE_Complex     *multi_recv_buf;
+   HYPRE_Complex     *multi_work_buf;
+   HYPRE_Int          multi_send_buf_size;
+   HYPRE_Int          multi_recv_buf_size;
+   HYPRE_Int          multi_work_buf_size;
+
+   /* work buffer of the fused residual and restriction */
+   HYPRE_Complex     *fused_buf;
+   HYPRE_Int          fused_buf_size;
+
    /* fields used by GSMG and LS interpolation */
    HYPRE_Int          gsmg;        /* nonzero indicates use of GSMG */
    HYPRE_Int          num_samples; /* number of sample vectors */
@@ -205,6 +237,11 @@ typedef struct
    hypre_ParVector     *u_coarse;
    MPI_Comm             new_comm;
 
+   /* agglomeration of the coarsest level onto fewer processors */
+   HYPRE_Int            agglomerated;
+   MPI_Comm             agglom_comm;
+   HYPRE_Int           *agglom_counts;
+
    /* store matrix, vector and communication info for Gaussian elimination */
    HYPRE_Int   gs_setup;
    HYPRE_Real *A_mat, *A_inv;
@@ -281,6 +318,10 @@ typedef struct
 #define hypre_ParAMGDataCoarsenType(amg_data)          ((amg_data) -> coarsen_type)
 #define hypre_ParAMGDataMeasureType(amg_data)          ((amg_data) -> measure_type)
 #define hypre_ParAMGDataSetupType(amg_data)            ((amg_data) -> setup_type)
+#define hypre_ParAMGDataSetupDiagNnz(amg_data)         ((amg_data) -> setup_diag_nnz)
+#define hypre_ParAMGDataSetupOffdNnz(amg_data)         ((amg_data) -> setup_offd_nnz)
+#define hypre_ParAMGDataSetupPatternKey(amg_data)      ((amg_data) -> setup_pattern_key)
+#define hypre_ParAMGDataRAPHandles(amg_data)           ((amg_data) -> rap_handles)
 #define hypre_ParAMGDataPMaxElmts(amg_data)            ((amg_data) -> P_max_elmts)
 #define hypre_ParAMGDataAggPMaxElmts(amg_data)         ((amg_data) -> agg_P_max_elmts)
 #define hypre_ParAMGDataAggP12MaxElmts(amg_data)       ((amg_data) -> agg_P12_max_elmts)
@@ -299,6 +340,8 @@ typedef struct
 #define hypre_ParAMGDataMaxCoarseSize(amg_data)        ((amg_data) -> max_coarse_size)
 #define hypre_ParAMGDataMinCoarseSize(amg_data)        ((amg_data) -> min_coarse_size)
 #define hypre_ParAMGDataSeqThreshold(amg_data)         ((amg_data) -> seq_threshold)
+#define hypre_ParAMGDataAgglomThreshold(amg_data)      ((amg_data) -> agglom_threshold)
+#define hypre_ParAMGDataAgglomFactor(amg_data)         ((amg_data) -> agglom_factor)
 
 /* solve params */
 
@@ -316,6 +359,11 @@ typedef struct
 #define hypre_ParAMGDataGridRelaxType(amg_data) ((amg_data)->grid_relax_type)
 #define hypre_ParAMGDataGridRelaxPoints(amg_data) ((amg_data)->grid_relax_points)
 #define hypre_ParAMGDataRelaxOrder(amg_data) ((amg_data)->relax_order)
+#define hypre_ParAMGDataRelaxOverlap(amg_data) ((amg_data)->relax_overlap)
+#define hypre_ParAMGDataMixedPrecisionLevel(amg_data) ((amg_data)->mixed_precision_level)
+#define hypre_ParAMGDataCompressColumns(amg_data) ((amg_data)->compress_columns)
+#define hypre_ParAMGDataFusedCycle(amg_data) ((amg_data)->fused_cycle)
+#define hypre_ParAMGDataCycleMinRowsPerThread(amg_data) ((amg_data)->cycle_min_rows_per_thread)
 #define hypre_ParAMGDataRelaxWeight(amg_data) ((amg_data)->relax_weight)
 #define hypre_ParAMGDataOmega(amg_data) ((amg_data)->omega)
 #define hypre_ParAMGDataOuterWt(amg_data) ((amg_data)->outer_wt)
@@ -377,6 +425,15 @@ typedef struct
 #define hypre_ParAMGDataChebyDS(amg_data) ((amg_data)->cheby_ds)
 #define hypre_ParAMGDataChebyCoefs(amg_data) ((amg_data)->cheby_coefs)
 
+#define hypre_ParAMGDataFSAIAlgoType(amg_data) ((amg_data)->fsai_algo_type)
+#define hypre_ParAMGDataFSAIMaxSteps(amg_data) ((amg_data)->fsai_max_steps)
+#define hypre_ParAMGDataFSAIMaxStepSize(amg_data) ((amg_data)->fsai_max_step_size)
+#define hypre_ParAMGDataFSAIKapTolerance(amg_data) ((amg_data)->fsai_kap_tolerance)
+#define hypre_ParAMGDataFSAIEigMaxIters(amg_data) ((amg_data)->fsai_eig_max_iters)
+#define hypre_ParAMGDataFSAIG(amg_data) ((amg_data)->fsai_G)
+#define hypre_ParAMGDataFSAIGT(amg_data) ((amg_data)->fsai_GT)
+#define hypre_ParAMGDataFSAIOmega(amg_data) ((amg_data)->fsai_omega)
+
 /* block */
 #define hypre_ParAMGDataABlockArray(amg_data) ((amg_data)->A_block_array)
 #define hypre_ParAMGDataPBlockArray(amg_data) ((amg_data)->P_block_array)
@@ -393,6 +450,14 @@ typedef struct
 #define hypre_ParAMGDataRtemp(amg_data) ((amg_data)->Rtemp)
 #define hypre_ParAMGDataPtemp(amg_data) ((amg_data)->Ptemp)
 #define hypre_ParAMGDataZtemp(amg_data) ((amg_data)->Ztemp)
+#define hypre_ParAMGDataMultiSendBuf(amg_data) ((amg_data)->multi_send_buf)
+#define hypre_ParAMGDataMultiRecvBuf(amg_data) ((amg_data)->multi_recv_buf)
+#define hypre_ParAMGDataMultiWorkBuf(amg_data) ((amg_data)->multi_work_buf)
+#define hypre_ParAMGDataMultiSendBufSize(amg_data) ((amg_data)->multi_send_buf_size)
+#define hypre_ParAMGDataMultiRecvBufSize(amg_data) ((amg_data)->multi_recv_buf_size)
+#define hypre_ParAMGDataMultiWorkBufSize(amg_data) ((amg_data)->multi_work_buf_size)
+#define hypre_ParAMGDataFusedBuf(amg_data) ((amg_data)->fused_buf)
+#define hypre_ParAMGDataFusedBufSize(amg_data) ((amg_data)->fused_buf_size)
 
 /* fields used by GSMG */
 #define hypre_ParAMGDataGSMG(amg_data) ((amg_data)->gsmg)
@@ -440,6 +505,9 @@ typedef struct
 #define hypre_ParAMGDataNewComm(amg_data) ((amg_data)->new_comm)
 #define hypre_ParAMGDataRedundant(amg_data) ((amg_data)->redundant)
 #define hypre_ParAMGDataParticipate(amg_data) ((amg_data)->participate)
+#define hypre_ParAMGDataAgglomerated(amg_data) ((amg_data)->agglomerated)
+#define hypre_ParAMGDataAgglomComm(amg_data) ((amg_data)->agglom_comm)
+#define hypre_ParAMGDataAgglomCounts(amg_data) ((amg_data)->agglom_counts)
 
 #define hypre_ParAMGDataGSSetup(amg_data) ((amg_data)->gs_setup)
 #define hypre_ParAMGDataAMat(amg_data) ((amg_data)->A_mat)
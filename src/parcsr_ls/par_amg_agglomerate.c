@@ -0,0 +1,607 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Multi-stage agglomeration of the coarse BoomerAMG levels
+ *
+ * When the average number of rows per process of a coarse level drops below
+ * hypre_ParAMGDataAgglomThreshold, hypre_BoomerAMGSetup stops coarsening and
+ * calls hypre_BoomerAMGAgglomerateSetup.  The processes are split into groups
+ * of hypre_ParAMGDataAgglomFactor consecutive ranks; each group gathers its
+ * rows of the level matrix on its first rank (the leader).  Since the global
+ * numbering is contiguous by rank, the gathered rows keep their global
+ * indices.  The leaders form a subcommunicator (hypre_ParAMGDataNewComm) on
+ * which a new BoomerAMG hierarchy is built with the same parameters, so it
+ * agglomerates again when its own levels become too small.  The coarse
+ * solver, matrix and vectors are kept in the same fields as for the
+ * redundant coarse grid solve of gen_redcs_mat.c.
+ *
+ * In the cycle, the coarsest level of the outer hierarchy gathers f and u on
+ * the leaders, which run one cycle of the inner hierarchy, and scatters u
+ * back.  The other processes are idle until the scatter.
+ *
+ * A numeric-only resetup (setup type 2) keeps the groups and the
+ * agglomerated matrix, and only gathers the new values
+ * (hypre_BoomerAMGAgglomerateResetup).
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateCheck
+ *
+ * Returns 1 if the coarse level `level' with coarse_size rows, distributed
+ * over num_procs processes, should be agglomerated.  The result is the same
+ * on all processes.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateCheck( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         level,
+                                 HYPRE_BigInt      coarse_size,
+                                 HYPRE_Int         num_procs )
+{
+   HYPRE_Int  agglom_threshold = hypre_ParAMGDataAgglomThreshold(amg_data);
+   HYPRE_Int  max_thresh       = hypre_max(hypre_ParAMGDataMaxCoarseSize(amg_data),
+                                           hypre_ParAMGDataSeqThreshold(amg_data));
+
+   if ( agglom_threshold < 1 ||
+        hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataAdditive(amg_data)     >= 0 ||
+        hypre_ParAMGDataMultAdditive(amg_data) >= 0 ||
+        hypre_ParAMGDataSimple(amg_data)       >= 0 ||
+        level >= hypre_ParAMGDataMaxLevels(amg_data) - 1 )
+   {
+      return 0;
+   }
+
+   /* leave small levels to the redundant or direct coarse grid solve */
+   if (num_procs < 2 || coarse_size <= (HYPRE_BigInt) max_thresh)
+   {
+      return 0;
+   }
+
+   return (coarse_size < (HYPRE_BigInt) agglom_threshold * (HYPRE_BigInt) num_procs);
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateCreateSolver
+ *
+ * Creates the BoomerAMG solver for the agglomerated levels, with the
+ * parameters of amg_data that apply below `level'.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Solver
+hypre_BoomerAMGAgglomerateCreateSolver( hypre_ParAMGData *amg_data,
+                                        HYPRE_Int         level )
+{
+   HYPRE_Int    *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int    *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Solver  solver;
+   HYPRE_Int     k;
+
+   HYPRE_BoomerAMGCreate(&solver);
+
+   HYPRE_BoomerAMGSetMaxLevels(solver, hypre_ParAMGDataMaxLevels(amg_data) - level);
+   HYPRE_BoomerAMGSetMaxCoarseSize(solver, hypre_ParAMGDataMaxCoarseSize(amg_data));
+   HYPRE_BoomerAMGSetMinCoarseSize(solver, hypre_ParAMGDataMinCoarseSize(amg_data));
+   HYPRE_BoomerAMGSetSeqThreshold(solver, hypre_ParAMGDataSeqThreshold(amg_data));
+   HYPRE_BoomerAMGSetRedundant(solver, hypre_ParAMGDataRedundant(amg_data));
+   HYPRE_BoomerAMGSetAgglomThreshold(solver, hypre_ParAMGDataAgglomThreshold(amg_data));
+   HYPRE_BoomerAMGSetAgglomFactor(solver, hypre_ParAMGDataAgglomFactor(amg_data));
+
+   HYPRE_BoomerAMGSetStrongThreshold(solver, hypre_ParAMGDataStrongThreshold(amg_data));
+   HYPRE_BoomerAMGSetMaxRowSum(solver, hypre_ParAMGDataMaxRowSum(amg_data));
+   HYPRE_BoomerAMGSetCoarsenType(solver, hypre_ParAMGDataCoarsenType(amg_data));
+   HYPRE_BoomerAMGSetInterpType(solver, hypre_ParAMGDataInterpType(amg_data));
+   HYPRE_BoomerAMGSetTruncFactor(solver, hypre_ParAMGDataTruncFactor(amg_data));
+   HYPRE_BoomerAMGSetPMaxElmts(solver, hypre_ParAMGDataPMaxElmts(amg_data));
+   HYPRE_BoomerAMGSetAggNumLevels(solver,
+                                  hypre_max(hypre_ParAMGDataAggNumLevels(amg_data) - level, 0));
+   HYPRE_BoomerAMGSetNumPaths(solver, hypre_ParAMGDataNumPaths(amg_data));
+   HYPRE_BoomerAMGSetAggInterpType(solver, hypre_ParAMGDataAggInterpType(amg_data));
+   HYPRE_BoomerAMGSetNumFunctions(solver, hypre_ParAMGDataNumFunctions(amg_data));
+
+   HYPRE_BoomerAMGSetCycleType(solver, hypre_ParAMGDataCycleType(amg_data));
+   for (k = 1; k < 4; k++)
+   {
+      HYPRE_BoomerAMGSetCycleRelaxType(solver, grid_relax_type[k], k);
+      HYPRE_BoomerAMGSetCycleNumSweeps(solver, num_grid_sweeps[k], k);
+   }
+   HYPRE_BoomerAMGSetRelaxOrder(solver, hypre_ParAMGDataRelaxOrder(amg_data));
+   HYPRE_BoomerAMGSetRelaxWt(solver, hypre_ParAMGDataUserRelaxWeight(amg_data));
+   HYPRE_BoomerAMGSetFSAIAlgoType(solver, hypre_ParAMGDataFSAIAlgoType(amg_data));
+   HYPRE_BoomerAMGSetFSAIMaxSteps(solver, hypre_ParAMGDataFSAIMaxSteps(amg_data));
+   HYPRE_BoomerAMGSetFSAIMaxStepSize(solver, hypre_ParAMGDataFSAIMaxStepSize(amg_data));
+   HYPRE_BoomerAMGSetFSAIKapTolerance(solver, hypre_ParAMGDataFSAIKapTolerance(amg_data));
+   HYPRE_BoomerAMGSetFSAIEigMaxIters(solver, hypre_ParAMGDataFSAIEigMaxIters(amg_data));
+   HYPRE_BoomerAMGSetFusedCycle(solver, hypre_ParAMGDataFusedCycle(amg_data));
+   HYPRE_BoomerAMGSetCycleMinRowsPerThread(solver,
+                                           hypre_ParAMGDataCycleMinRowsPerThread(amg_data));
+
+   HYPRE_BoomerAMGSetMaxIter(solver, 1);
+   HYPRE_BoomerAMGSetTol(solver, 0);
+
+   return solver;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateSetup
+ *
+ * Gathers A_array[level] on one process out of every agglom_factor and sets
+ * up the BoomerAMG hierarchy of the agglomerated matrix.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateSetup( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         level )
+{
+   hypre_ParCSRMatrix *A              = hypre_ParAMGDataAArray(amg_data)[level];
+   MPI_Comm            comm           = hypre_ParCSRMatrixComm(A);
+   HYPRE_Int           agglom_factor  = hypre_ParAMGDataAgglomFactor(amg_data);
+   HYPRE_Int           num_functions  = hypre_ParAMGDataNumFunctions(amg_data);
+
+   hypre_CSRMatrix    *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int          *A_diag_j       = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real         *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix    *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int          *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real         *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_BigInt       *col_map_offd   = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_BigInt        first_row      = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_BigInt        global_size    = hypre_ParCSRMatrixGlobalNumRows(A);
+   HYPRE_Int           num_rows       = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_nonzeros   = A_diag_i[num_rows] + A_offd_i[num_rows];
+
+   MPI_Comm            group_comm, new_comm;
+   HYPRE_Int           num_procs, my_id, group_size, group_id;
+
+   HYPRE_Int          *row_len, *counts = NULL, *displs = NULL;
+   HYPRE_Int          *nnz_counts = NULL, *nnz_displs = NULL;
+   HYPRE_Int          *agg_row_len = NULL, *agg_dof_func = NULL;
+   HYPRE_BigInt       *send_j, *agg_j = NULL;
+   HYPRE_Real         *send_data, *agg_data = NULL;
+   HYPRE_Int           i, j, jj, cnt, agg_num_rows = 0;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   hypre_MPI_Comm_split(comm, my_id / agglom_factor, my_id, &group_comm);
+   hypre_MPI_Comm_size(group_comm, &group_size);
+   hypre_MPI_Comm_rank(group_comm, &group_id);
+   hypre_MPI_Comm_split(comm, group_id ? hypre_MPI_UNDEFINED : 0, my_id, &new_comm);
+
+   /*-----------------------------------------------------------------------
+    * Rows of the group in global column indices, gathered on the leader
+    *-----------------------------------------------------------------------*/
+
+   row_len   = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   send_j    = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros, HYPRE_MEMORY_HOST);
+   send_data = hypre_CTAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+
+   cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      row_len[i] = A_diag_i[i+1] - A_diag_i[i] + A_offd_i[i+1] - A_offd_i[i];
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         send_j[cnt]      = first_row + (HYPRE_BigInt) A_diag_j[jj];
+         send_data[cnt++] = A_diag_data[jj];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         send_j[cnt]      = col_map_offd[A_offd_j[jj]];
+         send_data[cnt++] = A_offd_data[jj];
+      }
+   }
+
+   if (group_id == 0)
+   {
+      /* counts and displs of the group's rows, kept for the cycle */
+      counts     = hypre_CTAlloc(HYPRE_Int, 2*group_size + 1, HYPRE_MEMORY_HOST);
+      displs     = counts + group_size;
+      nnz_counts = hypre_CTAlloc(HYPRE_Int, group_size, HYPRE_MEMORY_HOST);
+      nnz_displs = hypre_CTAlloc(HYPRE_Int, group_size + 1, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_MPI_Gather(&num_rows, 1, HYPRE_MPI_INT, counts, 1, HYPRE_MPI_INT, 0, group_comm);
+
+   if (group_id == 0)
+   {
+      displs[0] = 0;
+      for (i = 0; i < group_size; i++)
+      {
+         displs[i+1] = displs[i] + counts[i];
+      }
+      agg_num_rows = displs[group_size];
+      agg_row_len  = hypre_CTAlloc(HYPRE_Int, agg_num_rows + 1, HYPRE_MEMORY_HOST);
+      if (num_functions > 1)
+      {
+         agg_dof_func = hypre_CTAlloc(HYPRE_Int, agg_num_rows, HYPRE_MEMORY_HOST);
+      }
+   }
+
+   hypre_MPI_Gatherv(row_len, num_rows, HYPRE_MPI_INT,
+                     agg_row_len, counts, displs, HYPRE_MPI_INT, 0, group_comm);
+   if (num_functions > 1)
+   {
+      hypre_MPI_Gatherv(hypre_ParAMGDataDofFuncArray(amg_data)[level], num_rows, HYPRE_MPI_INT,
+                        agg_dof_func, counts, displs, HYPRE_MPI_INT, 0, group_comm);
+   }
+
+   if (group_id == 0)
+   {
+      nnz_displs[0] = 0;
+      for (i = 0; i < group_size; i++)
+      {
+         nnz_counts[i] = 0;
+         for (j = displs[i]; j < displs[i+1]; j++)
+         {
+            nnz_counts[i] += agg_row_len[j];
+         }
+         nnz_displs[i+1] = nnz_displs[i] + nnz_counts[i];
+      }
+      agg_j    = hypre_CTAlloc(HYPRE_BigInt, nnz_displs[group_size], HYPRE_MEMORY_HOST);
+      agg_data = hypre_CTAlloc(HYPRE_Real, nnz_displs[group_size], HYPRE_MEMORY_HOST);
+   }
+
+   hypre_MPI_Gatherv(send_j, num_nonzeros, HYPRE_MPI_BIG_INT,
+                     agg_j, nnz_counts, nnz_displs, HYPRE_MPI_BIG_INT, 0, group_comm);
+   hypre_MPI_Gatherv(send_data, num_nonzeros, HYPRE_MPI_REAL,
+                     agg_data, nnz_counts, nnz_displs, HYPRE_MPI_REAL, 0, group_comm);
+
+   hypre_TFree(row_len, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    * Agglomerated matrix and its hierarchy on the leaders
+    *-----------------------------------------------------------------------*/
+
+   if (group_id == 0)
+   {
+      hypre_ParCSRMatrix *A_agg;
+      hypre_ParVector    *F_agg, *U_agg;
+      hypre_CSRMatrix    *agg_diag, *agg_offd;
+      HYPRE_Int          *agg_diag_i, *agg_diag_j, *agg_offd_i, *agg_offd_j;
+      HYPRE_Real         *agg_diag_data, *agg_offd_data;
+      HYPRE_BigInt       *agg_col_map, *row_starts;
+      HYPRE_BigInt        last_row = first_row + (HYPRE_BigInt) agg_num_rows - 1;
+      HYPRE_Int           total_nnz = nnz_displs[group_size];
+      HYPRE_Int           num_cols_offd = 0, nnz_diag = 0, nnz_offd, cd, co;
+      HYPRE_Solver        solver;
+
+#ifdef HYPRE_NO_GLOBAL_PARTITION
+      row_starts = hypre_CTAlloc(HYPRE_BigInt, 2, HYPRE_MEMORY_HOST);
+      row_starts[0] = first_row;
+      row_starts[1] = last_row + 1;
+#else
+      {
+         HYPRE_BigInt *A_row_starts = hypre_ParCSRMatrixRowStarts(A);
+         HYPRE_Int     num_groups   = (num_procs + agglom_factor - 1) / agglom_factor;
+
+         row_starts = hypre_CTAlloc(HYPRE_BigInt, num_groups + 1, HYPRE_MEMORY_HOST);
+         for (i = 0; i < num_groups; i++)
+         {
+            row_starts[i] = A_row_starts[i * agglom_factor];
+         }
+         row_starts[num_groups] = A_row_starts[num_procs];
+      }
+#endif
+
+      /* sorted, unique off-processor columns */
+      agg_col_map = hypre_CTAlloc(HYPRE_BigInt, total_nnz, HYPRE_MEMORY_HOST);
+      for (jj = 0; jj < total_nnz; jj++)
+      {
+         if (agg_j[jj] < first_row || agg_j[jj] > last_row)
+         {
+            agg_col_map[num_cols_offd++] = agg_j[jj];
+         }
+         else
+         {
+            nnz_diag++;
+         }
+      }
+      nnz_offd = num_cols_offd;
+      if (num_cols_offd > 1)
+      {
+         hypre_BigQsort0(agg_col_map, 0, num_cols_offd - 1);
+         cnt = 1;
+         for (i = 1; i < num_cols_offd; i++)
+         {
+            if (agg_col_map[i] > agg_col_map[cnt-1])
+            {
+               agg_col_map[cnt++] = agg_col_map[i];
+            }
+         }
+         num_cols_offd = cnt;
+      }
+
+      A_agg = hypre_ParCSRMatrixCreate(new_comm, global_size, global_size,
+                                       row_starts, row_starts,
+                                       num_cols_offd, nnz_diag, nnz_offd);
+      hypre_ParCSRMatrixInitialize(A_agg);
+
+      agg_diag      = hypre_ParCSRMatrixDiag(A_agg);
+      agg_diag_i    = hypre_CSRMatrixI(agg_diag);
+      agg_diag_j    = hypre_CSRMatrixJ(agg_diag);
+      agg_diag_data = hypre_CSRMatrixData(agg_diag);
+      agg_offd      = hypre_ParCSRMatrixOffd(A_agg);
+      agg_offd_i    = hypre_CSRMatrixI(agg_offd);
+      agg_offd_j    = hypre_CSRMatrixJ(agg_offd);
+      agg_offd_data = hypre_CSRMatrixData(agg_offd);
+
+      /* the gathered rows keep their order, so the diagonal stays first */
+      cd = 0;
+      co = 0;
+      jj = 0;
+      for (i = 0; i < agg_num_rows; i++)
+      {
+         agg_diag_i[i] = cd;
+         agg_offd_i[i] = co;
+         for (j = 0; j < agg_row_len[i]; j++, jj++)
+         {
+            if (agg_j[jj] < first_row || agg_j[jj] > last_row)
+            {
+               agg_offd_j[co] = hypre_BigBinarySearch(agg_col_map, agg_j[jj], num_cols_offd);
+               agg_offd_data[co++] = agg_data[jj];
+            }
+            else
+            {
+               agg_diag_j[cd] = (HYPRE_Int) (agg_j[jj] - first_row);
+               agg_diag_data[cd++] = agg_data[jj];
+            }
+         }
+      }
+      agg_diag_i[agg_num_rows] = cd;
+      agg_offd_i[agg_num_rows] = co;
+
+      hypre_TMemcpy(hypre_ParCSRMatrixColMapOffd(A_agg), agg_col_map, HYPRE_BigInt,
+                    num_cols_offd, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_ParCSRMatrixSetNumNonzeros(A_agg);
+      hypre_MatvecCommPkgCreate(A_agg);
+
+      F_agg = hypre_ParVectorCreate(new_comm, global_size, row_starts);
+      U_agg = hypre_ParVectorCreate(new_comm, global_size, row_starts);
+      hypre_ParVectorOwnsPartitioning(F_agg) = 0;
+      hypre_ParVectorOwnsPartitioning(U_agg) = 0;
+      hypre_ParVectorInitialize(F_agg);
+      hypre_ParVectorInitialize(U_agg);
+
+      solver = hypre_BoomerAMGAgglomerateCreateSolver(amg_data, level);
+      if (num_functions > 1)
+      {
+         HYPRE_BoomerAMGSetDofFunc(solver, agg_dof_func);
+      }
+      hypre_BoomerAMGSetup(solver, A_agg, F_agg, U_agg);
+
+      hypre_ParAMGDataCoarseSolver(amg_data) = solver;
+      hypre_ParAMGDataACoarse(amg_data) = A_agg;
+      hypre_ParAMGDataFCoarse(amg_data) = F_agg;
+      hypre_ParAMGDataUCoarse(amg_data) = U_agg;
+
+      hypre_TFree(agg_col_map, HYPRE_MEMORY_HOST);
+      hypre_TFree(agg_row_len, HYPRE_MEMORY_HOST);
+      hypre_TFree(agg_j, HYPRE_MEMORY_HOST);
+      hypre_TFree(agg_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_displs, HYPRE_MEMORY_HOST);
+   }
+
+   hypre_ParAMGDataAgglomerated(amg_data) = 1;
+   hypre_ParAMGDataAgglomComm(amg_data) = group_comm;
+   hypre_ParAMGDataAgglomCounts(amg_data) = counts;
+   hypre_ParAMGDataNewComm(amg_data) = new_comm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateResetup
+ *
+ * Numeric-only resetup of an agglomerated level: gathers the new values of
+ * A_array[level], whose sparsity is the one of the last
+ * hypre_BoomerAMGAgglomerateSetup, into the agglomerated matrix on the
+ * leaders, and resets up its hierarchy with setup type 2.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateResetup( hypre_ParAMGData *amg_data,
+                                   HYPRE_Int         level )
+{
+   hypre_ParCSRMatrix *A              = hypre_ParAMGDataAArray(amg_data)[level];
+   MPI_Comm            group_comm     = hypre_ParAMGDataAgglomComm(amg_data);
+   HYPRE_Int          *counts         = hypre_ParAMGDataAgglomCounts(amg_data);
+
+   hypre_CSRMatrix    *A_diag         = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int          *A_diag_i       = hypre_CSRMatrixI(A_diag);
+   HYPRE_Real         *A_diag_data    = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix    *A_offd         = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int          *A_offd_i       = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int          *A_offd_j       = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real         *A_offd_data    = hypre_CSRMatrixData(A_offd);
+   HYPRE_BigInt       *col_map_offd   = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int           num_rows       = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int           num_nonzeros   = A_diag_i[num_rows] + A_offd_i[num_rows];
+
+   HYPRE_BigInt        range[2], group_range[2];
+   HYPRE_Int          *nnz_counts = NULL, *nnz_displs = NULL;
+   HYPRE_Real         *send_data, *agg_data = NULL;
+   HYPRE_Int           group_size, group_id;
+   HYPRE_Int           i, jj, cnt;
+
+   hypre_MPI_Comm_size(group_comm, &group_size);
+   hypre_MPI_Comm_rank(group_comm, &group_id);
+
+   /* rows of the group: columns in this range are in the diag part of the
+      agglomerated matrix */
+   range[0] =   hypre_ParCSRMatrixFirstRowIndex(A);
+   range[1] = -(hypre_ParCSRMatrixFirstRowIndex(A) + (HYPRE_BigInt) num_rows - 1);
+   hypre_MPI_Allreduce(range, group_range, 2, HYPRE_MPI_BIG_INT, hypre_MPI_MIN, group_comm);
+   group_range[1] = -group_range[1];
+
+   /* values of each row in the order of the agglomerated row: diag part,
+      then offd part, each in the order of hypre_BoomerAMGAgglomerateSetup */
+   send_data = hypre_CTAlloc(HYPRE_Real, num_nonzeros, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+      {
+         send_data[cnt++] = A_diag_data[jj];
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         if (col_map_offd[A_offd_j[jj]] >= group_range[0] &&
+             col_map_offd[A_offd_j[jj]] <= group_range[1])
+         {
+            send_data[cnt++] = A_offd_data[jj];
+         }
+      }
+      for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+      {
+         if (col_map_offd[A_offd_j[jj]] < group_range[0] ||
+             col_map_offd[A_offd_j[jj]] > group_range[1])
+         {
+            send_data[cnt++] = A_offd_data[jj];
+         }
+      }
+   }
+
+   if (counts)
+   {
+      nnz_counts = hypre_CTAlloc(HYPRE_Int, group_size, HYPRE_MEMORY_HOST);
+      nnz_displs = hypre_CTAlloc(HYPRE_Int, group_size + 1, HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gather(&num_nonzeros, 1, HYPRE_MPI_INT, nnz_counts, 1, HYPRE_MPI_INT, 0, group_comm);
+   if (counts)
+   {
+      for (i = 0; i < group_size; i++)
+      {
+         nnz_displs[i+1] = nnz_displs[i] + nnz_counts[i];
+      }
+      agg_data = hypre_CTAlloc(HYPRE_Real, nnz_displs[group_size], HYPRE_MEMORY_HOST);
+   }
+   hypre_MPI_Gatherv(send_data, num_nonzeros, HYPRE_MPI_REAL,
+                     agg_data, nnz_counts, nnz_displs, HYPRE_MPI_REAL, 0, group_comm);
+   hypre_TFree(send_data, HYPRE_MEMORY_HOST);
+
+   if (counts)
+   {
+      HYPRE_Solver        solver   = (HYPRE_Solver) hypre_ParAMGDataCoarseSolver(amg_data);
+      hypre_ParCSRMatrix *A_agg    = hypre_ParAMGDataACoarse(amg_data);
+      hypre_CSRMatrix    *agg_diag = hypre_ParCSRMatrixDiag(A_agg);
+      hypre_CSRMatrix    *agg_offd = hypre_ParCSRMatrixOffd(A_agg);
+      HYPRE_Int          *agg_diag_i = hypre_CSRMatrixI(agg_diag);
+      HYPRE_Int          *agg_offd_i = hypre_CSRMatrixI(agg_offd);
+      HYPRE_Real         *agg_diag_data = hypre_CSRMatrixData(agg_diag);
+      HYPRE_Real         *agg_offd_data = hypre_CSRMatrixData(agg_offd);
+
+      cnt = 0;
+      for (i = 0; i < hypre_CSRMatrixNumRows(agg_diag); i++)
+      {
+         for (jj = agg_diag_i[i]; jj < agg_diag_i[i+1]; jj++)
+         {
+            agg_diag_data[jj] = agg_data[cnt++];
+         }
+         for (jj = agg_offd_i[i]; jj < agg_offd_i[i+1]; jj++)
+         {
+            agg_offd_data[jj] = agg_data[cnt++];
+         }
+      }
+      hypre_CSRMatrixClearSELL(agg_diag);
+      hypre_CSRMatrixClearSELL(agg_offd);
+
+      HYPRE_BoomerAMGSetSetupType(solver, 2);
+      hypre_BoomerAMGSetup(solver, A_agg, hypre_ParAMGDataFCoarse(amg_data),
+                           hypre_ParAMGDataUCoarse(amg_data));
+
+      hypre_TFree(agg_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_counts, HYPRE_MEMORY_HOST);
+      hypre_TFree(nnz_displs, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateCycle
+ *
+ * Coarsest-level solve of an agglomerated hierarchy: gathers f and u on the
+ * leaders, runs one cycle of the agglomerated hierarchy there, and scatters
+ * the new u back.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateCycle( hypre_ParAMGData *amg_data,
+                                 HYPRE_Int         level,
+                                 hypre_ParVector **F_array,
+                                 hypre_ParVector **U_array )
+{
+   MPI_Comm          group_comm = hypre_ParAMGDataAgglomComm(amg_data);
+   HYPRE_Int        *counts     = hypre_ParAMGDataAgglomCounts(amg_data);
+   hypre_ParVector  *F_agg      = hypre_ParAMGDataFCoarse(amg_data);
+   hypre_ParVector  *U_agg      = hypre_ParAMGDataUCoarse(amg_data);
+   HYPRE_Real       *f_data     = hypre_VectorData(hypre_ParVectorLocalVector(F_array[level]));
+   HYPRE_Real       *u_data     = hypre_VectorData(hypre_ParVectorLocalVector(U_array[level]));
+   HYPRE_Int         n          = hypre_VectorSize(hypre_ParVectorLocalVector(U_array[level]));
+   HYPRE_Real       *f_agg_data = NULL, *u_agg_data = NULL;
+   HYPRE_Int        *displs     = NULL;
+   HYPRE_Int         group_size;
+
+   if (counts)
+   {
+      hypre_MPI_Comm_size(group_comm, &group_size);
+      displs     = counts + group_size;
+      f_agg_data = hypre_VectorData(hypre_ParVectorLocalVector(F_agg));
+      u_agg_data = hypre_VectorData(hypre_ParVectorLocalVector(U_agg));
+   }
+
+   hypre_MPI_Gatherv(f_data, n, HYPRE_MPI_REAL,
+                     f_agg_data, counts, displs, HYPRE_MPI_REAL, 0, group_comm);
+   hypre_MPI_Gatherv(u_data, n, HYPRE_MPI_REAL,
+                     u_agg_data, counts, displs, HYPRE_MPI_REAL, 0, group_comm);
+
+   if (counts)
+   {
+      hypre_BoomerAMGSolve(hypre_ParAMGDataCoarseSolver(amg_data),
+                           hypre_ParAMGDataACoarse(amg_data), F_agg, U_agg);
+   }
+
+   hypre_MPI_Scatterv(u_agg_data, counts, displs, HYPRE_MPI_REAL,
+                      u_data, n, HYPRE_MPI_REAL, 0, group_comm);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGAgglomerateDestroy
+ *
+ * Frees the group communicator and counts of hypre_BoomerAMGAgglomerateSetup.
+ * The coarse solver, matrix, vectors and hypre_ParAMGDataNewComm are freed
+ * with those of the redundant coarse grid solve.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGAgglomerateDestroy( hypre_ParAMGData *amg_data )
+{
+   if (hypre_ParAMGDataAgglomComm(amg_data) != hypre_MPI_COMM_NULL)
+   {
+      hypre_MPI_Comm_free(&hypre_ParAMGDataAgglomComm(amg_data));
+      hypre_ParAMGDataAgglomComm(amg_data) = hypre_MPI_COMM_NULL;
+   }
+   hypre_TFree(hypre_ParAMGDataAgglomCounts(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataAgglomCounts(amg_data) = NULL;
+   hypre_ParAMGDataAgglomerated(amg_data) = 0;
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,184 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Reduced-storage BoomerAMG hierarchy
+ *
+ * After setup, the level matrices can keep their values in single precision
+ * (from hypre_ParAMGDataMixedPrecisionLevel on) and their column indices
+ * compressed (hypre_ParAMGDataCompressColumns).  The level matrices and the
+ * transfer operators are read-only during the solve phase; the matvecs and
+ * hypre_BoomerAMGRelax detect the reduced storage and use their dedicated
+ * kernels, so the cycle itself is unchanged.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReducedStorageRelaxSupported
+ *
+ * Returns 1 if relax_type has a reduced-storage kernel
+ * (hypre_BoomerAMGRelaxReducedStorage) for the given level.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGReducedStorageRelaxSupported( hypre_ParAMGData *amg_data,
+                                             HYPRE_Int         level,
+                                             HYPRE_Int         relax_type )
+{
+   HYPRE_Real   *relax_weight = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real   *omega        = hypre_ParAMGDataOmega(amg_data);
+   hypre_Vector **l1_norms    = hypre_ParAMGDataL1Norms(amg_data);
+
+   switch (relax_type)
+   {
+      case 0:
+         return 1;
+
+      case 3:
+      case 4:
+      case 6:
+         return (relax_weight[level] == 1.0 && omega[level] == 1.0);
+
+      case 8:
+      case 13:
+      case 14:
+         return (relax_weight[level] == 1.0 && omega[level] == 1.0 &&
+                 l1_norms != NULL && l1_norms[level] != NULL);
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReducedStorageSetup
+ *
+ * Converts the eligible levels of the hierarchy to single-precision values
+ * and/or compressed column indices.  Called at the end of
+ * hypre_BoomerAMGSetup.  Level 0 belongs to the caller and the coarsest level
+ * to the coarse-grid solver, so their matrices are left untouched.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReducedStorageSetup( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            float_level     = hypre_ParAMGDataMixedPrecisionLevel(amg_data);
+   HYPRE_Int            compress        = hypre_ParAMGDataCompressColumns(amg_data);
+   HYPRE_Int            additive        = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int            mult_additive   = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int            simple          = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int            level, relax_supported;
+
+#if defined(HYPRE_SINGLE) || defined(HYPRE_COMPLEX)
+   float_level = 0;
+#endif
+
+   if ( (float_level < 1 && !compress) ||
+        hypre_ParAMGDataBlockMode(amg_data) ||
+        (additive      >= 0 && additive      < num_levels) ||
+        (mult_additive >= 0 && mult_additive < num_levels) ||
+        (simple        >= 0 && simple        < num_levels) )
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_array[level])) !=
+          hypre_MEMORY_HOST)
+      {
+         break;
+      }
+
+      relax_supported =
+         level > 0 &&
+         hypre_ParAMGDataSmoothNumLevels(amg_data) <= level &&
+         hypre_BoomerAMGReducedStorageRelaxSupported(amg_data, level, grid_relax_type[1]) &&
+         hypre_BoomerAMGReducedStorageRelaxSupported(amg_data, level, grid_relax_type[2]);
+
+      if (float_level > 0 && level >= float_level)
+      {
+         if (relax_supported)
+         {
+            hypre_ParCSRMatrixConvertToFloat(A_array[level]);
+         }
+         hypre_ParCSRMatrixConvertToFloat(P_array[level]);
+         if (R_array[level])
+         {
+            hypre_ParCSRMatrixConvertToFloat(R_array[level]);
+         }
+      }
+
+      if (compress)
+      {
+         if (relax_supported)
+         {
+            hypre_ParCSRMatrixCompressColumns(A_array[level]);
+         }
+         hypre_ParCSRMatrixCompressColumns(P_array[level]);
+         if (R_array[level])
+         {
+            hypre_ParCSRMatrixCompressColumns(R_array[level]);
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGReducedStorageRestore
+ *
+ * Brings all levels back to full-precision values and plain column indices,
+ * e.g., before a numeric-only resetup recomputes them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGReducedStorageRestore( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array    = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            level;
+
+   if (!A_array)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 1; level < num_levels; level++)
+   {
+      if (A_array[level])
+      {
+         hypre_ParCSRMatrixConvertFromFloat(A_array[level]);
+         hypre_ParCSRMatrixDecompressColumns(A_array[level]);
+      }
+   }
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (P_array && P_array[level])
+      {
+         hypre_ParCSRMatrixConvertFromFloat(P_array[level]);
+         hypre_ParCSRMatrixDecompressColumns(P_array[level]);
+      }
+      if (R_array && R_array[level])
+      {
+         hypre_ParCSRMatrixConvertFromFloat(R_array[level]);
+         hypre_ParCSRMatrixDecompressColumns(R_array[level]);
+      }
+   }
+
+   return hypre_error_flag;
+}
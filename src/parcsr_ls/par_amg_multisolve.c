@@ -0,0 +1,1096 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * AMG solve routine for multiple right-hand sides
+ *
+ * All right-hand sides are cycled together on interleaved multivectors
+ * (multivec_storage_method = 1), so that every matvec, relaxation sweep,
+ * restriction and interpolation traverses the matrix once for all vectors
+ * and every halo exchange sends one message per neighbor for all vectors.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+#include "../parcsr_block_mv/par_csr_block_matrix.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGMultiVectorCreate
+ *
+ * Creates an interleaved multivector with the row partitioning of x.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParVector *
+hypre_ParAMGMultiVectorCreate( hypre_ParVector *x,
+                               HYPRE_Int        num_vectors )
+{
+   hypre_ParVector *y;
+
+   y = hypre_ParMultiVectorCreate(hypre_ParVectorComm(x),
+                                  hypre_ParVectorGlobalSize(x),
+                                  hypre_ParVectorPartitioning(x),
+                                  num_vectors);
+   hypre_ParVectorSetPartitioningOwner(y, 0);
+   hypre_VectorMultiVecStorageMethod(hypre_ParVectorLocalVector(y)) = 1;
+   hypre_ParVectorInitialize_v2(y, HYPRE_MEMORY_HOST);
+
+   return y;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGMultiVectorGetColumn, hypre_ParAMGMultiVectorSetColumn
+ *
+ * Copy column j of the multivector x (any storage method) into the
+ * single vector y, and back.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParAMGMultiVectorGetColumn( hypre_ParVector *x,
+                                  HYPRE_Int        j,
+                                  hypre_ParVector *y )
+{
+   hypre_Vector  *x_local   = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data    = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data    = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int      size      = hypre_VectorSize(x_local);
+   HYPRE_Int      vecstride = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      i;
+
+   for (i = 0; i < size; i++)
+   {
+      y_data[i] = x_data[j*vecstride + i*idxstride];
+   }
+
+   return hypre_error_flag;
+}
+
+static HYPRE_Int
+hypre_ParAMGMultiVectorSetColumn( hypre_ParVector *x,
+                                  HYPRE_Int        j,
+                                  hypre_ParVector *y )
+{
+   hypre_Vector  *x_local   = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data    = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data    = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   HYPRE_Int      size      = hypre_VectorSize(x_local);
+   HYPRE_Int      vecstride = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      idxstride = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      i;
+
+   for (i = 0; i < size; i++)
+   {
+      x_data[j*vecstride + i*idxstride] = y_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGMultiVectorCopy
+ *
+ * y = x for multivectors of possibly different storage methods.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParAMGMultiVectorCopy( hypre_ParVector *x,
+                             hypre_ParVector *y )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   hypre_Vector  *y_local     = hypre_ParVectorLocalVector(y);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Complex *y_data      = hypre_VectorData(y_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Int      vs_x = hypre_VectorVectorStride(x_local);
+   HYPRE_Int      is_x = hypre_VectorIndexStride(x_local);
+   HYPRE_Int      vs_y = hypre_VectorVectorStride(y_local);
+   HYPRE_Int      is_y = hypre_VectorIndexStride(y_local);
+   HYPRE_Int      i, j;
+
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         y_data[j*vs_y + i*is_y] = x_data[j*vs_x + i*is_x];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGMultiVectorColumnNorms
+ *
+ * norms[j] = ||x(:,j)||_2 for an interleaved multivector x.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParAMGMultiVectorColumnNorms( hypre_ParVector *x,
+                                    HYPRE_Real      *norms )
+{
+   hypre_Vector  *x_local     = hypre_ParVectorLocalVector(x);
+   HYPRE_Complex *x_data      = hypre_VectorData(x_local);
+   HYPRE_Int      size        = hypre_VectorSize(x_local);
+   HYPRE_Int      num_vectors = hypre_VectorNumVectors(x_local);
+   HYPRE_Real    *local_norms;
+   HYPRE_Int      i, j;
+
+   local_norms = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < size; i++)
+   {
+      for (j = 0; j < num_vectors; j++)
+      {
+         local_norms[j] += x_data[i*num_vectors + j] * x_data[i*num_vectors + j];
+      }
+   }
+
+   hypre_MPI_Allreduce(local_norms, norms, num_vectors, HYPRE_MPI_REAL,
+                       hypre_MPI_SUM, hypre_ParVectorComm(x));
+
+   for (j = 0; j < num_vectors; j++)
+   {
+      norms[j] = sqrt(norms[j]);
+   }
+
+   hypre_TFree(local_norms, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParAMGMultiBuffer
+ *
+ * Returns the buffer *buf_ptr of at least size entries, reallocating it
+ * only when it is too small. The buffers live in amg_data and are freed by
+ * hypre_BoomerAMGDestroy.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Complex *
+hypre_ParAMGMultiBuffer( HYPRE_Complex **buf_ptr,
+                         HYPRE_Int      *buf_size_ptr,
+                         HYPRE_Int       size )
+{
+   if (size > *buf_size_ptr)
+   {
+      hypre_TFree(*buf_ptr, HYPRE_MEMORY_HOST);
+      *buf_ptr = hypre_TAlloc(HYPRE_Complex, size, HYPRE_MEMORY_HOST);
+      *buf_size_ptr = size;
+   }
+
+   return *buf_ptr;
+}
+
+#define hypre_ParAMGMultiSendBuffer(amg_data, size) \
+   hypre_ParAMGMultiBuffer(&hypre_ParAMGDataMultiSendBuf(amg_data), \
+                           &hypre_ParAMGDataMultiSendBufSize(amg_data), size)
+#define hypre_ParAMGMultiRecvBuffer(amg_data, size) \
+   hypre_ParAMGMultiBuffer(&hypre_ParAMGDataMultiRecvBuf(amg_data), \
+                           &hypre_ParAMGDataMultiRecvBufSize(amg_data), size)
+#define hypre_ParAMGMultiWorkBuffer(amg_data, size) \
+   hypre_ParAMGMultiBuffer(&hypre_ParAMGDataMultiWorkBuf(amg_data), \
+                           &hypre_ParAMGDataMultiWorkBufSize(amg_data), size)
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMultiHaloStart, hypre_ParCSRMatrixMultiHaloFinish
+ *
+ * Exchange the off-processor entries of an interleaved multivector x that
+ * are needed by A. The values of all vectors for one neighbor travel in a
+ * single message. The send buffer is the one cached in amg_data, and x_ext
+ * must hold num_cols_offd*num_vectors entries.
+ *--------------------------------------------------------------------------*/
+
+static hypre_ParCSRCommHandle *
+hypre_ParCSRMatrixMultiHaloStart( hypre_ParAMGData    *amg_data,
+                                  hypre_ParCSRMatrix  *A,
+                                  hypre_ParVector     *x,
+                                  HYPRE_Complex       *x_ext )
+{
+   hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   HYPRE_Complex       *x_data = hypre_VectorData(hypre_ParVectorLocalVector(x));
+   HYPRE_Int            num_vectors = hypre_ParVectorNumVectors(x);
+   HYPRE_Complex       *buf, *x_row;
+   HYPRE_Int            num_sends, begin, end, i, j;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   buf = hypre_ParAMGMultiSendBuffer(amg_data, (end - begin)*num_vectors);
+
+   for (i = begin; i < end; i++)
+   {
+      x_row = x_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)*num_vectors;
+      for (j = 0; j < num_vectors; j++)
+      {
+         buf[(i - begin)*num_vectors + j] = x_row[j];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_ParCSRBlockCommHandleCreate(1, num_vectors, comm_pkg, buf, x_ext);
+}
+
+static HYPRE_Int
+hypre_ParCSRMatrixMultiHaloFinish( hypre_ParCSRCommHandle *comm_handle )
+{
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRBlockCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMultiMatvecOutOfPlace
+ *
+ * y = alpha*A*x + beta*b for interleaved multivectors x, b, y.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMultiMatvecOutOfPlace( hypre_ParAMGData   *amg_data,
+                                         HYPRE_Complex       alpha,
+                                         hypre_ParCSRMatrix *A,
+                                         hypre_ParVector    *x,
+                                         HYPRE_Complex       beta,
+                                         hypre_ParVector    *b,
+                                         hypre_ParVector    *y )
+{
+   hypre_CSRMatrix        *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int               num_vectors = hypre_ParVectorNumVectors(x);
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_Vector           *x_ext;
+
+   /* x_ext wraps the cached receive buffer */
+   x_ext = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(x_ext) = 1;
+   hypre_VectorData(x_ext) = hypre_ParAMGMultiRecvBuffer(amg_data, num_cols_offd*num_vectors);
+   hypre_VectorOwnsData(x_ext) = 0;
+   hypre_SeqVectorInitialize_v2(x_ext, HYPRE_MEMORY_HOST);
+
+   comm_handle = hypre_ParCSRMatrixMultiHaloStart(amg_data, A, x, hypre_VectorData(x_ext));
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecOutOfPlace(alpha, diag, hypre_ParVectorLocalVector(x), beta,
+                                   hypre_ParVectorLocalVector(b),
+                                   hypre_ParVectorLocalVector(y), 0);
+
+   hypre_ParCSRMatrixMultiHaloFinish(comm_handle);
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvec(alpha, offd, x_ext, 1.0, hypre_ParVectorLocalVector(y));
+   }
+
+   hypre_SeqVectorDestroy(x_ext);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixMultiMatvecT
+ *
+ * y = alpha*A^T*x + beta*y for interleaved multivectors x, y.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRMatrixMultiMatvecT( hypre_ParAMGData   *amg_data,
+                                HYPRE_Complex       alpha,
+                                hypre_ParCSRMatrix *A,
+                                hypre_ParVector    *x,
+                                HYPRE_Complex       beta,
+                                hypre_ParVector    *y )
+{
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_CSRMatrix        *diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix        *offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int               num_cols_offd = hypre_CSRMatrixNumCols(offd);
+   HYPRE_Int               num_vectors = hypre_ParVectorNumVectors(x);
+   HYPRE_Complex          *y_data = hypre_VectorData(hypre_ParVectorLocalVector(y));
+   hypre_ParCSRCommHandle *comm_handle;
+   hypre_Vector           *y_ext;
+   HYPRE_Complex          *buf, *y_row;
+   HYPRE_Int               num_sends, begin, end, i, j;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+
+   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+   end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+   /* y_ext wraps the cached send buffer, buf is the receive buffer */
+   y_ext = hypre_SeqMultiVectorCreate(num_cols_offd, num_vectors);
+   hypre_VectorMultiVecStorageMethod(y_ext) = 1;
+   hypre_VectorData(y_ext) = hypre_ParAMGMultiSendBuffer(amg_data, num_cols_offd*num_vectors);
+   hypre_VectorOwnsData(y_ext) = 0;
+   hypre_SeqVectorInitialize_v2(y_ext, HYPRE_MEMORY_HOST);
+
+   if (num_cols_offd)
+   {
+      hypre_CSRMatrixMatvecT(alpha, offd, hypre_ParVectorLocalVector(x), 0.0, y_ext);
+   }
+
+   buf = hypre_ParAMGMultiRecvBuffer(amg_data, (end - begin)*num_vectors);
+
+   comm_handle = hypre_ParCSRBlockCommHandleCreate(2, num_vectors, comm_pkg,
+                                                   hypre_VectorData(y_ext), buf);
+
+   /* overlapped local computation */
+   hypre_CSRMatrixMatvecT(alpha, diag, hypre_ParVectorLocalVector(x), beta,
+                          hypre_ParVectorLocalVector(y));
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+
+   hypre_ParCSRBlockCommHandleDestroy(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+
+   for (i = begin; i < end; i++)
+   {
+      y_row = y_data + hypre_ParCSRCommPkgSendMapElmt(comm_pkg, i)*num_vectors;
+      for (j = 0; j < num_vectors; j++)
+      {
+         y_row[j] += buf[(i - begin)*num_vectors + j];
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+   hypre_SeqVectorDestroy(y_ext);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelax
+ *
+ * One relaxation sweep on interleaved multivectors. Supported are weighted
+ * Jacobi (0) and hybrid Gauss-Seidel in the forward (3, 13), backward
+ * (4, 14) and symmetric (6, 8) variants, where the l1 variants (8, 13, 14)
+ * divide by the l1 norms. The Gauss-Seidel variants assume unit weights.
+ *
+ * The local rows are split into one block per thread as in
+ * hypre_BoomerAMGRelax: within a block the Gauss-Seidel sweeps use the new
+ * values, across blocks the values from before the sweep.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiRelax( hypre_ParAMGData   *amg_data,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           HYPRE_Int          *cf_marker,
+                           HYPRE_Int           relax_type,
+                           HYPRE_Int           relax_points,
+                           HYPRE_Real          relax_weight,
+                           HYPRE_Real         *l1_norms,
+                           hypre_ParVector    *u )
+{
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real      *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        n = hypre_CSRMatrixNumRows(A_diag);
+
+   HYPRE_Int        nv = hypre_ParVectorNumVectors(u);
+   HYPRE_Real      *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vext_data, *work_data, *tmp_data = NULL;
+   HYPRE_Real      *res, *u_row, *x_row;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   /* l1 variants update with the full residual, the others replace u_i */
+   HYPRE_Int        use_l1 = (relax_type == 8 || relax_type == 13 || relax_type == 14);
+   HYPRE_Int        num_passes = (relax_type == 6 || relax_type == 8) ? 2 : 1;
+   HYPRE_Int        num_threads = hypre_NumThreads();
+   HYPRE_Int        use_tmp = (relax_type == 0 || num_threads > 1);
+   HYPRE_Int        pass, backward, k, i, ii, jj, v, t, ns, ne, size, rest;
+   HYPRE_Real       diag, a;
+   HYPRE_Real       zero = 0.0;
+   HYPRE_Real       one_minus_weight = 1.0 - relax_weight;
+
+   /* one residual row per thread, followed by the copy of u if needed */
+   Vext_data = hypre_ParAMGMultiRecvBuffer(amg_data, num_cols_offd*nv);
+   work_data = hypre_ParAMGMultiWorkBuffer(amg_data, num_threads*nv + (use_tmp ? n*nv : 0));
+
+   comm_handle = hypre_ParCSRMatrixMultiHaloStart(amg_data, A, u, Vext_data);
+
+   if (use_tmp)
+   {
+      /* Jacobi, and Gauss-Seidel across thread blocks, use the previous
+       * iterate of the local rows */
+      tmp_data = work_data + num_threads*nv;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n*nv; i++)
+      {
+         tmp_data[i] = u_data[i];
+      }
+   }
+
+   hypre_ParCSRMatrixMultiHaloFinish(comm_handle);
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t,ns,ne,size,rest,res,pass,backward,k,i,ii,jj,v,diag,a,u_row,x_row) HYPRE_SMP_SCHEDULE
+#endif
+   for (t = 0; t < num_threads; t++)
+   {
+      size = n/num_threads;
+      rest = n - size*num_threads;
+      if (t < rest)
+      {
+         ns = t*size + t;
+         ne = (t+1)*size + t + 1;
+      }
+      else
+      {
+         ns = t*size + rest;
+         ne = (t+1)*size + rest;
+      }
+      res = work_data + t*nv;
+
+      for (pass = 0; pass < num_passes; pass++)
+      {
+         backward = (relax_type == 4 || relax_type == 14 || pass == 1);
+
+         for (k = ns; k < ne; k++)
+         {
+            i = backward ? ne - 1 - (k - ns) : k;
+
+            /*-----------------------------------------------------------
+             * If i is of the right type ( C or F ) and diagonal is
+             * nonzero, relax point i; otherwise, skip it.
+             *-----------------------------------------------------------*/
+
+            if (relax_points && cf_marker[i] != relax_points)
+            {
+               continue;
+            }
+
+            diag = use_l1 ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+            if (diag == zero)
+            {
+               continue;
+            }
+
+            for (v = 0; v < nv; v++)
+            {
+               res[v] = f_data[i*nv + v];
+            }
+            for (jj = A_diag_i[i] + !use_l1; jj < A_diag_i[i+1]; jj++)
+            {
+               ii = A_diag_j[jj];
+               a = A_diag_data[jj];
+               x_row = (relax_type == 0 || ii < ns || ii >= ne) ?
+                       tmp_data + ii*nv : u_data + ii*nv;
+               for (v = 0; v < nv; v++)
+               {
+                  res[v] -= a * x_row[v];
+               }
+            }
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               ii = A_offd_j[jj];
+               a = A_offd_data[jj];
+               x_row = Vext_data + ii*nv;
+               for (v = 0; v < nv; v++)
+               {
+                  res[v] -= a * x_row[v];
+               }
+            }
+
+            u_row = u_data + i*nv;
+            if (relax_type == 0)
+            {
+               for (v = 0; v < nv; v++)
+               {
+                  u_row[v] = one_minus_weight * u_row[v] + relax_weight * res[v] / diag;
+               }
+            }
+            else if (use_l1)
+            {
+               for (v = 0; v < nv; v++)
+               {
+                  u_row[v] += res[v] / diag;
+               }
+            }
+            else
+            {
+               for (v = 0; v < nv; v++)
+               {
+                  u_row[v] = res[v] / diag;
+               }
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiRelaxSupported
+ *
+ * Returns 1 if relax_type can be applied by hypre_BoomerAMGMultiRelax on
+ * the given level.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiRelaxSupported( hypre_ParAMGData *amg_data,
+                                    HYPRE_Int         level,
+                                    HYPRE_Int         relax_type )
+{
+   HYPRE_Real   *relax_weight = hypre_ParAMGDataRelaxWeight(amg_data);
+   HYPRE_Real   *omega        = hypre_ParAMGDataOmega(amg_data);
+   hypre_Vector **l1_norms    = hypre_ParAMGDataL1Norms(amg_data);
+
+   switch (relax_type)
+   {
+      case 0:
+         return 1;
+
+      case 3:
+      case 4:
+      case 6:
+         return (relax_weight[level] == 1.0 && omega[level] == 1.0);
+
+      case 8:
+      case 13:
+      case 14:
+         return (relax_weight[level] == 1.0 && omega[level] == 1.0 &&
+                 l1_norms != NULL && l1_norms[level] != NULL);
+   }
+
+   return 0;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycleSupported
+ *
+ * Returns 1 if the hierarchy and the cycle options in amg_data can be
+ * handled by hypre_BoomerAMGMultiCycle.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiCycleSupported( hypre_ParAMGData *amg_data )
+{
+   HYPRE_Int  num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int  additive        = hypre_ParAMGDataAdditive(amg_data);
+   HYPRE_Int  mult_additive   = hypre_ParAMGDataMultAdditive(amg_data);
+   HYPRE_Int  simple          = hypre_ParAMGDataSimple(amg_data);
+   HYPRE_Int  level, coarse_type;
+
+   if ( num_levels < 2 ||
+        hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataGridRelaxPoints(amg_data) ||
+        hypre_ParAMGDataSmoothNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataParticipate(amg_data) ||
+        (additive      >= 0 && additive      < num_levels) ||
+        (mult_additive >= 0 && mult_additive < num_levels) ||
+        (simple        >= 0 && simple        < num_levels) )
+   {
+      return 0;
+   }
+
+#ifdef HYPRE_USING_DSUPERLU
+   if (hypre_ParAMGDataDSLUSolver(amg_data) != NULL)
+   {
+      return 0;
+   }
+#endif
+
+   for (level = 0; level < num_levels; level++)
+   {
+      if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(
+             hypre_ParAMGDataAArray(amg_data)[level])) != hypre_MEMORY_HOST)
+      {
+         return 0;
+      }
+
+      /* hypre_BoomerAMGMultiRelax has no reduced-storage kernels */
+      if (hypre_CSRMatrixDataFloat(hypre_ParCSRMatrixDiag(hypre_ParAMGDataAArray(amg_data)[level])) ||
+          hypre_CSRMatrixColDelta(hypre_ParCSRMatrixDiag(hypre_ParAMGDataAArray(amg_data)[level])))
+      {
+         return 0;
+      }
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if ( !hypre_BoomerAMGMultiRelaxSupported(amg_data, level, grid_relax_type[1]) ||
+           !hypre_BoomerAMGMultiRelaxSupported(amg_data, level, grid_relax_type[2]) )
+      {
+         return 0;
+      }
+   }
+
+   coarse_type = grid_relax_type[3];
+   if ( coarse_type != 9 && coarse_type != 99 && coarse_type != 199 &&
+        !hypre_BoomerAMGMultiRelaxSupported(amg_data, num_levels - 1, coarse_type) )
+   {
+      return 0;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiCycle
+ *
+ * One AMG cycle on the interleaved multivectors F_array, U_array. The
+ * cycling control follows hypre_BoomerAMGCycle.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGMultiCycle( hypre_ParAMGData  *amg_data,
+                           hypre_ParVector  **F_array,
+                           hypre_ParVector  **U_array,
+                           hypre_ParVector   *Vtemp )
+{
+   hypre_ParCSRMatrix **A_array         = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **P_array         = hypre_ParAMGDataPArray(amg_data);
+   hypre_ParCSRMatrix **R_array         = hypre_ParAMGDataRArray(amg_data);
+   HYPRE_Int          **CF_marker_array = hypre_ParAMGDataCFMarkerArray(amg_data);
+   HYPRE_Int            num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            cycle_type      = hypre_ParAMGDataCycleType(amg_data);
+   HYPRE_Int            fcycle          = hypre_ParAMGDataFCycle(amg_data);
+   HYPRE_Int           *num_grid_sweeps = hypre_ParAMGDataNumGridSweeps(amg_data);
+   HYPRE_Int           *grid_relax_type = hypre_ParAMGDataGridRelaxType(amg_data);
+   HYPRE_Int            relax_order     = hypre_ParAMGDataRelaxOrder(amg_data);
+   HYPRE_Real          *relax_weight    = hypre_ParAMGDataRelaxWeight(amg_data);
+   hypre_Vector       **l1_norms        = hypre_ParAMGDataL1Norms(amg_data);
+   HYPRE_Int            restri_type     = hypre_ParAMGDataRestriction(amg_data);
+   HYPRE_Int            num_vectors     = hypre_ParVectorNumVectors(F_array[0]);
+
+   /* single vectors of the hierarchy, used by the coarse grid solve */
+   hypre_ParVector    **F_single        = hypre_ParAMGDataFArray(amg_data);
+   hypre_ParVector    **U_single        = hypre_ParAMGDataUArray(amg_data);
+
+   HYPRE_Int           *lev_counter;
+   HYPRE_Int            level, fine_grid, coarse_grid, fcycle_lev;
+   HYPRE_Int            cycle_param, relax_type, num_sweep;
+   HYPRE_Int            relax_points[2], num_points;
+   HYPRE_Int            Not_Finished, j, k, p;
+   HYPRE_Real          *l1_norms_level;
+
+   lev_counter = hypre_CTAlloc(HYPRE_Int, num_levels, HYPRE_MEMORY_HOST);
+
+   /*---------------------------------------------------------------------
+    *    Initialize cycling control counter, see hypre_BoomerAMGCycle
+    *---------------------------------------------------------------------*/
+
+   Not_Finished = 1;
+
+   lev_counter[0] = 1;
+   for (k = 1; k < num_levels; ++k)
+   {
+      lev_counter[k] = fcycle ? 1 : cycle_type;
+   }
+   fcycle_lev = num_levels - 2;
+
+   level = 0;
+   cycle_param = 1;
+
+   while (Not_Finished)
+   {
+      hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) =
+         hypre_VectorSize(hypre_ParVectorLocalVector(F_array[level]));
+
+      num_sweep  = num_grid_sweeps[cycle_param];
+      relax_type = grid_relax_type[cycle_param];
+      l1_norms_level = (l1_norms && l1_norms[level]) ? hypre_VectorData(l1_norms[level]) : NULL;
+
+      /* CF ordering as in hypre_BoomerAMGRelaxIF */
+      if (relax_order == 1 && cycle_param < 3)
+      {
+         num_points = 2;
+         relax_points[0] = (cycle_param < 2) ?  1 : -1;
+         relax_points[1] = (cycle_param < 2) ? -1 :  1;
+      }
+      else
+      {
+         num_points = 1;
+         relax_points[0] = 0;
+      }
+
+      for (j = 0; j < num_sweep; j++)
+      {
+         if (relax_type == 9 || relax_type == 99 || relax_type == 199)
+         {
+            /* Gaussian elimination, one right-hand side at a time */
+            for (k = 0; k < num_vectors; k++)
+            {
+               hypre_ParAMGMultiVectorGetColumn(F_array[level], k, F_single[level]);
+               hypre_GaussElimSolve(amg_data, level, relax_type);
+               hypre_ParAMGMultiVectorSetColumn(U_array[level], k, U_single[level]);
+            }
+         }
+         else
+         {
+            for (p = 0; p < num_points; p++)
+            {
+               hypre_BoomerAMGMultiRelax(amg_data, A_array[level], F_array[level],
+                                         CF_marker_array[level], relax_type,
+                                         relax_points[p], relax_weight[level],
+                                         l1_norms_level, U_array[level]);
+            }
+         }
+      }
+
+      /*------------------------------------------------------------------
+       * Decrement the control counter and determine which grid to visit next
+       *-----------------------------------------------------------------*/
+
+      --lev_counter[level];
+
+      if (lev_counter[level] >= 0 && level != num_levels-1)
+      {
+         /*---------------------------------------------------------------
+          * Visit coarser level next: restrict the residual.
+          *--------------------------------------------------------------*/
+
+         fine_grid = level;
+         coarse_grid = level + 1;
+
+         hypre_ParVectorSetConstantValues(U_array[coarse_grid], 0.0);
+
+         hypre_ParCSRMatrixMultiMatvecOutOfPlace(amg_data, -1.0, A_array[fine_grid],
+                                                 U_array[fine_grid], 1.0,
+                                                 F_array[fine_grid], Vtemp);
+
+         if (restri_type)
+         {
+            /* RL: no transpose for R */
+            hypre_ParCSRMatrixMultiMatvecOutOfPlace(amg_data, 1.0, R_array[fine_grid], Vtemp,
+                                                    0.0, F_array[coarse_grid],
+                                                    F_array[coarse_grid]);
+         }
+         else
+         {
+            hypre_ParCSRMatrixMultiMatvecT(amg_data, 1.0, R_array[fine_grid], Vtemp,
+                                           0.0, F_array[coarse_grid]);
+         }
+
+         ++level;
+         lev_counter[level] = hypre_max(lev_counter[level], cycle_type);
+         cycle_param = 1;
+         if (level == num_levels-1)
+         {
+            cycle_param = 3;
+         }
+      }
+      else if (level != 0)
+      {
+         /*---------------------------------------------------------------
+          * Visit finer level next: interpolate and add the correction.
+          *--------------------------------------------------------------*/
+
+         fine_grid = level - 1;
+         coarse_grid = level;
+
+         hypre_ParCSRMatrixMultiMatvecOutOfPlace(amg_data, 1.0, P_array[fine_grid],
+                                                 U_array[coarse_grid], 1.0,
+                                                 U_array[fine_grid], U_array[fine_grid]);
+
+         --level;
+
+         if (fcycle && fcycle_lev == level)
+         {
+            lev_counter[level] = hypre_max(lev_counter[level], 1);
+            fcycle_lev --;
+         }
+
+         cycle_param = 2;
+      }
+      else
+      {
+         Not_Finished = 0;
+      }
+   }
+
+   hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGMultiSolve
+ *
+ * Solves A u(:,k) = f(:,k) for all columns k of the multivectors f and u
+ * with the hierarchy built by hypre_BoomerAMGSetup. All columns are cycled
+ * together until the largest relative residual is below the tolerance, so
+ * columns that converge earlier keep being cycled. Configurations not
+ * covered by the block cycle (e.g. complex smoothers, additive cycles, block
+ * mode) are solved one column at a time with hypre_BoomerAMGSolve.
+ *
+ * The smoothers sweep the local rows in order, so for a single thread each
+ * column follows the iterates of hypre_BoomerAMGSolve run for the same
+ * number of cycles, up to rounding.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGMultiSolve( void               *amg_vdata,
+                           hypre_ParCSRMatrix *A,
+                           hypre_ParVector    *f,
+                           hypre_ParVector    *u )
+{
+   MPI_Comm            comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParAMGData   *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   HYPRE_Int           amg_print_level = hypre_ParAMGDataPrintLevel(amg_data);
+   HYPRE_Int           num_levels      = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int           converge_type   = hypre_ParAMGDataConvergeType(amg_data);
+   HYPRE_Real          tol             = hypre_ParAMGDataTol(amg_data);
+   HYPRE_Int           min_iter        = hypre_ParAMGDataMinIter(amg_data);
+   HYPRE_Int           max_iter        = hypre_ParAMGDataMaxIter(amg_data);
+   hypre_ParCSRMatrix **A_array        = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParVector    **F_single       = hypre_ParAMGDataFArray(amg_data);
+   HYPRE_Int           num_vectors     = hypre_ParVectorNumVectors(f);
+
+   hypre_ParVector   **F_array, **U_array;
+   hypre_ParVector    *Vtemp;
+   hypre_ParVector    *f_col, *u_col;
+   HYPRE_Real         *resid_nrm, *resid_nrm_init, *rhs_norm;
+   HYPRE_Real          relative_resid, max_relative_resid = 1.0;
+   HYPRE_Int           cycle_count = 0, max_cycle_count = 0;
+   HYPRE_Int           ieee_error = 0;
+   HYPRE_Int           my_id, level, k;
+
+   if (hypre_ParVectorNumVectors(u) != num_vectors)
+   {
+      hypre_error_in_arg(4);
+      return hypre_error_flag;
+   }
+
+   hypre_MPI_Comm_rank(comm, &my_id);
+
+   A_array[0] = A;
+
+   /*-----------------------------------------------------------------------
+    *    Fall back to one solve per right-hand side
+    *-----------------------------------------------------------------------*/
+
+   if (num_vectors == 1 || !hypre_BoomerAMGMultiCycleSupported(amg_data))
+   {
+      f_col = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(f),
+                                    hypre_ParVectorPartitioning(f));
+      hypre_ParVectorSetPartitioningOwner(f_col, 0);
+      hypre_ParVectorInitialize(f_col);
+      u_col = hypre_ParVectorCreate(comm, hypre_ParVectorGlobalSize(u),
+                                    hypre_ParVectorPartitioning(u));
+      hypre_ParVectorSetPartitioningOwner(u_col, 0);
+      hypre_ParVectorInitialize(u_col);
+
+      for (k = 0; k < num_vectors; k++)
+      {
+         hypre_ParAMGMultiVectorGetColumn(f, k, f_col);
+         hypre_ParAMGMultiVectorGetColumn(u, k, u_col);
+         hypre_BoomerAMGSolve(amg_data, A, f_col, u_col);
+         hypre_ParAMGMultiVectorSetColumn(u, k, u_col);
+
+         max_cycle_count = hypre_max(max_cycle_count, hypre_ParAMGDataNumIterations(amg_data));
+         if (k == 0 || hypre_ParAMGDataRelativeResidualNorm(amg_data) > max_relative_resid)
+         {
+            max_relative_resid = hypre_ParAMGDataRelativeResidualNorm(amg_data);
+         }
+      }
+
+      hypre_ParAMGDataNumIterations(amg_data) = max_cycle_count;
+      hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+
+      hypre_ParVectorDestroy(f_col);
+      hypre_ParVectorDestroy(u_col);
+
+      return hypre_error_flag;
+   }
+
+   /*-----------------------------------------------------------------------
+    *    Interleaved work vectors for all levels
+    *-----------------------------------------------------------------------*/
+
+   F_array = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   U_array = hypre_CTAlloc(hypre_ParVector*, num_levels, HYPRE_MEMORY_HOST);
+   for (level = 0; level < num_levels; level++)
+   {
+      F_array[level] = hypre_ParAMGMultiVectorCreate(level ? F_single[level] : f, num_vectors);
+      U_array[level] = hypre_ParAMGMultiVectorCreate(F_array[level], num_vectors);
+   }
+   Vtemp = hypre_ParAMGMultiVectorCreate(F_array[0], num_vectors);
+
+   hypre_ParAMGMultiVectorCopy(f, F_array[0]);
+   hypre_ParAMGMultiVectorCopy(u, U_array[0]);
+
+   resid_nrm      = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   resid_nrm_init = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+   rhs_norm       = hypre_CTAlloc(HYPRE_Real, num_vectors, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    *    Compute initial fine-grid residuals
+    *-----------------------------------------------------------------------*/
+
+   if (amg_print_level > 1 || tol > 0.)
+   {
+      hypre_ParCSRMatrixMultiMatvecOutOfPlace(amg_data, -1.0, A_array[0], U_array[0],
+                                              1.0, F_array[0], Vtemp);
+      hypre_ParAMGMultiVectorColumnNorms(Vtemp, resid_nrm_init);
+      hypre_ParAMGMultiVectorColumnNorms(F_array[0], rhs_norm);
+
+      max_relative_resid = 0.0;
+      for (k = 0; k < num_vectors; k++)
+      {
+         if (resid_nrm_init[k] != resid_nrm_init[k])
+         {
+            if (amg_print_level > 0 && my_id == 0)
+            {
+               hypre_printf("\n\nERROR detected by Hypre ...  BEGIN\n");
+               hypre_printf("ERROR -- hypre_BoomerAMGMultiSolve: INFs and/or NaNs detected in input.\n");
+               hypre_printf("User probably placed non-numerics in supplied A, x_0, or b.\n");
+               hypre_printf("ERROR detected by Hypre ...  END\n\n\n");
+            }
+            hypre_error(HYPRE_ERROR_GENERIC);
+            ieee_error = 1;
+            break;
+         }
+         resid_nrm[k] = resid_nrm_init[k];
+         relative_resid = 1.0;
+         if (0 == converge_type)
+         {
+            relative_resid = rhs_norm[k] ? resid_nrm[k] / rhs_norm[k] : resid_nrm[k];
+         }
+         max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+      }
+   }
+
+   if (my_id == 0 && amg_print_level > 1 && !ieee_error)
+   {
+      hypre_printf("\n\nAMG SOLUTION INFO (%d right-hand sides):\n", num_vectors);
+      hypre_printf("                                 max relative\n");
+      hypre_printf("                                     residual\n");
+      hypre_printf("                                     --------\n");
+      hypre_printf("    Initial                      %e\n", max_relative_resid);
+   }
+
+   /*-----------------------------------------------------------------------
+    *    Main cycle loop
+    *-----------------------------------------------------------------------*/
+
+   while ( !ieee_error &&
+           (max_relative_resid >= tol || cycle_count < min_iter) && cycle_count < max_iter )
+   {
+      hypre_BoomerAMGMultiCycle(amg_data, F_array, U_array, Vtemp);
+
+      if (amg_print_level > 1 || tol > 0.)
+      {
+         hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) =
+            hypre_VectorSize(hypre_ParVectorLocalVector(F_array[0]));
+         hypre_ParCSRMatrixMultiMatvecOutOfPlace(amg_data, -1.0, A_array[0], U_array[0],
+                                                 1.0, F_array[0], Vtemp);
+         hypre_ParAMGMultiVectorColumnNorms(Vtemp, resid_nrm);
+
+         max_relative_resid = 0.0;
+         for (k = 0; k < num_vectors; k++)
+         {
+            if (0 == converge_type)
+            {
+               relative_resid = rhs_norm[k] ? resid_nrm[k] / rhs_norm[k] : resid_nrm[k];
+            }
+            else
+            {
+               relative_resid = resid_nrm_init[k] ? resid_nrm[k] / resid_nrm_init[k] : resid_nrm[k];
+            }
+            max_relative_resid = hypre_max(max_relative_resid, relative_resid);
+         }
+      }
+
+      ++cycle_count;
+
+      if (my_id == 0 && amg_print_level > 1)
+      {
+         hypre_printf("    Cycle %2d                     %e \n", cycle_count, max_relative_resid);
+      }
+   }
+
+   if (cycle_count == max_iter && tol > 0.)
+   {
+      if (my_id == 0 && amg_print_level > 1)
+      {
+         hypre_printf("\n\n==============================================");
+         hypre_printf("\n NOTE: Convergence tolerance was not achieved\n");
+         hypre_printf("      within the allowed %d V-cycles\n",max_iter);
+         hypre_printf("==============================================\n");
+      }
+      hypre_error(HYPRE_ERROR_CONV);
+   }
+
+   hypre_ParAMGMultiVectorCopy(U_array[0], u);
+
+   hypre_ParAMGDataNumIterations(amg_data) = cycle_count;
+   hypre_ParAMGDataRelativeResidualNorm(amg_data) = max_relative_resid;
+
+   for (level = 0; level < num_levels; level++)
+   {
+      hypre_ParVectorDestroy(F_array[level]);
+      hypre_ParVectorDestroy(U_array[level]);
+   }
+   hypre_ParVectorDestroy(Vtemp);
+   hypre_TFree(F_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(U_array, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm, HYPRE_MEMORY_HOST);
+   hypre_TFree(resid_nrm_init, HYPRE_MEMORY_HOST);
+   hypre_TFree(rhs_norm, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
@@ -0,0 +1,736 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Numeric-only AMG resetup (setup_type = 2)
+ *
+ * When only the values of the fine matrix change, the C/F splittings, the
+ * coarse grids and the sparsity of the interpolation operators of the
+ * previous setup are kept.  On each level only the interpolation weights
+ * are recomputed, with the extended+i formula on the stored sparsity (no
+ * strength matrix, no new interpolation operator), and the Galerkin product
+ * is written into the existing coarse matrix.  Its structure is computed by
+ * the first resetup only (see hypre_ParCSRMatrixRAPKTSymbolic); later
+ * resetups just refill the values.  An agglomerated coarsest level keeps its
+ * processor groups and refreshes the values of the gathered matrix, and its
+ * own hierarchy is reset up the same way.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "par_amg.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupPatternKey
+ *
+ * Returns a checksum of the local sparsity pattern of A (row pointers,
+ * column indices and col_map_offd), used to detect pattern changes that
+ * keep the number of nonzeros.
+ *--------------------------------------------------------------------------*/
+
+hypre_ulonglongint
+hypre_BoomerAMGResetupPatternKey( hypre_ParCSRMatrix *A )
+{
+   hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(A);
+   hypre_CSRMatrix    *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int           num_rows = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int          *arrays[4];
+   HYPRE_Int           sizes[4];
+   HYPRE_BigInt       *col_map_offd = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int           num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ulonglongint  key = 14695981039346656037ULL;
+   HYPRE_Int           a, i;
+
+   arrays[0] = hypre_CSRMatrixI(A_diag);  sizes[0] = num_rows + 1;
+   arrays[1] = hypre_CSRMatrixJ(A_diag);  sizes[1] = hypre_CSRMatrixNumNonzeros(A_diag);
+   arrays[2] = hypre_CSRMatrixI(A_offd);  sizes[2] = num_rows + 1;
+   arrays[3] = hypre_CSRMatrixJ(A_offd);  sizes[3] = hypre_CSRMatrixNumNonzeros(A_offd);
+
+   /* FNV-1a over the index arrays */
+   for (a = 0; a < 4; a++)
+   {
+      if (!arrays[a])
+      {
+         continue;
+      }
+      for (i = 0; i < sizes[a]; i++)
+      {
+         key = (key ^ (hypre_ulonglongint) arrays[a][i]) * 1099511628211ULL;
+      }
+   }
+   for (i = 0; i < num_cols_offd; i++)
+   {
+      key = (key ^ (hypre_ulonglongint) col_map_offd[i]) * 1099511628211ULL;
+   }
+
+   return key;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCheckLocal
+ *
+ * Local part of hypre_BoomerAMGResetupCheck.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupCheckLocal( void               *amg_vdata,
+                                  hypre_ParCSRMatrix *A )
+{
+   hypre_ParAMGData  *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRMatrix **P_array = hypre_ParAMGDataPArray(amg_data);
+   HYPRE_Int          interp_type = hypre_ParAMGDataInterpType(amg_data);
+   HYPRE_Int          num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   HYPRE_Int          num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   hypre_ParCSRMatrix *A_coarse;
+   HYPRE_Int          num_procs;
+
+   if ( num_levels < 2 || P_array == NULL ||
+        hypre_ParAMGDataAArray(amg_data) == NULL ||
+        hypre_ParAMGDataCFMarkerArray(amg_data) == NULL )
+   {
+      return 0;
+   }
+
+   /* the sparsity of A must be the one of the previous setup */
+   if ( hypre_ParAMGDataSetupDiagNnz(amg_data) !=
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A)) ||
+        hypre_ParAMGDataSetupOffdNnz(amg_data) !=
+        hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A)) ||
+        hypre_ParCSRMatrixGlobalNumRows(A) != hypre_ParCSRMatrixGlobalNumRows(P_array[0]) ||
+        hypre_ParCSRMatrixNumRows(A) != hypre_ParCSRMatrixNumRows(P_array[0]) ||
+        hypre_ParAMGDataSetupPatternKey(amg_data) != hypre_BoomerAMGResetupPatternKey(A) )
+   {
+      return 0;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return 0;
+   }
+
+   /* options that change the hierarchy beyond coarsening, P and RAP */
+   if ( hypre_ParAMGDataBlockMode(amg_data) ||
+        hypre_ParAMGDataNodal(amg_data) ||
+        hypre_ParAMGDataAggNumLevels(amg_data) > 0 ||
+        hypre_ParAMGDataGSMG(amg_data) ||
+        hypre_ParAMGInterpVecVariant(amg_data) > 0 ||
+        hypre_ParAMGInterpRefine(amg_data) > 0 ||
+        hypre_ParAMGDataPostInterpType(amg_data) > 0 ||
+        hypre_ParAMGDataRestriction(amg_data) ||
+        hypre_ParAMGDataMultAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataAdditive(amg_data) > -1 ||
+        hypre_ParAMGDataSimple(amg_data) > -1 ||
+        hypre_ParAMGDataNonGalerkNumTol(amg_data) > 0 ||
+        hypre_ParAMGDataNonGalTolArray(amg_data) ||
+        hypre_ParAMGDataADropTol(amg_data) > 0.0 )
+   {
+      return 0;
+   }
+
+   /* an agglomerated coarsest level is refreshed in place, which needs the
+      agglomeration of the previous setup (see hypre_BoomerAMGAgglomerateResetup) */
+   A_coarse = hypre_ParAMGDataAArray(amg_data)[num_levels-1];
+   hypre_MPI_Comm_size(hypre_ParCSRMatrixComm(A), &num_procs);
+   if ( hypre_ParAMGDataAgglomerated(amg_data) !=
+        hypre_BoomerAMGAgglomerateCheck(amg_data, num_levels-1,
+                                        hypre_ParCSRMatrixGlobalNumRows(A_coarse), num_procs) )
+   {
+      return 0;
+   }
+   if ( hypre_ParAMGDataAgglomerated(amg_data) && hypre_ParAMGDataAgglomCounts(amg_data) &&
+        (!hypre_ParAMGDataCoarseSolver(amg_data) || !hypre_ParAMGDataACoarse(amg_data)) )
+   {
+      return 0;
+   }
+
+   switch (interp_type)
+   {
+      case 0:  case 2:  case 3:  case 4:  case 5:  case 6:  case 7:  case 8:
+      case 9:  case 12: case 13: case 14: case 15: case 16: case 17: case 18:
+         return 1;
+
+      case 19:
+         return (num_functions == 1);
+
+      default:
+         return 0;
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCheck
+ *
+ * Returns 1 if the hierarchy of the previous setup can be refreshed for A
+ * by a numeric-only resetup, 0 otherwise.  This requires a previous setup
+ * with more than one level and options for which the hierarchy depends on
+ * the matrix values only through the coarsening, the interpolation weights
+ * and the Galerkin product.  On every process, A must have the local size
+ * and the sparsity pattern of the fine matrix of the previous setup; the
+ * pattern is compared through the number of nonzeros and a checksum of the
+ * index arrays.  The result is the same on all processes of A.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupCheck( void               *amg_vdata,
+                             hypre_ParCSRMatrix *A )
+{
+   HYPRE_Int  resetup_local, resetup;
+
+   resetup_local = hypre_BoomerAMGResetupCheckLocal(amg_vdata, A);
+   hypre_MPI_Allreduce(&resetup_local, &resetup, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A));
+
+   return resetup;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupInterpWeights
+ *
+ * Recomputes the weights of P for the values of A, keeping the sparsity of
+ * P.  The extended+i formula is applied on the stored pattern: for an
+ * F-point i with interpolatory set C_i (the columns of row i of P),
+ *
+ *    w_ij = -( a_ij + sum_k a_ik abar_kj / sum_{l in C_i+{i}} abar_kl ) / d_i,
+ *
+ * where k runs over the F-neighbors of i, abar_kl are the entries of row k
+ * with the sign opposite to a_kk, and d_i is a_ii plus the distributed
+ * a_ik abar_ki / sum and the connections of i that are not interpolated
+ * (C-points outside C_i, F-points with nothing to distribute).  With more
+ * than one function, only connections within a function are used.  The
+ * strength and truncation of the previous setup are kept in the pattern of
+ * P, so neither is recomputed.  C-points keep their unit row.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupInterpWeights( hypre_ParCSRMatrix *A,
+                                     HYPRE_Int          *CF_marker,
+                                     HYPRE_Int           num_functions,
+                                     HYPRE_Int          *dof_func,
+                                     hypre_ParCSRMatrix *P )
+{
+   hypre_ParCSRCommPkg    *comm_pkg      = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommPkg    *P_comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix *A_diag        = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j      = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Real      *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix *A_offd        = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j      = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Real      *A_offd_data   = hypre_CSRMatrixData(A_offd);
+   HYPRE_BigInt    *col_map_offd  = hypre_ParCSRMatrixColMapOffd(A);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_BigInt     first_row     = hypre_ParCSRMatrixFirstRowIndex(A);
+   HYPRE_Int        num_rows      = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix *P_diag        = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Int       *P_diag_i      = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j      = hypre_CSRMatrixJ(P_diag);
+   HYPRE_Real      *P_diag_data   = hypre_CSRMatrixData(P_diag);
+   hypre_CSRMatrix *P_offd        = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Int       *P_offd_i      = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j      = hypre_CSRMatrixJ(P_offd);
+   HYPRE_Real      *P_offd_data   = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int        num_coarse    = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_P    = hypre_CSRMatrixNumCols(P_offd);
+
+   hypre_CSRMatrix *A_ext;
+   HYPRE_Int       *A_ext_i;
+   HYPRE_BigInt    *A_ext_j;
+   HYPRE_Real      *A_ext_data;
+
+   HYPRE_Int       *coarse_to_fine;     /* local fine index of a coarse point */
+   HYPRE_BigInt    *P_fine_map;         /* global fine index of a P offd column */
+   HYPRE_BigInt    *P_fine_sorted;
+   HYPRE_Int       *P_fine_perm;
+   HYPRE_Int       *offd_to_P;          /* P offd column of an A offd column, or -1 */
+   HYPRE_Int       *ext_col;            /* local fine index l >= 0 of an A_ext entry,
+                                           -2-p for P offd column p, -1 otherwise */
+   HYPRE_Int       *CF_marker_offd = NULL, *dof_func_offd = NULL;
+   HYPRE_Int       *markers;
+   HYPRE_BigInt    *send_buf;
+   HYPRE_Int        num_sends, num_threads;
+   HYPRE_Int        i, j, k, m, p, cnt;
+
+   if (!comm_pkg)
+   {
+      hypre_MatvecCommPkgCreate(A);
+      comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+
+   /*-----------------------------------------------------------------------
+    * Global fine index of every column of P, and the P offd column of every
+    * off-processor column of A and of the external rows of A
+    *-----------------------------------------------------------------------*/
+
+   coarse_to_fine = hypre_CTAlloc(HYPRE_Int, num_coarse, HYPRE_MEMORY_HOST);
+   cnt = 0;
+   for (i = 0; i < num_rows && cnt < num_coarse; i++)
+   {
+      if (CF_marker[i] >= 0)
+      {
+         coarse_to_fine[cnt++] = i;
+      }
+   }
+
+   num_sends  = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+   send_buf   = hypre_CTAlloc(HYPRE_BigInt, hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends),
+                              HYPRE_MEMORY_HOST);
+   P_fine_map = hypre_CTAlloc(HYPRE_BigInt, num_cols_P, HYPRE_MEMORY_HOST);
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends); i++)
+   {
+      send_buf[i] = first_row +
+                    (HYPRE_BigInt) coarse_to_fine[hypre_ParCSRCommPkgSendMapElmt(P_comm_pkg, i)];
+   }
+   comm_handle = hypre_ParCSRCommHandleCreate(21, P_comm_pkg, send_buf, P_fine_map);
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+   hypre_TFree(send_buf, HYPRE_MEMORY_HOST);
+
+   P_fine_sorted = hypre_TAlloc(HYPRE_BigInt, num_cols_P, HYPRE_MEMORY_HOST);
+   P_fine_perm   = hypre_TAlloc(HYPRE_Int, num_cols_P, HYPRE_MEMORY_HOST);
+   for (p = 0; p < num_cols_P; p++)
+   {
+      P_fine_sorted[p] = P_fine_map[p];
+      P_fine_perm[p]   = p;
+   }
+   hypre_BigQsortbi(P_fine_sorted, P_fine_perm, 0, num_cols_P - 1);
+
+   offd_to_P = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   for (m = 0; m < num_cols_offd; m++)
+   {
+      p = hypre_BigBinarySearch(P_fine_sorted, col_map_offd[m], num_cols_P);
+      offd_to_P[m] = (p < 0) ? -1 : P_fine_perm[p];
+   }
+
+   CF_marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+   hypre_exchange_marker(comm_pkg, CF_marker, CF_marker_offd);
+   if (num_functions > 1)
+   {
+      dof_func_offd = hypre_CTAlloc(HYPRE_Int, num_cols_offd, HYPRE_MEMORY_HOST);
+      hypre_exchange_marker(comm_pkg, dof_func, dof_func_offd);
+   }
+
+   A_ext      = hypre_ParCSRMatrixExtractBExt(A, A, 1);
+   A_ext_i    = hypre_CSRMatrixI(A_ext);
+   A_ext_j    = hypre_CSRMatrixBigJ(A_ext);
+   A_ext_data = hypre_CSRMatrixData(A_ext);
+
+   ext_col = hypre_CTAlloc(HYPRE_Int, A_ext_i[num_cols_offd], HYPRE_MEMORY_HOST);
+   for (k = 0; k < A_ext_i[num_cols_offd]; k++)
+   {
+      if (A_ext_j[k] >= first_row && A_ext_j[k] < first_row + (HYPRE_BigInt) num_rows)
+      {
+         ext_col[k] = (HYPRE_Int) (A_ext_j[k] - first_row);
+      }
+      else
+      {
+         p = hypre_BigBinarySearch(P_fine_sorted, A_ext_j[k], num_cols_P);
+         ext_col[k] = (p < 0) ? -1 : -2 - P_fine_perm[p];
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Weights, row by row.  The markers give the position in row i of P of
+    * a local fine point (P_marker) or of a P offd column (P_marker_offd).
+    *-----------------------------------------------------------------------*/
+
+   num_threads = hypre_NumThreads();
+   markers = hypre_TAlloc(HYPRE_Int, num_threads * (num_rows + num_cols_P), HYPRE_MEMORY_HOST);
+   for (k = 0; k < num_threads * (num_rows + num_cols_P); k++)
+   {
+      markers[k] = -1;
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,j,k,m,p)
+#endif
+   {
+      HYPRE_Int  *P_marker      = markers + hypre_GetThreadNum() * (num_rows + num_cols_P);
+      HYPRE_Int  *P_marker_offd = P_marker + num_rows;
+      HYPRE_Int   l, pos, func;
+      HYPRE_Real  diagonal, sum, distribute, sgn;
+      HYPRE_BigInt row_k;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if (CF_marker[i] >= 0 ||
+             (P_diag_i[i] == P_diag_i[i+1] && P_offd_i[i] == P_offd_i[i+1]))
+         {
+            continue;
+         }
+
+         for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+         {
+            P_marker[coarse_to_fine[P_diag_j[j]]] = j;
+            P_diag_data[j] = 0.0;
+         }
+         for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+         {
+            P_marker_offd[P_offd_j[j]] = j;
+            P_offd_data[j] = 0.0;
+         }
+         func = (num_functions > 1) ? dof_func[i] : 0;
+         diagonal = A_diag_data[A_diag_i[i]];
+
+         /* local neighbors */
+         for (j = A_diag_i[i] + 1; j < A_diag_i[i+1]; j++)
+         {
+            k = A_diag_j[j];
+            if (num_functions > 1 && dof_func[k] != func)
+            {
+               continue;
+            }
+            if (P_marker[k] > -1)
+            {
+               P_diag_data[P_marker[k]] += A_diag_data[j];
+               continue;
+            }
+            if (CF_marker[k] >= 0)
+            {
+               diagonal += A_diag_data[j];
+               continue;
+            }
+
+            /* distribute a_ik over C_i+{i} through row k */
+            sgn = (A_diag_data[A_diag_i[k]] < 0) ? -1.0 : 1.0;
+            sum = 0.0;
+            for (m = A_diag_i[k] + 1; m < A_diag_i[k+1]; m++)
+            {
+               l = A_diag_j[m];
+               if (sgn * A_diag_data[m] < 0 && (P_marker[l] > -1 || l == i))
+               {
+                  sum += A_diag_data[m];
+               }
+            }
+            for (m = A_offd_i[k]; m < A_offd_i[k+1]; m++)
+            {
+               p = offd_to_P[A_offd_j[m]];
+               if (sgn * A_offd_data[m] < 0 && p > -1 && P_marker_offd[p] > -1)
+               {
+                  sum += A_offd_data[m];
+               }
+            }
+            if (sum == 0.0)
+            {
+               diagonal += A_diag_data[j];
+               continue;
+            }
+            distribute = A_diag_data[j] / sum;
+            for (m = A_diag_i[k] + 1; m < A_diag_i[k+1]; m++)
+            {
+               l = A_diag_j[m];
+               if (sgn * A_diag_data[m] < 0)
+               {
+                  if (P_marker[l] > -1)
+                  {
+                     P_diag_data[P_marker[l]] += distribute * A_diag_data[m];
+                  }
+                  else if (l == i)
+                  {
+                     diagonal += distribute * A_diag_data[m];
+                  }
+               }
+            }
+            for (m = A_offd_i[k]; m < A_offd_i[k+1]; m++)
+            {
+               p = offd_to_P[A_offd_j[m]];
+               if (sgn * A_offd_data[m] < 0 && p > -1 && P_marker_offd[p] > -1)
+               {
+                  P_offd_data[P_marker_offd[p]] += distribute * A_offd_data[m];
+               }
+            }
+         }
+
+         /* off-processor neighbors, with their rows in A_ext */
+         for (j = A_offd_i[i]; j < A_offd_i[i+1]; j++)
+         {
+            k = A_offd_j[j];
+            if (num_functions > 1 && dof_func_offd[k] != func)
+            {
+               continue;
+            }
+            p = offd_to_P[k];
+            if (p > -1 && P_marker_offd[p] > -1)
+            {
+               P_offd_data[P_marker_offd[p]] += A_offd_data[j];
+               continue;
+            }
+            if (CF_marker_offd[k] >= 0)
+            {
+               diagonal += A_offd_data[j];
+               continue;
+            }
+
+            row_k = col_map_offd[k];
+            sgn = 1.0;
+            for (m = A_ext_i[k]; m < A_ext_i[k+1]; m++)
+            {
+               if (A_ext_j[m] == row_k)
+               {
+                  sgn = (A_ext_data[m] < 0) ? -1.0 : 1.0;
+                  break;
+               }
+            }
+            sum = 0.0;
+            for (m = A_ext_i[k]; m < A_ext_i[k+1]; m++)
+            {
+               l = ext_col[m];
+               if (A_ext_j[m] != row_k && sgn * A_ext_data[m] < 0 &&
+                   ( (l > -1 && (P_marker[l] > -1 || l == i)) ||
+                     (l < -1 && P_marker_offd[-2-l] > -1) ))
+               {
+                  sum += A_ext_data[m];
+               }
+            }
+            if (sum == 0.0)
+            {
+               diagonal += A_offd_data[j];
+               continue;
+            }
+            distribute = A_offd_data[j] / sum;
+            for (m = A_ext_i[k]; m < A_ext_i[k+1]; m++)
+            {
+               l = ext_col[m];
+               if (A_ext_j[m] == row_k || sgn * A_ext_data[m] >= 0)
+               {
+                  continue;
+               }
+               if (l > -1)
+               {
+                  if (P_marker[l] > -1)
+                  {
+                     P_diag_data[P_marker[l]] += distribute * A_ext_data[m];
+                  }
+                  else if (l == i)
+                  {
+                     diagonal += distribute * A_ext_data[m];
+                  }
+               }
+               else if (l < -1 && P_marker_offd[-2-l] > -1)
+               {
+                  P_offd_data[P_marker_offd[-2-l]] += distribute * A_ext_data[m];
+               }
+            }
+         }
+
+         diagonal = (diagonal != 0.0) ? -1.0 / diagonal : 0.0;
+         for (j = P_diag_i[i]; j < P_diag_i[i+1]; j++)
+         {
+            pos = coarse_to_fine[P_diag_j[j]];
+            P_diag_data[j] *= diagonal;
+            P_marker[pos] = -1;
+         }
+         for (j = P_offd_i[i]; j < P_offd_i[i+1]; j++)
+         {
+            P_offd_data[j] *= diagonal;
+            P_marker_offd[P_offd_j[j]] = -1;
+         }
+      }
+   }
+
+   hypre_TFree(markers, HYPRE_MEMORY_HOST);
+   hypre_TFree(ext_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(offd_to_P, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_fine_perm, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_fine_sorted, HYPRE_MEMORY_HOST);
+   hypre_TFree(P_fine_map, HYPRE_MEMORY_HOST);
+   hypre_TFree(coarse_to_fine, HYPRE_MEMORY_HOST);
+   hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
+   hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(A_ext);
+
+   hypre_CSRMatrixClearSELL(P_diag);
+   hypre_CSRMatrixClearSELL(P_offd);
+
+   /* a transpose kept from the previous Galerkin product is out of date */
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixDiagT(P));
+   hypre_CSRMatrixDestroy(hypre_ParCSRMatrixOffdT(P));
+   hypre_ParCSRMatrixDiagT(P) = NULL;
+   hypre_ParCSRMatrixOffdT(P) = NULL;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupCoarseValues
+ *
+ * Moves the Galerkin product A_new into the coarse matrix A_H and destroys
+ * A_new.  If the sparsity is unchanged only the values are copied, so A_H
+ * keeps its communication package; otherwise A_H takes the local matrices
+ * and communication package of A_new.  A_H keeps its partitioning.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_BoomerAMGResetupCoarseValues( hypre_ParCSRMatrix *A_H,
+                                    hypre_ParCSRMatrix *A_new )
+{
+   hypre_CSRMatrix      *H_diag = hypre_ParCSRMatrixDiag(A_H);
+   hypre_CSRMatrix      *H_offd = hypre_ParCSRMatrixOffd(A_H);
+   hypre_CSRMatrix      *N_diag = hypre_ParCSRMatrixDiag(A_new);
+   hypre_CSRMatrix      *N_offd = hypre_ParCSRMatrixOffd(A_new);
+   HYPRE_Int             num_rows = hypre_CSRMatrixNumRows(H_diag);
+   HYPRE_Int             num_cols_offd = hypre_CSRMatrixNumCols(H_offd);
+   HYPRE_Int             same, same_local;
+   void                 *tmp;
+
+   same = ( hypre_CSRMatrixNumNonzeros(H_diag) == hypre_CSRMatrixNumNonzeros(N_diag) &&
+            hypre_CSRMatrixNumNonzeros(H_offd) == hypre_CSRMatrixNumNonzeros(N_offd) &&
+            num_cols_offd == hypre_CSRMatrixNumCols(N_offd) );
+
+   if (same)
+   {
+      same = ( !memcmp(hypre_CSRMatrixI(H_diag), hypre_CSRMatrixI(N_diag),
+                       (num_rows + 1) * sizeof(HYPRE_Int)) &&
+               !memcmp(hypre_CSRMatrixJ(H_diag), hypre_CSRMatrixJ(N_diag),
+                       hypre_CSRMatrixNumNonzeros(H_diag) * sizeof(HYPRE_Int)) &&
+               !memcmp(hypre_CSRMatrixI(H_offd), hypre_CSRMatrixI(N_offd),
+                       (num_rows + 1) * sizeof(HYPRE_Int)) &&
+               !memcmp(hypre_CSRMatrixJ(H_offd), hypre_CSRMatrixJ(N_offd),
+                       hypre_CSRMatrixNumNonzeros(H_offd) * sizeof(HYPRE_Int)) &&
+               !memcmp(hypre_ParCSRMatrixColMapOffd(A_H), hypre_ParCSRMatrixColMapOffd(A_new),
+                       num_cols_offd * sizeof(HYPRE_BigInt)) );
+   }
+
+   /* the number of nonzeros of A_H is reset below by a collective call */
+   same_local = same;
+   hypre_MPI_Allreduce(&same_local, &same, 1, HYPRE_MPI_INT, hypre_MPI_MIN,
+                       hypre_ParCSRMatrixComm(A_H));
+
+   if (same)
+   {
+      hypre_TMemcpy(hypre_CSRMatrixData(H_diag), hypre_CSRMatrixData(N_diag), HYPRE_Complex,
+                    hypre_CSRMatrixNumNonzeros(H_diag), HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_CSRMatrixData(H_offd), hypre_CSRMatrixData(N_offd), HYPRE_Complex,
+                    hypre_CSRMatrixNumNonzeros(H_offd), HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixClearSELL(H_diag);
+      hypre_CSRMatrixClearSELL(H_offd);
+   }
+   else
+   {
+      hypre_ParCSRMatrixDiag(A_H)  = N_diag;
+      hypre_ParCSRMatrixDiag(A_new) = H_diag;
+      hypre_ParCSRMatrixOffd(A_H)  = N_offd;
+      hypre_ParCSRMatrixOffd(A_new) = H_offd;
+
+      tmp = hypre_ParCSRMatrixColMapOffd(A_H);
+      hypre_ParCSRMatrixColMapOffd(A_H)  = hypre_ParCSRMatrixColMapOffd(A_new);
+      hypre_ParCSRMatrixColMapOffd(A_new) = (HYPRE_BigInt *) tmp;
+
+      tmp = hypre_ParCSRMatrixCommPkg(A_H);
+      hypre_ParCSRMatrixCommPkg(A_H)  = hypre_ParCSRMatrixCommPkg(A_new);
+      hypre_ParCSRMatrixCommPkg(A_new) = (hypre_ParCSRCommPkg *) tmp;
+
+      tmp = hypre_ParCSRMatrixCommPkgT(A_H);
+      hypre_ParCSRMatrixCommPkgT(A_H)  = hypre_ParCSRMatrixCommPkgT(A_new);
+      hypre_ParCSRMatrixCommPkgT(A_new) = (hypre_ParCSRCommPkg *) tmp;
+
+      hypre_ParCSRMatrixSetNumNonzeros(A_H);
+      hypre_ParCSRMatrixSetDNumNonzeros(A_H);
+   }
+
+   /* the partitioning belongs to A_H and the interpolation operators */
+   hypre_ParCSRMatrixOwnsRowStarts(A_new) = 0;
+   hypre_ParCSRMatrixOwnsColStarts(A_new) = 0;
+   hypre_ParCSRMatrixDestroy(A_new);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupLevel
+ *
+ * Recomputes the values of P_array[level] and A_array[level+1] from
+ * A_array[level], keeping the C/F splitting and the sparsity of P.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupLevel( void      *amg_vdata,
+                             HYPRE_Int  level )
+{
+   hypre_ParAMGData    *amg_data = (hypre_ParAMGData*) amg_vdata;
+
+   hypre_ParCSRMatrix  *A         = hypre_ParAMGDataAArray(amg_data)[level];
+   hypre_ParCSRMatrix  *P         = hypre_ParAMGDataPArray(amg_data)[level];
+   hypre_ParCSRMatrix  *A_H       = hypre_ParAMGDataAArray(amg_data)[level+1];
+   HYPRE_Int           *CF_marker = hypre_ParAMGDataCFMarkerArray(amg_data)[level];
+   HYPRE_Int           *dof_func  = hypre_ParAMGDataDofFuncArray(amg_data)[level];
+
+   HYPRE_Int            num_functions = hypre_ParAMGDataNumFunctions(amg_data);
+   hypre_ParCSRRAPHandle **rap_handles = hypre_ParAMGDataRAPHandles(amg_data);
+
+   hypre_ParCSRMatrix  *A_new = NULL;
+
+   /*-----------------------------------------------------------------------
+    * Interpolation weights on the C/F splitting and sparsity of P
+    *-----------------------------------------------------------------------*/
+
+   hypre_BoomerAMGResetupInterpWeights(A, CF_marker, num_functions, dof_func, P);
+
+   /*-----------------------------------------------------------------------
+    * Galerkin product.  The first resetup of a level computes the structure
+    * of P^T*A*P, which replaces the one of the previous setup, and keeps it
+    * in a handle; every resetup then only recomputes the values of A_H.
+    *-----------------------------------------------------------------------*/
+
+   if (!rap_handles)
+   {
+      rap_handles = hypre_CTAlloc(hypre_ParCSRRAPHandle *,
+                                  hypre_ParAMGDataNumLevels(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPHandles(amg_data) = rap_handles;
+   }
+
+   if (!rap_handles[level])
+   {
+      A_new = hypre_ParCSRMatrixRAPKTSymbolic(P, A, P, &rap_handles[level]);
+      hypre_ParCSRMatrixOwnsColStarts(P) = 0;
+
+      hypre_BoomerAMGResetupCoarseValues(A_H, A_new);
+   }
+
+   hypre_ParCSRMatrixRAPKTNumeric(rap_handles[level], P, A, P, A_H);
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixDiag(A_H));
+   hypre_CSRMatrixClearSELL(hypre_ParCSRMatrixOffd(A_H));
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResetupDestroyHandles
+ *
+ * Frees the Galerkin product handles of the resetups since the last setup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResetupDestroyHandles( void *amg_vdata )
+{
+   hypre_ParAMGData       *amg_data = (hypre_ParAMGData*) amg_vdata;
+   hypre_ParCSRRAPHandle **rap_handles = hypre_ParAMGDataRAPHandles(amg_data);
+   HYPRE_Int               level;
+
+   if (rap_handles)
+   {
+      for (level = 0; level < hypre_ParAMGDataNumLevels(amg_data); level++)
+      {
+         hypre_ParCSRRAPHandleDestroy(rap_handles[level]);
+      }
+      hypre_TFree(rap_handles, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataRAPHandles(amg_data) = NULL;
+   }
+
+   return hypre_error_flag;
+}
@@ -62,6 +62,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Real           S_commpkg_switch;
    HYPRE_Real           CR_rate;
    HYPRE_Int            relax_order;
+   HYPRE_Int            relax_overlap;
    HYPRE_Int            max_levels;
    HYPRE_Int            amg_logging;
    HYPRE_Int            amg_print_level;
@@ -108,6 +109,9 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    hypre_Vector       **l1_norms = NULL;
    HYPRE_Real         **cheby_ds = NULL;
    HYPRE_Real         **cheby_coefs = NULL;
+   hypre_CSRMatrix    **fsai_G = NULL;
+   hypre_CSRMatrix    **fsai_GT = NULL;
+   HYPRE_Real          *fsai_omega = NULL;
 
    HYPRE_Int       old_num_levels, num_levels;
    HYPRE_Int       level;
@@ -121,6 +125,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    HYPRE_Int       rest, tms, indx;
    HYPRE_Real      size;
    HYPRE_Int       not_finished_coarsening = 1;
+   HYPRE_Int       resetup = 0;
    HYPRE_Int       coarse_threshold = hypre_ParAMGDataMaxCoarseSize(amg_data);
    HYPRE_Int       min_coarse_size = hypre_ParAMGDataMinCoarseSize(amg_data);
    HYPRE_Int       seq_threshold = hypre_ParAMGDataSeqThreshold(amg_data);
@@ -272,6 +277,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    cgc_its = hypre_ParAMGDataCGCIts(amg_data);
 
    relax_order         = hypre_ParAMGDataRelaxOrder(amg_data);
+   relax_overlap       = hypre_ParAMGDataRelaxOverlap(amg_data);
 
    hypre_ParCSRMatrixSetNumNonzeros(A);
    hypre_ParCSRMatrixSetDNumNonzeros(A);
@@ -290,12 +296,24 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    local_size = hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A));
    first_local_row = hypre_ParCSRMatrixFirstRowIndex(A);
 
+   /* numeric-only resetup: keep the coarse grids and the sparsity of P
+      of the previous setup if only the values of A have changed */
+   resetup = (setup_type == 2) && hypre_BoomerAMGResetupCheck(amg_data, A);
+   if (resetup)
+   {
+      /* the numeric RAP reads the previous P's and coarse A's */
+      hypre_BoomerAMGReducedStorageRestore(amg_data);
+   }
+
 
    A_block_array = hypre_ParAMGDataABlockArray(amg_data);
    P_block_array = hypre_ParAMGDataPBlockArray(amg_data);
    R_block_array = hypre_ParAMGDataRBlockArray(amg_data);
 
-   grid_relax_type[3] = hypre_ParAMGDataUserCoarseRelaxType(amg_data);
+   if (!resetup)
+   {
+      grid_relax_type[3] = hypre_ParAMGDataUserCoarseRelaxType(amg_data);
+   }
 
    HYPRE_ANNOTATION_BEGIN("BoomerAMG.setup");
 
@@ -380,8 +398,14 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    /* free up storage in case of new setup without previous destroy */
 
-   if (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
-       dof_func_array || R_array || R_block_array)
+   if (!resetup)
+   {
+      hypre_BoomerAMGResetupDestroyHandles(amg_data);
+   }
+
+   if ( !resetup &&
+        (A_array || A_block_array || P_array || P_block_array || CF_marker_array ||
+         dof_func_array || R_array || R_block_array) )
    {
       for (j = 1; j < old_num_levels; j++)
       {
@@ -454,6 +478,8 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
    {
       MPI_Comm new_comm = hypre_ParAMGDataNewComm(amg_data);
       void *amg = hypre_ParAMGDataCoarseSolver(amg_data);
+      /* a resetup refreshes an agglomerated coarsest level in place */
+      HYPRE_Int keep_agglom = resetup && hypre_ParAMGDataAgglomerated(amg_data);
       if (hypre_ParAMGDataRtemp(amg_data))
       {
          hypre_ParVectorDestroy(hypre_ParAMGDataRtemp(amg_data));
@@ -470,19 +496,19 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParAMGDataZtemp(amg_data) = NULL;
       }
 
-      if (hypre_ParAMGDataACoarse(amg_data))
+      if (hypre_ParAMGDataACoarse(amg_data) && !keep_agglom)
       {
          hypre_ParCSRMatrixDestroy(hypre_ParAMGDataACoarse(amg_data));
          hypre_ParAMGDataACoarse(amg_data) = NULL;
       }
 
-      if (hypre_ParAMGDataUCoarse(amg_data))
+      if (hypre_ParAMGDataUCoarse(amg_data) && !keep_agglom)
       {
          hypre_ParVectorDestroy(hypre_ParAMGDataUCoarse(amg_data));
          hypre_ParAMGDataUCoarse(amg_data) = NULL;
       }
 
-      if (hypre_ParAMGDataFCoarse(amg_data))
+      if (hypre_ParAMGDataFCoarse(amg_data) && !keep_agglom)
       {
          hypre_ParVectorDestroy(hypre_ParAMGDataFCoarse(amg_data));
          hypre_ParAMGDataFCoarse(amg_data) = NULL;
@@ -511,13 +537,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          hypre_ParAMGDataCommInfo(amg_data) = NULL;
       }
 
-      if (new_comm != hypre_MPI_COMM_NULL)
+      if (new_comm != hypre_MPI_COMM_NULL && !keep_agglom)
       {
          hypre_MPI_Comm_free (&new_comm);
          hypre_ParAMGDataNewComm(amg_data) = hypre_MPI_COMM_NULL;
       }
+      if (!keep_agglom)
+      {
+         hypre_BoomerAMGAgglomerateDestroy(amg_data);
+      }
 
-      if (amg)
+      if (amg && !keep_agglom)
       {
          hypre_BoomerAMGDestroy (amg);
          hypre_ParAMGDataCoarseSolver(amg_data) = NULL;
@@ -541,6 +571,7 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          }
          hypre_TFree(hypre_ParAMGDataL1Norms(amg_data), HYPRE_MEMORY_HOST);
       }
+      hypre_BoomerAMGFSAIDestroy(amg_data, old_num_levels);
       if (smooth_num_levels && smoother)
       {
          if (smooth_num_levels > old_num_levels-1)
@@ -788,6 +819,16 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
        hypre_ParAMGDataZtemp(amg_data) = Ztemp;
 
    }
+   else if (grid_relax_type[0] == 12 || grid_relax_type[1] == 12 || grid_relax_type[2] == 12 || grid_relax_type[3] == 12)
+   {
+      /* FSAI */
+      Ztemp = hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[0]),
+                                    hypre_ParCSRMatrixGlobalNumRows(A_array[0]),
+                                    hypre_ParCSRMatrixRowStarts(A_array[0]));
+      hypre_ParVectorInitialize(Ztemp);
+      hypre_ParVectorSetPartitioningOwner(Ztemp,0);
+      hypre_ParAMGDataZtemp(amg_data) = Ztemp;
+   }
    else if (num_threads > 1)
    {
       /* we need the temp Z vector for relaxation 3 and 6 now if we are
@@ -867,6 +908,39 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataSmoother(amg_data) = smoother;
    }
 
+   /*-----------------------------------------------------
+    *  Numeric-only resetup of the previous hierarchy
+    *-----------------------------------------------------*/
+
+   if (resetup)
+   {
+      for (level = 0; level < old_num_levels-1; level++)
+      {
+         if (level > 0)
+         {
+            F_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(F_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(F_array[level],0);
+
+            U_array[level] =
+               hypre_ParVectorCreate(hypre_ParCSRMatrixComm(A_array[level]),
+                                     hypre_ParCSRMatrixGlobalNumRows(A_array[level]),
+                                     hypre_ParCSRMatrixRowStarts(A_array[level]));
+            hypre_ParVectorInitialize_v2(U_array[level], memory_location);
+            hypre_ParVectorSetPartitioningOwner(U_array[level],0);
+         }
+
+         hypre_BoomerAMGResetupLevel(amg_data, level);
+      }
+
+      level = old_num_levels-1;
+      coarse_size = hypre_ParCSRMatrixGlobalNumRows(A_array[level]);
+      not_finished_coarsening = 0;
+   }
+
    /*-----------------------------------------------------
     *  Enter Coarsening Loop
     *-----------------------------------------------------*/
@@ -2835,11 +2909,25 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          {
             not_finished_coarsening = 0;
          }
+         else if (hypre_BoomerAMGAgglomerateCheck(amg_data, level, coarse_size, num_procs))
+         {
+            /* continue coarsening on fewer processors */
+            not_finished_coarsening = 0;
+         }
       }
    }  /* end of coarsening loop: while (not_finished_coarsening) */
 
+   /* agglomeration of the coarsest level onto fewer processors */
+   if (resetup && hypre_ParAMGDataAgglomerated(amg_data))
+   {
+      hypre_BoomerAMGAgglomerateResetup(amg_data, level);
+   }
+   else if (hypre_BoomerAMGAgglomerateCheck(amg_data, level, coarse_size, num_procs))
+   {
+      hypre_BoomerAMGAgglomerateSetup(amg_data, level);
+   }
    /* redundant coarse grid solve */
-   if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
+   else if (  (seq_threshold >= coarse_threshold) && (coarse_size > (HYPRE_BigInt)coarse_threshold) && (level != max_levels-1))
    {
       hypre_seqAMGSetup( amg_data, level, coarse_threshold);
 
@@ -2915,6 +3003,11 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    num_levels = level+1;
    hypre_ParAMGDataNumLevels(amg_data) = num_levels;
+   hypre_ParAMGDataSetupDiagNnz(amg_data) =
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixDiag(A));
+   hypre_ParAMGDataSetupOffdNnz(amg_data) =
+      hypre_CSRMatrixNumNonzeros(hypre_ParCSRMatrixOffd(A));
+   hypre_ParAMGDataSetupPatternKey(amg_data) = hypre_BoomerAMGResetupPatternKey(A);
    if (hypre_ParAMGDataSmoothNumLevels(amg_data) > num_levels-1)
    {
       hypre_ParAMGDataSmoothNumLevels(amg_data) = num_levels;
@@ -2949,6 +3042,17 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
       hypre_ParAMGDataChebyCoefs(amg_data) = cheby_coefs;
    }
 
+   /* FSAI */
+   if (grid_relax_type[0] == 12 || grid_relax_type[1] == 12 || grid_relax_type[2] == 12 || grid_relax_type[3] == 12)
+   {
+      fsai_G = hypre_CTAlloc(hypre_CSRMatrix *, num_levels, HYPRE_MEMORY_HOST);
+      fsai_GT = hypre_CTAlloc(hypre_CSRMatrix *, num_levels, HYPRE_MEMORY_HOST);
+      fsai_omega = hypre_CTAlloc(HYPRE_Real, num_levels, HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFSAIG(amg_data) = fsai_G;
+      hypre_ParAMGDataFSAIGT(amg_data) = fsai_GT;
+      hypre_ParAMGDataFSAIOmega(amg_data) = fsai_omega;
+   }
+
    /* CG */
    if (grid_relax_type[0] == 15 ||grid_relax_type[1] == 15 ||  grid_relax_type[2] == 15 || grid_relax_type[3] == 15)
    {
@@ -3066,6 +3170,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 
    for (j = 0; j < num_levels; j++)
    {
+      /* interior/boundary row splitting for the overlapped hybrid smoothers */
+      if (relax_overlap &&
+          hypre_GetActualMemLocation(hypre_ParCSRMatrixMemoryLocation(A_array[j])) == hypre_MEMORY_HOST)
+      {
+         hypre_ParCSRMatrixSetInteriorBoundaryRows(A_array[j]);
+      }
+
       if (grid_relax_type[1] == 7 || grid_relax_type[2] == 7 || (grid_relax_type[3] == 7 && j == (num_levels-1)))
       {
          HYPRE_Real *l1_norm_data = NULL;
@@ -3102,6 +3213,18 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
          cheby_coefs[j] = coefs;
          cheby_ds[j] = ds;
       }
+      else if (grid_relax_type[1] == 12 || grid_relax_type[2] == 12 ||
+               (grid_relax_type[0] == 12 && j == 0) ||
+               (grid_relax_type[3] == 12 && j == (num_levels-1)))
+      {
+         hypre_ParCSRRelax_FSAI_Setup(A_array[j],
+                                      hypre_ParAMGDataFSAIAlgoType(amg_data),
+                                      hypre_ParAMGDataFSAIMaxSteps(amg_data),
+                                      hypre_ParAMGDataFSAIMaxStepSize(amg_data),
+                                      hypre_ParAMGDataFSAIKapTolerance(amg_data),
+                                      hypre_ParAMGDataFSAIEigMaxIters(amg_data),
+                                      &fsai_G[j], &fsai_GT[j], &fsai_omega[j]);
+      }
       else if (grid_relax_type[1] == 15 || (grid_relax_type[3] == 15 && j == (num_levels-1))  )
       {
 
@@ -3457,6 +3580,13 @@ hypre_BoomerAMGSetup( void               *amg_vdata,
 }
 #endif
 
+   /* work buffer of the fused residual and restriction */
+   hypre_BoomerAMGFusedCycleSetup(amg_data);
+
+   /* single-precision values and compressed column indices on the
+      read-only levels */
+   hypre_BoomerAMGReducedStorageSetup(amg_data);
+
    HYPRE_ANNOTATION_END("BoomerAMG.setup");
 
    return(hypre_error_flag);
@@ -102,7 +102,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    hypre_Vector   *l1_norms_level;
    HYPRE_Real    **ds = hypre_ParAMGDataChebyDS(amg_data);
    HYPRE_Real    **coefs = hypre_ParAMGDataChebyCoefs(amg_data);
+   hypre_CSRMatrix **fsai_G = hypre_ParAMGDataFSAIG(amg_data);
+   hypre_CSRMatrix **fsai_GT = hypre_ParAMGDataFSAIGT(amg_data);
+   HYPRE_Real     *fsai_omega = hypre_ParAMGDataFSAIOmega(amg_data);
    HYPRE_Int       seq_cg = 0;
+   HYPRE_Int       fused_cycle;
+   HYPRE_Int       max_num_threads;
    MPI_Comm        comm;
 
 #if 0
@@ -146,6 +151,8 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
    /* smooth_option       = hypre_ParAMGDataSmoothOption(amg_data); */
    /* RL */
    restri_type = hypre_ParAMGDataRestriction(amg_data);
+   fused_cycle = hypre_ParAMGDataFusedCycle(amg_data);
+   max_num_threads = hypre_NumThreads();
 
    /*max_eig_est = hypre_ParAMGDataMaxEigEst(amg_data);
    min_eig_est = hypre_ParAMGDataMinEigEst(amg_data);
@@ -265,6 +272,7 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
       {
          local_size = hypre_VectorSize(hypre_ParVectorLocalVector(F_array[level]));
          hypre_VectorSize(hypre_ParVectorLocalVector(Vtemp)) = local_size;
+         hypre_BoomerAMGCycleSetNumThreads(amg_data, local_size, max_num_threads);
 
          if (smooth_num_levels <= level)
          {
@@ -325,7 +333,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          l1_norms_level = NULL;
       }
 
-      if (cycle_param == 3 && seq_cg)
+      if (cycle_param == 3 && hypre_ParAMGDataAgglomerated(amg_data))
+      {
+         hypre_BoomerAMGAgglomerateCycle(amg_data, level, F_array, U_array);
+      }
+      else if (cycle_param == 3 && seq_cg)
       {
          hypre_seqAMGCycle(amg_data, level, F_array, U_array);
       }
@@ -533,6 +545,12 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
                                                 cheby_order, scale,
                                                 variant, Aux_U, Vtemp, Ztemp );
                }
+               else if (relax_type == 12)
+               { /* FSAI */
+                  hypre_ParCSRRelax_FSAI_Solve(A_array[level], Aux_F,
+                                               fsai_G[level], fsai_GT[level],
+                                               fsai_omega[level], Aux_U, Vtemp, Ztemp);
+               }
                else if (relax_type == 17)
                {
                   //printf("Proc %d: level %d, n %d, CF %p\n", my_id, level, local_size, CF_marker_array[level]);
@@ -603,6 +621,10 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
                if (Solve_err_flag != 0)
                {
+                  if (hypre_ParAMGDataCycleMinRowsPerThread(amg_data) > 0)
+                  {
+                     hypre_SetNumThreads(max_num_threads);
+                  }
                   return(Solve_err_flag);
                }
             }
@@ -655,39 +677,51 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          alpha = -1.0;
          beta = 1.0;
 
-         if (block_mode)
+         if (fused_cycle && !block_mode && !restri_type &&
+             hypre_BoomerAMGFusedRestrictSupported(A_array[fine_grid], R_array[fine_grid],
+                                                   U_array[fine_grid]))
          {
-            hypre_ParVectorCopy(F_array[fine_grid],Vtemp);
-            hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
-                                          beta, Vtemp);
+            /* residual and restriction in one pass, Vtemp is not used */
+            hypre_BoomerAMGResidualRestrict(amg_data, A_array[fine_grid], U_array[fine_grid],
+                                            F_array[fine_grid], R_array[fine_grid],
+                                            F_array[coarse_grid]);
          }
          else
          {
-            // JSP: avoid unnecessary copy using out-of-place version of SpMV
-            hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
-                                               beta, F_array[fine_grid], Vtemp);
-         }
+            if (block_mode)
+            {
+               hypre_ParVectorCopy(F_array[fine_grid],Vtemp);
+               hypre_ParCSRBlockMatrixMatvec(alpha, A_block_array[fine_grid], U_array[fine_grid],
+                                             beta, Vtemp);
+            }
+            else
+            {
+               // JSP: avoid unnecessary copy using out-of-place version of SpMV
+               hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A_array[fine_grid], U_array[fine_grid],
+                                                  beta, F_array[fine_grid], Vtemp);
+            }
 
-         alpha = 1.0;
-         beta = 0.0;
+            alpha = 1.0;
+            beta = 0.0;
 
-         if (block_mode)
-         {
-            hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
-                                           beta, F_array[coarse_grid]);
-         }
-         else
-         {
-            if (restri_type)
+            if (block_mode)
             {
-               /* RL: no transpose for R */
-               hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
-                                        beta, F_array[coarse_grid]);
+               hypre_ParCSRBlockMatrixMatvecT(alpha, R_block_array[fine_grid], Vtemp,
+                                              beta, F_array[coarse_grid]);
             }
             else
             {
-               hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
-                                         beta, F_array[coarse_grid]);
+               if (restri_type)
+               {
+                  /* RL: no transpose for R */
+                  hypre_ParCSRMatrixMatvec(alpha, R_array[fine_grid], Vtemp,
+                                           beta, F_array[coarse_grid]);
+               }
+               else
+               {
+                  hypre_ParCSRMatrixMatvecT(alpha, R_array[fine_grid], Vtemp,
+                                            beta, F_array[coarse_grid]);
+               }
             }
          }
 
@@ -722,6 +756,9 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
          else
          {
             /* printf("Proc %d: level %d, n %d, Interpolation\n", my_id, level, local_size); */
+            hypre_BoomerAMGCycleSetNumThreads(amg_data,
+                                              hypre_VectorSize(hypre_ParVectorLocalVector(U_array[fine_grid])),
+                                              max_num_threads);
             hypre_ParCSRMatrixMatvec(alpha, P_array[fine_grid],
                                      U_array[coarse_grid],
                                      beta, U_array[fine_grid]);
@@ -754,6 +791,11 @@ hypre_BoomerAMGCycle( void              *amg_vdata,
 
    hypre_ParAMGDataCycleOpCount(amg_data) = cycle_op_count;
 
+   if (hypre_ParAMGDataCycleMinRowsPerThread(amg_data) > 0)
+   {
+      hypre_SetNumThreads(max_num_threads);
+   }
+
    hypre_TFree(lev_counter, HYPRE_MEMORY_HOST);
    hypre_TFree(num_coeffs, HYPRE_MEMORY_HOST);
 
@@ -0,0 +1,418 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Fused and thread-adaptive kernels for the BoomerAMG cycle
+ *
+ * By default, hypre_BoomerAMGCycle computes the fine-grid residual with one
+ * matvec, stores it in Vtemp, and restricts it with a second, transposed
+ * matvec, each in its own parallel region.  With hypre_ParAMGDataFusedCycle
+ * set, both steps are done in a single pass over row blocks of A: each
+ * thread computes the residual of its rows and immediately scatters it
+ * through the same rows of P, so the residual is not stored, except for a
+ * partial value on the rows coupled to other processors while the halo of u
+ * is exchanged.
+ *
+ * hypre_ParAMGDataCycleMinRowsPerThread lets the cycle lower the number of
+ * OpenMP threads on levels with too few local rows to amortize the
+ * fork/join and the thread-private reductions.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGCycleSetNumThreads
+ *
+ * Sets the number of OpenMP threads used for the work on a level with
+ * local_size rows: one thread per min_rows_per_thread rows, between 1 and
+ * max_num_threads.  Does nothing if min_rows_per_thread is not positive.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGCycleSetNumThreads( hypre_ParAMGData *amg_data,
+                                   HYPRE_Int         local_size,
+                                   HYPRE_Int         max_num_threads )
+{
+   HYPRE_Int min_rows_per_thread = hypre_ParAMGDataCycleMinRowsPerThread(amg_data);
+   HYPRE_Int num_threads;
+
+   if (min_rows_per_thread > 0)
+   {
+      num_threads = hypre_max(1, local_size / min_rows_per_thread);
+      num_threads = hypre_min(num_threads, max_num_threads);
+      if (num_threads != hypre_NumThreads())
+      {
+         hypre_SetNumThreads(num_threads);
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFusedRestrictSupported
+ *
+ * Returns 1 if hypre_BoomerAMGResidualRestrict can be used for the level
+ * matrix A and the restriction P^T: both on the host, with plain
+ * double-precision values and uncompressed column indices, and one vector.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFusedRestrictSupported( hypre_ParCSRMatrix *A,
+                                       hypre_ParCSRMatrix *P,
+                                       hypre_ParVector    *u )
+{
+   hypre_CSRMatrix *blocks[4];
+   HYPRE_Int        k;
+
+   blocks[0] = hypre_ParCSRMatrixDiag(A);
+   blocks[1] = hypre_ParCSRMatrixOffd(A);
+   blocks[2] = hypre_ParCSRMatrixDiag(P);
+   blocks[3] = hypre_ParCSRMatrixOffd(P);
+
+   if (hypre_VectorNumVectors(hypre_ParVectorLocalVector(u)) != 1)
+   {
+      return 0;
+   }
+
+   for (k = 0; k < 4; k++)
+   {
+      if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(blocks[k])) !=
+          hypre_MEMORY_HOST ||
+          hypre_CSRMatrixDataFloat(blocks[k]) ||
+          hypre_CSRMatrixColBase(blocks[k]))
+      {
+         return 0;
+      }
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResidualRestrictBufferSize
+ *
+ * Returns the length of the work buffer of hypre_BoomerAMGResidualRestrict
+ * for the level matrix A, the restriction P^T and num_threads threads, and
+ * creates the communication packages of A and P if needed.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResidualRestrictBufferSize( hypre_ParCSRMatrix *A,
+                                           hypre_ParCSRMatrix *P,
+                                           HYPRE_Int           num_threads )
+{
+   hypre_ParCSRCommPkg *A_comm_pkg;
+   hypre_ParCSRCommPkg *P_comm_pkg;
+   HYPRE_Int            y_size;
+
+   if (!hypre_ParCSRMatrixCommPkg(A))
+   {
+      hypre_MatvecCommPkgCreate(A);
+   }
+   if (!hypre_ParCSRMatrixCommPkg(P))
+   {
+      hypre_MatvecCommPkgCreate(P);
+   }
+   A_comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   P_comm_pkg = hypre_ParCSRMatrixCommPkg(P);
+
+   y_size = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(P)) +
+            hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(P));
+
+   /* u_buf, u_ext, partial residuals, y_expand, y_buf */
+   return hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, hypre_ParCSRCommPkgNumSends(A_comm_pkg)) +
+          hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A)) +
+          hypre_CSRMatrixNumRows(hypre_ParCSRMatrixDiag(A)) +
+          num_threads * y_size +
+          hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, hypre_ParCSRCommPkgNumSends(P_comm_pkg));
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFusedCycleSetup
+ *
+ * Allocates the work buffer of hypre_BoomerAMGResidualRestrict for the
+ * largest level of the hierarchy, so that the cycle does not allocate.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFusedCycleSetup( hypre_ParAMGData *amg_data )
+{
+   hypre_ParCSRMatrix **A_array    = hypre_ParAMGDataAArray(amg_data);
+   hypre_ParCSRMatrix **R_array    = hypre_ParAMGDataRArray(amg_data);
+   hypre_ParVector    **U_array    = hypre_ParAMGDataUArray(amg_data);
+   HYPRE_Int            num_levels = hypre_ParAMGDataNumLevels(amg_data);
+   HYPRE_Int            num_threads = hypre_NumThreads();
+   HYPRE_Int            buf_size = 0;
+   HYPRE_Int            level;
+
+   hypre_TFree(hypre_ParAMGDataFusedBuf(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataFusedBufSize(amg_data) = 0;
+
+   if (!hypre_ParAMGDataFusedCycle(amg_data) || hypre_ParAMGDataBlockMode(amg_data) ||
+       hypre_ParAMGDataRestriction(amg_data) || !R_array || !U_array)
+   {
+      return hypre_error_flag;
+   }
+
+   for (level = 0; level < num_levels - 1; level++)
+   {
+      if (A_array[level] && R_array[level] && U_array[level] &&
+          hypre_BoomerAMGFusedRestrictSupported(A_array[level], R_array[level], U_array[level]))
+      {
+         buf_size = hypre_max(buf_size,
+                              hypre_BoomerAMGResidualRestrictBufferSize(A_array[level],
+                                                                        R_array[level],
+                                                                        num_threads));
+      }
+   }
+
+   if (buf_size > 0)
+   {
+      hypre_ParAMGDataFusedBuf(amg_data)     = hypre_CTAlloc(HYPRE_Complex, buf_size,
+                                                             HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFusedBufSize(amg_data) = buf_size;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGResidualRestrict
+ *
+ * Computes f_c = P^T (f - A u) in one pass over the rows of A and P.  Each
+ * thread works on a block of rows with about the same number of nonzeros in
+ * A_diag, and accumulates the contributions of its rows to the local coarse
+ * points and to the off-processor columns of P in a private buffer; the
+ * buffers are then summed and the off-processor part is sent to its owners,
+ * as in hypre_ParCSRMatrixMatvecT.
+ *
+ * Both exchanges overlap with local work: rows without off-processor
+ * columns in A are finished while the halo of u is in flight, and the local
+ * coarse points are summed while the off-processor part is sent.  The work
+ * buffer is allocated by hypre_BoomerAMGFusedCycleSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGResidualRestrict( hypre_ParAMGData   *amg_data,
+                                 hypre_ParCSRMatrix *A,
+                                 hypre_ParVector    *u,
+                                 hypre_ParVector    *f,
+                                 hypre_ParCSRMatrix *P,
+                                 hypre_ParVector    *f_c )
+{
+   hypre_ParCSRCommPkg    *A_comm_pkg;
+   hypre_ParCSRCommPkg    *P_comm_pkg;
+   hypre_ParCSRCommHandle *comm_handle;
+
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   hypre_CSRMatrix *P_diag      = hypre_ParCSRMatrixDiag(P);
+   HYPRE_Complex   *P_diag_data = hypre_CSRMatrixData(P_diag);
+   HYPRE_Int       *P_diag_i    = hypre_CSRMatrixI(P_diag);
+   HYPRE_Int       *P_diag_j    = hypre_CSRMatrixJ(P_diag);
+   hypre_CSRMatrix *P_offd      = hypre_ParCSRMatrixOffd(P);
+   HYPRE_Complex   *P_offd_data = hypre_CSRMatrixData(P_offd);
+   HYPRE_Int       *P_offd_i    = hypre_CSRMatrixI(P_offd);
+   HYPRE_Int       *P_offd_j    = hypre_CSRMatrixJ(P_offd);
+
+   HYPRE_Complex   *u_data  = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Complex   *f_data  = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Complex   *fc_data = hypre_VectorData(hypre_ParVectorLocalVector(f_c));
+
+   HYPRE_Int        num_rows        = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+   HYPRE_Int        num_coarse      = hypre_CSRMatrixNumCols(P_diag);
+   HYPRE_Int        num_cols_offd_P = hypre_CSRMatrixNumCols(P_offd);
+   HYPRE_Int        y_size          = num_coarse + num_cols_offd_P;
+   HYPRE_Int        num_threads     = hypre_NumThreads();
+   HYPRE_Int        buf_size;
+
+   HYPRE_Complex   *u_buf_data, *u_ext_data, *r_data;
+   HYPRE_Complex   *y_expand, *y_buf_data;
+   HYPRE_Int        num_sends_A, num_sends_P, i, t;
+
+   buf_size = hypre_BoomerAMGResidualRestrictBufferSize(A, P, num_threads);
+   if (buf_size > hypre_ParAMGDataFusedBufSize(amg_data))
+   {
+      /* more threads than at setup, or no setup of the fused cycle */
+      hypre_TFree(hypre_ParAMGDataFusedBuf(amg_data), HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFusedBuf(amg_data)     = hypre_CTAlloc(HYPRE_Complex, buf_size,
+                                                             HYPRE_MEMORY_HOST);
+      hypre_ParAMGDataFusedBufSize(amg_data) = buf_size;
+   }
+
+   A_comm_pkg  = hypre_ParCSRMatrixCommPkg(A);
+   P_comm_pkg  = hypre_ParCSRMatrixCommPkg(P);
+   num_sends_A = hypre_ParCSRCommPkgNumSends(A_comm_pkg);
+   num_sends_P = hypre_ParCSRCommPkgNumSends(P_comm_pkg);
+
+   u_buf_data = hypre_ParAMGDataFusedBuf(amg_data);
+   u_ext_data = u_buf_data + hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, num_sends_A);
+   r_data     = u_ext_data + num_cols_offd_A;
+   y_expand   = r_data + num_rows;
+   y_buf_data = y_expand + num_threads * y_size;
+
+   /*-----------------------------------------------------------------
+    * Start sending the off-processor values of u
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(A_comm_pkg, num_sends_A); i++)
+   {
+      u_buf_data[i] = u_data[hypre_ParCSRCommPkgSendMapElmt(A_comm_pkg, i)];
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(1, A_comm_pkg, u_buf_data, u_ext_data);
+
+   /*-----------------------------------------------------------------
+    * Residual and restriction of the rows without off-processor columns;
+    * the other rows keep the A_diag part of their residual in r_data
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i,t)
+#endif
+   {
+      HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+      HYPRE_Complex *y_thread = y_expand + my_thread_num * y_size;
+      HYPRE_Complex *y_offd   = y_thread + num_coarse;
+      HYPRE_Complex  res;
+      HYPRE_Int      ns, ne, jj;
+
+      ns = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A_diag);
+      ne = hypre_CSRMatrixGetLoadBalancedPartitionEnd(A_diag);
+
+      /* also the buffers of threads that are not in the team, if any */
+      for (t = my_thread_num; t < num_threads; t += hypre_NumActiveThreads())
+      {
+         for (jj = 0; jj < y_size; jj++)
+         {
+            y_expand[t * y_size + jj] = 0.0;
+         }
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         res = f_data[i];
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            res -= A_diag_data[jj] * u_data[A_diag_j[jj]];
+         }
+
+         if (A_offd_i[i+1] > A_offd_i[i])
+         {
+            r_data[i] = res;
+            continue;
+         }
+
+         for (jj = P_diag_i[i]; jj < P_diag_i[i+1]; jj++)
+         {
+            y_thread[P_diag_j[jj]] += P_diag_data[jj] * res;
+         }
+         for (jj = P_offd_i[i]; jj < P_offd_i[i+1]; jj++)
+         {
+            y_offd[P_offd_j[jj]] += P_offd_data[jj] * res;
+         }
+      }
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   /*-----------------------------------------------------------------
+    * Rows with off-processor columns, same row blocks
+    *-----------------------------------------------------------------*/
+
+   if (num_cols_offd_A)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i)
+#endif
+      {
+         HYPRE_Int      my_thread_num = hypre_GetThreadNum();
+         HYPRE_Complex *y_thread = y_expand + my_thread_num * y_size;
+         HYPRE_Complex *y_offd   = y_thread + num_coarse;
+         HYPRE_Complex  res;
+         HYPRE_Int      ns, ne, jj;
+
+         ns = hypre_CSRMatrixGetLoadBalancedPartitionBegin(A_diag);
+         ne = hypre_CSRMatrixGetLoadBalancedPartitionEnd(A_diag);
+
+         for (i = ns; i < ne; i++)
+         {
+            if (A_offd_i[i+1] == A_offd_i[i])
+            {
+               continue;
+            }
+
+            res = r_data[i];
+            for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+            {
+               res -= A_offd_data[jj] * u_ext_data[A_offd_j[jj]];
+            }
+
+            for (jj = P_diag_i[i]; jj < P_diag_i[i+1]; jj++)
+            {
+               y_thread[P_diag_j[jj]] += P_diag_data[jj] * res;
+            }
+            for (jj = P_offd_i[i]; jj < P_offd_i[i+1]; jj++)
+            {
+               y_offd[P_offd_j[jj]] += P_offd_data[jj] * res;
+            }
+         }
+      }
+   }
+
+   /*-----------------------------------------------------------------
+    * Sum the contributions to coarse points owned by other processors
+    * and start sending them, then sum the local ones
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = num_coarse; i < y_size; i++)
+   {
+      for (t = 1; t < num_threads; t++)
+      {
+         y_expand[i] += y_expand[t * y_size + i];
+      }
+   }
+
+   comm_handle = hypre_ParCSRCommHandleCreate(2, P_comm_pkg, y_expand + num_coarse, y_buf_data);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_coarse; i++)
+   {
+      fc_data[i] = y_expand[i];
+      for (t = 1; t < num_threads; t++)
+      {
+         fc_data[i] += y_expand[t * y_size + i];
+      }
+   }
+
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   for (i = 0; i < hypre_ParCSRCommPkgSendMapStart(P_comm_pkg, num_sends_P); i++)
+   {
+      fc_data[hypre_ParCSRCommPkgSendMapElmt(P_comm_pkg, i)] += y_buf_data[i];
+   }
+
+   return hypre_error_flag;
+}
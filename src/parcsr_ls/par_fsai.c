@@ -0,0 +1,634 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Factorized sparse approximate inverse (FSAI) setup and solve
+ *
+ * The smoother (relax_type 12) is u = u + omega G^T G (f - A u), where G is a
+ * sparse lower triangular matrix such that G^T G approximates the inverse of
+ * the local diagonal block of the SPD matrix A.  Row i of G only depends on
+ * the entries of A in the rows of its pattern P_i, so all rows are computed
+ * independently and in parallel: with y = -A(P_i,P_i)^{-1} A(P_i,i),
+ *
+ *    G(i,i)   = 1 / sqrt(a_ii + A(i,P_i) y)
+ *    G(i,P_i) = G(i,i) y
+ *
+ * algo_type 0 uses the strictly lower part of A as the pattern.  algo_type 1
+ * builds the pattern adaptively: starting from the diagonal, up to
+ * max_step_size entries with the largest gradient of the Kaporin number
+ * are added to P_i in each of at most max_steps steps, and the row is
+ * finished early when the relative decrease of a_ii + A(i,P_i) y drops
+ * below kap_tolerance.
+ *
+ * The weight omega is the inverse of an estimate of the largest eigenvalue
+ * of G A G^T obtained with eig_max_iters power iterations.
+ *
+ *****************************************************************************/
+
+#include "_hypre_parcsr_ls.h"
+#include "_hypre_lapack.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAIDenseSolve
+ *
+ * Solves the n x n SPD system mat x = rhs in place.  Returns a nonzero value
+ * if mat is not positive definite.  The internal f2c LAPACK keeps its local
+ * variables in static storage, so it cannot be called from several threads
+ * at once; a plain Cholesky factorization is used instead in that case.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_FSAIDenseSolve( HYPRE_Int   n,
+                      HYPRE_Real *mat,
+                      HYPRE_Real *rhs )
+{
+#if defined(HYPRE_USING_OPENMP) && defined(HYPRE_USING_HYPRE_LAPACK)
+   HYPRE_Int  i, j, k;
+   HYPRE_Real sum;
+
+   /* mat = L L^T, L stored in the lower triangle (column-major) */
+   for (j = 0; j < n; j++)
+   {
+      sum = mat[j + j*n];
+      for (k = 0; k < j; k++)
+      {
+         sum -= mat[j + k*n] * mat[j + k*n];
+      }
+      if (sum <= 0.0)
+      {
+         return 1;
+      }
+      mat[j + j*n] = sqrt(sum);
+
+      for (i = j + 1; i < n; i++)
+      {
+         sum = mat[i + j*n];
+         for (k = 0; k < j; k++)
+         {
+            sum -= mat[i + k*n] * mat[j + k*n];
+         }
+         mat[i + j*n] = sum / mat[j + j*n];
+      }
+   }
+
+   for (i = 0; i < n; i++)
+   {
+      sum = rhs[i];
+      for (k = 0; k < i; k++)
+      {
+         sum -= mat[i + k*n] * rhs[k];
+      }
+      rhs[i] = sum / mat[i + i*n];
+   }
+   for (i = n - 1; i >= 0; i--)
+   {
+      sum = rhs[i];
+      for (k = i + 1; k < n; k++)
+      {
+         sum -= mat[k + i*n] * rhs[k];
+      }
+      rhs[i] = sum / mat[i + i*n];
+   }
+
+   return 0;
+#else
+   char      uplo = 'L';
+   HYPRE_Int one = 1;
+   HYPRE_Int info;
+
+   hypre_dpotrf(&uplo, &n, mat, &n, &info);
+   if (info == 0)
+   {
+      hypre_dpotrs(&uplo, &n, &one, mat, &n, rhs, &n, &info);
+   }
+
+   return info;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_FSAISolveRow
+ *
+ * Computes y = -A(P,P)^{-1} A(P,i) for the pattern P of length np and
+ * returns psi = a_ii + A(i,P) y, or a nonpositive value if the local
+ * system is not SPD.  pos is a work array of length num_rows set to -1.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Real
+hypre_FSAISolveRow( HYPRE_Int   *A_i,
+                    HYPRE_Int   *A_j,
+                    HYPRE_Real  *A_data,
+                    HYPRE_Int    row,
+                    HYPRE_Real   a_ii,
+                    HYPRE_Int   *P,
+                    HYPRE_Int    np,
+                    HYPRE_Int   *pos,
+                    HYPRE_Real  *mat,
+                    HYPRE_Real  *rhs,
+                    HYPRE_Real  *y )
+{
+   HYPRE_Real psi = a_ii;
+   HYPRE_Int  k, l, jj;
+
+   if (np == 0)
+   {
+      return psi;
+   }
+
+   for (k = 0; k < np; k++)
+   {
+      pos[P[k]] = k;
+   }
+   for (k = 0; k < np*np; k++)
+   {
+      mat[k] = 0.0;
+   }
+   for (k = 0; k < np; k++)
+   {
+      rhs[k] = 0.0;
+      for (jj = A_i[P[k]]; jj < A_i[P[k]+1]; jj++)
+      {
+         l = pos[A_j[jj]];
+         if (l > -1)
+         {
+            mat[k + l*np] = A_data[jj];
+         }
+      }
+   }
+   for (jj = A_i[row]; jj < A_i[row+1]; jj++)
+   {
+      l = pos[A_j[jj]];
+      if (l > -1)
+      {
+         rhs[l] = -A_data[jj];
+      }
+   }
+   for (k = 0; k < np; k++)
+   {
+      pos[P[k]] = -1;
+      y[k] = rhs[k];
+   }
+
+   if (hypre_FSAIDenseSolve(np, mat, y))
+   {
+      return -1.0;
+   }
+
+   for (k = 0; k < np; k++)
+   {
+      psi -= rhs[k] * y[k];
+   }
+
+   return psi;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_FSAI_Setup
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRelax_FSAI_Setup( hypre_ParCSRMatrix  *A,
+                              HYPRE_Int            algo_type,
+                              HYPRE_Int            max_steps,
+                              HYPRE_Int            max_step_size,
+                              HYPRE_Real           kap_tolerance,
+                              HYPRE_Int            eig_max_iters,
+                              hypre_CSRMatrix    **G_ptr,
+                              hypre_CSRMatrix    **GT_ptr,
+                              HYPRE_Real          *omega_ptr )
+{
+   MPI_Comm         comm        = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Int        num_rows    = hypre_CSRMatrixNumRows(A_diag);
+
+   hypre_CSRMatrix *G, *GT;
+   HYPRE_Real      *G_data;
+   HYPRE_Int       *G_i, *G_j;
+   HYPRE_Int       *row_max, *row_nnz;
+   HYPRE_Int        max_size, i, jj;
+
+   hypre_ParVector *x, *t, *w;
+   HYPRE_Real      *x_data, *t_data, *w_data;
+   HYPRE_Real       lambda, norm;
+   HYPRE_Int        iter;
+
+   if (algo_type == 0)
+   {
+      max_steps = 1;
+   }
+   max_steps     = hypre_max(max_steps, 0);
+   max_step_size = hypre_max(max_step_size, 1);
+
+   /*-----------------------------------------------------------------
+    * Upper bound on the number of entries of each row of G
+    *-----------------------------------------------------------------*/
+
+   row_max  = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   row_nnz  = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+   max_size = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      HYPRE_Int size = 0;
+
+      if (algo_type == 0)
+      {
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            if (A_diag_j[jj] < i)
+            {
+               size++;
+            }
+         }
+      }
+      else
+      {
+         size = hypre_min(i, max_steps * max_step_size);
+      }
+      max_size = hypre_max(max_size, size);
+      row_max[i+1] = row_max[i] + size + 1;
+   }
+
+   G_j    = hypre_CTAlloc(HYPRE_Int, row_max[num_rows], HYPRE_MEMORY_HOST);
+   G_data = hypre_CTAlloc(HYPRE_Real, row_max[num_rows], HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * Compute the rows of G, one row block per thread
+    *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, jj)
+#endif
+   {
+      HYPRE_Int  *pos    = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *mark   = hypre_CTAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      HYPRE_Real *grad   = hypre_CTAlloc(HYPRE_Real, num_rows, HYPRE_MEMORY_HOST);
+      HYPRE_Int  *cand   = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+      HYPRE_Real *mat    = hypre_TAlloc(HYPRE_Real, max_size * max_size + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Real *rhs    = hypre_TAlloc(HYPRE_Real, max_size + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Real *y      = hypre_TAlloc(HYPRE_Real, max_size + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Real *best_y = hypre_TAlloc(HYPRE_Real, max_size + 1, HYPRE_MEMORY_HOST);
+      HYPRE_Int   ns, ne, np, best_np, num_cand, step, k, l, col;
+      HYPRE_Real  a_ii, psi, best_psi, score, coef;
+      HYPRE_Int  *P;
+
+      hypre_GetSimpleThreadPartition(&ns, &ne, num_rows);
+
+      for (i = 0; i < num_rows; i++)
+      {
+         pos[i] = -1;
+      }
+
+      for (i = ns; i < ne; i++)
+      {
+         P    = G_j + row_max[i] + 1;
+         a_ii = 0.0;
+         for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+         {
+            if (A_diag_j[jj] == i)
+            {
+               a_ii = A_diag_data[jj];
+               break;
+            }
+         }
+
+         np       = 0;
+         best_np  = 0;
+         best_psi = a_ii;
+
+         if (algo_type == 0)
+         {
+            for (jj = A_diag_i[i]; jj < A_diag_i[i+1]; jj++)
+            {
+               if (A_diag_j[jj] < i)
+               {
+                  P[np++] = A_diag_j[jj];
+               }
+            }
+            psi = hypre_FSAISolveRow(A_diag_i, A_diag_j, A_diag_data, i, a_ii,
+                                     P, np, pos, mat, rhs, best_y);
+            if (psi > 0.0)
+            {
+               best_np  = np;
+               best_psi = psi;
+            }
+         }
+
+         for (step = 0; algo_type != 0 && step < max_steps; step++)
+         {
+            /* gradient of the Kaporin number: A(j,i) + A(j,P) y for j < i */
+            num_cand = 0;
+            for (k = -1; k < np; k++)
+            {
+               HYPRE_Int r = (k < 0) ? i : P[k];
+
+               coef = (k < 0) ? 1.0 : best_y[k];
+               for (jj = A_diag_i[r]; jj < A_diag_i[r+1]; jj++)
+               {
+                  col = A_diag_j[jj];
+                  if (col < i && mark[col] != i + 1)
+                  {
+                     if (mark[col] != -(i + 1))
+                     {
+                        mark[col] = -(i + 1);
+                        grad[col] = 0.0;
+                        cand[num_cand++] = col;
+                     }
+                     grad[col] += coef * A_diag_data[jj];
+                  }
+               }
+            }
+
+            /* move the max_step_size largest scaled gradients to P */
+            for (l = 0; l < max_step_size && l < num_cand; l++)
+            {
+               HYPRE_Int best = -1;
+               HYPRE_Real best_score = 0.0;
+
+               for (k = 0; k < num_cand; k++)
+               {
+                  col = cand[k];
+                  if (mark[col] == -(i + 1))
+                  {
+                     score = grad[col] * grad[col];
+                     for (jj = A_diag_i[col]; jj < A_diag_i[col+1]; jj++)
+                     {
+                        if (A_diag_j[jj] == col)
+                        {
+                           if (A_diag_data[jj] != 0.0)
+                           {
+                              score /= hypre_abs(A_diag_data[jj]);
+                           }
+                           break;
+                        }
+                     }
+                     if (score > best_score)
+                     {
+                        best_score = score;
+                        best = col;
+                     }
+                  }
+               }
+               if (best < 0)
+               {
+                  break;
+               }
+               mark[best] = i + 1;
+               P[np++] = best;
+            }
+            for (k = 0; k < num_cand; k++)
+            {
+               if (mark[cand[k]] == -(i + 1))
+               {
+                  mark[cand[k]] = 0;
+               }
+            }
+            if (np == best_np)
+            {
+               break;
+            }
+
+            psi = hypre_FSAISolveRow(A_diag_i, A_diag_j, A_diag_data, i, a_ii,
+                                     P, np, pos, mat, rhs, y);
+            if (psi <= 0.0)
+            {
+               np = best_np;
+               break;
+            }
+
+            score    = (best_psi - psi) / best_psi;
+            best_np  = np;
+            best_psi = psi;
+            for (k = 0; k < np; k++)
+            {
+               best_y[k] = y[k];
+            }
+            if (score < kap_tolerance)
+            {
+               break;
+            }
+         }
+
+         /* store the row, diagonal first */
+         row_nnz[i] = best_np + 1;
+         G_j[row_max[i]] = i;
+         if (best_psi > 0.0)
+         {
+            coef = 1.0 / sqrt(best_psi);
+         }
+         else
+         {
+            coef = (a_ii != 0.0) ? 1.0 / sqrt(hypre_abs(a_ii)) : 1.0;
+         }
+         G_data[row_max[i]] = coef;
+         for (k = 0; k < best_np; k++)
+         {
+            G_data[row_max[i] + 1 + k] = coef * best_y[k];
+         }
+      }
+
+      hypre_TFree(pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(mark, HYPRE_MEMORY_HOST);
+      hypre_TFree(grad, HYPRE_MEMORY_HOST);
+      hypre_TFree(cand, HYPRE_MEMORY_HOST);
+      hypre_TFree(mat, HYPRE_MEMORY_HOST);
+      hypre_TFree(rhs, HYPRE_MEMORY_HOST);
+      hypre_TFree(y, HYPRE_MEMORY_HOST);
+      hypre_TFree(best_y, HYPRE_MEMORY_HOST);
+   }
+
+   /*-----------------------------------------------------------------
+    * Compress G and form G^T
+    *-----------------------------------------------------------------*/
+
+   G_i = hypre_CTAlloc(HYPRE_Int, num_rows + 1, HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_rows; i++)
+   {
+      G_i[i+1] = G_i[i] + row_nnz[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = 0; jj < row_nnz[i]; jj++)
+      {
+         G_j[G_i[i] + jj]    = G_j[row_max[i] + jj];
+         G_data[G_i[i] + jj] = G_data[row_max[i] + jj];
+      }
+   }
+
+   G = hypre_CSRMatrixCreate(num_rows, num_rows, G_i[num_rows]);
+   hypre_CSRMatrixI(G)    = G_i;
+   hypre_CSRMatrixJ(G)    = hypre_TReAlloc(G_j, HYPRE_Int, G_i[num_rows], HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixData(G) = hypre_TReAlloc(G_data, HYPRE_Real, G_i[num_rows], HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(G) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixTranspose(G, &GT, 1);
+
+   hypre_TFree(row_max, HYPRE_MEMORY_HOST);
+   hypre_TFree(row_nnz, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------
+    * omega = 1 / lambda_max(G A G^T), estimated by power iteration
+    *-----------------------------------------------------------------*/
+
+   lambda = 1.0;
+   if (eig_max_iters > 0)
+   {
+      x = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(x);
+      hypre_ParVectorSetPartitioningOwner(x, 0);
+      t = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(t);
+      hypre_ParVectorSetPartitioningOwner(t, 0);
+      w = hypre_ParVectorCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixRowStarts(A));
+      hypre_ParVectorInitialize(w);
+      hypre_ParVectorSetPartitioningOwner(w, 0);
+      x_data = hypre_VectorData(hypre_ParVectorLocalVector(x));
+      t_data = hypre_VectorData(hypre_ParVectorLocalVector(t));
+      w_data = hypre_VectorData(hypre_ParVectorLocalVector(w));
+
+      hypre_ParVectorSetRandomValues(x, 2747);
+      for (iter = 0; iter < eig_max_iters; iter++)
+      {
+         norm = sqrt(hypre_ParVectorInnerProd(x, x));
+         if (norm == 0.0)
+         {
+            break;
+         }
+         hypre_ParVectorScale(1.0 / norm, x);
+
+         /* lambda = x^T G A G^T x, x = G A G^T x */
+         hypre_ParCSRRelax_FSAI_Apply(GT, x_data, t_data);
+         hypre_ParCSRMatrixMatvec(1.0, A, t, 0.0, w);
+         lambda = hypre_ParVectorInnerProd(t, w);
+         hypre_ParCSRRelax_FSAI_Apply(G, w_data, x_data);
+      }
+
+      hypre_ParVectorDestroy(x);
+      hypre_ParVectorDestroy(t);
+      hypre_ParVectorDestroy(w);
+   }
+
+   *G_ptr     = G;
+   *GT_ptr    = GT;
+   *omega_ptr = (lambda > 0.0) ? 1.0 / lambda : 1.0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_FSAI_Apply
+ *
+ * y = G x for the local factor G.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRelax_FSAI_Apply( hypre_CSRMatrix *G,
+                              HYPRE_Real      *x_data,
+                              HYPRE_Real      *y_data )
+{
+   HYPRE_Real *G_data   = hypre_CSRMatrixData(G);
+   HYPRE_Int  *G_i      = hypre_CSRMatrixI(G);
+   HYPRE_Int  *G_j      = hypre_CSRMatrixJ(G);
+   HYPRE_Int   num_rows = hypre_CSRMatrixNumRows(G);
+   HYPRE_Real  tmp;
+   HYPRE_Int   i, jj;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,tmp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      tmp = 0.0;
+      for (jj = G_i[i]; jj < G_i[i+1]; jj++)
+      {
+         tmp += G_data[jj] * x_data[G_j[jj]];
+      }
+      y_data[i] = tmp;
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRelax_FSAI_Solve
+ *
+ * One sweep of u = u + omega G^T G (f - A u).  v and z are work vectors
+ * with at least as many local entries as A has rows.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRelax_FSAI_Solve( hypre_ParCSRMatrix *A,
+                              hypre_ParVector    *f,
+                              hypre_CSRMatrix    *G,
+                              hypre_CSRMatrix    *GT,
+                              HYPRE_Real          omega,
+                              hypre_ParVector    *u,
+                              hypre_ParVector    *v,
+                              hypre_ParVector    *z )
+{
+   HYPRE_Real *u_data   = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real *v_data   = hypre_VectorData(hypre_ParVectorLocalVector(v));
+   HYPRE_Real *z_data   = hypre_VectorData(hypre_ParVectorLocalVector(z));
+   HYPRE_Int   num_rows = hypre_CSRMatrixNumRows(G);
+   HYPRE_Int   i;
+
+   hypre_ParCSRMatrixMatvecOutOfPlace(-1.0, A, u, 1.0, f, v);
+
+   hypre_ParCSRRelax_FSAI_Apply(G, v_data, z_data);
+   hypre_ParCSRRelax_FSAI_Apply(GT, z_data, v_data);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      u_data[i] += omega * v_data[i];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGFSAIDestroy
+ *
+ * Frees the FSAI factors of the first num_levels levels of a BoomerAMG
+ * hierarchy.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGFSAIDestroy( hypre_ParAMGData *amg_data,
+                            HYPRE_Int         num_levels )
+{
+   hypre_CSRMatrix **fsai_G  = hypre_ParAMGDataFSAIG(amg_data);
+   hypre_CSRMatrix **fsai_GT = hypre_ParAMGDataFSAIGT(amg_data);
+   HYPRE_Int         i;
+
+   for (i = 0; i < num_levels; i++)
+   {
+      if (fsai_G && fsai_G[i])
+      {
+         hypre_CSRMatrixDestroy(fsai_G[i]);
+      }
+      if (fsai_GT && fsai_GT[i])
+      {
+         hypre_CSRMatrixDestroy(fsai_GT[i]);
+      }
+   }
+   hypre_TFree(fsai_G, HYPRE_MEMORY_HOST);
+   hypre_TFree(fsai_GT, HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParAMGDataFSAIOmega(amg_data), HYPRE_MEMORY_HOST);
+   hypre_ParAMGDataFSAIG(amg_data)     = NULL;
+   hypre_ParAMGDataFSAIGT(amg_data)    = NULL;
+   hypre_ParAMGDataFSAIOmega(amg_data) = NULL;
+
+   return hypre_error_flag;
+}
@@ -76,6 +76,15 @@ hypre_ILUCreate()
    /* reordering_type default to use local RCM */
    (ilu_data -> reordering_type) = 1;
 
+   /* sequential triangular solves by default */
+   (ilu_data -> level_scheduling) = 0;
+   (ilu_data -> num_lower_levels) = 0;
+   (ilu_data -> lower_level_ptr) = NULL;
+   (ilu_data -> lower_level_rows) = NULL;
+   (ilu_data -> num_upper_levels) = 0;
+   (ilu_data -> upper_level_ptr) = NULL;
+   (ilu_data -> upper_level_rows) = NULL;
+
    /* see hypre_ILUSetType for more default values */
 
    return (void *)                     ilu_data;
@@ -197,6 +206,11 @@ hypre_ILUDestroy( void *data )
       hypre_TFree((ilu_data -> CF_marker_array), HYPRE_MEMORY_HOST);
       (ilu_data -> CF_marker_array) = NULL;
    }
+   /* level sets */
+   hypre_TFree((ilu_data -> lower_level_ptr), HYPRE_MEMORY_HOST);
+   hypre_TFree((ilu_data -> lower_level_rows), HYPRE_MEMORY_HOST);
+   hypre_TFree((ilu_data -> upper_level_ptr), HYPRE_MEMORY_HOST);
+   hypre_TFree((ilu_data -> upper_level_rows), HYPRE_MEMORY_HOST);
    /* permutation array */
    if((ilu_data -> perm))
    {
@@ -384,6 +398,15 @@ hypre_ILUSetLocalReordering( void *ilu_vdata, HYPRE_Int ordering_type )
    return hypre_error_flag;
 }
 
+/* Set whether the triangular solves are level scheduled */
+HYPRE_Int
+hypre_ILUSetLevelScheduling( void *ilu_vdata, HYPRE_Int level_scheduling )
+{
+   hypre_ParILUData   *ilu_data = (hypre_ParILUData*) ilu_vdata;
+   (ilu_data -> level_scheduling) = level_scheduling;
+   return hypre_error_flag;
+}
+
 /* Set KDim (for GMRES) for Solver of Schur System */
 HYPRE_Int
 hypre_ILUSetSchurSolverKDIM( void *ilu_vdata, HYPRE_Int ss_kDim )
@@ -1226,7 +1249,7 @@ hypre_ILUGetPermddPQPre(HYPRE_Int n, HYPRE_Int nLU, HYPRE_Int *A_diag_i, HYPRE_I
  * nI: number of interial nodes
  * tol: the dropping tolorance for ddPQ
  * reordering_type: Type of reordering for the interior nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1 for RCM, 2 for multicoloring. Set to 0 for no reordering.
  */
 
 HYPRE_Int
@@ -1342,6 +1365,10 @@ hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **io_pperm, HYPRE_Int **io
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm, 0);
          break;
+      case 2:
+         /* multicoloring */
+         hypre_ILULocalMulticolor( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, nLU, &pperm, &qperm, 0);
@@ -1367,7 +1394,7 @@ hypre_ILUGetPermddPQ(hypre_ParCSRMatrix *A, HYPRE_Int **io_pperm, HYPRE_Int **io
  * perm: permutation array
  * nLU: number of interial nodes
  * reordering_type: Type of (additional) reordering for the interior nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1 for RCM, 2 for multicoloring. Set to 0 for no reordering.
  */
 HYPRE_Int
 hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type)
@@ -1437,6 +1464,10 @@ hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm, 1);
          break;
+      case 2:
+         /* multicoloring */
+         hypre_ILULocalMulticolor( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, first, &temp_perm, &temp_perm, 1);
@@ -1458,7 +1489,7 @@ hypre_ILUGetInteriorExteriorPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_
  * perm: permutation array
  * nLU: number of interior nodes
  * reordering_type: Type of (additional) reordering for the nodes.
- * Currently only supports RCM reordering. Set to 0 for no reordering.
+ * 1 for RCM, 2 for multicoloring. Set to 0 for no reordering.
  */
 HYPRE_Int
 hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, HYPRE_Int reordering_type)
@@ -1482,6 +1513,10 @@ hypre_ILUGetLocalPerm(hypre_ParCSRMatrix *A, HYPRE_Int **perm, HYPRE_Int *nLU, H
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm, 1);
          break;
+      case 2:
+         /* multicoloring */
+         hypre_ILULocalMulticolor( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm);
+         break;
       default:
          /* RCM */
          hypre_ILULocalRCM( hypre_ParCSRMatrixDiag(A), 0, n, &temp_perm, &temp_perm, 1);
@@ -2539,6 +2574,271 @@ hypre_ILULocalRCMReverse(HYPRE_Int *perm, HYPRE_Int start, HYPRE_Int end)
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ILULocalMulticolor
+ *--------------------------------------------------------------------------*/
+
+/* This function computes a greedy multicoloring of a sub matrix of
+ * sparse matrix B = A(perm,perm) and reorders it color by color, so that
+ * the rows of one color have no connections to each other.
+ * The coloring is done on the graph of B + B'.
+ * A: The input CSR matrix
+ * start:      the start position of the submatrix in B
+ * end:        the end position of the submatrix in B ( exclude end, [start,end) )
+ * permp:      pointer to the row permutation array such that B = A(perm, perm)
+ *             point to NULL if you want to work directly on A
+ *             on return, permp will point to the new permutation where
+ *             in [start, end) the matrix will reordered
+ * qpermp:     pointer to the col permutation array such that B = A(perm, perm)
+ *             point to NULL or equal to permp if you want symmetric order
+ *             on return, qpermp will point to the new permutation where
+ *             in [start, end) the matrix will reordered
+ */
+HYPRE_Int
+hypre_ILULocalMulticolor( hypre_CSRMatrix *A, HYPRE_Int start, HYPRE_Int end,
+                          HYPRE_Int **permp, HYPRE_Int **qpermp)
+{
+   HYPRE_Int               i, j, k, row, col, c;
+
+   HYPRE_Int               num_nodes      = end - start;
+   HYPRE_Int               n              = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int               ncol           = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int               *A_i           = hypre_CSRMatrixI(A);
+   HYPRE_Int               *A_j           = hypre_CSRMatrixJ(A);
+   HYPRE_Int               *perm          = *permp;
+   HYPRE_Int               *qperm         = *qpermp;
+   HYPRE_Int               *rqperm;
+   HYPRE_Int               *G_i, *G_j, *GT_i, *GT_j;
+   HYPRE_Int               *color, *color_marker, *color_start;
+   HYPRE_Int               *perm_temp;
+   HYPRE_Int               num_colors;
+
+   if(num_nodes <= 0)
+   {
+      return hypre_error_flag;
+   }
+   if(n!=ncol || end > n || start < 0)
+   {
+      hypre_printf("Error input, abort multicoloring\n");
+      return hypre_error_flag;
+   }
+   if(!perm)
+   {
+      perm = hypre_TAlloc( HYPRE_Int, n, HYPRE_MEMORY_DEVICE);
+      for(i = 0 ; i < n ; i ++)
+      {
+         perm[i] = i;
+      }
+   }
+   if(!qperm)
+   {
+      qperm = perm;
+   }
+   rqperm = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      rqperm[qperm[i]] = i;
+   }
+
+   /* graph of B restricted to [start, end) and its transpose */
+   G_i = hypre_CTAlloc(HYPRE_Int, num_nodes + 1, HYPRE_MEMORY_HOST);
+   GT_i = hypre_CTAlloc(HYPRE_Int, num_nodes + 1, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      row = perm[i + start];
+      G_i[i+1] = G_i[i];
+      for(j = A_i[row] ; j < A_i[row+1] ; j ++)
+      {
+         col = rqperm[A_j[j]];
+         if(col != i + start && col >= start && col < end)
+         {
+            G_i[i+1]++;
+            GT_i[col - start + 1]++;
+         }
+      }
+   }
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      GT_i[i+1] += GT_i[i];
+   }
+   G_j = hypre_TAlloc(HYPRE_Int, G_i[num_nodes], HYPRE_MEMORY_HOST);
+   GT_j = hypre_TAlloc(HYPRE_Int, G_i[num_nodes], HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      row = perm[i + start];
+      k = G_i[i];
+      for(j = A_i[row] ; j < A_i[row+1] ; j ++)
+      {
+         col = rqperm[A_j[j]];
+         if(col != i + start && col >= start && col < end)
+         {
+            G_j[k++] = col - start;
+            GT_j[GT_i[col - start]++] = i;
+         }
+      }
+   }
+   for(i = num_nodes ; i > 0 ; i --)
+   {
+      GT_i[i] = GT_i[i-1];
+   }
+   GT_i[0] = 0;
+
+   /* greedy coloring: smallest color not used by any neighbor */
+   color = hypre_TAlloc(HYPRE_Int, num_nodes, HYPRE_MEMORY_HOST);
+   color_marker = hypre_TAlloc(HYPRE_Int, num_nodes + 1, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      color[i] = -1;
+      color_marker[i] = -1;
+   }
+   color_marker[num_nodes] = -1;
+   num_colors = 0;
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      for(j = G_i[i] ; j < G_i[i+1] ; j ++)
+      {
+         if(color[G_j[j]] > -1)
+         {
+            color_marker[color[G_j[j]]] = i;
+         }
+      }
+      for(j = GT_i[i] ; j < GT_i[i+1] ; j ++)
+      {
+         if(color[GT_j[j]] > -1)
+         {
+            color_marker[color[GT_j[j]]] = i;
+         }
+      }
+      for(c = 0 ; color_marker[c] == i ; c ++);
+      color[i] = c;
+      num_colors = hypre_max(num_colors, c + 1);
+   }
+
+   /* stable sort of the nodes by color */
+   color_start = hypre_CTAlloc(HYPRE_Int, num_colors + 1, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < num_nodes ; i ++)
+   {
+      color_start[color[i] + 1]++;
+   }
+   for(c = 0 ; c < num_colors ; c ++)
+   {
+      color_start[c+1] += color_start[c];
+   }
+   perm_temp = hypre_TAlloc(HYPRE_Int, num_nodes, HYPRE_MEMORY_HOST);
+   for( i = 0 ; i < num_nodes ; i ++)
+   {
+      perm_temp[color_start[color[i]]++] = perm[i + start];
+   }
+   if(perm != qperm)
+   {
+      for(c = num_colors ; c > 0 ; c --)
+      {
+         color_start[c] = color_start[c-1];
+      }
+      color_start[0] = 0;
+      for( i = 0 ; i < num_nodes ; i ++)
+      {
+         color_marker[color_start[color[i]]++] = qperm[i + start];
+      }
+      for( i = 0 ; i < num_nodes ; i ++)
+      {
+         qperm[i+start] = color_marker[i];
+      }
+   }
+   for( i = 0 ; i < num_nodes ; i ++)
+   {
+      perm[i+start] = perm_temp[i];
+   }
+
+   *permp   = perm;
+   *qpermp  = qperm;
+
+   hypre_TFree(G_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(G_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(GT_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(GT_j, HYPRE_MEMORY_HOST);
+   hypre_TFree(color, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(color_start, HYPRE_MEMORY_HOST);
+   hypre_TFree(perm_temp, HYPRE_MEMORY_HOST);
+   hypre_TFree(rqperm, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ILUBuildLevelSets
+ *--------------------------------------------------------------------------*/
+
+/* This function groups the first n rows of a triangular factor T into
+ * level sets: the rows of one level only depend on rows of earlier levels,
+ * so they can be eliminated in parallel.
+ * T:          the L (lower != 0) or U (lower == 0) factor, in the local
+ *             (permuted) numbering of the factorization
+ * n:          number of rows to schedule (nLU)
+ * T_end:      if not NULL, only the entries T_i[i] <= j < T_end[i] of
+ *             row i are used (u_end of the Schur complement variants)
+ * num_levels_ptr, level_ptr_ptr, level_rows_ptr:
+ *             on return, the rows of level l are
+ *             level_rows[level_ptr[l]], ..., level_rows[level_ptr[l+1]-1]
+ */
+HYPRE_Int
+hypre_ILUBuildLevelSets( hypre_CSRMatrix *T, HYPRE_Int n, HYPRE_Int *T_end, HYPRE_Int lower,
+                         HYPRE_Int *num_levels_ptr, HYPRE_Int **level_ptr_ptr,
+                         HYPRE_Int **level_rows_ptr)
+{
+   HYPRE_Int   *T_i = hypre_CSRMatrixI(T);
+   HYPRE_Int   *T_j = hypre_CSRMatrixJ(T);
+   HYPRE_Int   *level = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   HYPRE_Int   *level_ptr, *level_rows;
+   HYPRE_Int   num_levels = 0;
+   HYPRE_Int   i, ii, j, k1, k2, col;
+
+   for(ii = 0 ; ii < n ; ii ++)
+   {
+      i = lower ? ii : n - 1 - ii;
+      level[i] = 0;
+      k1 = T_i[i] ; k2 = T_end ? T_end[i] : T_i[i+1];
+      for(j = k1 ; j < k2 ; j ++)
+      {
+         col = T_j[j];
+         if((lower && col < i) || (!lower && col > i && col < n))
+         {
+            level[i] = hypre_max(level[i], level[col] + 1);
+         }
+      }
+      num_levels = hypre_max(num_levels, level[i] + 1);
+   }
+
+   level_ptr = hypre_CTAlloc(HYPRE_Int, num_levels + 1, HYPRE_MEMORY_HOST);
+   level_rows = hypre_TAlloc(HYPRE_Int, n, HYPRE_MEMORY_HOST);
+   for(i = 0 ; i < n ; i ++)
+   {
+      level_ptr[level[i] + 1]++;
+   }
+   for(i = 0 ; i < num_levels ; i ++)
+   {
+      level_ptr[i+1] += level_ptr[i];
+   }
+   for(i = 0 ; i < n ; i ++)
+   {
+      level_rows[level_ptr[level[i]]++] = i;
+   }
+   for(i = num_levels ; i > 0 ; i --)
+   {
+      level_ptr[i] = level_ptr[i-1];
+   }
+   level_ptr[0] = 0;
+
+   *num_levels_ptr = num_levels;
+   *level_ptr_ptr = level_ptr;
+   *level_rows_ptr = level_rows;
+
+   hypre_TFree(level, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
+
 /* NSH create and solve and help functions */
 
 /* Create */
@@ -111,6 +111,18 @@ hypre_ILUSetup( void               *ilu_vdata,
    }
 
 
+   /* clear old level sets, if created */
+   hypre_TFree(hypre_ParILUDataLowerLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataLowerLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelPtr(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_ParILUDataUpperLevelRows(ilu_data), HYPRE_MEMORY_HOST);
+   hypre_ParILUDataLowerLevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataLowerLevelRows(ilu_data) = NULL;
+   hypre_ParILUDataUpperLevelPtr(ilu_data) = NULL;
+   hypre_ParILUDataUpperLevelRows(ilu_data) = NULL;
+   hypre_ParILUDataNumLowerLevels(ilu_data) = 0;
+   hypre_ParILUDataNumUpperLevels(ilu_data) = 0;
+
    /* clear old l1_norm data, if created */
    if(hypre_ParILUDataL1Norms(ilu_data))
    {
@@ -256,6 +268,38 @@ hypre_ILUSetup( void               *ilu_vdata,
       default: hypre_ILUSetupILU0(matA, perm, perm, n, n, &matL, &matD, &matU, &matS, &u_end);//BJ + hypre_ilu0()
                break;
    }
+
+   /* group the rows of the local factors into level sets for the solve */
+   if(hypre_ParILUDataLevelScheduling(ilu_data))
+   {
+      switch(ilu_type)
+      {
+         case 30: case 31:
+            /* RAS: the factors include the external rows, keep the sequential solve */
+            break;
+         case 10: case 11: case 20: case 21: case 40: case 41:
+            hypre_ILUBuildLevelSets(hypre_ParCSRMatrixDiag(matL), nLU, NULL, 1,
+                  &hypre_ParILUDataNumLowerLevels(ilu_data),
+                  &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                  &hypre_ParILUDataLowerLevelRows(ilu_data));
+            hypre_ILUBuildLevelSets(hypre_ParCSRMatrixDiag(matU), nLU, u_end, 0,
+                  &hypre_ParILUDataNumUpperLevels(ilu_data),
+                  &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                  &hypre_ParILUDataUpperLevelRows(ilu_data));
+            break;
+         default:
+            hypre_ILUBuildLevelSets(hypre_ParCSRMatrixDiag(matL), n, NULL, 1,
+                  &hypre_ParILUDataNumLowerLevels(ilu_data),
+                  &hypre_ParILUDataLowerLevelPtr(ilu_data),
+                  &hypre_ParILUDataLowerLevelRows(ilu_data));
+            hypre_ILUBuildLevelSets(hypre_ParCSRMatrixDiag(matU), n, NULL, 0,
+                  &hypre_ParILUDataNumUpperLevels(ilu_data),
+                  &hypre_ParILUDataUpperLevelPtr(ilu_data),
+                  &hypre_ParILUDataUpperLevelRows(ilu_data));
+            break;
+      }
+   }
+
    /* setup Schur solver */
    switch(ilu_type)
    {
@@ -284,6 +328,7 @@ hypre_ILUSetup( void               *ilu_vdata,
             hypre_ILUSetOwnDropThreshold  (schur_precond, 0);/* using exist droptol */
             HYPRE_ILUSetPrintLevel        (schur_precond, (ilu_data -> sp_print_level));
             HYPRE_ILUSetMaxIter           (schur_precond, (ilu_data -> sp_max_iter));
+            HYPRE_ILUSetLevelScheduling   (schur_precond, hypre_ParILUDataLevelScheduling(ilu_data));
             //HYPRE_ILUSetTol               (schur_precond, (ilu_data -> sp_tol));
             HYPRE_ILUSetTol               (schur_precond, 0.); /* set tol for preconditioner to zero. Avoids triggering hypre error for non convergence -DOK*/
 
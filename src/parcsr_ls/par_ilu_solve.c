@@ -75,6 +75,14 @@ hypre_ILUSolve( void               *ilu_vdata,
    HYPRE_Int            nLU            = hypre_ParILUDataNLU(ilu_data);
    HYPRE_Int            *u_end         = hypre_ParILUDataUEnd(ilu_data);
 
+   /* level sets of the L and U factors */
+   HYPRE_Int            num_lower_levels = hypre_ParILUDataNumLowerLevels(ilu_data);
+   HYPRE_Int            *lower_level_ptr = hypre_ParILUDataLowerLevelPtr(ilu_data);
+   HYPRE_Int            *lower_level_rows = hypre_ParILUDataLowerLevelRows(ilu_data);
+   HYPRE_Int            num_upper_levels = hypre_ParILUDataNumUpperLevels(ilu_data);
+   HYPRE_Int            *upper_level_ptr = hypre_ParILUDataUpperLevelPtr(ilu_data);
+   HYPRE_Int            *upper_level_rows = hypre_ParILUDataUpperLevelRows(ilu_data);
+
    /* Schur system solve */
    HYPRE_Solver         schur_solver   = hypre_ParILUDataSchurSolver(ilu_data);
    HYPRE_Solver         schur_precond  = hypre_ParILUDataSchurPrecond(ilu_data);
@@ -210,25 +218,35 @@ hypre_ILUSolve( void               *ilu_vdata,
       /* Do one solve on LUe=r */
       switch(ilu_type){
          case 0: case 1:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
             break;
          case 10: case 11:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, perm, nLU, matL, matD, matU, matS,
-                  Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
+                  Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //GMRES
             break;
          case 20: case 21:
             hypre_ILUSolveSchurNSH(matA, F_array, U_array, perm, nLU, matL, matD, matU, matS,
-                  Utemp, Ftemp, schur_solver, rhs, x, u_end); //MR+NSH
+                  Utemp, Ftemp, schur_solver, rhs, x, u_end,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //MR+NSH
             break;
          case 30: case 31:
             hypre_ILUSolveLURAS(matA, F_array, U_array, perm, matL, matD, matU, Utemp, Utemp, fext, uext); //RAS
             break;
          case 40: case 41:
             hypre_ILUSolveSchurGMRES(matA, F_array, U_array, perm, qperm, nLU, matL, matD, matU, matS,
-                  Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end); //GMRES
+                  Utemp, Ftemp, schur_solver, schur_precond, rhs, x, u_end,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //GMRES
             break;
          default:
-            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp); //BJ
+            hypre_ILUSolveLU(matA, F_array, U_array, perm, n, matL, matD, matU, Utemp, Ftemp,
+                  num_lower_levels, lower_level_ptr, lower_level_rows,
+                  num_upper_levels, upper_level_ptr, upper_level_rows); //BJ
             break;
 
       }
@@ -317,6 +335,77 @@ hypre_ILUSolve( void               *ilu_vdata,
    return hypre_error_flag;
 }
 
+/* Level scheduled triangular solves
+ * The rows of one level set only depend on rows of earlier levels (see
+ * hypre_ILUBuildLevelSets), so each level is done as a parallel loop.
+ * Lower solve: u[qperm[i]] = f[perm[i]] - L(i,:)*u(qperm)
+ * Upper solve: u[qperm[i]] = D[i] * (u[qperm[i]] - U(i,:)*u(qperm)),
+ * only using the entries up to u_end[i] if u_end is not NULL.
+*/
+
+HYPRE_Int
+hypre_ILUSolveLowerLevels(hypre_CSRMatrix *L_diag, HYPRE_Int *perm, HYPRE_Int *qperm,
+                  HYPRE_Real *f_data, HYPRE_Real *u_data, HYPRE_Int num_levels,
+                  HYPRE_Int *level_ptr, HYPRE_Int *level_rows)
+{
+   HYPRE_Real        *L_diag_data = hypre_CSRMatrixData(L_diag);
+   HYPRE_Int         *L_diag_i = hypre_CSRMatrixI(L_diag);
+   HYPRE_Int         *L_diag_j = hypre_CSRMatrixJ(L_diag);
+   HYPRE_Int         level, ii, i, j;
+   HYPRE_Real        sum;
+
+   for(level = 0 ; level < num_levels ; level ++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i,j,sum) HYPRE_SMP_SCHEDULE
+#endif
+      for(ii = level_ptr[level] ; ii < level_ptr[level+1] ; ii ++)
+      {
+         i = level_rows[ii];
+         sum = f_data[perm[i]];
+         for(j = L_diag_i[i] ; j < L_diag_i[i+1] ; j ++)
+         {
+            sum -= L_diag_data[j] * u_data[qperm[L_diag_j[j]]];
+         }
+         u_data[qperm[i]] = sum;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+HYPRE_Int
+hypre_ILUSolveUpperLevels(hypre_CSRMatrix *U_diag, HYPRE_Int *u_end, HYPRE_Real *D,
+                  HYPRE_Int *qperm, HYPRE_Real *u_data, HYPRE_Int num_levels,
+                  HYPRE_Int *level_ptr, HYPRE_Int *level_rows)
+{
+   HYPRE_Real        *U_diag_data = hypre_CSRMatrixData(U_diag);
+   HYPRE_Int         *U_diag_i = hypre_CSRMatrixI(U_diag);
+   HYPRE_Int         *U_diag_j = hypre_CSRMatrixJ(U_diag);
+   HYPRE_Int         level, ii, i, j, k2;
+   HYPRE_Real        sum;
+
+   for(level = 0 ; level < num_levels ; level ++)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(ii,i,j,k2,sum) HYPRE_SMP_SCHEDULE
+#endif
+      for(ii = level_ptr[level] ; ii < level_ptr[level+1] ; ii ++)
+      {
+         i = level_rows[ii];
+         k2 = u_end ? u_end[i] : U_diag_i[i+1];
+         sum = u_data[qperm[i]];
+         for(j = U_diag_i[i] ; j < k2 ; j ++)
+         {
+            sum -= U_diag_data[j] * u_data[qperm[U_diag_j[j]]];
+         }
+         u_data[qperm[i]] = sum * D[i];
+      }
+   }
+
+   return hypre_error_flag;
+}
+
 /* Schur Complement solve with GMRES on schur complement
  * ParCSRMatrix S is already built in ilu data sturcture, here directly use S
  * L, D and U factors only have local scope (no off-diagonal processor terms)
@@ -336,7 +425,9 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParCSRMatrix *S,
                   hypre_ParVector *ftemp, hypre_ParVector *utemp,
                   HYPRE_Solver schur_solver, HYPRE_Solver schur_precond,
-                  hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end)
+                  hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
    /* data objects for communication */
    //   MPI_Comm          comm = hypre_ParCSRMatrixComm(A);
@@ -384,13 +475,21 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    //   f_local = hypre_ParVectorLocalVector(f);
    //   f_data = hypre_VectorData(f_local);
    /* now update with L to solve */
-   for(i = 0 ; i < nLU ; i ++)
+   if(lower_level_ptr)
    {
-      utemp_data[qperm[i]] = ftemp_data[perm[i]];
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveLowerLevels(L_diag, perm, qperm, ftemp_data, utemp_data,
+            num_lower_levels, lower_level_ptr, lower_level_rows);
+   }
+   else
+   {
+      for(i = 0 ; i < nLU ; i ++)
       {
-         utemp_data[qperm[i]] -= L_diag_data[j] * utemp_data[qperm[L_diag_j[j]]];
+         utemp_data[qperm[i]] = ftemp_data[perm[i]];
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
+         for(j = k1 ; j < k2 ; j ++)
+         {
+            utemp_data[qperm[i]] -= L_diag_data[j] * utemp_data[qperm[L_diag_j[j]]];
+         }
       }
    }
 
@@ -463,15 +562,23 @@ hypre_ILUSolveSchurGMRES(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    /* 5th need to solve UBi*ui = zi */
    /* put result in u_temp upper */
-   for(i = nLU-1 ; i >= 0 ; i --)
+   if(upper_level_ptr)
    {
-      k1 = U_diag_i[i] ; k2 = u_end[i];
-      for(j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveUpperLevels(U_diag, u_end, D, qperm, utemp_data,
+            num_upper_levels, upper_level_ptr, upper_level_rows);
+   }
+   else
+   {
+      for(i = nLU-1 ; i >= 0 ; i --)
       {
-         col = U_diag_j[j];
-         utemp_data[qperm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
+         k1 = U_diag_i[i] ; k2 = u_end[i];
+         for(j = k1 ; j < k2 ; j ++)
+         {
+            col = U_diag_j[j];
+            utemp_data[qperm[i]] -= U_diag_data[j] * utemp_data[qperm[col]];
+         }
+         utemp_data[qperm[i]] *= D[i];
       }
-      utemp_data[qperm[i]] *= D[i];
    }
 
    /* done, now everything are in u_temp, update solution */
@@ -498,7 +605,9 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParCSRMatrix *S,
                   hypre_ParVector *ftemp, hypre_ParVector *utemp,
                   HYPRE_Solver schur_solver,
-                  hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end)
+                  hypre_ParVector *rhs, hypre_ParVector *x, HYPRE_Int *u_end,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
    /* data objects for communication */
    //   MPI_Comm          comm = hypre_ParCSRMatrixComm(A);
@@ -546,13 +655,21 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    //   f_local = hypre_ParVectorLocalVector(f);
    //   f_data = hypre_VectorData(f_local);
    /* now update with L to solve */
-   for(i = 0 ; i < nLU ; i ++)
+   if(lower_level_ptr)
    {
-      utemp_data[perm[i]] = ftemp_data[perm[i]];
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveLowerLevels(L_diag, perm, perm, ftemp_data, utemp_data,
+            num_lower_levels, lower_level_ptr, lower_level_rows);
+   }
+   else
+   {
+      for(i = 0 ; i < nLU ; i ++)
       {
-         utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         utemp_data[perm[i]] = ftemp_data[perm[i]];
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
+         for(j = k1 ; j < k2 ; j ++)
+         {
+            utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         }
       }
    }
 
@@ -627,15 +744,23 @@ hypre_ILUSolveSchurNSH(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
 
    /* 5th need to solve UBi*ui = zi */
    /* put result in u_temp upper */
-   for(i = nLU-1 ; i >= 0 ; i --)
+   if(upper_level_ptr)
    {
-      k1 = U_diag_i[i] ; k2 = u_end[i];
-      for(j = k1 ; j < k2 ; j ++)
+      hypre_ILUSolveUpperLevels(U_diag, u_end, D, perm, utemp_data,
+            num_upper_levels, upper_level_ptr, upper_level_rows);
+   }
+   else
+   {
+      for(i = nLU-1 ; i >= 0 ; i --)
       {
-         col = U_diag_j[j];
-         utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
+         k1 = U_diag_i[i] ; k2 = u_end[i];
+         for(j = k1 ; j < k2 ; j ++)
+         {
+            col = U_diag_j[j];
+            utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[col]];
+         }
+         utemp_data[perm[i]] *= D[i];
       }
-      utemp_data[perm[i]] *= D[i];
    }
 
    /* done, now everything are in u_temp, update solution */
@@ -655,7 +780,9 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
                   hypre_ParVector    *u, HYPRE_Int *perm,
                   HYPRE_Int nLU, hypre_ParCSRMatrix *L,
                   HYPRE_Real* D, hypre_ParCSRMatrix *U,
-                  hypre_ParVector *ftemp, hypre_ParVector *utemp)
+                  hypre_ParVector *ftemp, hypre_ParVector *utemp,
+                  HYPRE_Int num_lower_levels, HYPRE_Int *lower_level_ptr, HYPRE_Int *lower_level_rows,
+                  HYPRE_Int num_upper_levels, HYPRE_Int *upper_level_ptr, HYPRE_Int *upper_level_rows)
 {
    hypre_CSRMatrix *L_diag = hypre_ParCSRMatrixDiag(L);
    HYPRE_Real      *L_diag_data = hypre_CSRMatrixData(L_diag);
@@ -690,31 +817,47 @@ hypre_ILUSolveLU(hypre_ParCSRMatrix *A, hypre_ParVector    *f,
    hypre_ParCSRMatrixMatvecOutOfPlace(alpha, A, u, beta, f, ftemp);
 
    /* L solve - Forward solve */
-   /* copy rhs to account for diagonal of L (which is identity) */
-   for( i = 0; i < nLU; i++ )
+   if(lower_level_ptr)
    {
-      utemp_data[perm[i]] = ftemp_data[perm[i]];
+      hypre_ILUSolveLowerLevels(L_diag, perm, perm, ftemp_data, utemp_data,
+            num_lower_levels, lower_level_ptr, lower_level_rows);
    }
-   /* update with remaining (off-diagonal) entries of L */
-   for( i = 0; i < nLU; i++ )
+   else
    {
-      k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
-      for(j=k1; j <k2; j++)
+      /* copy rhs to account for diagonal of L (which is identity) */
+      for( i = 0; i < nLU; i++ )
       {
-         utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         utemp_data[perm[i]] = ftemp_data[perm[i]];
+      }
+      /* update with remaining (off-diagonal) entries of L */
+      for( i = 0; i < nLU; i++ )
+      {
+         k1 = L_diag_i[i] ; k2 = L_diag_i[i+1];
+         for(j=k1; j <k2; j++)
+         {
+            utemp_data[perm[i]] -= L_diag_data[j] * utemp_data[perm[L_diag_j[j]]];
+         }
       }
    }
    /*-------------------- U solve - Backward substitution */
-   for( i = nLU-1; i >= 0; i-- )
+   if(upper_level_ptr)
    {
-      /* first update with the remaining (off-diagonal) entries of U */
-      k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
-      for(j=k1; j <k2; j++)
+      hypre_ILUSolveUpperLevels(U_diag, NULL, D, perm, utemp_data,
+            num_upper_levels, upper_level_ptr, upper_level_rows);
+   }
+   else
+   {
+      for( i = nLU-1; i >= 0; i-- )
       {
-         utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+         /* first update with the remaining (off-diagonal) entries of U */
+         k1 = U_diag_i[i] ; k2 = U_diag_i[i+1];
+         for(j=k1; j <k2; j++)
+         {
+            utemp_data[perm[i]] -= U_diag_data[j] * utemp_data[perm[U_diag_j[j]]];
+         }
+         /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
+         utemp_data[perm[i]] *= D[i];
       }
-      /* diagonal scaling (contribution from D. Note: D is stored as its inverse) */
-      utemp_data[perm[i]] *= D[i];
    }
 
    /* Update solution */
@@ -370,18 +370,18 @@ hypre_BoomerAMGBuildInterp( hypre_ParCSRMatrix   *A,
 
    P_diag_size = jj_counter;
 
-   P_diag_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
-   P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, HYPRE_MEMORY_DEVICE);
-   P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, HYPRE_MEMORY_DEVICE);
+   P_diag_i    = hypre_CTAllocFirstTouch(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
+   P_diag_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_diag_size, HYPRE_MEMORY_DEVICE);
+   P_diag_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_diag_size, HYPRE_MEMORY_DEVICE);
 
    P_diag_i[n_fine] = jj_counter;
 
 
    P_offd_size = jj_counter_offd;
 
-   P_offd_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
-   P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, HYPRE_MEMORY_DEVICE);
-   P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, HYPRE_MEMORY_DEVICE);
+   P_offd_i    = hypre_CTAllocFirstTouch(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
+   P_offd_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_offd_size, HYPRE_MEMORY_DEVICE);
+   P_offd_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_offd_size, HYPRE_MEMORY_DEVICE);
 
    /*-----------------------------------------------------------------------
     *  Intialize some stuff.
@@ -2234,18 +2234,18 @@ hypre_BoomerAMGBuildDirInterpHost( hypre_ParCSRMatrix   *A,
 
    P_diag_size = jj_counter;
 
-   P_diag_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
-   P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, HYPRE_MEMORY_DEVICE);
-   P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, HYPRE_MEMORY_DEVICE);
+   P_diag_i    = hypre_CTAllocFirstTouch(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
+   P_diag_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_diag_size, HYPRE_MEMORY_DEVICE);
+   P_diag_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_diag_size, HYPRE_MEMORY_DEVICE);
 
    P_diag_i[n_fine] = jj_counter;
 
 
    P_offd_size = jj_counter_offd;
 
-   P_offd_i    = hypre_CTAlloc(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
-   P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, HYPRE_MEMORY_DEVICE);
-   P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, HYPRE_MEMORY_DEVICE);
+   P_offd_i    = hypre_CTAllocFirstTouch(HYPRE_Int,  n_fine+1,    HYPRE_MEMORY_DEVICE);
+   P_offd_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_offd_size, HYPRE_MEMORY_DEVICE);
+   P_offd_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_offd_size, HYPRE_MEMORY_DEVICE);
 
    /*-----------------------------------------------------------------------
     *  Intialize some stuff.
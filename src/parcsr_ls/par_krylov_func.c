@@ -177,6 +177,23 @@ hypre_ParKrylovInnerProd( void *x,
                                       (hypre_ParVector *) y ) );
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParKrylovInnerProdStart
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParKrylovInnerProdStart( HYPRE_Int           n,
+                               void              **x,
+                               void              **y,
+                               HYPRE_Real         *local_result,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   return ( hypre_ParVectorInnerProdStart( n, (hypre_ParVector **) x,
+                                           (hypre_ParVector **) y,
+                                           local_result, result, request ) );
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParKrylovMassInnerProd
  *--------------------------------------------------------------------------*/
@@ -191,8 +191,8 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
    /*-----------------------------------------------------------------------
     *  Intialize counters and allocate mapping vector.
     *-----------------------------------------------------------------------*/
-   P_diag_i    = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
-   P_offd_i    = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
+   P_diag_i    = hypre_CTAllocFirstTouch(HYPRE_Int, n_fine+1, memory_location_P);
+   P_offd_i    = hypre_CTAllocFirstTouch(HYPRE_Int, n_fine+1, memory_location_P);
 
    if (n_fine)
    {
@@ -365,14 +365,14 @@ hypre_BoomerAMGBuildStdInterp(hypre_ParCSRMatrix  *A,
 
    if (P_diag_size)
    {
-      P_diag_j    = hypre_CTAlloc(HYPRE_Int,  P_diag_size, memory_location_P);
-      P_diag_data = hypre_CTAlloc(HYPRE_Real, P_diag_size, memory_location_P);
+      P_diag_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_diag_size, memory_location_P);
+      P_diag_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_diag_size, memory_location_P);
    }
 
    if (P_offd_size)
    {
-      P_offd_j    = hypre_CTAlloc(HYPRE_Int,  P_offd_size, memory_location_P);
-      P_offd_data = hypre_CTAlloc(HYPRE_Real, P_offd_size, memory_location_P);
+      P_offd_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  P_offd_size, memory_location_P);
+      P_offd_data = hypre_CTAllocFirstTouch(HYPRE_Real, P_offd_size, memory_location_P);
    }
 
    P_diag_i[n_fine] = jj_counter;
@@ -1201,6 +1201,9 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       Sop_j         = hypre_CSRMatrixBigJ(Sop);
    }
 
+   /* work arrays, including the per-thread markers, come from the host arena */
+   hypre_HostArenaPush();
+
    /*-----------------------------------------------------------------------
     *  First Pass: Determine size of P and fill in fine_to_coarse mapping.
     *-----------------------------------------------------------------------*/
@@ -1208,18 +1211,18 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
    /*-----------------------------------------------------------------------
     *  Intialize counters and allocate mapping vector.
     *-----------------------------------------------------------------------*/
-   P_diag_i    = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
-   P_offd_i    = hypre_CTAlloc(HYPRE_Int, n_fine+1, memory_location_P);
+   P_diag_i    = hypre_CTAllocFirstTouch(HYPRE_Int, n_fine+1, memory_location_P);
+   P_offd_i    = hypre_CTAllocFirstTouch(HYPRE_Int, n_fine+1, memory_location_P);
 
    if (n_fine)
    {
-      fine_to_coarse = hypre_CTAlloc(HYPRE_Int, n_fine, HYPRE_MEMORY_HOST);
+      fine_to_coarse = hypre_ArenaCTAlloc(HYPRE_Int, n_fine);
    }
 
    if (full_off_procNodes)
    {
-      fine_to_coarse_offd = hypre_CTAlloc(HYPRE_BigInt, full_off_procNodes, HYPRE_MEMORY_HOST);
-      tmp_CF_marker_offd  = hypre_CTAlloc(HYPRE_Int,    full_off_procNodes, HYPRE_MEMORY_HOST);
+      fine_to_coarse_offd = hypre_ArenaCTAlloc(HYPRE_BigInt, full_off_procNodes);
+      tmp_CF_marker_offd  = hypre_ArenaCTAlloc(HYPRE_Int,    full_off_procNodes);
    }
 
    /* This function is smart enough to check P_marker and P_marker_offd only,
@@ -1233,9 +1236,9 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
     *  Initialize threading variables
     *-----------------------------------------------------------------------*/
    max_num_threads[0] = hypre_NumThreads();
-   diag_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   fine_to_coarse_offset = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
-   offd_offset           = hypre_CTAlloc(HYPRE_Int, max_num_threads[0], HYPRE_MEMORY_HOST);
+   diag_offset           = hypre_ArenaCTAlloc(HYPRE_Int, max_num_threads[0]);
+   fine_to_coarse_offset = hypre_ArenaCTAlloc(HYPRE_Int, max_num_threads[0]);
+   offd_offset           = hypre_ArenaCTAlloc(HYPRE_Int, max_num_threads[0]);
    for (i=0; i < max_num_threads[0]; i++)
    {
       diag_offset[i] = 0;
@@ -1274,13 +1277,13 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       jj_counter_offd = start_indexing;
       if (n_fine)
       {
-         P_marker = hypre_CTAlloc(HYPRE_Int,  n_fine, HYPRE_MEMORY_HOST);
+         P_marker = hypre_ArenaTAlloc(HYPRE_Int,  n_fine);
          for (i = 0; i < n_fine; i++)
          {  P_marker[i] = -1; }
       }
       if (full_off_procNodes)
       {
-         P_marker_offd = hypre_CTAlloc(HYPRE_Int,  full_off_procNodes, HYPRE_MEMORY_HOST);
+         P_marker_offd = hypre_ArenaTAlloc(HYPRE_Int,  full_off_procNodes);
          for (i = 0; i < full_off_procNodes; i++)
          {  P_marker_offd[i] = -1;}
       }
@@ -1804,16 +1807,6 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
       /*-----------------------------------------------------------------------
        *  End large for loop over nfine
        *-----------------------------------------------------------------------*/
-
-      if (n_fine)
-      {
-         hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
-      }
-
-      if (full_off_procNodes)
-      {
-         hypre_TFree(P_marker_offd, HYPRE_MEMORY_HOST);
-      }
    }
    /*-----------------------------------------------------------------------
     *  End PAR_REGION
@@ -1897,18 +1890,13 @@ hypre_BoomerAMGBuildExtPIInterpHost(hypre_ParCSRMatrix   *A,
 
    /* Deallocate memory */
    hypre_TFree(max_num_threads, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse, HYPRE_MEMORY_HOST);
-   hypre_TFree(diag_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(offd_offset, HYPRE_MEMORY_HOST);
-   hypre_TFree(fine_to_coarse_offset, HYPRE_MEMORY_HOST);
+   hypre_HostArenaPop();
 
    if (num_procs > 1)
    {
       hypre_CSRMatrixDestroy(Sop);
       hypre_CSRMatrixDestroy(A_ext);
-      hypre_TFree(fine_to_coarse_offd, HYPRE_MEMORY_HOST);
       hypre_TFree(CF_marker_offd, HYPRE_MEMORY_HOST);
-      hypre_TFree(tmp_CF_marker_offd, HYPRE_MEMORY_HOST);
       if (num_functions > 1)
       {
          hypre_TFree(dof_func_offd, HYPRE_MEMORY_HOST);
@@ -440,6 +440,8 @@ hypre_MGRSetup( void               *mgr_vdata,
       HYPRE_ILUSetType(mgr_data -> global_smoother, 0);
       HYPRE_ILUSetLevelOfFill(mgr_data -> global_smoother, 0);
       HYPRE_ILUSetMaxIter(mgr_data -> global_smoother, global_smooth_iters);
+      /* thread the triangular solves of the smoother */
+      HYPRE_ILUSetLevelScheduling(mgr_data -> global_smoother, hypre_NumThreads() > 1);
       HYPRE_ILUSetup(mgr_data -> global_smoother, A, f, u);
     }
   }
@@ -196,6 +196,10 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    hypre_MPI_Comm_size(comm,&num_procs);
    num_threads = hypre_NumThreads();
 
+   /* work arrays below come from the host arena and are released together
+      by the hypre_HostArenaPop at the end */
+   hypre_HostArenaPush();
+
    if (comm_pkg_RT)
    {
       num_recvs_RT = hypre_ParCSRCommPkgNumRecvs(comm_pkg_RT);
@@ -274,8 +278,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       }
       hypre_TFree(send_map_elmts_unique, HYPRE_MEMORY_HOST);
 
-      send_map_elmts_starts_RT_aggregated = hypre_TAlloc(HYPRE_Int,  send_map_elmts_unique_size + 1, HYPRE_MEMORY_HOST);
-      send_map_elmts_RT_aggregated = hypre_TAlloc(HYPRE_Int,  send_map_starts_RT[num_sends_RT], HYPRE_MEMORY_HOST);
+      send_map_elmts_starts_RT_aggregated = hypre_ArenaTAlloc(HYPRE_Int,  send_map_elmts_unique_size + 1);
+      send_map_elmts_RT_aggregated = hypre_ArenaTAlloc(HYPRE_Int,  send_map_starts_RT[num_sends_RT]);
 
 #pragma omp parallel for HYPRE_SMP_SCHEDULE
       for (i = 0; i < send_map_elmts_unique_size; i++)
@@ -320,8 +324,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       Ps_ext_j    = hypre_CSRMatrixBigJ(Ps_ext);
    }
 
-   P_ext_diag_i = hypre_TAlloc(HYPRE_Int, num_cols_offd_A+1, HYPRE_MEMORY_HOST);
-   P_ext_offd_i = hypre_TAlloc(HYPRE_Int, num_cols_offd_A+1, HYPRE_MEMORY_HOST);
+   P_ext_diag_i = hypre_ArenaTAlloc(HYPRE_Int, num_cols_offd_A+1);
+   P_ext_offd_i = hypre_ArenaTAlloc(HYPRE_Int, num_cols_offd_A+1);
    P_ext_diag_i[0] = 0;
    P_ext_offd_i[0] = 0;
    P_ext_diag_size = 0;
@@ -329,7 +333,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    last_col_diag_P = first_col_diag_P + (HYPRE_BigInt) num_cols_diag_P - 1;
 
    /*HYPRE_Int prefix_sum_workspace[2*(num_threads + 1)];*/
-   prefix_sum_workspace = hypre_TAlloc(HYPRE_Int,  2*(num_threads + 1), HYPRE_MEMORY_HOST);
+   prefix_sum_workspace = hypre_ArenaTAlloc(HYPRE_Int,  2*(num_threads + 1));
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel private(i,j)
@@ -358,14 +362,14 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       {
          if (P_ext_diag_size)
          {
-            P_ext_diag_j = hypre_CTAlloc(HYPRE_Int,  P_ext_diag_size, HYPRE_MEMORY_HOST);
-            P_ext_diag_data = hypre_CTAlloc(HYPRE_Real,  P_ext_diag_size, HYPRE_MEMORY_HOST);
+            P_ext_diag_j = hypre_ArenaCTAlloc(HYPRE_Int,  P_ext_diag_size);
+            P_ext_diag_data = hypre_ArenaCTAlloc(HYPRE_Real,  P_ext_diag_size);
          }
          if (P_ext_offd_size)
          {
-            P_ext_offd_j = hypre_CTAlloc(HYPRE_Int,  P_ext_offd_size, HYPRE_MEMORY_HOST);
-            P_big_offd_j = hypre_CTAlloc(HYPRE_BigInt,  P_ext_offd_size, HYPRE_MEMORY_HOST);
-            P_ext_offd_data = hypre_CTAlloc(HYPRE_Real,  P_ext_offd_size, HYPRE_MEMORY_HOST);
+            P_ext_offd_j = hypre_ArenaCTAlloc(HYPRE_Int,  P_ext_offd_size);
+            P_big_offd_j = hypre_ArenaCTAlloc(HYPRE_BigInt,  P_ext_offd_size);
+            P_ext_offd_data = hypre_ArenaCTAlloc(HYPRE_Real,  P_ext_offd_size);
             //temp = hypre_CTAlloc(HYPRE_BigInt,  P_ext_offd_size+num_cols_offd_P, HYPRE_MEMORY_HOST);
          }
       }
@@ -395,7 +399,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          P_ext_offd_i[i+1] = P_ext_offd_size_private;
       }
    } /* omp parallel */
-   hypre_TFree(prefix_sum_workspace, HYPRE_MEMORY_HOST);
 
    if (num_procs > 1)
    {
@@ -442,7 +445,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 #else /* !HYPRE_CONCURRENT_HOPSCOTCH */
    if (P_ext_offd_size || num_cols_offd_P)
    {
-      temp = hypre_CTAlloc(HYPRE_BigInt,  P_ext_offd_size+num_cols_offd_P, HYPRE_MEMORY_HOST);
+      temp = hypre_ArenaCTAlloc(HYPRE_BigInt,  P_ext_offd_size+num_cols_offd_P);
       for (i=0; i < P_ext_offd_size; i++)
          //Ps_ext_j[i] = temp[i];
          //temp[i] = Ps_ext_j[i];
@@ -473,9 +476,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    for (i=0; i < num_cols_offd_Pext; i++)
       col_map_offd_Pext[i] = temp[i];
 
-   if (P_ext_offd_size || num_cols_offd_P)
-      hypre_TFree(temp, HYPRE_MEMORY_HOST);
-
    /*if (P_ext_offd_size)
      P_ext_offd_j = hypre_CTAlloc(HYPRE_Int,  P_ext_offd_size, HYPRE_MEMORY_HOST);*/
    for (i=0 ; i < P_ext_offd_size; i++)
@@ -485,8 +485,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
             num_cols_offd_Pext);
 #endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
 
-   if (P_ext_offd_size)
-      hypre_TFree(P_big_offd_j, HYPRE_MEMORY_HOST);
    /*if (num_procs > 1)
      {
      hypre_CSRMatrixDestroy(Ps_ext);
@@ -495,7 +493,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    if (num_cols_offd_P)
    {
-      map_P_to_Pext = hypre_CTAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+      map_P_to_Pext = hypre_ArenaCTAlloc(HYPRE_Int, num_cols_offd_P);
 
       cnt = 0;
       for (i=0; i < num_cols_offd_Pext; i++)
@@ -515,12 +513,15 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
     *  are more than one processor and nonzero elements in R_offd
     *-----------------------------------------------------------------------*/
 
-   P_mark_array = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
-   A_mark_array = hypre_CTAlloc(HYPRE_Int *,  num_threads, HYPRE_MEMORY_HOST);
+   P_mark_array = hypre_ArenaCTAlloc(HYPRE_Int *,  num_threads);
+   A_mark_array = hypre_ArenaCTAlloc(HYPRE_Int *,  num_threads);
 
    if (num_cols_offd_RT)
    {
-      jj_count = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+      /* the markers of this pass are released before the second pass
+         allocates its own */
+      hypre_HostArenaPush();
+      jj_count = hypre_ArenaCTAlloc(HYPRE_Int,  num_threads);
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_counter,jj_row_begining,A_marker,P_marker) HYPRE_SMP_SCHEDULE
@@ -546,10 +547,10 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
          if (num_cols_offd_Pext || num_cols_diag_P)
          {
-            P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_Pext, HYPRE_MEMORY_HOST);
+            P_mark_array[ii] = hypre_ArenaCTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_Pext);
             P_marker = P_mark_array[ii];
          }
-         A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
+         A_mark_array[ii] = hypre_ArenaCTAlloc(HYPRE_Int,  num_nz_cols_A);
          A_marker = A_mark_array[ii];
          /*-----------------------------------------------------------------------
           *  Initialize some stuff.
@@ -984,9 +985,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
                }
             }
          }
-         if (num_cols_offd_Pext || num_cols_diag_P)
-            hypre_TFree(P_mark_array[ii], HYPRE_MEMORY_HOST);
-         hypre_TFree(A_mark_array[ii], HYPRE_MEMORY_HOST);
       }
 
       RAP_int = hypre_CSRMatrixCreate(num_cols_offd_RT,num_rows_offd_RT,RAP_size);
@@ -996,7 +994,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       hypre_CSRMatrixI(RAP_int) = RAP_int_i;
       hypre_CSRMatrixBigJ(RAP_int) = RAP_int_j;
       hypre_CSRMatrixData(RAP_int) = RAP_int_data;
-      hypre_TFree(jj_count, HYPRE_MEMORY_HOST);
+      hypre_HostArenaPop();
    }
 
 #ifdef HYPRE_PROFILE
@@ -1063,7 +1061,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 #else /* !HYPRE_CONCURRENT_HOPSCOTCH */
    if (RAP_ext_size || num_cols_offd_Pext)
    {
-      temp = hypre_CTAlloc(HYPRE_BigInt, RAP_ext_size+num_cols_offd_Pext, HYPRE_MEMORY_HOST);
+      temp = hypre_ArenaCTAlloc(HYPRE_BigInt, RAP_ext_size+num_cols_offd_Pext);
       cnt = 0;
       for (i=0; i < RAP_ext_size; i++)
          if (RAP_ext_j[i] < first_col_diag_RAP
@@ -1094,14 +1092,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
       for (i=0 ; i < num_cols_offd_RAP; i++)
          col_map_offd_RAP[i] = temp[i];
-
-      hypre_TFree(temp, HYPRE_MEMORY_HOST);
    }
 #endif /* !HYPRE_CONCURRENT_HOPSCOTCH */
 
    if (num_cols_offd_P)
    {
-      map_P_to_RAP = hypre_TAlloc(HYPRE_Int, num_cols_offd_P, HYPRE_MEMORY_HOST);
+      map_P_to_RAP = hypre_ArenaTAlloc(HYPRE_Int, num_cols_offd_P);
 
       cnt = 0;
       for (i=0; i < num_cols_offd_RAP; i++)
@@ -1114,7 +1110,7 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
 
    if (num_cols_offd_Pext)
    {
-      map_Pext_to_RAP = hypre_TAlloc(HYPRE_Int, num_cols_offd_Pext, HYPRE_MEMORY_HOST);
+      map_Pext_to_RAP = hypre_ArenaTAlloc(HYPRE_Int, num_cols_offd_Pext);
 
       cnt = 0;
       for (i=0; i < num_cols_offd_RAP; i++)
@@ -1158,8 +1154,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    /*-----------------------------------------------------------------------
     *  Initialize some stuff.
     *-----------------------------------------------------------------------*/
-   jj_cnt_diag = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
-   jj_cnt_offd = hypre_CTAlloc(HYPRE_Int,  num_threads, HYPRE_MEMORY_HOST);
+   jj_cnt_diag = hypre_ArenaCTAlloc(HYPRE_Int,  num_threads);
+   jj_cnt_offd = hypre_ArenaCTAlloc(HYPRE_Int,  num_threads);
 
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for private(i,j,k,jcol,ii,ic,i1,i2,i3,jj1,jj2,jj3,ns,ne,size,rest,jj_count_diag,jj_count_offd,jj_row_begin_diag,jj_row_begin_offd,A_marker,P_marker) HYPRE_SMP_SCHEDULE
@@ -1179,8 +1175,8 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
          ne = (ii+1)*size+rest;
       }
 
-      P_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_RAP, HYPRE_MEMORY_HOST);
-      A_mark_array[ii] = hypre_CTAlloc(HYPRE_Int,  num_nz_cols_A, HYPRE_MEMORY_HOST);
+      P_mark_array[ii] = hypre_ArenaCTAlloc(HYPRE_Int,  num_cols_diag_P+num_cols_offd_RAP);
+      A_mark_array[ii] = hypre_ArenaCTAlloc(HYPRE_Int,  num_nz_cols_A);
       P_marker = P_mark_array[ii];
       A_marker = A_mark_array[ii];
       jj_count_diag = start_indexing;
@@ -1446,15 +1442,15 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
    RAP_diag_size = jj_count_diag;
    if (RAP_diag_size)
    {
-      RAP_diag_data = hypre_CTAlloc(HYPRE_Real, RAP_diag_size, HYPRE_MEMORY_DEVICE);
-      RAP_diag_j    = hypre_CTAlloc(HYPRE_Int,  RAP_diag_size, HYPRE_MEMORY_DEVICE);
+      RAP_diag_data = hypre_CTAllocFirstTouch(HYPRE_Real, RAP_diag_size, HYPRE_MEMORY_DEVICE);
+      RAP_diag_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  RAP_diag_size, HYPRE_MEMORY_DEVICE);
    }
 
    RAP_offd_size = jj_count_offd;
    if (RAP_offd_size)
    {
-      RAP_offd_data = hypre_CTAlloc(HYPRE_Real, RAP_offd_size, HYPRE_MEMORY_DEVICE);
-      RAP_offd_j    = hypre_CTAlloc(HYPRE_Int,  RAP_offd_size, HYPRE_MEMORY_DEVICE);
+      RAP_offd_data = hypre_CTAllocFirstTouch(HYPRE_Real, RAP_offd_size, HYPRE_MEMORY_DEVICE);
+      RAP_offd_j    = hypre_CTAllocFirstTouch(HYPRE_Int,  RAP_offd_size, HYPRE_MEMORY_DEVICE);
    }
 
    if (RAP_offd_size == 0 && num_cols_offd_RAP != 0)
@@ -1463,12 +1459,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       hypre_TFree(col_map_offd_RAP, HYPRE_MEMORY_HOST);
    }
 
-   RA_diag_data_array = hypre_TAlloc(HYPRE_Real,  num_cols_diag_A*num_threads, HYPRE_MEMORY_HOST);
-   RA_diag_j_array = hypre_TAlloc(HYPRE_Int,  num_cols_diag_A*num_threads, HYPRE_MEMORY_HOST);
+   RA_diag_data_array = hypre_ArenaTAlloc(HYPRE_Real,  num_cols_diag_A*num_threads);
+   RA_diag_j_array = hypre_ArenaTAlloc(HYPRE_Int,  num_cols_diag_A*num_threads);
    if (num_cols_offd_A)
    {
-      RA_offd_data_array = hypre_TAlloc(HYPRE_Real,  num_cols_offd_A*num_threads, HYPRE_MEMORY_HOST);
-      RA_offd_j_array = hypre_TAlloc(HYPRE_Int,  num_cols_offd_A*num_threads, HYPRE_MEMORY_HOST);
+      RA_offd_data_array = hypre_ArenaTAlloc(HYPRE_Real,  num_cols_offd_A*num_threads);
+      RA_offd_j_array = hypre_ArenaTAlloc(HYPRE_Int,  num_cols_offd_A*num_threads);
    }
 
    /*-----------------------------------------------------------------------
@@ -1854,14 +1850,12 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
             } // num_cols_offd_P
          } // loop over entries in row ic of RA_diag.
       } // Loop over interior c-points.
-      hypre_TFree(P_mark_array[ii], HYPRE_MEMORY_HOST);
-      hypre_TFree(A_mark_array[ii], HYPRE_MEMORY_HOST);
    } // omp parallel for
 
    /* check if really all off-diagonal entries occurring in col_map_offd_RAP
       are represented and eliminate if necessary */
 
-   P_marker = hypre_CTAlloc(HYPRE_Int, num_cols_offd_RAP, HYPRE_MEMORY_HOST);
+   P_marker = hypre_ArenaCTAlloc(HYPRE_Int, num_cols_offd_RAP);
 #ifdef HYPRE_USING_OPENMP
 #pragma omp parallel for HYPRE_SMP_SCHEDULE
 #endif
@@ -1913,7 +1907,6 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       hypre_TFree(col_map_offd_RAP, HYPRE_MEMORY_HOST);
       col_map_offd_RAP = new_col_map_offd_RAP;
    }
-   hypre_TFree(P_marker, HYPRE_MEMORY_HOST);
 
    RAP = hypre_ParCSRMatrixCreate(comm, n_coarse_RT, n_coarse,
          RT_partitioning, coarse_partitioning,
@@ -1981,47 +1974,17 @@ hypre_BoomerAMGBuildCoarseOperatorKT( hypre_ParCSRMatrix  *RT,
       hypre_CSRMatrixDestroy(RAP_ext);
       RAP_ext = NULL;
    }
-   hypre_TFree(P_mark_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(A_mark_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_ext_diag_i, HYPRE_MEMORY_HOST);
-   hypre_TFree(P_ext_offd_i, HYPRE_MEMORY_HOST);
-   hypre_TFree(jj_cnt_diag, HYPRE_MEMORY_HOST);
-   hypre_TFree(jj_cnt_offd, HYPRE_MEMORY_HOST);
-   if (num_cols_offd_P)
-   {
-      hypre_TFree(map_P_to_Pext, HYPRE_MEMORY_HOST);
-      hypre_TFree(map_P_to_RAP, HYPRE_MEMORY_HOST);
-   }
    if (num_cols_offd_Pext)
    {
       hypre_TFree(col_map_offd_Pext, HYPRE_MEMORY_HOST);
-      hypre_TFree(map_Pext_to_RAP, HYPRE_MEMORY_HOST);
-   }
-   if (P_ext_diag_size)
-   {
-      hypre_TFree(P_ext_diag_data, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_ext_diag_j, HYPRE_MEMORY_HOST);
-   }
-   if (P_ext_offd_size)
-   {
-      hypre_TFree(P_ext_offd_data, HYPRE_MEMORY_HOST);
-      hypre_TFree(P_ext_offd_j, HYPRE_MEMORY_HOST);
-   }
-   hypre_TFree(RA_diag_data_array, HYPRE_MEMORY_HOST);
-   hypre_TFree(RA_diag_j_array, HYPRE_MEMORY_HOST);
-   if (num_cols_offd_A)
-   {
-      hypre_TFree(RA_offd_data_array, HYPRE_MEMORY_HOST);
-      hypre_TFree(RA_offd_j_array, HYPRE_MEMORY_HOST);
    }
 #ifdef HYPRE_CONCURRENT_HOPSCOTCH
    if (send_map_elmts_RT_inverse_map_initialized)
    {
       hypre_UnorderedIntMapDestroy(&send_map_elmts_RT_inverse_map);
    }
-   hypre_TFree(send_map_elmts_starts_RT_aggregated, HYPRE_MEMORY_HOST);
-   hypre_TFree(send_map_elmts_RT_aggregated, HYPRE_MEMORY_HOST);
 #endif
+   hypre_HostArenaPop();
 
 #ifdef HYPRE_PROFILE
    hypre_profile_times[HYPRE_TIMER_ID_RAP] += hypre_MPI_Wtime();
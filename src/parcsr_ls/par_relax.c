@@ -55,8 +55,8 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    hypre_Vector   *f_local = hypre_ParVectorLocalVector(f);
    HYPRE_Real     *f_data  = hypre_VectorData(f_local);
 
-   hypre_Vector   *Vtemp_local;
-   HYPRE_Real     *Vtemp_data;
+   hypre_Vector   *Vtemp_local = NULL;
+   HYPRE_Real     *Vtemp_data = NULL;
    if (relax_type != 10)
    {
       Vtemp_local = hypre_ParVectorLocalVector(Vtemp);
@@ -104,6 +104,33 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    hypre_MPI_Comm_size(comm,&num_procs);
    hypre_MPI_Comm_rank(comm,&my_id);
    num_threads = hypre_NumThreads();
+
+   /*-----------------------------------------------------------------------
+    * Matrices with single-precision values or compressed column indices
+    * (read-only AMG levels)
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_CSRMatrixDataFloat(A_diag) || hypre_CSRMatrixColDelta(A_diag))
+   {
+      return hypre_BoomerAMGRelaxReducedStorage(A, f, cf_marker, relax_type, relax_points,
+                                                relax_weight, l1_norms, u, Vtemp);
+   }
+
+   /*-----------------------------------------------------------------------
+    * If A carries an interior/boundary row splitting, the single-threaded
+    * hybrid Gauss-Seidel sweeps with unit weights overlap the halo exchange
+    * with the relaxation of the interior rows.
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_ParCSRMatrixInteriorBoundaryRows(A) && num_threads == 1 &&
+       relax_weight == 1.0 && omega == 1.0 &&
+       (relax_type == 3 || relax_type == 6 || relax_type == 8 ||
+        relax_type == 13 || relax_type == 14))
+   {
+      return hypre_BoomerAMGRelaxHybridOverlap(A, f, cf_marker, relax_type,
+                                               relax_points, l1_norms, u);
+   }
+
    /*-----------------------------------------------------------------------
     * Switch statement to direct control based on relax_type:
     *     relax_type = 0 -> Jacobi or CF-Jacobi
@@ -138,15 +165,25 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    {
       case 0: /* Weighted Jacobi */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
          if (num_procs > 1)
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
             /* printf("!! Proc %d: n %d,  num_sends %d, num_cols_offd %d\n", my_id, n, num_sends, num_cols_offd); */
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -164,7 +201,11 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+#endif
          }
          /*-----------------------------------------------------------------
           * Copy current approximation into temporary vector.
@@ -179,7 +220,11 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          }
          if (num_procs > 1)
          {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -251,24 +296,36 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
       case 5: /* Hybrid: Jacobi off-processor,
                          chaotic Gauss-Seidel on-processor       */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
          if (num_procs > 1)
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -286,12 +343,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -363,11 +428,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
@@ -1182,14 +1249,24 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                  Gauss-Seidel/SOR on-processor
                  (backward loop) */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
          if (num_procs > 1)
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real,
                   hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -1206,13 +1283,21 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
                   Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -1621,11 +1706,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
@@ -1633,6 +1720,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                  Symm. Gauss-Seidel/ SSOR on-processor
                  with outer relaxation parameter */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
 
          if (num_threads > 1)
          {
@@ -1647,10 +1738,16 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real,
                   hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -1667,13 +1764,21 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data,
                   Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -2325,11 +2430,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
@@ -2364,6 +2471,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 
       case 8: /* hybrid L1 Symm. Gauss-Seidel */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
          if (num_threads > 1)
          {
             Ztemp_local = hypre_ParVectorLocalVector(Ztemp);
@@ -2377,9 +2488,15 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -2397,12 +2514,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -3052,11 +3177,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
@@ -3338,6 +3465,10 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
 
       case 13: /* hybrid L1 Gauss-Seidel forward solve */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
          if (num_threads > 1)
          {
             Ztemp_local = hypre_ParVectorLocalVector(Ztemp);
@@ -3351,10 +3482,16 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real,
                   hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -3371,12 +3508,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                      = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,j)];
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -3789,16 +3934,22 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
       case 14: /* hybrid L1 Gauss-Seidel backward solve */
       {
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#endif
+
 
          if (num_threads > 1)
          {
@@ -3813,9 +3964,15 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
          {
             num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+            v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+            Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
             v_buf_data = hypre_CTAlloc(HYPRE_Real, hypre_ParCSRCommPkgSendMapStart(comm_pkg,  num_sends), HYPRE_MEMORY_HOST);
 
             Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
 
             if (num_cols_offd)
             {
@@ -3833,12 +3990,20 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
 
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
             comm_handle = hypre_ParCSRCommHandleCreate( 1, comm_pkg, v_buf_data, Vext_data);
+#endif
 
             /*-----------------------------------------------------------------
              * Copy current approximation into temporary vector.
              *-----------------------------------------------------------------*/
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+            hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
             hypre_ParCSRCommHandleDestroy(comm_handle);
+#endif
             comm_handle = NULL;
          }
 
@@ -4248,11 +4413,13 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
                }
             }
          }
+#ifndef HYPRE_USING_PERSISTENT_COMM
          if (num_procs > 1)
          {
             hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
             hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
          }
+#endif
       }
       break;
 
@@ -4408,3 +4575,457 @@ HYPRE_Int  hypre_BoomerAMGRelax( hypre_ParCSRMatrix *A,
    return (relax_error);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxHybridOverlap
+ *
+ * Hybrid Gauss-Seidel (relax types 3, 6, 8, 13, 14) with unit weights,
+ * using the interior/boundary row splitting of A (see
+ * hypre_ParCSRMatrixSetInteriorBoundaryRows). The interior rows do not
+ * touch the halo and are relaxed while it is being exchanged; the boundary
+ * rows are relaxed after the exchange has completed. Symmetric sweeps
+ * (6, 8) traverse the same row ordering backwards for the second half.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxHybridOverlap( hypre_ParCSRMatrix *A,
+                                   hypre_ParVector    *f,
+                                   HYPRE_Int          *cf_marker,
+                                   HYPRE_Int           relax_type,
+                                   HYPRE_Int           relax_points,
+                                   HYPRE_Real         *l1_norms,
+                                   hypre_ParVector    *u )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Real      *A_diag_data  = hypre_CSRMatrixData(A_diag);
+   HYPRE_Int       *A_diag_i     = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j     = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i     = hypre_CSRMatrixI(A_offd);
+   HYPRE_Real      *A_offd_data  = hypre_CSRMatrixData(A_offd);
+   HYPRE_Int       *A_offd_j     = hypre_CSRMatrixJ(A_offd);
+   hypre_ParCSRCommPkg  *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+   hypre_ParCSRPersistentCommHandle *persistent_comm_handle = NULL;
+#else
+   hypre_ParCSRCommHandle *comm_handle;
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+#endif
+
+   HYPRE_Int        n = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_interior = hypre_ParCSRMatrixNumInteriorRows(A);
+   HYPRE_Int       *rows = hypre_ParCSRMatrixInteriorBoundaryRows(A);
+
+   HYPRE_Real      *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *Vext_data = NULL;
+   HYPRE_Real      *v_buf_data = NULL;
+
+   /* l1 variants update with the full residual, the others replace u_i */
+   HYPRE_Int        use_l1 = (relax_type == 8 || relax_type == 13 || relax_type == 14);
+   HYPRE_Int        symmetric = (relax_type == 6 || relax_type == 8);
+   HYPRE_Int        backward = (relax_type == 14);
+
+   HYPRE_Int        num_procs, num_sends, begin, end;
+   HYPRE_Int        sweep, k, kb, ke, i, ii, jj;
+   HYPRE_Real       res, diag;
+   HYPRE_Real       zero = 0.0;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] -= hypre_MPI_Wtime();
+#endif
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+      persistent_comm_handle = hypre_ParCSRCommPkgGetPersistentCommHandle(1, comm_pkg);
+      v_buf_data = (HYPRE_Real *) hypre_ParCSRCommHandleSendDataBuffer(persistent_comm_handle);
+      Vext_data  = (HYPRE_Real *) hypre_ParCSRCommHandleRecvDataBuffer(persistent_comm_handle);
+#else
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+#endif
+
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i-begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_PACK_UNPACK] += hypre_MPI_Wtime();
+#endif
+
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+      hypre_ParCSRPersistentCommHandleStart(persistent_comm_handle, HYPRE_MEMORY_HOST, v_buf_data);
+#else
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+#endif
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   /*-----------------------------------------------------------------
+    * sweep 0: interior rows (halo in flight), sweep 1: boundary rows;
+    * symmetric variants add sweeps 2 and 3 traversing the reversed
+    * ordering, i.e. boundary rows first.
+    *-----------------------------------------------------------------*/
+
+   for (sweep = 0; sweep < (symmetric ? 4 : 2); sweep++)
+   {
+      if (sweep == 1 && num_procs > 1)
+      {
+#ifdef HYPRE_PROFILE
+         hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+         hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] -= hypre_MPI_Wtime();
+#endif
+#if defined(HYPRE_USING_PERSISTENT_COMM)
+         hypre_ParCSRPersistentCommHandleWait(persistent_comm_handle, HYPRE_MEMORY_HOST, Vext_data);
+#else
+         hypre_ParCSRCommHandleDestroy(comm_handle);
+         comm_handle = NULL;
+#endif
+#ifdef HYPRE_PROFILE
+         hypre_profile_times[HYPRE_TIMER_ID_HALO_EXCHANGE] += hypre_MPI_Wtime();
+         hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+      }
+
+      if (sweep == 0 || sweep == 3)
+      {
+         kb = 0;
+         ke = num_interior;
+      }
+      else
+      {
+         kb = num_interior;
+         ke = n;
+      }
+
+      for (k = kb; k < ke; k++)
+      {
+         /* forward sweeps run in list order, backward sweeps reversed */
+         if ((sweep < 2) == backward)
+         {
+            i = rows[kb + ke - 1 - k];
+         }
+         else
+         {
+            i = rows[k];
+         }
+
+         /*-----------------------------------------------------------
+          * If i is of the right type ( C or F ) and diagonal is
+          * nonzero, relax point i; otherwise, skip it.
+          *-----------------------------------------------------------*/
+
+         if (relax_points && cf_marker[i] != relax_points)
+         {
+            continue;
+         }
+
+         diag = use_l1 ? l1_norms[i] : A_diag_data[A_diag_i[i]];
+         if (diag == zero)
+         {
+            continue;
+         }
+
+         res = f_data[i];
+         for (jj = A_diag_i[i] + !use_l1; jj < A_diag_i[i+1]; jj++)
+         {
+            ii = A_diag_j[jj];
+            res -= A_diag_data[jj] * u_data[ii];
+         }
+         for (jj = A_offd_i[i]; jj < A_offd_i[i+1]; jj++)
+         {
+            ii = A_offd_j[jj];
+            res -= A_offd_data[jj] * Vext_data[ii];
+         }
+
+         if (use_l1)
+         {
+            u_data[i] += res / diag;
+         }
+         else
+         {
+            u_data[i] = res / diag;
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+#ifndef HYPRE_USING_PERSISTENT_COMM
+   if (num_procs > 1)
+   {
+      hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   }
+#endif
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_RelaxReducedStorageRowSum
+ *
+ * Returns the sum of a_ij * w_j over the entries [jb,je) of row i of A, where
+ * w_j is u_j for the columns in [ns,ne) and v_j otherwise.  A may keep its
+ * values in single precision and its column indices compressed.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_RELAX_ROW_SUM(values, column)                          \
+   for (jj = jb; jj < je; jj++)                                      \
+   {                                                                 \
+      ii = (column);                                                 \
+      sum += values[jj] * ((ii >= ns && ii < ne) ? u[ii] : v[ii]);   \
+   }
+
+static inline HYPRE_Real
+hypre_RelaxReducedStorageRowSum( hypre_CSRMatrix *A,
+                                 HYPRE_Int        i,
+                                 HYPRE_Int        jb,
+                                 HYPRE_Int        je,
+                                 HYPRE_Real      *u,
+                                 HYPRE_Real      *v,
+                                 HYPRE_Int        ns,
+                                 HYPRE_Int        ne )
+{
+   HYPRE_Complex   *data      = hypre_CSRMatrixData(A);
+   float           *data_f    = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int       *A_j       = hypre_CSRMatrixJ(A);
+   unsigned char   *delta8    = NULL;
+   unsigned short  *delta16   = NULL;
+   HYPRE_Int        base      = 0;
+   HYPRE_Real       sum       = 0.0;
+   HYPRE_Int        jj, ii;
+
+   if (hypre_CSRMatrixColDelta(A))
+   {
+      base = hypre_CSRMatrixColBase(A)[i];
+      if (hypre_CSRMatrixColDeltaSize(A) == 2)
+      {
+         delta16 = (unsigned short *) hypre_CSRMatrixColDelta(A);
+      }
+      else
+      {
+         delta8 = (unsigned char *) hypre_CSRMatrixColDelta(A);
+      }
+   }
+
+   if (data)
+   {
+      if (delta8)       { HYPRE_RELAX_ROW_SUM(data, base + delta8[jj]); }
+      else if (delta16) { HYPRE_RELAX_ROW_SUM(data, base + delta16[jj]); }
+      else              { HYPRE_RELAX_ROW_SUM(data, A_j[jj]); }
+   }
+   else
+   {
+      if (delta8)       { HYPRE_RELAX_ROW_SUM(data_f, base + delta8[jj]); }
+      else if (delta16) { HYPRE_RELAX_ROW_SUM(data_f, base + delta16[jj]); }
+      else              { HYPRE_RELAX_ROW_SUM(data_f, A_j[jj]); }
+   }
+
+   return sum;
+}
+
+#undef HYPRE_RELAX_ROW_SUM
+
+/*--------------------------------------------------------------------------
+ * hypre_BoomerAMGRelaxReducedStorage
+ *
+ * Jacobi (relax_type 0) and the hybrid Gauss-Seidel smoothers 3, 4, 6, 8,
+ * 13 and 14 (unit weights) for a matrix whose values are stored in single
+ * precision (see hypre_ParCSRMatrixConvertToFloat) and/or whose column
+ * indices are compressed (see hypre_ParCSRMatrixCompressColumns).  The
+ * vectors and the residual accumulation keep HYPRE_Real.  With several
+ * threads, each thread relaxes a contiguous block of rows and uses the values
+ * of u from before the sweep for the columns of the other blocks.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_BoomerAMGRelaxReducedStorage( hypre_ParCSRMatrix *A,
+                                    hypre_ParVector    *f,
+                                    HYPRE_Int          *cf_marker,
+                                    HYPRE_Int           relax_type,
+                                    HYPRE_Int           relax_points,
+                                    HYPRE_Real          relax_weight,
+                                    HYPRE_Real         *l1_norms,
+                                    hypre_ParVector    *u,
+                                    hypre_ParVector    *Vtemp )
+{
+   MPI_Comm         comm = hypre_ParCSRMatrixComm(A);
+   hypre_CSRMatrix *A_diag = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Complex   *A_diag_data   = hypre_CSRMatrixData(A_diag);
+   float           *A_diag_data_f = hypre_CSRMatrixDataFloat(A_diag);
+   HYPRE_Int       *A_diag_i      = hypre_CSRMatrixI(A_diag);
+   hypre_CSRMatrix *A_offd = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i      = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int        num_cols_offd = hypre_CSRMatrixNumCols(A_offd);
+   hypre_ParCSRCommPkg    *comm_pkg = hypre_ParCSRMatrixCommPkg(A);
+   hypre_ParCSRCommHandle *comm_handle;
+
+   HYPRE_Int        n = hypre_CSRMatrixNumRows(A_diag);
+
+   HYPRE_Real      *u_data = hypre_VectorData(hypre_ParVectorLocalVector(u));
+   HYPRE_Real      *f_data = hypre_VectorData(hypre_ParVectorLocalVector(f));
+   HYPRE_Real      *v_data = hypre_VectorData(hypre_ParVectorLocalVector(Vtemp));
+   HYPRE_Real      *Vext_data = NULL;
+   HYPRE_Real      *v_buf_data = NULL;
+
+   /* l1 variants update with the full residual, the others replace u_i */
+   HYPRE_Int        use_l1 = (relax_type == 8 || relax_type == 13 || relax_type == 14);
+   HYPRE_Int        symmetric = (relax_type == 6 || relax_type == 8);
+   HYPRE_Int        backward = (relax_type == 4 || relax_type == 14);
+   HYPRE_Int        num_threads = hypre_NumThreads();
+
+   HYPRE_Int        num_procs, num_sends, begin, end;
+   HYPRE_Int        sweep, t, k, i, ns, ne, size, rest;
+   HYPRE_Real       res, diag;
+   HYPRE_Real       zero = 0.0;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   if (num_procs > 1)
+   {
+      num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+      begin = hypre_ParCSRCommPkgSendMapStart(comm_pkg, 0);
+      end   = hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends);
+
+      v_buf_data = hypre_CTAlloc(HYPRE_Real, end, HYPRE_MEMORY_HOST);
+      Vext_data = hypre_CTAlloc(HYPRE_Real, num_cols_offd, HYPRE_MEMORY_HOST);
+
+      for (i = begin; i < end; i++)
+      {
+         v_buf_data[i-begin] = u_data[hypre_ParCSRCommPkgSendMapElmt(comm_pkg,i)];
+      }
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, comm_pkg, v_buf_data, Vext_data);
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] -= hypre_MPI_Wtime();
+#endif
+
+   if (relax_type == 0 || num_threads > 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         v_data[i] = u_data[i];
+      }
+   }
+
+   if (relax_type == 0)
+   {
+      /*-----------------------------------------------------------------
+       * Jacobi: u_i = (1-w)*u_i + w*(f_i - sum_{j != i} a_ij v_j)/a_ii
+       *-----------------------------------------------------------------*/
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,res,diag) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < n; i++)
+      {
+         if (relax_points && cf_marker[i] != relax_points)
+         {
+            continue;
+         }
+
+         diag = A_diag_data ? A_diag_data[A_diag_i[i]] : A_diag_data_f[A_diag_i[i]];
+         if (diag == zero)
+         {
+            continue;
+         }
+
+         res = f_data[i];
+         res -= hypre_RelaxReducedStorageRowSum(A_diag, i, A_diag_i[i] + 1, A_diag_i[i+1],
+                                                v_data, v_data, 0, 0);
+         res -= hypre_RelaxReducedStorageRowSum(A_offd, i, A_offd_i[i], A_offd_i[i+1],
+                                                Vext_data, Vext_data, 0, 0);
+         u_data[i] = (1.0 - relax_weight) * u_data[i] + relax_weight * res / diag;
+      }
+   }
+   else
+   {
+      /*-----------------------------------------------------------------
+       * Hybrid Gauss-Seidel; symmetric variants sweep forward, then
+       * backward.
+       *-----------------------------------------------------------------*/
+
+      for (sweep = 0; sweep < (symmetric ? 2 : 1); sweep++)
+      {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t,k,i,ns,ne,size,rest,res,diag) HYPRE_SMP_SCHEDULE
+#endif
+         for (t = 0; t < num_threads; t++)
+         {
+            size = n/num_threads;
+            rest = n - size*num_threads;
+            ns = t*size + hypre_min(t, rest);
+            ne = ns + size + (t < rest);
+
+            for (k = ns; k < ne; k++)
+            {
+               i = (backward == (sweep == 0)) ? ns + ne - 1 - k : k;
+
+               if (relax_points && cf_marker[i] != relax_points)
+               {
+                  continue;
+               }
+
+               if (use_l1)
+               {
+                  diag = l1_norms[i];
+               }
+               else
+               {
+                  diag = A_diag_data ? A_diag_data[A_diag_i[i]] : A_diag_data_f[A_diag_i[i]];
+               }
+               if (diag == zero)
+               {
+                  continue;
+               }
+
+               res = f_data[i];
+               res -= hypre_RelaxReducedStorageRowSum(A_diag, i, A_diag_i[i] + !use_l1,
+                                                      A_diag_i[i+1], u_data, v_data, ns, ne);
+               res -= hypre_RelaxReducedStorageRowSum(A_offd, i, A_offd_i[i], A_offd_i[i+1],
+                                                      Vext_data, Vext_data, 0, 0);
+
+               if (use_l1)
+               {
+                  u_data[i] += res / diag;
+               }
+               else
+               {
+                  u_data[i] = res / diag;
+               }
+            }
+         }
+      }
+   }
+
+#ifdef HYPRE_PROFILE
+   hypre_profile_times[HYPRE_TIMER_ID_RELAX] += hypre_MPI_Wtime();
+#endif
+
+   if (num_procs > 1)
+   {
+      hypre_TFree(Vext_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(v_buf_data, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
@@ -85,6 +85,12 @@ typedef struct _hypre_ParCSRCommPkg
    hypre_ParCSRPersistentCommHandle *persistent_comm_handles[NUM_OF_COMM_PKG_JOB_TYPE];
 #endif
 
+   /* distributed graph communicator used for job 1 (matvec) exchanges, see
+      hypre_ParCSRCommPkgCreateNeighborComm; counts holds the send counts and
+      displacements followed by the recv counts and displacements */
+   MPI_Comm                    *neighbor_comm;
+   hypre_int                   *neighbor_counts;
+
    /* temporary memory for matvec. cudaMalloc is expensive. alloc once and reuse */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    HYPRE_Complex *tmp_data;
@@ -116,6 +122,8 @@ typedef struct _hypre_ParCSRCommPkg
 #define hypre_ParCSRCommPkgSendMPIType(comm_pkg,i)       (comm_pkg -> send_mpi_types[i])
 #define hypre_ParCSRCommPkgRecvMPITypes(comm_pkg)        (comm_pkg -> recv_mpi_types)
 #define hypre_ParCSRCommPkgRecvMPIType(comm_pkg,i)       (comm_pkg -> recv_mpi_types[i])
+#define hypre_ParCSRCommPkgNeighborComm(comm_pkg)        (comm_pkg -> neighbor_comm)
+#define hypre_ParCSRCommPkgNeighborCounts(comm_pkg)      (comm_pkg -> neighbor_counts)
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 #define hypre_ParCSRCommPkgTmpData(comm_pkg)             ((comm_pkg) -> tmp_data)
@@ -358,6 +366,11 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Local rows without offd entries (interior) followed by the remaining
+      (boundary) rows. Optional, used by the hybrid smoothers to relax the
+      interior rows while the halo exchange is in flight */
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *interior_boundary_rows;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -404,6 +417,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixInteriorBoundaryRows(matrix)   ((matrix) -> interior_boundary_rows)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -426,6 +441,62 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic product handles
+ *
+ * Reusable structure of C = A*B (hypre_ParCSRMatMatSymbolic) and of
+ * C = R^T*A*P (hypre_ParCSRMatrixRAPKTSymbolic).  As long as the sparsity
+ * patterns and the partitionings of the factors do not change, the values
+ * of C can be recomputed with the corresponding Numeric routine without
+ * rebuilding col_map_offd, the communication packages or the rows of C.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;          /* local rows of C */
+   HYPRE_Int             num_cols_diag;     /* local columns of C */
+   HYPRE_Int             num_cols_offd;     /* offd columns of C */
+   HYPRE_Int             num_cols_offd_B;
+   HYPRE_Int            *map_B_to_C;        /* offd columns of B in C */
+
+   /* rows of B owned by other processes (one per offd column of A), split
+      into the diag and offd columns of C, and the nonzero based package
+      that exchanges their values */
+   hypre_ParCSRCommPkg  *ext_comm_pkg;
+   HYPRE_Int             num_ext_send_rows;
+   HYPRE_Int            *ext_send_rows;     /* local rows of B to send */
+   HYPRE_Complex        *ext_send_data;
+   HYPRE_Complex        *ext_recv_data;
+   HYPRE_Int            *ext_pos;           /* received entry -> Bext_diag (>= 0)
+                                               or Bext_offd (-pos-1) */
+   hypre_CSRMatrix      *Bext_diag;
+   hypre_CSRMatrix      *Bext_offd;
+
+} hypre_ParCSRMatMatHandle;
+
+typedef struct
+{
+   hypre_ParCSRMatMatHandle *AP_handle;
+   hypre_ParCSRMatrix       *AP;            /* storage for A*P */
+   HYPRE_Int                *map_AP_to_C;   /* offd columns of A*P in C */
+
+   /* R^T, with the positions of its entries in R */
+   hypre_CSRMatrix          *RT_diag;
+   HYPRE_Int                *RT_diag_perm;
+   hypre_CSRMatrix          *RT_offd;
+   HYPRE_Int                *RT_offd_perm;
+
+   /* R_offd^T*A*P: rows of C owned by other processes, in the columns of
+      A*P (diag columns first), and the nonzero based package that sends
+      their values to the owners, where they are added at C_int_pos */
+   hypre_CSRMatrix          *C_ext;
+   hypre_ParCSRCommPkg      *C_ext_comm_pkg;
+   HYPRE_Int                 num_C_int;
+   HYPRE_Complex            *C_int_data;
+   HYPRE_Int                *C_int_pos;     /* C_diag (< nnz_diag) or C_offd */
+
+} hypre_ParCSRRAPHandle;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -788,6 +859,7 @@ void hypre_ParCSRCommPkgCreate_core ( MPI_Comm comm , HYPRE_BigInt *col_map_offd
 HYPRE_Int
 hypre_ParCSRCommPkgCreate(MPI_Comm comm, HYPRE_BigInt *col_map_offd, HYPRE_BigInt first_col_diag, HYPRE_BigInt *col_starts, HYPRE_Int num_cols_diag, HYPRE_Int num_cols_offd, hypre_ParCSRCommPkg *comm_pkg);
 HYPRE_Int hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A );
+HYPRE_Int hypre_ParCSRCommPkgCreateNeighborComm ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_MatvecCommPkgDestroy ( hypre_ParCSRCommPkg *comm_pkg );
 HYPRE_Int hypre_BuildCSRMatrixMPIDataType ( HYPRE_Int num_nonzeros , HYPRE_Int num_rows , HYPRE_Complex *a_data , HYPRE_Int *a_i , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_matrix_datatype );
 HYPRE_Int hypre_BuildCSRJDataType ( HYPRE_Int num_nonzeros , HYPRE_Complex *a_data , HYPRE_Int *a_j , hypre_MPI_Datatype *csr_jdata_datatype );
@@ -857,6 +929,11 @@ HYPRE_Int hypre_ParCSRMatrixInitialize_v2( hypre_ParCSRMatrix *matrix, HYPRE_Mem
 HYPRE_Int hypre_ParCSRMatrixInitialize ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetNumNonzeros ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDNumNonzeros ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixSetInteriorBoundaryRows ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixConvertToFloat ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixConvertFromFloat ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixCompressColumns ( hypre_ParCSRMatrix *matrix );
+HYPRE_Int hypre_ParCSRMatrixDecompressColumns ( hypre_ParCSRMatrix *matrix );
 HYPRE_Int hypre_ParCSRMatrixSetDataOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_data );
 HYPRE_Int hypre_ParCSRMatrixSetRowStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_row_starts );
 HYPRE_Int hypre_ParCSRMatrixSetColStartsOwner ( hypre_ParCSRMatrix *matrix , HYPRE_Int owns_col_starts );
@@ -902,6 +979,12 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKT( hypre_ParCSRMatrix *R, hypre_ParCSR
 hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix  *A, hypre_ParCSRMatrix  *P );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTDevice( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
 hypre_ParCSRMatrix* hypre_ParCSRMatrixRAPKTHost( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, HYPRE_Int keep_transpose );
+hypre_ParCSRMatrix *hypre_ParCSRMatMatSymbolic( hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B, hypre_ParCSRMatMatHandle **handle_ptr );
+HYPRE_Int hypre_ParCSRMatMatNumeric( hypre_ParCSRMatMatHandle *handle, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *B, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRMatMatHandleDestroy( hypre_ParCSRMatMatHandle *handle );
+hypre_ParCSRMatrix *hypre_ParCSRMatrixRAPKTSymbolic( hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, hypre_ParCSRRAPHandle **handle_ptr );
+HYPRE_Int hypre_ParCSRMatrixRAPKTNumeric( hypre_ParCSRRAPHandle *handle, hypre_ParCSRMatrix *R, hypre_ParCSRMatrix *A, hypre_ParCSRMatrix *P, hypre_ParCSRMatrix *C );
+HYPRE_Int hypre_ParCSRRAPHandleDestroy( hypre_ParCSRRAPHandle *handle );
 
 /* par_make_system.c */
 HYPRE_ParCSR_System_Problem *HYPRE_Generate2DSystem ( HYPRE_ParCSRMatrix H_L1 , HYPRE_ParCSRMatrix H_L2 , HYPRE_ParVector H_b1 , HYPRE_ParVector H_b2 , HYPRE_ParVector H_x1 , HYPRE_ParVector H_x2 , HYPRE_Complex *M_vals );
@@ -928,6 +1011,7 @@ HYPRE_Int hypre_ParVectorScale ( HYPRE_Complex alpha , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorAxpy ( HYPRE_Complex alpha , hypre_ParVector *x , hypre_ParVector *y );
 HYPRE_Int hypre_ParVectorMassAxpy ( HYPRE_Complex *alpha, hypre_ParVector **x, hypre_ParVector *y, HYPRE_Int k, HYPRE_Int unroll);
 HYPRE_Real hypre_ParVectorInnerProd ( hypre_ParVector *x , hypre_ParVector *y );
+HYPRE_Int hypre_ParVectorInnerProdStart ( HYPRE_Int n , hypre_ParVector **x , hypre_ParVector **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 HYPRE_Int hypre_ParVectorMassInnerProd ( hypre_ParVector *x , hypre_ParVector **y , HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod );
 HYPRE_Int hypre_ParVectorMassDotpTwo ( hypre_ParVector *x , hypre_ParVector *y , hypre_ParVector **z, HYPRE_Int k, HYPRE_Int unroll, HYPRE_Real *prod_x , HYPRE_Real *prod_y );
 hypre_ParVector *hypre_VectorToParVector ( MPI_Comm comm , hypre_Vector *v , HYPRE_BigInt *vec_starts );
@@ -57,8 +57,16 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
    MPI_Comm  comm      = hypre_ParCSRCommPkgComm(comm_pkg);
 
    HYPRE_Int num_requests = num_sends + num_recvs;
+   HYPRE_Int use_neighbor_comm = job_type == HYPRE_COMM_PKG_JOB_COMPLEX &&
+                                 hypre_ParCSRCommPkgNeighborComm(comm_pkg) != NULL;
+   if (use_neighbor_comm)
+   {
+      /* one neighborhood collective per start, see hypre_ParCSRPersistentCommHandleStart */
+      num_requests = 1;
+   }
    hypre_MPI_Request *requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
+   hypre_ParCSRCommHandleCommPkg(comm_handle)     = comm_pkg;
    hypre_ParCSRCommHandleNumRequests(comm_handle) = num_requests;
    hypre_ParCSRCommHandleRequests(comm_handle)    = requests;
 
@@ -71,6 +79,10 @@ hypre_ParCSRPersistentCommHandleCreate( HYPRE_Int job, hypre_ParCSRCommPkg *comm
          num_bytes_recv = sizeof(HYPRE_Complex) * hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs);
          send_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgSendMapStart(comm_pkg, num_sends), HYPRE_MEMORY_HOST);
          recv_buff = hypre_TAlloc(HYPRE_Complex, hypre_ParCSRCommPkgRecvVecStart(comm_pkg, num_recvs), HYPRE_MEMORY_HOST);
+         if (use_neighbor_comm)
+         {
+            break;
+         }
          for (i = 0; i < num_recvs; ++i)
          {
             HYPRE_Int ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
@@ -249,15 +261,42 @@ void hypre_ParCSRPersistentCommHandleStart( hypre_ParCSRPersistentCommHandle *co
 
    if (hypre_ParCSRCommHandleNumRequests(comm_handle) > 0)
    {
-      hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
-                     send_data,
-                     char,
-                     hypre_ParCSRCommHandleNumSendBytes(comm_handle),
-                     HYPRE_MEMORY_HOST,
-                     send_memory_location );
+      /* callers may pack directly into the send buffer of the handle */
+      if (send_data != hypre_ParCSRCommHandleSendDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy( hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                        send_data,
+                        char,
+                        hypre_ParCSRCommHandleNumSendBytes(comm_handle),
+                        HYPRE_MEMORY_HOST,
+                        send_memory_location );
+      }
+
+      HYPRE_Int ret;
+#if !defined(HYPRE_SEQUENTIAL) && MPI_VERSION >= 3
+      hypre_ParCSRCommPkg *comm_pkg = hypre_ParCSRCommHandleCommPkg(comm_handle);
 
-      HYPRE_Int ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
-                                         hypre_ParCSRCommHandleRequests(comm_handle));
+      if ( hypre_ParCSRCommPkgNeighborComm(comm_pkg) &&
+           comm_pkg->persistent_comm_handles[HYPRE_COMM_PKG_JOB_COMPLEX] == comm_handle )
+      {
+         HYPRE_Int  num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+         HYPRE_Int  num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+         hypre_int *counts    = hypre_ParCSRCommPkgNeighborCounts(comm_pkg);
+
+         ret = hypre_MPI_Ineighbor_alltoallv(hypre_ParCSRCommHandleSendDataBuffer(comm_handle),
+                                             counts, counts + num_sends, HYPRE_MPI_COMPLEX,
+                                             hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                                             counts + 2*num_sends, counts + 2*num_sends + num_recvs,
+                                             HYPRE_MPI_COMPLEX,
+                                             *hypre_ParCSRCommPkgNeighborComm(comm_pkg),
+                                             hypre_ParCSRCommHandleRequests(comm_handle));
+      }
+      else
+#endif
+      {
+         ret = hypre_MPI_Startall(hypre_ParCSRCommHandleNumRequests(comm_handle),
+                                  hypre_ParCSRCommHandleRequests(comm_handle));
+      }
       if (hypre_MPI_SUCCESS != ret)
       {
          hypre_error_w_msg(HYPRE_ERROR_GENERIC,"MPI error\n");
@@ -284,12 +323,16 @@ void hypre_ParCSRPersistentCommHandleWait( hypre_ParCSRPersistentCommHandle *com
          /*hypre_printf("MPI error %d in %s (%s, line %u)\n", ret, __FUNCTION__, __FILE__, __LINE__);*/
       }
 
-      hypre_TMemcpy(recv_data,
-                    hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
-                    char,
-                    hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
-                    recv_memory_location,
-                    HYPRE_MEMORY_HOST);
+      /* callers may read directly from the receive buffer of the handle */
+      if (recv_data != hypre_ParCSRCommHandleRecvDataBuffer(comm_handle))
+      {
+         hypre_TMemcpy(recv_data,
+                       hypre_ParCSRCommHandleRecvDataBuffer(comm_handle),
+                       char,
+                       hypre_ParCSRCommHandleNumRecvBytes(comm_handle),
+                       recv_memory_location,
+                       HYPRE_MEMORY_HOST);
+      }
    }
 }
 #endif // HYPRE_USING_PERSISTENT_COMM
@@ -417,6 +460,11 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
 #endif
 
    num_requests = num_sends + num_recvs;
+   if (job == 1 && hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      /* one neighborhood collective, posted even without neighbors */
+      num_requests = 1;
+   }
    requests = hypre_CTAlloc(hypre_MPI_Request, num_requests, HYPRE_MEMORY_HOST);
 
    hypre_MPI_Comm_size(comm, &num_procs);
@@ -429,6 +477,21 @@ hypre_ParCSRCommHandleCreate_v2 ( HYPRE_Int            job,
       {
          HYPRE_Complex *d_send_data = (HYPRE_Complex *) send_data;
          HYPRE_Complex *d_recv_data = (HYPRE_Complex *) recv_data;
+#if !defined(HYPRE_SEQUENTIAL) && MPI_VERSION >= 3
+         if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+         {
+            hypre_int *counts = hypre_ParCSRCommPkgNeighborCounts(comm_pkg);
+
+            hypre_MPI_Ineighbor_alltoallv(d_send_data, counts, counts + num_sends,
+                                          HYPRE_MPI_COMPLEX,
+                                          d_recv_data, counts + 2*num_sends,
+                                          counts + 2*num_sends + num_recvs,
+                                          HYPRE_MPI_COMPLEX,
+                                          *hypre_ParCSRCommPkgNeighborComm(comm_pkg),
+                                          &requests[j++]);
+            break;
+         }
+#endif
          for (i = 0; i < num_recvs; i++)
          {
             ip = hypre_ParCSRCommPkgRecvProc(comm_pkg, i);
@@ -943,6 +1006,63 @@ hypre_MatvecCommPkgCreate ( hypre_ParCSRMatrix *A )
                                     comm_pkg );
 #endif
 
+   if (hypre_HandleCommNeighborColl(hypre_handle()))
+   {
+      hypre_ParCSRCommPkgCreateNeighborComm(comm_pkg);
+   }
+
+   return hypre_error_flag;
+}
+
+/* ----------------------------------------------------------------------
+ * hypre_ParCSRCommPkgCreateNeighborComm
+ * caches an MPI-3 distributed graph communicator on comm_pkg that
+ * mirrors its send/recv pattern.  hypre_ParCSRCommHandleCreate then
+ * performs job 1 exchanges with a single neighborhood all-to-all
+ * instead of num_sends + num_recvs point-to-point messages.
+ * Collective on the communicator of comm_pkg.
+ * ---------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRCommPkgCreateNeighborComm( hypre_ParCSRCommPkg *comm_pkg )
+{
+#if !defined(HYPRE_SEQUENTIAL) && MPI_VERSION >= 3
+   HYPRE_Int   num_sends = hypre_ParCSRCommPkgNumSends(comm_pkg);
+   HYPRE_Int   num_recvs = hypre_ParCSRCommPkgNumRecvs(comm_pkg);
+   HYPRE_Int   i;
+   hypre_int  *counts;
+   MPI_Comm   *neighbor_comm;
+
+   if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      return hypre_error_flag;
+   }
+
+   neighbor_comm = hypre_TAlloc(MPI_Comm, 1, HYPRE_MEMORY_HOST);
+   hypre_MPI_Dist_graph_create_adjacent(hypre_ParCSRCommPkgComm(comm_pkg),
+                                        num_recvs, hypre_ParCSRCommPkgRecvProcs(comm_pkg),
+                                        num_sends, hypre_ParCSRCommPkgSendProcs(comm_pkg),
+                                        0, neighbor_comm);
+
+   counts = hypre_TAlloc(hypre_int, 2*(num_sends + num_recvs), HYPRE_MEMORY_HOST);
+   for (i = 0; i < num_sends; i++)
+   {
+      counts[i] = (hypre_int) (hypre_ParCSRCommPkgSendMapStart(comm_pkg, i+1) -
+                               hypre_ParCSRCommPkgSendMapStart(comm_pkg, i));
+      counts[num_sends + i] = (hypre_int) hypre_ParCSRCommPkgSendMapStart(comm_pkg, i);
+   }
+   for (i = 0; i < num_recvs; i++)
+   {
+      counts[2*num_sends + i] = (hypre_int) (hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i+1) -
+                                             hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i));
+      counts[2*num_sends + num_recvs + i] =
+         (hypre_int) hypre_ParCSRCommPkgRecvVecStart(comm_pkg, i);
+   }
+
+   hypre_ParCSRCommPkgNeighborComm(comm_pkg)   = neighbor_comm;
+   hypre_ParCSRCommPkgNeighborCounts(comm_pkg) = counts;
+#endif
+
    return hypre_error_flag;
 }
 
@@ -975,6 +1095,12 @@ hypre_MatvecCommPkgDestroy( hypre_ParCSRCommPkg *comm_pkg )
       hypre_TFree(hypre_ParCSRCommPkgRecvProcs(comm_pkg), HYPRE_MEMORY_HOST);
    }
    hypre_TFree(hypre_ParCSRCommPkgRecvVecStarts(comm_pkg), HYPRE_MEMORY_HOST);
+   if (hypre_ParCSRCommPkgNeighborComm(comm_pkg))
+   {
+      hypre_MPI_Comm_free(hypre_ParCSRCommPkgNeighborComm(comm_pkg));
+      hypre_TFree(hypre_ParCSRCommPkgNeighborComm(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_ParCSRCommPkgNeighborCounts(comm_pkg), HYPRE_MEMORY_HOST);
+   }
    /* if (hypre_ParCSRCommPkgRecvMPITypes(comm_pkg))
       hypre_TFree(hypre_ParCSRCommPkgRecvMPITypes(comm_pkg), HYPRE_MEMORY_HOST); */
 
@@ -813,12 +813,12 @@ hypre_ParCSRMatrix *hypre_ParMatmul( hypre_ParCSRMatrix  *A,
     *-----------------------------------------------------------------------*/
 
    last_col_diag_B = first_col_diag_B + (HYPRE_BigInt)num_cols_diag_B - 1;
-   C_diag_data = hypre_CTAlloc(HYPRE_Complex, C_diag_size, memory_location_C);
-   C_diag_j    = hypre_CTAlloc(HYPRE_Int, C_diag_size, memory_location_C);
+   C_diag_data = hypre_CTAllocFirstTouch(HYPRE_Complex, C_diag_size, memory_location_C);
+   C_diag_j    = hypre_CTAllocFirstTouch(HYPRE_Int, C_diag_size, memory_location_C);
    if (C_offd_size)
    {
-      C_offd_data = hypre_CTAlloc(HYPRE_Complex, C_offd_size, memory_location_C);
-      C_offd_j    = hypre_CTAlloc(HYPRE_Int, C_offd_size, memory_location_C);
+      C_offd_data = hypre_CTAllocFirstTouch(HYPRE_Complex, C_offd_size, memory_location_C);
+      C_offd_j    = hypre_CTAllocFirstTouch(HYPRE_Int, C_offd_size, memory_location_C);
    }
 
    /*-----------------------------------------------------------------------
@@ -114,6 +114,8 @@ hypre_ParCSRMatrixCreate( MPI_Comm comm,
    hypre_ParCSRMatrixColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixDeviceColMapOffd(matrix) = NULL;
    hypre_ParCSRMatrixProcOrdering(matrix) = NULL;
+   hypre_ParCSRMatrixNumInteriorRows(matrix) = 0;
+   hypre_ParCSRMatrixInteriorBoundaryRows(matrix) = NULL;
 
    hypre_ParCSRMatrixAssumedPartition(matrix) = NULL;
    hypre_ParCSRMatrixOwnsAssumedPartition(matrix) = 1;
@@ -225,6 +227,8 @@ hypre_ParCSRMatrixDestroy( hypre_ParCSRMatrix *matrix )
          hypre_TFree(hypre_ParCSRMatrixProcOrdering(matrix), HYPRE_MEMORY_HOST);
       }
 
+      hypre_TFree(hypre_ParCSRMatrixInteriorBoundaryRows(matrix), HYPRE_MEMORY_HOST);
+
       hypre_TFree(matrix->bdiaginv, HYPRE_MEMORY_HOST);
       if (matrix->bdiaginv_comm_pkg)
       {
@@ -413,6 +417,174 @@ hypre_ParCSRMatrixSetDNumNonzeros( hypre_ParCSRMatrix *matrix )
    return hypre_ParCSRMatrixSetNumNonzeros_core(matrix, "Double");
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixSetInteriorBoundaryRows
+ *
+ * Splits the local rows into interior rows (no entries in offd) and
+ * boundary rows, both kept in increasing order. Interior rows only couple
+ * to local unknowns, so they can be relaxed before the halo has arrived.
+ * Any previously computed splitting is replaced.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixSetInteriorBoundaryRows( hypre_ParCSRMatrix *matrix )
+{
+   hypre_CSRMatrix *offd;
+   HYPRE_Int       *offd_i;
+   HYPRE_Int       *rows;
+   HYPRE_Int        num_rows, num_interior, num_boundary, i;
+
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   offd     = hypre_ParCSRMatrixOffd(matrix);
+   offd_i   = hypre_CSRMatrixI(offd);
+   num_rows = hypre_CSRMatrixNumRows(offd);
+
+   hypre_TFree(hypre_ParCSRMatrixInteriorBoundaryRows(matrix), HYPRE_MEMORY_HOST);
+   rows = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   num_interior = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i+1] == offd_i[i])
+      {
+         rows[num_interior++] = i;
+      }
+   }
+
+   num_boundary = num_interior;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (offd_i[i+1] > offd_i[i])
+      {
+         rows[num_boundary++] = i;
+      }
+   }
+
+   hypre_ParCSRMatrixNumInteriorRows(matrix) = num_interior;
+   hypre_ParCSRMatrixInteriorBoundaryRows(matrix) = rows;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertToFloat
+ *
+ * Stores the values of the diag and offd parts (and of their transposes,
+ * if kept) in single precision.  See hypre_CSRMatrixConvertToFloat.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertToFloat( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffd(matrix));
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertToFloat(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixConvertFromFloat
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixConvertFromFloat( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixOffd(matrix));
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixConvertFromFloat(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixCompressColumns
+ *
+ * Compresses the column indices of the diag and offd parts (and of their
+ * transposes, if kept).  See hypre_CSRMatrixCompressColumns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixCompressColumns( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixCompressColumns(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixCompressColumns(hypre_ParCSRMatrixOffd(matrix));
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixCompressColumns(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixCompressColumns(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixDecompressColumns
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixDecompressColumns( hypre_ParCSRMatrix *matrix )
+{
+   if (!matrix)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   hypre_CSRMatrixDecompressColumns(hypre_ParCSRMatrixDiag(matrix));
+   hypre_CSRMatrixDecompressColumns(hypre_ParCSRMatrixOffd(matrix));
+   if (hypre_ParCSRMatrixDiagT(matrix))
+   {
+      hypre_CSRMatrixDecompressColumns(hypre_ParCSRMatrixDiagT(matrix));
+   }
+   if (hypre_ParCSRMatrixOffdT(matrix))
+   {
+      hypre_CSRMatrixDecompressColumns(hypre_ParCSRMatrixOffdT(matrix));
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParCSRMatrixSetDataOwner
  *--------------------------------------------------------------------------*/
@@ -2536,6 +2708,9 @@ hypre_ParCSRMatrixDropSmallEntries( hypre_ParCSRMatrix *A,
       return hypre_error_flag;
    }
 
+   hypre_CSRMatrixClearSELL(A_diag);
+   hypre_CSRMatrixClearSELL(A_offd);
+
    marker_offd = hypre_CTAlloc(HYPRE_Int, num_cols_A_offd, HYPRE_MEMORY_HOST);
 
    nnz_diag = nnz_offd = A_diag_i_i = A_offd_i_i = 0;
@@ -2726,6 +2901,10 @@ hypre_ParCSRMatrixTruncate(hypre_ParCSRMatrix *A,
    HYPRE_Int * num_lost_per_thread;
    HYPRE_Int * num_lost_offd_per_thread;
 
+   /* Entries are dropped and rescaled in place */
+   hypre_CSRMatrixClearSELL(A_diag);
+   hypre_CSRMatrixClearSELL(A_offd);
+
    /* Initialize threading variables */
    max_num_threads[0] = hypre_NumThreads();
    cum_lost_per_thread = hypre_CTAlloc(HYPRE_Int,  max_num_threads[0], HYPRE_MEMORY_HOST);
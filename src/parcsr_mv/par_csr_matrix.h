@@ -79,6 +79,11 @@ typedef struct hypre_ParCSRMatrix_struct
    /* Array to store ordering of local diagonal block to relax. In particular,
    used for triangulr matrices that are not ordered to be triangular. */
    HYPRE_Int            *proc_ordering;
+   /* Local rows without offd entries (interior) followed by the remaining
+      (boundary) rows. Optional, used by the hybrid smoothers to relax the
+      interior rows while the halo exchange is in flight */
+   HYPRE_Int             num_interior_rows;
+   HYPRE_Int            *interior_boundary_rows;
 
    /* Save block diagonal inverse */
    HYPRE_Int             bdiag_size;
@@ -125,6 +130,8 @@ typedef struct hypre_ParCSRMatrix_struct
 #define hypre_ParCSRMatrixAssumedPartition(matrix)       ((matrix) -> assumed_partition)
 #define hypre_ParCSRMatrixOwnsAssumedPartition(matrix)   ((matrix) -> owns_assumed_partition)
 #define hypre_ParCSRMatrixProcOrdering(matrix)           ((matrix) -> proc_ordering)
+#define hypre_ParCSRMatrixNumInteriorRows(matrix)        ((matrix) -> num_interior_rows)
+#define hypre_ParCSRMatrixInteriorBoundaryRows(matrix)   ((matrix) -> interior_boundary_rows)
 #if defined(HYPRE_USING_CUDA)
 #define hypre_ParCSRMatrixSocDiagJ(matrix)               ((matrix) -> soc_diag_j)
 #define hypre_ParCSRMatrixSocOffdJ(matrix)               ((matrix) -> soc_offd_j)
@@ -147,6 +154,62 @@ hypre_ParCSRMatrixMemoryLocation(hypre_ParCSRMatrix *matrix)
    return memory_diag;
 }
 
+/*--------------------------------------------------------------------------
+ * Symbolic product handles
+ *
+ * Reusable structure of C = A*B (hypre_ParCSRMatMatSymbolic) and of
+ * C = R^T*A*P (hypre_ParCSRMatrixRAPKTSymbolic).  As long as the sparsity
+ * patterns and the partitionings of the factors do not change, the values
+ * of C can be recomputed with the corresponding Numeric routine without
+ * rebuilding col_map_offd, the communication packages or the rows of C.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int             num_rows;          /* local rows of C */
+   HYPRE_Int             num_cols_diag;     /* local columns of C */
+   HYPRE_Int             num_cols_offd;     /* offd columns of C */
+   HYPRE_Int             num_cols_offd_B;
+   HYPRE_Int            *map_B_to_C;        /* offd columns of B in C */
+
+   /* rows of B owned by other processes (one per offd column of A), split
+      into the diag and offd columns of C, and the nonzero based package
+      that exchanges their values */
+   hypre_ParCSRCommPkg  *ext_comm_pkg;
+   HYPRE_Int             num_ext_send_rows;
+   HYPRE_Int            *ext_send_rows;     /* local rows of B to send */
+   HYPRE_Complex        *ext_send_data;
+   HYPRE_Complex        *ext_recv_data;
+   HYPRE_Int            *ext_pos;           /* received entry -> Bext_diag (>= 0)
+                                               or Bext_offd (-pos-1) */
+   hypre_CSRMatrix      *Bext_diag;
+   hypre_CSRMatrix      *Bext_offd;
+
+} hypre_ParCSRMatMatHandle;
+
+typedef struct
+{
+   hypre_ParCSRMatMatHandle *AP_handle;
+   hypre_ParCSRMatrix       *AP;            /* storage for A*P */
+   HYPRE_Int                *map_AP_to_C;   /* offd columns of A*P in C */
+
+   /* R^T, with the positions of its entries in R */
+   hypre_CSRMatrix          *RT_diag;
+   HYPRE_Int                *RT_diag_perm;
+   hypre_CSRMatrix          *RT_offd;
+   HYPRE_Int                *RT_offd_perm;
+
+   /* R_offd^T*A*P: rows of C owned by other processes, in the columns of
+      A*P (diag columns first), and the nonzero based package that sends
+      their values to the owners, where they are added at C_int_pos */
+   hypre_CSRMatrix          *C_ext;
+   hypre_ParCSRCommPkg      *C_ext_comm_pkg;
+   HYPRE_Int                 num_C_int;
+   HYPRE_Complex            *C_int_data;
+   HYPRE_Int                *C_int_pos;     /* C_diag (< nnz_diag) or C_offd */
+
+} hypre_ParCSRRAPHandle;
+
 /*--------------------------------------------------------------------------
  * Parallel CSR Boolean Matrix
  *--------------------------------------------------------------------------*/
@@ -960,6 +960,1362 @@ hypre_ParCSRMatrix *hypre_ParCSRMatrixRAP( hypre_ParCSRMatrix *R,
    return hypre_ParCSRMatrixRAPKT( R, A, P, 0);
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTripleMatTransposeWithPerm
+ *
+ * Transposes the pattern of A.  perm[k] is the position in A of entry k of
+ * AT, so that the values of AT can be refreshed without transposing again.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRTripleMatTransposeWithPerm( hypre_CSRMatrix  *A,
+                                        hypre_CSRMatrix **AT_ptr,
+                                        HYPRE_Int       **perm_ptr )
+{
+   HYPRE_Int        num_rows = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int        num_cols = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int        nnz      = hypre_CSRMatrixI(A)[num_rows];
+   HYPRE_Int       *A_i      = hypre_CSRMatrixI(A);
+   HYPRE_Int       *A_j      = hypre_CSRMatrixJ(A);
+   hypre_CSRMatrix *AT;
+   HYPRE_Int       *AT_i, *AT_j, *perm;
+   HYPRE_Int        i, k, pos;
+
+   AT = hypre_CSRMatrixCreate(num_cols, num_rows, nnz);
+   hypre_CSRMatrixInitialize_v2(AT, 0, HYPRE_MEMORY_HOST);
+   AT_i = hypre_CSRMatrixI(AT);
+   AT_j = hypre_CSRMatrixJ(AT);
+   perm = hypre_TAlloc(HYPRE_Int, nnz, HYPRE_MEMORY_HOST);
+
+   for (k = 0; k < nnz; k++)
+   {
+      AT_i[A_j[k] + 1]++;
+   }
+   for (i = 0; i < num_cols; i++)
+   {
+      AT_i[i + 1] += AT_i[i];
+   }
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = A_i[i]; k < A_i[i + 1]; k++)
+      {
+         pos = AT_i[A_j[k]]++;
+         AT_j[pos] = i;
+         perm[pos] = k;
+      }
+   }
+   for (i = num_cols; i > 0; i--)
+   {
+      AT_i[i] = AT_i[i - 1];
+   }
+   AT_i[0] = 0;
+
+   *AT_ptr   = AT;
+   *perm_ptr = perm;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRTripleMatUnionColMap
+ *
+ * Returns in col_map (length *num_cols_ptr) the sorted union of the
+ * num_cols_B indices of col_map_B (sorted) and of the entries of big_j that
+ * are not in [first_col, last_col].  If requested, map_B[i] is the position
+ * of col_map_B[i] in col_map.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_ParCSRTripleMatUnionColMap( HYPRE_Int      num_cols_B,
+                                  HYPRE_BigInt  *col_map_B,
+                                  HYPRE_Int      nnz,
+                                  HYPRE_BigInt  *big_j,
+                                  HYPRE_BigInt   first_col,
+                                  HYPRE_BigInt   last_col,
+                                  HYPRE_Int     *num_cols_ptr,
+                                  HYPRE_BigInt **col_map_ptr,
+                                  HYPRE_Int    **map_B_ptr )
+{
+   HYPRE_BigInt *col_map;
+   HYPRE_Int    *map_B = NULL;
+   HYPRE_Int     num_cols, i, cnt;
+
+   col_map = hypre_TAlloc(HYPRE_BigInt, num_cols_B + nnz, HYPRE_MEMORY_HOST);
+   num_cols = 0;
+   for (i = 0; i < num_cols_B; i++)
+   {
+      col_map[num_cols++] = col_map_B[i];
+   }
+   for (i = 0; i < nnz; i++)
+   {
+      if (big_j[i] < first_col || big_j[i] > last_col)
+      {
+         col_map[num_cols++] = big_j[i];
+      }
+   }
+
+   if (num_cols)
+   {
+      hypre_BigQsort0(col_map, 0, num_cols - 1);
+      cnt = 0;
+      for (i = 1; i < num_cols; i++)
+      {
+         if (col_map[i] > col_map[cnt])
+         {
+            col_map[++cnt] = col_map[i];
+         }
+      }
+      num_cols = cnt + 1;
+   }
+
+   if (map_B_ptr)
+   {
+      map_B = hypre_TAlloc(HYPRE_Int, num_cols_B, HYPRE_MEMORY_HOST);
+      cnt = 0;
+      for (i = 0; i < num_cols_B; i++)
+      {
+         while (col_map[cnt] < col_map_B[i])
+         {
+            cnt++;
+         }
+         map_B[i] = cnt;
+      }
+      *map_B_ptr = map_B;
+   }
+
+   *num_cols_ptr = num_cols;
+   *col_map_ptr  = col_map;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatSymbolic : computes the structure of C = A*B and returns
+ * it in a ParCSRMatrix C with zero values, together with a handle that
+ * hypre_ParCSRMatMatNumeric uses to compute (and recompute) the values of C.
+ * The external rows of B are fetched once; their values are exchanged by
+ * every numeric call through a package that is built here.
+ * As in hypre_ParCSRMatMat, C does not own the partitionings.
+ * The column indices of C are ordered as in the product, except that the
+ * diagonal comes first in every row when C is square.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatMatSymbolic( hypre_ParCSRMatrix        *A,
+                            hypre_ParCSRMatrix        *B,
+                            hypre_ParCSRMatMatHandle **handle_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg *comm_pkg_A;
+
+   hypre_CSRMatrix *A_diag   = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j = hypre_CSRMatrixJ(A_diag);
+   hypre_CSRMatrix *A_offd   = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Int        num_rows_diag_A = hypre_CSRMatrixNumRows(A_diag);
+   HYPRE_Int        num_cols_diag_A = hypre_CSRMatrixNumCols(A_diag);
+   HYPRE_Int        num_cols_offd_A = hypre_CSRMatrixNumCols(A_offd);
+
+   hypre_CSRMatrix *B_diag   = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int       *B_diag_i = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *B_diag_j = hypre_CSRMatrixJ(B_diag);
+   hypre_CSRMatrix *B_offd   = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int       *B_offd_i = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int       *B_offd_j = hypre_CSRMatrixJ(B_offd);
+   HYPRE_BigInt    *col_map_offd_B   = hypre_ParCSRMatrixColMapOffd(B);
+   HYPRE_BigInt     first_col_diag_B = hypre_ParCSRMatrixFirstColDiag(B);
+   HYPRE_Int        num_rows_diag_B  = hypre_CSRMatrixNumRows(B_diag);
+   HYPRE_Int        num_cols_diag_B  = hypre_CSRMatrixNumCols(B_diag);
+   HYPRE_Int        num_cols_offd_B  = hypre_CSRMatrixNumCols(B_offd);
+   HYPRE_BigInt     last_col_diag_B  = first_col_diag_B + num_cols_diag_B - 1;
+
+   hypre_ParCSRMatMatHandle *handle;
+   hypre_ParCSRCommPkg      *ext_comm_pkg;
+   hypre_CSRMatrix          *Bs_ext, *Bext_diag = NULL, *Bext_offd = NULL;
+   HYPRE_Int                *Bs_ext_i, *Bext_diag_i = NULL, *Bext_diag_j = NULL;
+   HYPRE_Int                *Bext_offd_i = NULL, *Bext_offd_j = NULL;
+   HYPRE_BigInt             *Bs_ext_j;
+   HYPRE_Int                 Bs_ext_nnz = 0, *ext_pos = NULL;
+
+   hypre_ParCSRMatrix *C;
+   hypre_CSRMatrix    *C_diag, *C_offd;
+   HYPRE_Int          *C_diag_i, *C_diag_j, *C_offd_i, *C_offd_j;
+   HYPRE_BigInt       *col_map_offd_C = NULL;
+   HYPRE_Int          *map_B_to_C = NULL;
+   HYPRE_Int           num_cols_offd_C = 0;
+   HYPRE_Int           nnz_diag, nnz_offd, num_cols_C, allsquare;
+   HYPRE_Int          *marker;
+
+   HYPRE_Int           num_procs, num_sends, num_recvs, num_send_rows;
+   HYPRE_Int           i, j, k, kk, row, col, cnt_diag, cnt_offd, pass;
+
+   if (hypre_ParCSRMatrixGlobalNumCols(A) != hypre_ParCSRMatrixGlobalNumRows(B) ||
+       num_cols_diag_A != num_rows_diag_B)
+   {
+      hypre_error_in_arg(1);
+      hypre_printf(" Error! Incompatible matrix dimensions!\n");
+      return NULL;
+   }
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   handle = hypre_CTAlloc(hypre_ParCSRMatMatHandle, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    *  Fetch the structure of the external rows of B, build the columns of C
+    *  and split the external rows into the diag and offd columns of C
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      if (!hypre_ParCSRMatrixCommPkg(A))
+      {
+         hypre_MatvecCommPkgCreate(A);
+      }
+      comm_pkg_A = hypre_ParCSRMatrixCommPkg(A);
+
+      Bs_ext     = hypre_ParCSRMatrixExtractBExt(B, A, 0);
+      Bs_ext_i   = hypre_CSRMatrixI(Bs_ext);
+      Bs_ext_j   = hypre_CSRMatrixBigJ(Bs_ext);
+      Bs_ext_nnz = Bs_ext_i[num_cols_offd_A];
+
+      hypre_ParCSRTripleMatUnionColMap(num_cols_offd_B, col_map_offd_B, Bs_ext_nnz, Bs_ext_j,
+                                       first_col_diag_B, last_col_diag_B, &num_cols_offd_C,
+                                       &col_map_offd_C, &map_B_to_C);
+
+      ext_pos     = hypre_TAlloc(HYPRE_Int, Bs_ext_nnz, HYPRE_MEMORY_HOST);
+      Bext_diag_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+      Bext_offd_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_A + 1, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_A; i++)
+      {
+         for (k = Bs_ext_i[i]; k < Bs_ext_i[i + 1]; k++)
+         {
+            if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+            {
+               Bext_offd_i[i + 1]++;
+            }
+            else
+            {
+               Bext_diag_i[i + 1]++;
+            }
+         }
+         Bext_diag_i[i + 1] += Bext_diag_i[i];
+         Bext_offd_i[i + 1] += Bext_offd_i[i];
+      }
+
+      Bext_diag = hypre_CSRMatrixCreate(num_cols_offd_A, num_cols_diag_B,
+                                        Bext_diag_i[num_cols_offd_A]);
+      Bext_offd = hypre_CSRMatrixCreate(num_cols_offd_A, num_cols_offd_C,
+                                        Bext_offd_i[num_cols_offd_A]);
+      hypre_CSRMatrixI(Bext_diag) = Bext_diag_i;
+      hypre_CSRMatrixI(Bext_offd) = Bext_offd_i;
+      hypre_CSRMatrixInitialize_v2(Bext_diag, 0, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixInitialize_v2(Bext_offd, 0, HYPRE_MEMORY_HOST);
+      Bext_diag_j = hypre_CSRMatrixJ(Bext_diag);
+      Bext_offd_j = hypre_CSRMatrixJ(Bext_offd);
+
+      cnt_diag = cnt_offd = 0;
+      for (k = 0; k < Bs_ext_nnz; k++)
+      {
+         if (Bs_ext_j[k] < first_col_diag_B || Bs_ext_j[k] > last_col_diag_B)
+         {
+            Bext_offd_j[cnt_offd] = hypre_BigBinarySearch(col_map_offd_C, Bs_ext_j[k],
+                                                          num_cols_offd_C);
+            ext_pos[k] = -cnt_offd - 1;
+            cnt_offd++;
+         }
+         else
+         {
+            Bext_diag_j[cnt_diag] = (HYPRE_Int)(Bs_ext_j[k] - first_col_diag_B);
+            ext_pos[k] = cnt_diag;
+            cnt_diag++;
+         }
+      }
+
+      /* package that sends the values of the rows of B in the order in
+         which hypre_ParCSRMatrixExtractBExt sends them (diag, then offd) */
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg_A);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg_A);
+      num_send_rows = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, num_sends);
+
+      ext_comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm(ext_comm_pkg)     = comm;
+      hypre_ParCSRCommPkgNumSends(ext_comm_pkg) = num_sends;
+      hypre_ParCSRCommPkgNumRecvs(ext_comm_pkg) = num_recvs;
+      hypre_ParCSRCommPkgSendProcs(ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvProcs(ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(ext_comm_pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg_A),
+                    HYPRE_Int, num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(ext_comm_pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg_A),
+                    HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+
+      handle->ext_send_rows = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(handle->ext_send_rows, hypre_ParCSRCommPkgSendMapElmts(comm_pkg_A),
+                    HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStart(ext_comm_pkg, 0) = 0;
+      cnt_diag = 0;
+      for (i = 0; i < num_sends; i++)
+      {
+         for (j = hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i);
+              j < hypre_ParCSRCommPkgSendMapStart(comm_pkg_A, i + 1); j++)
+         {
+            row = handle->ext_send_rows[j];
+            cnt_diag += B_diag_i[row + 1] - B_diag_i[row] + B_offd_i[row + 1] - B_offd_i[row];
+         }
+         hypre_ParCSRCommPkgSendMapStart(ext_comm_pkg, i + 1) = cnt_diag;
+      }
+      for (i = 0; i <= num_recvs; i++)
+      {
+         hypre_ParCSRCommPkgRecvVecStart(ext_comm_pkg, i) =
+            Bs_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg_A, i)];
+      }
+
+      handle->ext_comm_pkg      = ext_comm_pkg;
+      handle->num_ext_send_rows = num_send_rows;
+      handle->ext_send_data     = hypre_TAlloc(HYPRE_Complex, cnt_diag, HYPRE_MEMORY_HOST);
+      handle->ext_recv_data     = hypre_TAlloc(HYPRE_Complex, Bs_ext_nnz, HYPRE_MEMORY_HOST);
+
+      hypre_CSRMatrixDestroy(Bs_ext);
+   }
+   else if (num_cols_offd_B)
+   {
+      num_cols_offd_C = num_cols_offd_B;
+      col_map_offd_C  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      map_B_to_C      = hypre_TAlloc(HYPRE_Int, num_cols_offd_B, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_B; i++)
+      {
+         col_map_offd_C[i] = col_map_offd_B[i];
+         map_B_to_C[i] = i;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Structure of C: columns in [0, num_cols_diag_B) are diag columns,
+    *  the others are offd columns shifted by num_cols_diag_B.  The first
+    *  pass counts, the second one fills.
+    *-----------------------------------------------------------------------*/
+
+   num_cols_C = num_cols_diag_B + num_cols_offd_C;
+   allsquare  = (num_rows_diag_A == num_cols_diag_B);
+   marker     = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+
+   C_diag_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, HYPRE_MEMORY_HOST);
+   C_offd_i = hypre_CTAlloc(HYPRE_Int, num_rows_diag_A + 1, HYPRE_MEMORY_HOST);
+   C_diag_j = C_offd_j = NULL;
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (i = 0; i < num_cols_C; i++)
+      {
+         marker[i] = -1;
+      }
+      cnt_diag = cnt_offd = 0;
+
+      for (i = 0; i < num_rows_diag_A; i++)
+      {
+         HYPRE_Int row_start_diag = cnt_diag;
+         HYPRE_Int row_start_offd = cnt_offd;
+
+         if (allsquare)
+         {
+            col = i;
+            if (marker[col] < row_start_diag)
+            {
+               marker[col] = cnt_diag;
+               if (pass)
+               {
+                  C_diag_j[cnt_diag] = col;
+               }
+               cnt_diag++;
+            }
+         }
+         for (kk = A_diag_i[i]; kk < A_diag_i[i + 1]; kk++)
+         {
+            row = A_diag_j[kk];
+            for (k = B_diag_i[row]; k < B_diag_i[row + 1]; k++)
+            {
+               col = B_diag_j[k];
+               if (marker[col] < row_start_diag)
+               {
+                  marker[col] = cnt_diag;
+                  if (pass)
+                  {
+                     C_diag_j[cnt_diag] = col;
+                  }
+                  cnt_diag++;
+               }
+            }
+            for (k = B_offd_i[row]; k < B_offd_i[row + 1]; k++)
+            {
+               col = num_cols_diag_B + map_B_to_C[B_offd_j[k]];
+               if (marker[col] < row_start_offd)
+               {
+                  marker[col] = cnt_offd;
+                  if (pass)
+                  {
+                     C_offd_j[cnt_offd] = col - num_cols_diag_B;
+                  }
+                  cnt_offd++;
+               }
+            }
+         }
+         if (Bext_diag)
+         {
+            for (kk = A_offd_i[i]; kk < A_offd_i[i + 1]; kk++)
+            {
+               row = A_offd_j[kk];
+               for (k = Bext_diag_i[row]; k < Bext_diag_i[row + 1]; k++)
+               {
+                  col = Bext_diag_j[k];
+                  if (marker[col] < row_start_diag)
+                  {
+                     marker[col] = cnt_diag;
+                     if (pass)
+                     {
+                        C_diag_j[cnt_diag] = col;
+                     }
+                     cnt_diag++;
+                  }
+               }
+               for (k = Bext_offd_i[row]; k < Bext_offd_i[row + 1]; k++)
+               {
+                  col = num_cols_diag_B + Bext_offd_j[k];
+                  if (marker[col] < row_start_offd)
+                  {
+                     marker[col] = cnt_offd;
+                     if (pass)
+                     {
+                        C_offd_j[cnt_offd] = col - num_cols_diag_B;
+                     }
+                     cnt_offd++;
+                  }
+               }
+            }
+         }
+
+         if (!pass)
+         {
+            C_diag_i[i + 1] = cnt_diag;
+            C_offd_i[i + 1] = cnt_offd;
+         }
+      }
+
+      if (!pass)
+      {
+         nnz_diag = cnt_diag;
+         nnz_offd = cnt_offd;
+         C_diag_j = hypre_TAlloc(HYPRE_Int, nnz_diag, HYPRE_MEMORY_HOST);
+         C_offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+   C = hypre_ParCSRMatrixCreate(comm, hypre_ParCSRMatrixGlobalNumRows(A),
+                                hypre_ParCSRMatrixGlobalNumCols(B),
+                                hypre_ParCSRMatrixRowStarts(A),
+                                hypre_ParCSRMatrixColStarts(B),
+                                num_cols_offd_C, nnz_diag, nnz_offd);
+
+   /* Note that C does not own the partitionings */
+   hypre_ParCSRMatrixSetRowStartsOwner(C, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(C, 0);
+
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_diag) = C_diag_i;
+   hypre_CSRMatrixJ(C_diag) = C_diag_j;
+   hypre_CSRMatrixData(C_diag) = hypre_CTAlloc(HYPRE_Complex, nnz_diag, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C_diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(C_offd) = C_offd_i;
+   hypre_CSRMatrixJ(C_offd) = C_offd_j;
+   hypre_CSRMatrixData(C_offd) = hypre_CTAlloc(HYPRE_Complex, nnz_offd, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C_offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+
+   handle->num_rows        = num_rows_diag_A;
+   handle->num_cols_diag   = num_cols_diag_B;
+   handle->num_cols_offd   = num_cols_offd_C;
+   handle->num_cols_offd_B = num_cols_offd_B;
+   handle->map_B_to_C      = map_B_to_C;
+   handle->ext_pos         = ext_pos;
+   handle->Bext_diag       = Bext_diag;
+   handle->Bext_offd       = Bext_offd;
+
+   *handle_ptr = handle;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatNumeric : computes the values of C = A*B in place, for a
+ * C and a handle returned by hypre_ParCSRMatMatSymbolic(A, B).  The values
+ * of A and B may have changed since then, their structures may not.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatNumeric( hypre_ParCSRMatMatHandle *handle,
+                           hypre_ParCSRMatrix       *A,
+                           hypre_ParCSRMatrix       *B,
+                           hypre_ParCSRMatrix       *C )
+{
+   hypre_CSRMatrix *A_diag      = hypre_ParCSRMatrixDiag(A);
+   HYPRE_Int       *A_diag_i    = hypre_CSRMatrixI(A_diag);
+   HYPRE_Int       *A_diag_j    = hypre_CSRMatrixJ(A_diag);
+   HYPRE_Complex   *A_diag_data = hypre_CSRMatrixData(A_diag);
+   hypre_CSRMatrix *A_offd      = hypre_ParCSRMatrixOffd(A);
+   HYPRE_Int       *A_offd_i    = hypre_CSRMatrixI(A_offd);
+   HYPRE_Int       *A_offd_j    = hypre_CSRMatrixJ(A_offd);
+   HYPRE_Complex   *A_offd_data = hypre_CSRMatrixData(A_offd);
+
+   hypre_CSRMatrix *B_diag      = hypre_ParCSRMatrixDiag(B);
+   HYPRE_Int       *B_diag_i    = hypre_CSRMatrixI(B_diag);
+   HYPRE_Int       *B_diag_j    = hypre_CSRMatrixJ(B_diag);
+   HYPRE_Complex   *B_diag_data = hypre_CSRMatrixData(B_diag);
+   hypre_CSRMatrix *B_offd      = hypre_ParCSRMatrixOffd(B);
+   HYPRE_Int       *B_offd_i    = hypre_CSRMatrixI(B_offd);
+   HYPRE_Int       *B_offd_j    = hypre_CSRMatrixJ(B_offd);
+   HYPRE_Complex   *B_offd_data = hypre_CSRMatrixData(B_offd);
+
+   hypre_CSRMatrix *C_diag      = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int       *C_diag_i    = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int       *C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex   *C_diag_data = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix *C_offd      = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int       *C_offd_i    = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int       *C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex   *C_offd_data = hypre_CSRMatrixData(C_offd);
+
+   HYPRE_Int        num_rows      = handle->num_rows;
+   HYPRE_Int        num_cols_diag = handle->num_cols_diag;
+   HYPRE_Int        num_cols_C    = num_cols_diag + handle->num_cols_offd;
+   HYPRE_Int       *map_B_to_C    = handle->map_B_to_C;
+   hypre_CSRMatrix *Bext_diag     = handle->Bext_diag;
+   hypre_CSRMatrix *Bext_offd     = handle->Bext_offd;
+   HYPRE_Int       *ext_pos       = handle->ext_pos;
+
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int        i, k, row, pos, nnz_ext;
+
+#if defined(HYPRE_USING_CUDA)
+   if (hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(A),
+                             hypre_ParCSRMatrixMemoryLocation(B) ) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Symbolic/numeric MatMat is host only\n");
+      return hypre_error_flag;
+   }
+#endif
+
+   /* start the exchange of the values of the external rows of B */
+   if (handle->ext_comm_pkg)
+   {
+      HYPRE_Complex *send_data = handle->ext_send_data;
+
+      for (i = 0, pos = 0; i < handle->num_ext_send_rows; i++)
+      {
+         row = handle->ext_send_rows[i];
+         for (k = B_diag_i[row]; k < B_diag_i[row + 1]; k++)
+         {
+            send_data[pos++] = B_diag_data[k];
+         }
+         for (k = B_offd_i[row]; k < B_offd_i[row + 1]; k++)
+         {
+            send_data[pos++] = B_offd_data[k];
+         }
+      }
+      comm_handle = hypre_ParCSRCommHandleCreate(1, handle->ext_comm_pkg, send_data,
+                                                 handle->ext_recv_data);
+   }
+
+   /* C = A_diag*B, overlapped with the exchange */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k, row)
+#endif
+   {
+      HYPRE_Int *marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int  kk;
+      HYPRE_Complex a;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = C_diag_i[i]; k < C_diag_i[i + 1]; k++)
+         {
+            marker[C_diag_j[k]] = k;
+            C_diag_data[k] = 0.0;
+         }
+         for (k = C_offd_i[i]; k < C_offd_i[i + 1]; k++)
+         {
+            marker[num_cols_diag + C_offd_j[k]] = k;
+            C_offd_data[k] = 0.0;
+         }
+         for (kk = A_diag_i[i]; kk < A_diag_i[i + 1]; kk++)
+         {
+            row = A_diag_j[kk];
+            a = A_diag_data[kk];
+            for (k = B_diag_i[row]; k < B_diag_i[row + 1]; k++)
+            {
+               C_diag_data[marker[B_diag_j[k]]] += a * B_diag_data[k];
+            }
+            for (k = B_offd_i[row]; k < B_offd_i[row + 1]; k++)
+            {
+               C_offd_data[marker[num_cols_diag + map_B_to_C[B_offd_j[k]]]] += a * B_offd_data[k];
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   if (!comm_handle)
+   {
+      return hypre_error_flag;
+   }
+
+   /* C += A_offd*B_ext */
+   hypre_ParCSRCommHandleDestroy(comm_handle);
+
+   nnz_ext = hypre_CSRMatrixNumNonzeros(Bext_diag) + hypre_CSRMatrixNumNonzeros(Bext_offd);
+   for (k = 0; k < nnz_ext; k++)
+   {
+      pos = ext_pos[k];
+      if (pos >= 0)
+      {
+         hypre_CSRMatrixData(Bext_diag)[pos] = handle->ext_recv_data[k];
+      }
+      else
+      {
+         hypre_CSRMatrixData(Bext_offd)[-pos - 1] = handle->ext_recv_data[k];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k, row)
+#endif
+   {
+      HYPRE_Int     *marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int     *Bext_diag_i    = hypre_CSRMatrixI(Bext_diag);
+      HYPRE_Int     *Bext_diag_j    = hypre_CSRMatrixJ(Bext_diag);
+      HYPRE_Complex *Bext_diag_data = hypre_CSRMatrixData(Bext_diag);
+      HYPRE_Int     *Bext_offd_i    = hypre_CSRMatrixI(Bext_offd);
+      HYPRE_Int     *Bext_offd_j    = hypre_CSRMatrixJ(Bext_offd);
+      HYPRE_Complex *Bext_offd_data = hypre_CSRMatrixData(Bext_offd);
+      HYPRE_Int      kk;
+      HYPRE_Complex  a;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         if (A_offd_i[i] == A_offd_i[i + 1])
+         {
+            continue;
+         }
+         for (k = C_diag_i[i]; k < C_diag_i[i + 1]; k++)
+         {
+            marker[C_diag_j[k]] = k;
+         }
+         for (k = C_offd_i[i]; k < C_offd_i[i + 1]; k++)
+         {
+            marker[num_cols_diag + C_offd_j[k]] = k;
+         }
+         for (kk = A_offd_i[i]; kk < A_offd_i[i + 1]; kk++)
+         {
+            row = A_offd_j[kk];
+            a = A_offd_data[kk];
+            for (k = Bext_diag_i[row]; k < Bext_diag_i[row + 1]; k++)
+            {
+               C_diag_data[marker[Bext_diag_j[k]]] += a * Bext_diag_data[k];
+            }
+            for (k = Bext_offd_i[row]; k < Bext_offd_i[row + 1]; k++)
+            {
+               C_offd_data[marker[num_cols_diag + Bext_offd_j[k]]] += a * Bext_offd_data[k];
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatMatHandleDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatMatHandleDestroy( hypre_ParCSRMatMatHandle *handle )
+{
+   if (handle)
+   {
+      hypre_TFree(handle->map_B_to_C, HYPRE_MEMORY_HOST);
+      if (handle->ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(handle->ext_comm_pkg);
+      }
+      hypre_TFree(handle->ext_send_rows, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle->ext_send_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle->ext_recv_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle->ext_pos, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(handle->Bext_diag);
+      hypre_CSRMatrixDestroy(handle->Bext_offd);
+      hypre_TFree(handle, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTSymbolic : computes the structure of C = R^T*A*P
+ * and returns it in a ParCSRMatrix C with zero values, together with a
+ * handle that hypre_ParCSRMatrixRAPKTNumeric uses to compute (and
+ * recompute) the values of C.  A*P is formed with hypre_ParCSRMatMatSymbolic
+ * and kept in the handle, as is the transpose of R.  The rows of C that are
+ * owned by other processes are exchanged once here; every numeric call only
+ * sends their values.  As in hypre_ParCSRMatrixRAPKT, C takes over the
+ * ownership of the column partitionings of P and R and gets a CommPkg.
+ *--------------------------------------------------------------------------*/
+
+hypre_ParCSRMatrix*
+hypre_ParCSRMatrixRAPKTSymbolic( hypre_ParCSRMatrix     *R,
+                                 hypre_ParCSRMatrix     *A,
+                                 hypre_ParCSRMatrix     *P,
+                                 hypre_ParCSRRAPHandle **handle_ptr )
+{
+   MPI_Comm             comm = hypre_ParCSRMatrixComm(A);
+   hypre_ParCSRCommPkg *comm_pkg_R;
+   hypre_ParCSRCommPkg *C_ext_comm_pkg = NULL;
+   void                *request;
+
+   hypre_CSRMatrix *R_diag = hypre_ParCSRMatrixDiag(R);
+   hypre_CSRMatrix *R_offd = hypre_ParCSRMatrixOffd(R);
+   HYPRE_Int        num_cols_diag_R = hypre_CSRMatrixNumCols(R_diag);
+   HYPRE_Int        num_cols_offd_R = hypre_CSRMatrixNumCols(R_offd);
+
+   HYPRE_BigInt     first_col_diag_P = hypre_ParCSRMatrixFirstColDiag(P);
+   HYPRE_Int        num_cols_diag_P  = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixDiag(P));
+   HYPRE_BigInt     last_col_diag_P  = first_col_diag_P + num_cols_diag_P - 1;
+
+   hypre_ParCSRRAPHandle    *handle;
+   hypre_ParCSRMatMatHandle *AP_handle;
+   hypre_ParCSRMatrix       *AP;
+   HYPRE_Int                *AP_diag_i, *AP_diag_j, *AP_offd_i, *AP_offd_j;
+   HYPRE_BigInt             *col_map_offd_AP;
+   HYPRE_Int                 num_cols_offd_AP, num_cols_AP;
+   HYPRE_Int                *map_AP_to_C = NULL;
+
+   hypre_CSRMatrix *RT_diag, *RT_offd = NULL;
+   HYPRE_Int       *RT_diag_perm, *RT_offd_perm = NULL;
+   HYPRE_Int       *RT_diag_i, *RT_diag_j;
+
+   hypre_CSRMatrix *C_ext = NULL, *C_int = NULL;
+   HYPRE_Int       *C_ext_i = NULL, *C_ext_j = NULL, *C_int_i = NULL;
+   HYPRE_BigInt    *C_ext_big_j, *C_int_j = NULL;
+   HYPRE_Int        num_C_int = 0, *C_int_pos = NULL, *C_int_col = NULL;
+   HYPRE_Int       *int_rows_i = NULL, *int_rows = NULL;
+
+   hypre_ParCSRMatrix *C;
+   hypre_CSRMatrix    *C_diag, *C_offd;
+   HYPRE_Int          *C_diag_i, *C_diag_j = NULL, *C_offd_i, *C_offd_j = NULL;
+   HYPRE_BigInt       *col_map_offd_C = NULL;
+   HYPRE_Int           num_cols_offd_C = 0, num_cols_C;
+   HYPRE_Int           nnz_diag = 0, nnz_offd = 0, allsquare;
+   HYPRE_Int          *marker;
+
+   HYPRE_Int           num_procs, num_sends, num_recvs, num_send_rows;
+   HYPRE_Int           i, j, k, kk, row, col, cnt, cnt_diag, cnt_offd, pass;
+
+   hypre_MPI_Comm_size(comm, &num_procs);
+
+   /*-----------------------------------------------------------------------
+    *  A*P and R^T
+    *-----------------------------------------------------------------------*/
+
+   AP = hypre_ParCSRMatMatSymbolic(A, P, &AP_handle);
+   if (!AP)
+   {
+      return NULL;
+   }
+   AP_diag_i        = hypre_CSRMatrixI(hypre_ParCSRMatrixDiag(AP));
+   AP_diag_j        = hypre_CSRMatrixJ(hypre_ParCSRMatrixDiag(AP));
+   AP_offd_i        = hypre_CSRMatrixI(hypre_ParCSRMatrixOffd(AP));
+   AP_offd_j        = hypre_CSRMatrixJ(hypre_ParCSRMatrixOffd(AP));
+   col_map_offd_AP  = hypre_ParCSRMatrixColMapOffd(AP);
+   num_cols_offd_AP = hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(AP));
+   num_cols_AP      = num_cols_diag_P + num_cols_offd_AP;
+
+   hypre_ParCSRTripleMatTransposeWithPerm(R_diag, &RT_diag, &RT_diag_perm);
+   RT_diag_i = hypre_CSRMatrixI(RT_diag);
+   RT_diag_j = hypre_CSRMatrixJ(RT_diag);
+
+   handle = hypre_CTAlloc(hypre_ParCSRRAPHandle, 1, HYPRE_MEMORY_HOST);
+
+   /*-----------------------------------------------------------------------
+    *  C_ext = R_offd^T*A*P: rows of C owned by other processes, in the
+    *  columns of A*P (diag columns first).  Their structure is sent once to
+    *  the owners (C_int, one row per send element of the CommPkg of R).
+    *-----------------------------------------------------------------------*/
+
+   if (num_procs > 1)
+   {
+      HYPRE_Int *RT_offd_i, *RT_offd_j;
+
+      if (!hypre_ParCSRMatrixCommPkg(R))
+      {
+         hypre_MatvecCommPkgCreate(R);
+      }
+      comm_pkg_R = hypre_ParCSRMatrixCommPkg(R);
+
+      hypre_ParCSRTripleMatTransposeWithPerm(R_offd, &RT_offd, &RT_offd_perm);
+      RT_offd_i = hypre_CSRMatrixI(RT_offd);
+      RT_offd_j = hypre_CSRMatrixJ(RT_offd);
+
+      marker  = hypre_TAlloc(HYPRE_Int, num_cols_AP, HYPRE_MEMORY_HOST);
+      C_ext_i = hypre_CTAlloc(HYPRE_Int, num_cols_offd_R + 1, HYPRE_MEMORY_HOST);
+      for (pass = 0; pass < 2; pass++)
+      {
+         for (i = 0; i < num_cols_AP; i++)
+         {
+            marker[i] = -1;
+         }
+         cnt = 0;
+         for (i = 0; i < num_cols_offd_R; i++)
+         {
+            for (kk = RT_offd_i[i]; kk < RT_offd_i[i + 1]; kk++)
+            {
+               row = RT_offd_j[kk];
+               for (k = AP_diag_i[row]; k < AP_diag_i[row + 1]; k++)
+               {
+                  col = AP_diag_j[k];
+                  if (marker[col] != i)
+                  {
+                     marker[col] = i;
+                     if (pass)
+                     {
+                        C_ext_j[cnt] = col;
+                     }
+                     cnt++;
+                  }
+               }
+               for (k = AP_offd_i[row]; k < AP_offd_i[row + 1]; k++)
+               {
+                  col = num_cols_diag_P + AP_offd_j[k];
+                  if (marker[col] != i)
+                  {
+                     marker[col] = i;
+                     if (pass)
+                     {
+                        C_ext_j[cnt] = col;
+                     }
+                     cnt++;
+                  }
+               }
+            }
+            if (!pass)
+            {
+               C_ext_i[i + 1] = cnt;
+            }
+         }
+         if (!pass)
+         {
+            C_ext_j = hypre_TAlloc(HYPRE_Int, cnt, HYPRE_MEMORY_HOST);
+         }
+      }
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+      C_ext = hypre_CSRMatrixCreate(num_cols_offd_R, hypre_ParCSRMatrixGlobalNumCols(P), cnt);
+      hypre_CSRMatrixI(C_ext) = C_ext_i;
+      hypre_CSRMatrixJ(C_ext) = C_ext_j;
+      hypre_CSRMatrixInitialize_v2(C_ext, 1, HYPRE_MEMORY_HOST);
+      C_ext_big_j = hypre_CSRMatrixBigJ(C_ext);
+      for (k = 0; k < cnt; k++)
+      {
+         col = C_ext_j[k];
+         C_ext_big_j[k] = col < num_cols_diag_P ? first_col_diag_P + col :
+                          col_map_offd_AP[col - num_cols_diag_P];
+      }
+
+      hypre_ExchangeExternalRowsInit(C_ext, comm_pkg_R, &request);
+      C_int = hypre_ExchangeExternalRowsWait(request);
+
+      hypre_TFree(hypre_CSRMatrixBigJ(C_ext), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixBigJ(C_ext) = NULL;
+
+      C_int_i   = hypre_CSRMatrixI(C_int);
+      C_int_j   = hypre_CSRMatrixBigJ(C_int);
+      num_C_int = hypre_CSRMatrixNumNonzeros(C_int);
+
+      hypre_ParCSRTripleMatUnionColMap(num_cols_offd_AP, col_map_offd_AP, num_C_int, C_int_j,
+                                       first_col_diag_P, last_col_diag_P, &num_cols_offd_C,
+                                       &col_map_offd_C, &map_AP_to_C);
+
+      /* received entries in the local column numbering of C */
+      C_int_col = hypre_TAlloc(HYPRE_Int, num_C_int, HYPRE_MEMORY_HOST);
+      for (k = 0; k < num_C_int; k++)
+      {
+         if (C_int_j[k] < first_col_diag_P || C_int_j[k] > last_col_diag_P)
+         {
+            C_int_col[k] = num_cols_diag_P +
+                           hypre_BigBinarySearch(col_map_offd_C, C_int_j[k], num_cols_offd_C);
+         }
+         else
+         {
+            C_int_col[k] = (HYPRE_Int)(C_int_j[k] - first_col_diag_P);
+         }
+      }
+
+      /* received rows grouped by the local row of C they belong to */
+      num_sends     = hypre_ParCSRCommPkgNumSends(comm_pkg_R);
+      num_recvs     = hypre_ParCSRCommPkgNumRecvs(comm_pkg_R);
+      num_send_rows = hypre_ParCSRCommPkgSendMapStart(comm_pkg_R, num_sends);
+      int_rows_i = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R + 1, HYPRE_MEMORY_HOST);
+      int_rows   = hypre_TAlloc(HYPRE_Int, num_send_rows, HYPRE_MEMORY_HOST);
+      for (j = 0; j < num_send_rows; j++)
+      {
+         int_rows_i[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_R, j) + 1]++;
+      }
+      for (i = 0; i < num_cols_diag_R; i++)
+      {
+         int_rows_i[i + 1] += int_rows_i[i];
+      }
+      for (j = 0; j < num_send_rows; j++)
+      {
+         int_rows[int_rows_i[hypre_ParCSRCommPkgSendMapElmt(comm_pkg_R, j)]++] = j;
+      }
+      for (i = num_cols_diag_R; i > 0; i--)
+      {
+         int_rows_i[i] = int_rows_i[i - 1];
+      }
+      int_rows_i[0] = 0;
+
+      /* package that sends the values of C_ext to C_int */
+      C_ext_comm_pkg = hypre_CTAlloc(hypre_ParCSRCommPkg, 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgComm(C_ext_comm_pkg)     = comm;
+      hypre_ParCSRCommPkgNumSends(C_ext_comm_pkg) = num_recvs;
+      hypre_ParCSRCommPkgNumRecvs(C_ext_comm_pkg) = num_sends;
+      hypre_ParCSRCommPkgSendProcs(C_ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvProcs(C_ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgSendMapStarts(C_ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_recvs + 1, HYPRE_MEMORY_HOST);
+      hypre_ParCSRCommPkgRecvVecStarts(C_ext_comm_pkg) = hypre_TAlloc(HYPRE_Int, num_sends + 1, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgSendProcs(C_ext_comm_pkg), hypre_ParCSRCommPkgRecvProcs(comm_pkg_R),
+                    HYPRE_Int, num_recvs, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      hypre_TMemcpy(hypre_ParCSRCommPkgRecvProcs(C_ext_comm_pkg), hypre_ParCSRCommPkgSendProcs(comm_pkg_R),
+                    HYPRE_Int, num_sends, HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+      for (i = 0; i <= num_recvs; i++)
+      {
+         hypre_ParCSRCommPkgSendMapStart(C_ext_comm_pkg, i) =
+            C_ext_i[hypre_ParCSRCommPkgRecvVecStart(comm_pkg_R, i)];
+      }
+      for (i = 0; i <= num_sends; i++)
+      {
+         hypre_ParCSRCommPkgRecvVecStart(C_ext_comm_pkg, i) =
+            C_int_i[hypre_ParCSRCommPkgSendMapStart(comm_pkg_R, i)];
+      }
+   }
+   else if (num_cols_offd_AP)
+   {
+      num_cols_offd_C = num_cols_offd_AP;
+      col_map_offd_C  = hypre_TAlloc(HYPRE_BigInt, num_cols_offd_AP, HYPRE_MEMORY_HOST);
+      map_AP_to_C     = hypre_TAlloc(HYPRE_Int, num_cols_offd_AP, HYPRE_MEMORY_HOST);
+      for (i = 0; i < num_cols_offd_AP; i++)
+      {
+         col_map_offd_C[i] = col_map_offd_AP[i];
+         map_AP_to_C[i] = i;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    *  Structure of C = R_diag^T*A*P + C_int.  Columns in [0, num_cols_diag_P)
+    *  are diag columns, the others are offd columns shifted by
+    *  num_cols_diag_P.  The first pass counts, the second one fills and
+    *  records where the received entries go.
+    *-----------------------------------------------------------------------*/
+
+   num_cols_C = num_cols_diag_P + num_cols_offd_C;
+   allsquare  = (num_cols_diag_R == num_cols_diag_P);
+   marker     = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+   C_diag_i   = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R + 1, HYPRE_MEMORY_HOST);
+   C_offd_i   = hypre_CTAlloc(HYPRE_Int, num_cols_diag_R + 1, HYPRE_MEMORY_HOST);
+   if (num_C_int)
+   {
+      C_int_pos = hypre_TAlloc(HYPRE_Int, num_C_int, HYPRE_MEMORY_HOST);
+   }
+
+   for (pass = 0; pass < 2; pass++)
+   {
+      for (i = 0; i < num_cols_C; i++)
+      {
+         marker[i] = -1;
+      }
+      cnt_diag = cnt_offd = 0;
+
+      for (i = 0; i < num_cols_diag_R; i++)
+      {
+         HYPRE_Int row_start_diag = cnt_diag;
+         HYPRE_Int row_start_offd = cnt_offd;
+
+         if (allsquare)
+         {
+            marker[i] = cnt_diag;
+            if (pass)
+            {
+               C_diag_j[cnt_diag] = i;
+            }
+            cnt_diag++;
+         }
+         for (kk = RT_diag_i[i]; kk < RT_diag_i[i + 1]; kk++)
+         {
+            row = RT_diag_j[kk];
+            for (k = AP_diag_i[row]; k < AP_diag_i[row + 1]; k++)
+            {
+               col = AP_diag_j[k];
+               if (marker[col] < row_start_diag)
+               {
+                  marker[col] = cnt_diag;
+                  if (pass)
+                  {
+                     C_diag_j[cnt_diag] = col;
+                  }
+                  cnt_diag++;
+               }
+            }
+            for (k = AP_offd_i[row]; k < AP_offd_i[row + 1]; k++)
+            {
+               col = num_cols_diag_P + map_AP_to_C[AP_offd_j[k]];
+               if (marker[col] < row_start_offd)
+               {
+                  marker[col] = cnt_offd;
+                  if (pass)
+                  {
+                     C_offd_j[cnt_offd] = col - num_cols_diag_P;
+                  }
+                  cnt_offd++;
+               }
+            }
+         }
+         if (int_rows_i)
+         {
+            for (kk = int_rows_i[i]; kk < int_rows_i[i + 1]; kk++)
+            {
+               row = int_rows[kk];
+               for (k = C_int_i[row]; k < C_int_i[row + 1]; k++)
+               {
+                  col = C_int_col[k];
+                  if (col < num_cols_diag_P)
+                  {
+                     if (marker[col] < row_start_diag)
+                     {
+                        marker[col] = cnt_diag;
+                        if (pass)
+                        {
+                           C_diag_j[cnt_diag] = col;
+                        }
+                        cnt_diag++;
+                     }
+                     if (pass)
+                     {
+                        C_int_pos[k] = marker[col];
+                     }
+                  }
+                  else
+                  {
+                     if (marker[col] < row_start_offd)
+                     {
+                        marker[col] = cnt_offd;
+                        if (pass)
+                        {
+                           C_offd_j[cnt_offd] = col - num_cols_diag_P;
+                        }
+                        cnt_offd++;
+                     }
+                     if (pass)
+                     {
+                        C_int_pos[k] = nnz_diag + marker[col];
+                     }
+                  }
+               }
+            }
+         }
+
+         if (!pass)
+         {
+            C_diag_i[i + 1] = cnt_diag;
+            C_offd_i[i + 1] = cnt_offd;
+         }
+      }
+
+      if (!pass)
+      {
+         nnz_diag = cnt_diag;
+         nnz_offd = cnt_offd;
+         C_diag_j = hypre_TAlloc(HYPRE_Int, nnz_diag, HYPRE_MEMORY_HOST);
+         C_offd_j = hypre_TAlloc(HYPRE_Int, nnz_offd, HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   hypre_TFree(C_int_col, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_rows_i, HYPRE_MEMORY_HOST);
+   hypre_TFree(int_rows, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDestroy(C_int);
+
+   C = hypre_ParCSRMatrixCreate(comm, hypre_ParCSRMatrixGlobalNumCols(R),
+                                hypre_ParCSRMatrixGlobalNumCols(P),
+                                hypre_ParCSRMatrixColStarts(R),
+                                hypre_ParCSRMatrixColStarts(P),
+                                num_cols_offd_C, nnz_diag, nnz_offd);
+
+   /* Note that C does not own the partitionings */
+   hypre_ParCSRMatrixSetColStartsOwner(P, 0);
+   hypre_ParCSRMatrixSetColStartsOwner(R, 0);
+
+   C_diag = hypre_ParCSRMatrixDiag(C);
+   C_offd = hypre_ParCSRMatrixOffd(C);
+   hypre_CSRMatrixI(C_diag) = C_diag_i;
+   hypre_CSRMatrixJ(C_diag) = C_diag_j;
+   hypre_CSRMatrixData(C_diag) = hypre_CTAlloc(HYPRE_Complex, nnz_diag, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C_diag) = HYPRE_MEMORY_HOST;
+   hypre_CSRMatrixI(C_offd) = C_offd_i;
+   hypre_CSRMatrixJ(C_offd) = C_offd_j;
+   hypre_CSRMatrixData(C_offd) = hypre_CTAlloc(HYPRE_Complex, nnz_offd, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixMemoryLocation(C_offd) = HYPRE_MEMORY_HOST;
+   hypre_ParCSRMatrixColMapOffd(C) = col_map_offd_C;
+
+   if (num_procs > 1)
+   {
+      hypre_MatvecCommPkgCreate(C);
+   }
+
+   handle->AP_handle      = AP_handle;
+   handle->AP             = AP;
+   handle->map_AP_to_C    = map_AP_to_C;
+   handle->RT_diag        = RT_diag;
+   handle->RT_diag_perm   = RT_diag_perm;
+   handle->RT_offd        = RT_offd;
+   handle->RT_offd_perm   = RT_offd_perm;
+   handle->C_ext          = C_ext;
+   handle->C_ext_comm_pkg = C_ext_comm_pkg;
+   handle->num_C_int      = num_C_int;
+   handle->C_int_data     = hypre_TAlloc(HYPRE_Complex, num_C_int, HYPRE_MEMORY_HOST);
+   handle->C_int_pos      = C_int_pos;
+
+   *handle_ptr = handle;
+
+   return C;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRMatrixRAPKTNumeric : computes the values of C = R^T*A*P in
+ * place, for a C and a handle returned by
+ * hypre_ParCSRMatrixRAPKTSymbolic(R, A, P).  The values of R, A and P may
+ * have changed since then, their structures may not.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRMatrixRAPKTNumeric( hypre_ParCSRRAPHandle *handle,
+                                hypre_ParCSRMatrix    *R,
+                                hypre_ParCSRMatrix    *A,
+                                hypre_ParCSRMatrix    *P,
+                                hypre_ParCSRMatrix    *C )
+{
+   hypre_ParCSRMatrix *AP          = handle->AP;
+   hypre_CSRMatrix    *AP_diag     = hypre_ParCSRMatrixDiag(AP);
+   HYPRE_Int          *AP_diag_i   = hypre_CSRMatrixI(AP_diag);
+   HYPRE_Int          *AP_diag_j   = hypre_CSRMatrixJ(AP_diag);
+   HYPRE_Complex      *AP_diag_data = hypre_CSRMatrixData(AP_diag);
+   hypre_CSRMatrix    *AP_offd     = hypre_ParCSRMatrixOffd(AP);
+   HYPRE_Int          *AP_offd_i   = hypre_CSRMatrixI(AP_offd);
+   HYPRE_Int          *AP_offd_j   = hypre_CSRMatrixJ(AP_offd);
+   HYPRE_Complex      *AP_offd_data = hypre_CSRMatrixData(AP_offd);
+   HYPRE_Int           num_cols_diag_P = hypre_CSRMatrixNumCols(AP_diag);
+   HYPRE_Int           num_cols_AP = num_cols_diag_P + hypre_CSRMatrixNumCols(AP_offd);
+   HYPRE_Int          *map_AP_to_C = handle->map_AP_to_C;
+
+   hypre_CSRMatrix    *RT_diag      = handle->RT_diag;
+   HYPRE_Int          *RT_diag_i    = hypre_CSRMatrixI(RT_diag);
+   HYPRE_Int          *RT_diag_j    = hypre_CSRMatrixJ(RT_diag);
+   HYPRE_Complex      *RT_diag_data = hypre_CSRMatrixData(RT_diag);
+   HYPRE_Complex      *R_diag_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixDiag(R));
+
+   hypre_CSRMatrix    *C_diag      = hypre_ParCSRMatrixDiag(C);
+   HYPRE_Int          *C_diag_i    = hypre_CSRMatrixI(C_diag);
+   HYPRE_Int          *C_diag_j    = hypre_CSRMatrixJ(C_diag);
+   HYPRE_Complex      *C_diag_data = hypre_CSRMatrixData(C_diag);
+   hypre_CSRMatrix    *C_offd      = hypre_ParCSRMatrixOffd(C);
+   HYPRE_Int          *C_offd_i    = hypre_CSRMatrixI(C_offd);
+   HYPRE_Int          *C_offd_j    = hypre_CSRMatrixJ(C_offd);
+   HYPRE_Complex      *C_offd_data = hypre_CSRMatrixData(C_offd);
+   HYPRE_Int           num_rows_C  = hypre_CSRMatrixNumRows(C_diag);
+   HYPRE_Int           num_cols_C  = num_cols_diag_P + hypre_CSRMatrixNumCols(C_offd);
+   HYPRE_Int           nnz_diag    = C_diag_i[num_rows_C];
+
+   hypre_ParCSRCommHandle *comm_handle = NULL;
+   HYPRE_Int           i, k, pos;
+
+#if defined(HYPRE_USING_CUDA)
+   if (hypre_GetExecPolicy2( hypre_ParCSRMatrixMemoryLocation(R),
+                             hypre_ParCSRMatrixMemoryLocation(A) ) == HYPRE_EXEC_DEVICE)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Symbolic/numeric RAP is host only\n");
+      return hypre_error_flag;
+   }
+#endif
+
+   hypre_ParCSRMatMatNumeric(handle->AP_handle, A, P, AP);
+
+   for (k = 0; k < hypre_CSRMatrixNumNonzeros(RT_diag); k++)
+   {
+      RT_diag_data[k] = R_diag_data[handle->RT_diag_perm[k]];
+   }
+
+   /* values of C_ext = R_offd^T*A*P, sent to the owners of its rows */
+   if (handle->C_ext_comm_pkg)
+   {
+      hypre_CSRMatrix *RT_offd      = handle->RT_offd;
+      HYPRE_Int       *RT_offd_i    = hypre_CSRMatrixI(RT_offd);
+      HYPRE_Int       *RT_offd_j    = hypre_CSRMatrixJ(RT_offd);
+      HYPRE_Complex   *RT_offd_data = hypre_CSRMatrixData(RT_offd);
+      HYPRE_Complex   *R_offd_data  = hypre_CSRMatrixData(hypre_ParCSRMatrixOffd(R));
+      hypre_CSRMatrix *C_ext        = handle->C_ext;
+      HYPRE_Int       *C_ext_i      = hypre_CSRMatrixI(C_ext);
+      HYPRE_Int       *C_ext_j      = hypre_CSRMatrixJ(C_ext);
+      HYPRE_Complex   *C_ext_data   = hypre_CSRMatrixData(C_ext);
+      HYPRE_Int       *marker       = hypre_TAlloc(HYPRE_Int, num_cols_AP, HYPRE_MEMORY_HOST);
+      HYPRE_Int        kk, row;
+      HYPRE_Complex    r;
+
+      for (k = 0; k < hypre_CSRMatrixNumNonzeros(RT_offd); k++)
+      {
+         RT_offd_data[k] = R_offd_data[handle->RT_offd_perm[k]];
+      }
+
+      for (i = 0; i < hypre_CSRMatrixNumRows(C_ext); i++)
+      {
+         for (k = C_ext_i[i]; k < C_ext_i[i + 1]; k++)
+         {
+            marker[C_ext_j[k]] = k;
+            C_ext_data[k] = 0.0;
+         }
+         for (kk = RT_offd_i[i]; kk < RT_offd_i[i + 1]; kk++)
+         {
+            row = RT_offd_j[kk];
+            r = RT_offd_data[kk];
+            for (k = AP_diag_i[row]; k < AP_diag_i[row + 1]; k++)
+            {
+               C_ext_data[marker[AP_diag_j[k]]] += r * AP_diag_data[k];
+            }
+            for (k = AP_offd_i[row]; k < AP_offd_i[row + 1]; k++)
+            {
+               C_ext_data[marker[num_cols_diag_P + AP_offd_j[k]]] += r * AP_offd_data[k];
+            }
+         }
+      }
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+
+      comm_handle = hypre_ParCSRCommHandleCreate(1, handle->C_ext_comm_pkg, C_ext_data,
+                                                 handle->C_int_data);
+   }
+
+   /* C = R_diag^T*A*P, overlapped with the exchange */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel private(i, k)
+#endif
+   {
+      HYPRE_Int    *marker = hypre_TAlloc(HYPRE_Int, num_cols_C, HYPRE_MEMORY_HOST);
+      HYPRE_Int     kk, row;
+      HYPRE_Complex r;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp for HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows_C; i++)
+      {
+         for (k = C_diag_i[i]; k < C_diag_i[i + 1]; k++)
+         {
+            marker[C_diag_j[k]] = k;
+            C_diag_data[k] = 0.0;
+         }
+         for (k = C_offd_i[i]; k < C_offd_i[i + 1]; k++)
+         {
+            marker[num_cols_diag_P + C_offd_j[k]] = k;
+            C_offd_data[k] = 0.0;
+         }
+         for (kk = RT_diag_i[i]; kk < RT_diag_i[i + 1]; kk++)
+         {
+            row = RT_diag_j[kk];
+            r = RT_diag_data[kk];
+            for (k = AP_diag_i[row]; k < AP_diag_i[row + 1]; k++)
+            {
+               C_diag_data[marker[AP_diag_j[k]]] += r * AP_diag_data[k];
+            }
+            for (k = AP_offd_i[row]; k < AP_offd_i[row + 1]; k++)
+            {
+               C_offd_data[marker[num_cols_diag_P + map_AP_to_C[AP_offd_j[k]]]] +=
+                  r * AP_offd_data[k];
+            }
+         }
+      }
+
+      hypre_TFree(marker, HYPRE_MEMORY_HOST);
+   }
+
+   /* C += C_int */
+   if (comm_handle)
+   {
+      hypre_ParCSRCommHandleDestroy(comm_handle);
+
+      for (k = 0; k < handle->num_C_int; k++)
+      {
+         pos = handle->C_int_pos[k];
+         if (pos < nnz_diag)
+         {
+            C_diag_data[pos] += handle->C_int_data[k];
+         }
+         else
+         {
+            C_offd_data[pos - nnz_diag] += handle->C_int_data[k];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_ParCSRRAPHandleDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParCSRRAPHandleDestroy( hypre_ParCSRRAPHandle *handle )
+{
+   if (handle)
+   {
+      hypre_ParCSRMatMatHandleDestroy(handle->AP_handle);
+      hypre_ParCSRMatrixDestroy(handle->AP);
+      hypre_TFree(handle->map_AP_to_C, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(handle->RT_diag);
+      hypre_TFree(handle->RT_diag_perm, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(handle->RT_offd);
+      hypre_TFree(handle->RT_offd_perm, HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixDestroy(handle->C_ext);
+      if (handle->C_ext_comm_pkg)
+      {
+         hypre_MatvecCommPkgDestroy(handle->C_ext_comm_pkg);
+      }
+      hypre_TFree(handle->C_int_data, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle->C_int_pos, HYPRE_MEMORY_HOST);
+      hypre_TFree(handle, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * OLD NOTES:
  * Sketch of John's code to build RAP
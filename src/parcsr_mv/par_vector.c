@@ -500,6 +500,37 @@ hypre_ParVectorInnerProd( hypre_ParVector *x,
    return result;
 }
 
+/*--------------------------------------------------------------------------
+ * hypre_ParVectorInnerProdStart
+ *
+ * Starts the n inner products result[k] = <x[k],y[k]> as a single
+ * non-blocking reduction.  The local sums are left in local_result, which
+ * must stay valid until the request has completed (hypre_MPI_Wait).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_ParVectorInnerProdStart( HYPRE_Int           n,
+                               hypre_ParVector   **x,
+                               hypre_ParVector   **y,
+                               HYPRE_Real         *local_result,
+                               HYPRE_Real         *result,
+                               hypre_MPI_Request  *request )
+{
+   MPI_Comm   comm = hypre_ParVectorComm(x[0]);
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      local_result[k] = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x[k]),
+                                                 hypre_ParVectorLocalVector(y[k]));
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, comm, request);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  * hypre_ParVectorMassInnerProd
  *--------------------------------------------------------------------------*/
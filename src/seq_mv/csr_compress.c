@@ -0,0 +1,528 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Compressed column indices for hypre_CSRMatrix.
+ *
+ * A host matrix compressed with hypre_CSRMatrixCompressColumns stores, for
+ * each row i, the smallest column index col_base[i] and, for each nonzero,
+ * the distance of its column to that base as an 8-bit or 16-bit unsigned
+ * integer (col_delta, with col_delta_size bytes per entry).  The array `j' is
+ * released, so the matrix is read-only: only the matvecs and the relaxation
+ * kernels for reduced storage (hypre_BoomerAMGRelaxReducedStorage) decode it.
+ * The values may be HYPRE_Complex or single precision (csr_float.c).
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixCompressColumns
+ *
+ * Replaces the column indices of the host matrix A by per-row bases and the
+ * narrowest deltas that fit all rows.  Does nothing if A is already
+ * compressed, is empty, does not own its arrays, or has a row spanning more
+ * than 65536 columns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixCompressColumns( hypre_CSRMatrix *A )
+{
+   HYPRE_Int      *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j          = hypre_CSRMatrixJ(A);
+   HYPRE_Int       num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+
+   HYPRE_Int      *col_base;
+   unsigned char  *delta8  = NULL;
+   unsigned short *delta16 = NULL;
+   HYPRE_Int       max_span = 0;
+   HYPRE_Int       i, jj, base, span;
+
+   if (hypre_CSRMatrixColDelta(A) || !A_j || !num_nonzeros ||
+       !hypre_CSRMatrixOwnsData(A) || hypre_CSRMatrixBigJ(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Compressed columns are only available for host matrices\n");
+      return hypre_error_flag;
+   }
+
+   col_base = hypre_TAlloc(HYPRE_Int, num_rows, HYPRE_MEMORY_HOST);
+
+   for (i = 0; i < num_rows; i++)
+   {
+      base = 0;
+      span = 0;
+      if (A_i[i+1] > A_i[i])
+      {
+         base = A_j[A_i[i]];
+         span = A_j[A_i[i]];
+         for (jj = A_i[i] + 1; jj < A_i[i+1]; jj++)
+         {
+            base = hypre_min(base, A_j[jj]);
+            span = hypre_max(span, A_j[jj]);
+         }
+         span -= base;
+      }
+      col_base[i] = base;
+      max_span    = hypre_max(max_span, span);
+   }
+
+   if (max_span > 65535)
+   {
+      hypre_TFree(col_base, HYPRE_MEMORY_HOST);
+      return hypre_error_flag;
+   }
+
+   if (max_span > 255)
+   {
+      delta16 = hypre_TAlloc(unsigned short, num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+   else
+   {
+      delta8 = hypre_TAlloc(unsigned char, num_nonzeros, HYPRE_MEMORY_HOST);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         if (delta16)
+         {
+            delta16[jj] = (unsigned short) (A_j[jj] - col_base[i]);
+         }
+         else
+         {
+            delta8[jj] = (unsigned char) (A_j[jj] - col_base[i]);
+         }
+      }
+   }
+
+   /* the SELL shadow is built from `j' */
+   hypre_CSRMatrixClearSELL(A);
+
+   hypre_TFree(A_j, hypre_CSRMatrixMemoryLocation(A));
+   hypre_CSRMatrixJ(A)            = NULL;
+   hypre_CSRMatrixColBase(A)      = col_base;
+   hypre_CSRMatrixColDelta(A)     = delta16 ? (void *) delta16 : (void *) delta8;
+   hypre_CSRMatrixColDeltaSize(A) = delta16 ? 2 : 1;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixDecompressColumns
+ *
+ * Restores the array `j' of a matrix compressed with
+ * hypre_CSRMatrixCompressColumns.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixDecompressColumns( hypre_CSRMatrix *A )
+{
+   HYPRE_Int      *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int      *col_base     = hypre_CSRMatrixColBase(A);
+   unsigned char  *delta8       = NULL;
+   unsigned short *delta16      = NULL;
+   HYPRE_Int       num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Int      *A_j;
+   HYPRE_Int       i, jj;
+
+   if (!hypre_CSRMatrixColDelta(A))
+   {
+      return hypre_error_flag;
+   }
+
+   if (hypre_CSRMatrixColDeltaSize(A) == 2)
+   {
+      delta16 = (unsigned short *) hypre_CSRMatrixColDelta(A);
+   }
+   else
+   {
+      delta8 = (unsigned char *) hypre_CSRMatrixColDelta(A);
+   }
+
+   A_j = hypre_TAlloc(HYPRE_Int, num_nonzeros, hypre_CSRMatrixMemoryLocation(A));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+      {
+         A_j[jj] = col_base[i] + (delta16 ? (HYPRE_Int) delta16[jj] : (HYPRE_Int) delta8[jj]);
+      }
+   }
+
+   hypre_TFree(hypre_CSRMatrixColBase(A), HYPRE_MEMORY_HOST);
+   hypre_TFree(hypre_CSRMatrixColDelta(A), HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixColDeltaSize(A) = 0;
+   hypre_CSRMatrixJ(A)            = A_j;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixCompressedRowDot
+ *
+ * Returns sum_{jj in [jb,je)} a_jj * x[(base + delta_jj) * stride].
+ * Exactly one of data/data_float and one of delta8/delta16 is set.
+ *--------------------------------------------------------------------------*/
+
+static inline HYPRE_Complex
+hypre_CSRMatrixCompressedRowDot( HYPRE_Complex  *data,
+                                 float          *data_float,
+                                 unsigned char  *delta8,
+                                 unsigned short *delta16,
+                                 HYPRE_Int       jb,
+                                 HYPRE_Int       je,
+                                 HYPRE_Complex  *x,
+                                 HYPRE_Int       stride )
+{
+   HYPRE_Complex temp = 0.0;
+   HYPRE_Int     jj;
+
+   if (stride == 1)
+   {
+      if (data && delta8)
+      {
+         for (jj = jb; jj < je; jj++) { temp += data[jj] * x[delta8[jj]]; }
+      }
+      else if (data)
+      {
+         for (jj = jb; jj < je; jj++) { temp += data[jj] * x[delta16[jj]]; }
+      }
+      else if (delta8)
+      {
+         for (jj = jb; jj < je; jj++) { temp += data_float[jj] * x[delta8[jj]]; }
+      }
+      else
+      {
+         for (jj = jb; jj < je; jj++) { temp += data_float[jj] * x[delta16[jj]]; }
+      }
+   }
+   else
+   {
+      for (jj = jb; jj < je; jj++)
+      {
+         temp += (data ? data[jj] : (HYPRE_Complex) data_float[jj]) *
+                 x[(delta8 ? (HYPRE_Int) delta8[jj] : (HYPRE_Int) delta16[jj]) * stride];
+      }
+   }
+
+   return temp;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixCompressedRowAxpy
+ *
+ * y[(base + delta_jj) * stride] += a_jj * xi for jj in [jb,je).
+ *--------------------------------------------------------------------------*/
+
+static inline void
+hypre_CSRMatrixCompressedRowAxpy( HYPRE_Complex  *data,
+                                  float          *data_float,
+                                  unsigned char  *delta8,
+                                  unsigned short *delta16,
+                                  HYPRE_Int       jb,
+                                  HYPRE_Int       je,
+                                  HYPRE_Complex   xi,
+                                  HYPRE_Complex  *y,
+                                  HYPRE_Int       stride )
+{
+   HYPRE_Int jj;
+
+   if (stride == 1)
+   {
+      if (data && delta8)
+      {
+         for (jj = jb; jj < je; jj++) { y[delta8[jj]] += data[jj] * xi; }
+      }
+      else if (data)
+      {
+         for (jj = jb; jj < je; jj++) { y[delta16[jj]] += data[jj] * xi; }
+      }
+      else if (delta8)
+      {
+         for (jj = jb; jj < je; jj++) { y[delta8[jj]] += data_float[jj] * xi; }
+      }
+      else
+      {
+         for (jj = jb; jj < je; jj++) { y[delta16[jj]] += data_float[jj] * xi; }
+      }
+   }
+   else
+   {
+      for (jj = jb; jj < je; jj++)
+      {
+         y[(delta8 ? (HYPRE_Int) delta8[jj] : (HYPRE_Int) delta16[jj]) * stride] +=
+            (data ? data[jj] : (HYPRE_Complex) data_float[jj]) * xi;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecCompressed
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for a matrix
+ * with compressed column indices.  b and y have the same layout.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecCompressed( HYPRE_Complex    alpha,
+                                 hypre_CSRMatrix *A,
+                                 hypre_Vector    *x,
+                                 HYPRE_Complex    beta,
+                                 hypre_Vector    *b,
+                                 hypre_Vector    *y,
+                                 HYPRE_Int        offset )
+{
+   HYPRE_Complex    *A_data      = hypre_CSRMatrixData(A);
+   float            *A_data_f    = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *col_base    = hypre_CSRMatrixColBase(A) + offset;
+   unsigned char    *delta8      = NULL;
+   unsigned short   *delta16     = NULL;
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex     temp;
+   HYPRE_Int         i, k, iy, ierr = 0;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (hypre_CSRMatrixColDeltaSize(A) == 2)
+   {
+      delta16 = (unsigned short *) hypre_CSRMatrixColDelta(A);
+   }
+   else
+   {
+      delta8 = (unsigned char *) hypre_CSRMatrixColDelta(A);
+   }
+
+   if (num_cols != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_rows != hypre_VectorSize(y) - offset)
+   {
+      ierr += 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k,iy,temp) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_rows; i++)
+   {
+      for (k = 0; k < num_vectors; k++)
+      {
+         temp = hypre_CSRMatrixCompressedRowDot(A_data, A_data_f, delta8, delta16,
+                                                A_i[i], A_i[i+1],
+                                                x_data + k*vecstride_x + col_base[i]*idxstride_x,
+                                                idxstride_x);
+         iy = k*vecstride_y + i*idxstride_y;
+         y_data[iy] = (beta == 0.0) ? alpha*temp : alpha*temp + beta*b_data[iy];
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTCompressed
+ *
+ * y = alpha*A^T*x + beta*y for a matrix with compressed column indices.
+ * With several threads, each thread accumulates into its own copy of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTCompressed( HYPRE_Complex    alpha,
+                                  hypre_CSRMatrix *A,
+                                  hypre_Vector    *x,
+                                  HYPRE_Complex    beta,
+                                  hypre_Vector    *y )
+{
+   HYPRE_Complex    *A_data      = hypre_CSRMatrixData(A);
+   float            *A_data_f    = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *col_base    = hypre_CSRMatrixColBase(A);
+   unsigned char    *delta8      = NULL;
+   unsigned short   *delta16     = NULL;
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         y_len       = num_cols*num_vectors;
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex    *y_expand, *y_thread;
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Int         i, k, t, ns, ne, size, rest, ierr = 0;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (hypre_CSRMatrixColDeltaSize(A) == 2)
+   {
+      delta16 = (unsigned short *) hypre_CSRMatrixColDelta(A);
+   }
+   else
+   {
+      delta8 = (unsigned char *) hypre_CSRMatrixColDelta(A);
+   }
+
+   if (num_rows != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_cols != hypre_VectorSize(y))
+   {
+      ierr += 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (alpha == 0.0)
+   {
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] *= beta;
+      }
+      if (x_tmp)
+      {
+         hypre_SeqVectorDestroy(x_tmp);
+      }
+      return ierr;
+   }
+
+   /* y = (beta/alpha)*y; A^T*x is added and the sum is scaled by alpha */
+   if (beta != alpha)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : y_data[i] * (beta / alpha);
+      }
+   }
+
+   if (num_threads == 1)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            hypre_CSRMatrixCompressedRowAxpy(A_data, A_data_f, delta8, delta16,
+                                             A_i[i], A_i[i+1],
+                                             x_data[k*vecstride_x + i*idxstride_x],
+                                             y_data + k*vecstride_y + col_base[i]*idxstride_y,
+                                             idxstride_y);
+         }
+      }
+   }
+   else
+   {
+      y_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_len, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t,i,k,ns,ne,size,rest,y_thread) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         size = num_rows/num_threads;
+         rest = num_rows - size*num_threads;
+         ns = t*size + hypre_min(t, rest);
+         ne = ns + size + (t < rest);
+         y_thread = y_expand + t*y_len;
+
+         for (i = ns; i < ne; i++)
+         {
+            for (k = 0; k < num_vectors; k++)
+            {
+               hypre_CSRMatrixCompressedRowAxpy(A_data, A_data_f, delta8, delta16,
+                                                A_i[i], A_i[i+1],
+                                                x_data[k*vecstride_x + i*idxstride_x],
+                                                y_thread + k*vecstride_y + col_base[i]*idxstride_y,
+                                                idxstride_y);
+            }
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            y_data[i] += y_expand[t*y_len + i];
+         }
+      }
+
+      hypre_TFree(y_expand, HYPRE_MEMORY_HOST);
+   }
+
+   if (alpha != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] *= alpha;
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
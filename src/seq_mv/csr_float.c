@@ -0,0 +1,353 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Single-precision value storage for hypre_CSRMatrix.
+ *
+ * A host matrix converted with hypre_CSRMatrixConvertToFloat keeps its values
+ * in `data_float' and has no HYPRE_Complex values.  The sparsity pattern is
+ * unchanged.  The matvecs read the float values and accumulate in
+ * HYPRE_Complex, so vectors keep the working precision.
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertToFloat
+ *
+ * Replaces the values of the host matrix A by single-precision copies.  Does
+ * nothing if A is already converted, has no values, or does not own them.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertToFloat( hypre_CSRMatrix *A )
+{
+   HYPRE_Complex  *data         = hypre_CSRMatrixData(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   float          *data_float;
+   HYPRE_Int       i;
+
+   if (hypre_CSRMatrixDataFloat(A) || !data || !hypre_CSRMatrixOwnsData(A))
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_COMPLEX)
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Float storage is not available for complex values\n");
+   return hypre_error_flag;
+#endif
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Float storage is only available for host matrices\n");
+      return hypre_error_flag;
+   }
+
+   data_float = hypre_TAlloc(float, num_nonzeros, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data_float[i] = (float) hypre_creal(data[i]);
+   }
+
+   /* the SELL shadow refers to the old values */
+   hypre_CSRMatrixClearSELL(A);
+
+   hypre_TFree(data, hypre_CSRMatrixMemoryLocation(A));
+   hypre_CSRMatrixData(A)      = NULL;
+   hypre_CSRMatrixDataFloat(A) = data_float;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixConvertFromFloat
+ *
+ * Restores HYPRE_Complex values from the single-precision ones.  The values
+ * keep the rounding of the float storage.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixConvertFromFloat( hypre_CSRMatrix *A )
+{
+   float          *data_float   = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+   HYPRE_Complex  *data;
+   HYPRE_Int       i;
+
+   if (!data_float)
+   {
+      return hypre_error_flag;
+   }
+
+   data = hypre_TAlloc(HYPRE_Complex, num_nonzeros, hypre_CSRMatrixMemoryLocation(A));
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+   for (i = 0; i < num_nonzeros; i++)
+   {
+      data[i] = (HYPRE_Complex) data_float[i];
+   }
+
+   hypre_TFree(data_float, HYPRE_MEMORY_HOST);
+   hypre_CSRMatrixDataFloat(A) = NULL;
+   hypre_CSRMatrixData(A)      = data;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecFloat
+ *
+ * y[offset:end] = alpha*A[offset:end,:]*x + beta*b[offset:end] for a matrix
+ * with single-precision values.  b and y have the same layout.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecFloat( HYPRE_Complex    alpha,
+                            hypre_CSRMatrix *A,
+                            hypre_Vector    *x,
+                            HYPRE_Complex    beta,
+                            hypre_Vector    *b,
+                            hypre_Vector    *y,
+                            HYPRE_Int        offset )
+{
+   float            *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A) + offset;
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A) - offset;
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *b_data      = hypre_VectorData(b) + offset;
+   HYPRE_Complex    *y_data      = hypre_VectorData(y) + offset;
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex     temp;
+   HYPRE_Int         i, k, jj, iy, ierr = 0;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (num_cols != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_rows != hypre_VectorSize(y) - offset)
+   {
+      ierr += 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (num_vectors == 1)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,jj,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         temp = 0.0;
+         for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+         {
+            temp += A_data[jj] * x_data[A_j[jj]];
+         }
+         y_data[i] = (beta == 0.0) ? alpha*temp : alpha*temp + beta*b_data[i];
+      }
+   }
+   else
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,k,jj,iy,temp) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            temp = 0.0;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               temp += A_data[jj] * x_data[k*vecstride_x + A_j[jj]*idxstride_x];
+            }
+            iy = k*vecstride_y + i*idxstride_y;
+            y_data[iy] = (beta == 0.0) ? alpha*temp : alpha*temp + beta*b_data[iy];
+         }
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixMatvecTFloat
+ *
+ * y = alpha*A^T*x + beta*y for a matrix with single-precision values.  With
+ * several threads, each thread accumulates into its own copy of y.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixMatvecTFloat( HYPRE_Complex    alpha,
+                             hypre_CSRMatrix *A,
+                             hypre_Vector    *x,
+                             HYPRE_Complex    beta,
+                             hypre_Vector    *y )
+{
+   float            *A_data      = hypre_CSRMatrixDataFloat(A);
+   HYPRE_Int        *A_i         = hypre_CSRMatrixI(A);
+   HYPRE_Int        *A_j         = hypre_CSRMatrixJ(A);
+   HYPRE_Int         num_rows    = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int         num_cols    = hypre_CSRMatrixNumCols(A);
+
+   HYPRE_Complex    *x_data      = hypre_VectorData(x);
+   HYPRE_Complex    *y_data      = hypre_VectorData(y);
+   HYPRE_Int         num_vectors = hypre_VectorNumVectors(x);
+   HYPRE_Int         idxstride_x = hypre_VectorIndexStride(x);
+   HYPRE_Int         vecstride_x = hypre_VectorVectorStride(x);
+   HYPRE_Int         idxstride_y = hypre_VectorIndexStride(y);
+   HYPRE_Int         vecstride_y = hypre_VectorVectorStride(y);
+   HYPRE_Int         y_len       = num_cols*num_vectors;
+
+   hypre_Vector     *x_tmp = NULL;
+   HYPRE_Complex    *y_expand, *y_thread;
+   HYPRE_Int         num_threads = hypre_NumThreads();
+   HYPRE_Int         i, k, t, jj, ns, ne, size, rest, ierr = 0;
+
+   hypre_assert( num_vectors == hypre_VectorNumVectors(y) );
+
+   if (num_rows != hypre_VectorSize(x))
+   {
+      ierr = 1;
+   }
+   if (num_cols != hypre_VectorSize(y))
+   {
+      ierr += 2;
+   }
+
+   if (x == y)
+   {
+      x_tmp  = hypre_SeqVectorCloneDeep(x);
+      x_data = hypre_VectorData(x_tmp);
+   }
+
+   if (alpha == 0.0)
+   {
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] *= beta;
+      }
+      if (x_tmp)
+      {
+         hypre_SeqVectorDestroy(x_tmp);
+      }
+      return ierr;
+   }
+
+   /* y = (beta/alpha)*y; A^T*x is added and the sum is scaled by alpha */
+   if (beta != alpha)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] = (beta == 0.0) ? 0.0 : y_data[i] * (beta / alpha);
+      }
+   }
+
+   if (num_threads == 1)
+   {
+      for (i = 0; i < num_rows; i++)
+      {
+         for (k = 0; k < num_vectors; k++)
+         {
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               y_data[k*vecstride_y + A_j[jj]*idxstride_y] +=
+                  A_data[jj] * x_data[k*vecstride_x + i*idxstride_x];
+            }
+         }
+      }
+   }
+   else
+   {
+      y_expand = hypre_CTAlloc(HYPRE_Complex, num_threads*y_len, HYPRE_MEMORY_HOST);
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(t,i,k,jj,ns,ne,size,rest,y_thread) HYPRE_SMP_SCHEDULE
+#endif
+      for (t = 0; t < num_threads; t++)
+      {
+         size = num_rows/num_threads;
+         rest = num_rows - size*num_threads;
+         ns = t*size + hypre_min(t, rest);
+         ne = ns + size + (t < rest);
+         y_thread = y_expand + t*y_len;
+
+         for (i = ns; i < ne; i++)
+         {
+            for (k = 0; k < num_vectors; k++)
+            {
+               for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+               {
+                  y_thread[k*vecstride_y + A_j[jj]*idxstride_y] +=
+                     A_data[jj] * x_data[k*vecstride_x + i*idxstride_x];
+               }
+            }
+         }
+      }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,t) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         for (t = 0; t < num_threads; t++)
+         {
+            y_data[i] += y_expand[t*y_len + i];
+         }
+      }
+
+      hypre_TFree(y_expand, HYPRE_MEMORY_HOST);
+   }
+
+   if (alpha != 1.0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < y_len; i++)
+      {
+         y_data[i] *= alpha;
+      }
+   }
+
+   if (x_tmp)
+   {
+      hypre_SeqVectorDestroy(x_tmp);
+   }
+
+   return ierr;
+}
@@ -35,6 +35,11 @@ hypre_CSRMatrixCreate( HYPRE_Int num_rows,
    hypre_CSRMatrixJ(matrix)              = NULL;
    hypre_CSRMatrixBigJ(matrix)           = NULL;
    hypre_CSRMatrixRownnz(matrix)         = NULL;
+   hypre_CSRMatrixSELL(matrix)           = NULL;
+   hypre_CSRMatrixDataFloat(matrix)      = NULL;
+   hypre_CSRMatrixColBase(matrix)        = NULL;
+   hypre_CSRMatrixColDelta(matrix)       = NULL;
+   hypre_CSRMatrixColDeltaSize(matrix)   = 0;
    hypre_CSRMatrixNumRows(matrix)        = num_rows;
    hypre_CSRMatrixNumCols(matrix)        = num_cols;
    hypre_CSRMatrixNumNonzeros(matrix)    = num_nonzeros;
@@ -62,12 +67,16 @@ hypre_CSRMatrixDestroy( hypre_CSRMatrix *matrix )
 
       hypre_TFree(hypre_CSRMatrixI(matrix),      memory_location);
       hypre_TFree(hypre_CSRMatrixRownnz(matrix), HYPRE_MEMORY_HOST);
+      hypre_CSRMatrixClearSELL(matrix);
 
       if ( hypre_CSRMatrixOwnsData(matrix) )
       {
          hypre_TFree(hypre_CSRMatrixData(matrix), memory_location);
+         hypre_TFree(hypre_CSRMatrixDataFloat(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(hypre_CSRMatrixJ(matrix),    memory_location);
          hypre_TFree(hypre_CSRMatrixBigJ(matrix), memory_location);
+         hypre_TFree(hypre_CSRMatrixColBase(matrix), HYPRE_MEMORY_HOST);
+         hypre_TFree(hypre_CSRMatrixColDelta(matrix), HYPRE_MEMORY_HOST);
       }
 
       hypre_TFree(matrix, HYPRE_MEMORY_HOST);
@@ -91,12 +100,18 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_
 
    hypre_CSRMatrixMemoryLocation(matrix) = memory_location;
 
+   /* The structure and values are about to be (re)set */
+   hypre_CSRMatrixClearSELL(matrix);
+
    /* Caveat: for pre-existing i, j, data, their memory location must be guaranteed to be consistent with `memory_location'
     * Otherwise, mismatches will exist and problems will be encountered when being used, and freed */
 
+   /* With OpenMP, the arrays are first touched by the threads in blocks of nonzeros (or
+    * rows for I), which matches the load-balanced row partition of the threaded kernels */
+
    if ( !hypre_CSRMatrixData(matrix) && num_nonzeros )
    {
-      hypre_CSRMatrixData(matrix) = hypre_CTAlloc(HYPRE_Complex, num_nonzeros, memory_location);
+      hypre_CSRMatrixData(matrix) = hypre_CTAllocFirstTouch(HYPRE_Complex, num_nonzeros, memory_location);
    }
    /*
    else
@@ -107,7 +122,7 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_
 
    if ( !hypre_CSRMatrixI(matrix) )
    {
-      hypre_CSRMatrixI(matrix) = hypre_CTAlloc(HYPRE_Int, num_rows + 1, memory_location);
+      hypre_CSRMatrixI(matrix) = hypre_CTAllocFirstTouch(HYPRE_Int, num_rows + 1, memory_location);
    }
 
    /*
@@ -121,14 +136,14 @@ hypre_CSRMatrixInitialize_v2( hypre_CSRMatrix *matrix, HYPRE_Int bigInit, HYPRE_
    {
       if ( !hypre_CSRMatrixBigJ(matrix) && num_nonzeros )
       {
-         hypre_CSRMatrixBigJ(matrix) = hypre_CTAlloc(HYPRE_BigInt, num_nonzeros, memory_location);
+         hypre_CSRMatrixBigJ(matrix) = hypre_CTAllocFirstTouch(HYPRE_BigInt, num_nonzeros, memory_location);
       }
    }
    else
    {
       if ( !hypre_CSRMatrixJ(matrix) && num_nonzeros )
       {
-         hypre_CSRMatrixJ(matrix) = hypre_CTAlloc(HYPRE_Int, num_nonzeros, memory_location);
+         hypre_CSRMatrixJ(matrix) = hypre_CTAllocFirstTouch(HYPRE_Int, num_nonzeros, memory_location);
       }
    }
 
@@ -180,6 +195,7 @@ hypre_CSRMatrixBigJtoJ( hypre_CSRMatrix *matrix )
       {
          matrix_j[i] = (HYPRE_Int) matrix_big_j[i];
       }
+      hypre_CSRMatrixClearSELL(matrix);
       hypre_CSRMatrixJ(matrix) = matrix_j;
       hypre_TFree(matrix_big_j, hypre_CSRMatrixMemoryLocation(matrix));
       hypre_CSRMatrixBigJ(matrix) = NULL;
@@ -209,6 +225,7 @@ hypre_CSRMatrixJtoBigJ( hypre_CSRMatrix *matrix )
       {
          matrix_big_j[i] = (HYPRE_BigInt) matrix_j[i];
       }
+      hypre_CSRMatrixClearSELL(matrix);
       hypre_CSRMatrixBigJ(matrix) = matrix_big_j;
       hypre_TFree(matrix_j, hypre_CSRMatrixMemoryLocation(matrix));
       hypre_CSRMatrixJ(matrix) = NULL;
@@ -630,6 +647,9 @@ hypre_CSRMatrixCopy( hypre_CSRMatrix *A, hypre_CSRMatrix *B, HYPRE_Int copy_data
    HYPRE_MemoryLocation memory_location_A = hypre_CSRMatrixMemoryLocation(A);
    HYPRE_MemoryLocation memory_location_B = hypre_CSRMatrixMemoryLocation(B);
 
+   /* the pattern and values of B change in place */
+   hypre_CSRMatrixClearSELL(B);
+
    hypre_TMemcpy(B_i, A_i, HYPRE_Int, num_rows + 1, memory_location_B, memory_location_A);
 
    if (A_j && B_j)
@@ -16,6 +16,47 @@
 #ifndef hypre_CSR_MATRIX_HEADER
 #define hypre_CSR_MATRIX_HEADER
 
+/*--------------------------------------------------------------------------
+ * SELL-C-sigma (sliced ELLPACK) shadow of a CSR Matrix
+ *
+ * Built lazily from a host CSR matrix and used by the host matvec.  The rows
+ * that have nonzeros are sorted by length inside windows of `sigma' rows and
+ * grouped into chunks of HYPRE_SELL_CHUNK_SIZE rows.  Every chunk is stored
+ * column-major and padded to its longest row, so that the innermost loop runs
+ * with unit stride across the rows of a chunk.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_SELL_CHUNK_SIZE 8
+#define HYPRE_SELL_SIGMA      256
+
+typedef struct
+{
+   HYPRE_Int      num_rows;
+   HYPRE_Int      num_sell_rows;  /* rows with nonzeros, the only ones stored */
+   HYPRE_Int      num_chunks;
+   HYPRE_Int      sigma;
+   HYPRE_Int     *chunk_ptr;      /* offsets of the chunks in j and data */
+   HYPRE_Int     *perm;           /* CSR row of each chunk slot, -1 for padding */
+   hypre_int     *j;
+   HYPRE_Complex *data;
+
+   /* CSR arrays the shadow was built from, used to detect stale shadows */
+   HYPRE_Int     *csr_i;
+   HYPRE_Int     *csr_j;
+   HYPRE_Complex *csr_data;
+   HYPRE_Int      csr_num_nonzeros;
+
+} hypre_SELLMatrix;
+
+#define hypre_SELLMatrixNumRows(matrix)       ((matrix) -> num_rows)
+#define hypre_SELLMatrixNumSellRows(matrix)   ((matrix) -> num_sell_rows)
+#define hypre_SELLMatrixNumChunks(matrix)     ((matrix) -> num_chunks)
+#define hypre_SELLMatrixSigma(matrix)         ((matrix) -> sigma)
+#define hypre_SELLMatrixChunkPtr(matrix)      ((matrix) -> chunk_ptr)
+#define hypre_SELLMatrixPerm(matrix)          ((matrix) -> perm)
+#define hypre_SELLMatrixJ(matrix)             ((matrix) -> j)
+#define hypre_SELLMatrixData(matrix)          ((matrix) -> data)
+
 /*--------------------------------------------------------------------------
  * CSR Matrix
  *--------------------------------------------------------------------------*/
@@ -43,6 +84,20 @@ typedef struct
    /* memory location of arrays i, j, data */
    HYPRE_MemoryLocation      memory_location;
 
+   /* SELL-C-sigma shadow for the host matvec (built on demand) */
+   hypre_SELLMatrix         *sell;
+
+   /* single-precision values; when set, `data' is NULL and the host matvecs
+      use these instead (see csr_float.c) */
+   float                    *data_float;
+
+   /* compressed column indices; when set, `j' is NULL and column jj of row i
+      is col_base[i] + col_delta[jj], with col_delta_size (1 or 2) bytes per
+      entry (see csr_compress.c) */
+   HYPRE_Int                *col_base;
+   void                     *col_delta;
+   HYPRE_Int                 col_delta_size;
+
 } hypre_CSRMatrix;
 
 /*--------------------------------------------------------------------------
@@ -60,6 +115,11 @@ typedef struct
 #define hypre_CSRMatrixNumRownnz(matrix)      ((matrix) -> num_rownnz)
 #define hypre_CSRMatrixOwnsData(matrix)       ((matrix) -> owns_data)
 #define hypre_CSRMatrixMemoryLocation(matrix) ((matrix) -> memory_location)
+#define hypre_CSRMatrixSELL(matrix)           ((matrix) -> sell)
+#define hypre_CSRMatrixDataFloat(matrix)      ((matrix) -> data_float)
+#define hypre_CSRMatrixColBase(matrix)        ((matrix) -> col_base)
+#define hypre_CSRMatrixColDelta(matrix)       ((matrix) -> col_delta)
+#define hypre_CSRMatrixColDeltaSize(matrix)   ((matrix) -> col_delta_size)
 
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionBegin( hypre_CSRMatrix *A );
 HYPRE_Int hypre_CSRMatrixGetLoadBalancedPartitionEnd( hypre_CSRMatrix *A );
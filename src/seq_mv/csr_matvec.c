@@ -110,6 +110,53 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
       return ierr;
    }
 
+   /*-----------------------------------------------------------------------
+    * A with compressed column indices or single-precision values
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_CSRMatrixColDelta(A))
+   {
+      ierr = hypre_CSRMatrixMatvecCompressed(alpha, A, x, beta, b, y, offset);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+      return ierr;
+   }
+
+   if (hypre_CSRMatrixDataFloat(A))
+   {
+      ierr = hypre_CSRMatrixMatvecFloat(alpha, A, x, beta, b, y, offset);
+
+#ifdef HYPRE_PROFILE
+      hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+      return ierr;
+   }
+
+   /*-----------------------------------------------------------------------
+    * Use the SELL-C-sigma shadow of A if requested
+    *-----------------------------------------------------------------------*/
+
+   if ( hypre_HandleSpMVUseSELL(hypre_handle()) &&
+        offset == 0 && num_vectors == 1 && x != y )
+   {
+      hypre_SELLMatrix *A_sell = hypre_CSRMatrixGetSELL(A);
+
+      if (A_sell)
+      {
+         hypre_SELLMatrixMatvec(alpha, A_sell, x_data, beta, b_data, y_data);
+
+#ifdef HYPRE_PROFILE
+         hypre_profile_times[HYPRE_TIMER_ID_MATVEC] += hypre_MPI_Wtime() - time_begin;
+#endif
+
+         return ierr;
+      }
+   }
+
    if (x == y)
    {
       x_tmp = hypre_SeqVectorCloneDeep(x);
@@ -183,6 +230,19 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
                   tempx +=  A_data[jj] * x_data[A_j[jj]];
                y_data[m] += tempx;
             }
+            else if (idxstride_x == num_vectors && idxstride_y == num_vectors &&
+                     vecstride_x == 1 && vecstride_y == 1)
+            {
+               /* interleaved multivectors (SpMM) */
+               for (jj = A_i[m]; jj < A_i[m+1]; jj++)
+               {
+                  tempx = A_data[jj];
+                  for (j = 0; j < num_vectors; ++j)
+                  {
+                     y_data[m*num_vectors + j] += tempx * x_data[A_j[jj]*num_vectors + j];
+                  }
+               }
+            }
             else
                for ( j=0; j<num_vectors; ++j )
                {
@@ -193,6 +253,29 @@ hypre_CSRMatrixMatvecOutOfPlace( HYPRE_Complex    alpha,
                }
          }
       }
+      else if (idxstride_x == num_vectors && idxstride_y == num_vectors &&
+               vecstride_x == 1 && vecstride_y == 1)
+      {
+         /* interleaved multivectors: traverse each row once and update all
+            vectors per nonzero (SpMM) */
+         HYPRE_Complex *x_row, *y_row;
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i,j,jj,tempx,x_row,y_row) HYPRE_SMP_SCHEDULE
+#endif
+         for (i = 0; i < num_rows; i++)
+         {
+            y_row = y_data + i*num_vectors;
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               tempx = A_data[jj];
+               x_row = x_data + A_j[jj]*num_vectors;
+               for (j = 0; j < num_vectors; ++j)
+               {
+                  y_row[j] += tempx * x_row[j];
+               }
+            }
+         }
+      }
       else // num_vectors > 1
       {
 #ifdef HYPRE_USING_OPENMP
@@ -506,6 +589,16 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
       return ierr;
    }
 
+   if (hypre_CSRMatrixColDelta(A))
+   {
+      return hypre_CSRMatrixMatvecTCompressed(alpha, A, x, beta, y);
+   }
+
+   if (hypre_CSRMatrixDataFloat(A))
+   {
+      return hypre_CSRMatrixMatvecTFloat(alpha, A, x, beta, y);
+   }
+
    if (x == y)
    {
       x_tmp = hypre_SeqVectorCloneDeep(x);
@@ -614,6 +707,19 @@ hypre_CSRMatrixMatvecT( HYPRE_Complex    alpha,
                y_data[j] += A_data[jj] * x_data[i];
             }
          }
+         else if (idxstride_x == num_vectors && idxstride_y == num_vectors &&
+                  vecstride_x == 1 && vecstride_y == 1)
+         {
+            /* interleaved multivectors (SpMM) */
+            for (jj = A_i[i]; jj < A_i[i+1]; jj++)
+            {
+               j = A_j[jj]*num_vectors;
+               for ( jv=0; jv<num_vectors; ++jv )
+               {
+                  y_data[j + jv] += A_data[jj] * x_data[i*num_vectors + jv];
+               }
+            }
+         }
          else
          {
             for ( jv=0; jv<num_vectors; ++jv )
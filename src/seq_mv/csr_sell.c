@@ -0,0 +1,315 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * SELL-C-sigma (sliced ELLPACK) shadow format of hypre_CSRMatrix, used by the
+ * host matvec.
+ *
+ * The chunk height C = HYPRE_SELL_CHUNK_SIZE is a compile-time constant, so
+ * the innermost loops below have a fixed trip count and unit stride, and are
+ * vectorized by the compiler (one AVX-512 or two AVX2 registers of doubles).
+ *
+ *****************************************************************************/
+
+#include "seq_mv.h"
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixCreateFromCSR
+ *
+ * Builds the SELL-C-sigma shadow of the host CSR matrix A.  Only rows with
+ * nonzeros are stored.  Returns NULL if A cannot be represented, i.e., if A
+ * has no nonzeros or its column indices do not fit in 32 bits.
+ *--------------------------------------------------------------------------*/
+
+hypre_SELLMatrix *
+hypre_SELLMatrixCreateFromCSR( hypre_CSRMatrix *A,
+                               HYPRE_Int        sigma )
+{
+   HYPRE_Int      *A_i          = hypre_CSRMatrixI(A);
+   HYPRE_Int      *A_j          = hypre_CSRMatrixJ(A);
+   HYPRE_Complex  *A_data       = hypre_CSRMatrixData(A);
+   HYPRE_Int       num_rows     = hypre_CSRMatrixNumRows(A);
+   HYPRE_Int       num_cols     = hypre_CSRMatrixNumCols(A);
+   HYPRE_Int       num_nonzeros = hypre_CSRMatrixNumNonzeros(A);
+
+   hypre_SELLMatrix *S;
+   HYPRE_Int        *chunk_ptr, *perm, *rows, *neg_len;
+   hypre_int        *S_j;
+   HYPRE_Complex    *S_data;
+   HYPRE_Int         num_sell_rows, num_chunks, chunk_width;
+   HYPRE_Int         i, c, r, k, w, row, len, pos;
+
+   const HYPRE_Int   C = HYPRE_SELL_CHUNK_SIZE;
+
+   if (!A_i || !A_j || !A_data || num_nonzeros <= 0 ||
+       (HYPRE_Int) ((hypre_int) num_cols) != num_cols)
+   {
+      return NULL;
+   }
+
+   /* sigma is rounded up to a multiple of C so that no chunk spans two windows */
+   sigma = hypre_max(sigma, C);
+   sigma = ((sigma + C - 1) / C) * C;
+
+   /* list the nonempty rows */
+   num_sell_rows = 0;
+   for (i = 0; i < num_rows; i++)
+   {
+      if (A_i[i+1] > A_i[i])
+      {
+         num_sell_rows++;
+      }
+   }
+
+   rows    = hypre_TAlloc(HYPRE_Int, num_sell_rows, HYPRE_MEMORY_HOST);
+   neg_len = hypre_TAlloc(HYPRE_Int, num_sell_rows, HYPRE_MEMORY_HOST);
+   for (i = 0, k = 0; i < num_rows; i++)
+   {
+      if (A_i[i+1] > A_i[i])
+      {
+         rows[k]    = i;
+         neg_len[k] = A_i[i] - A_i[i+1];
+         k++;
+      }
+   }
+
+   /* sort by decreasing row length inside each window of sigma rows */
+   for (w = 0; w < num_sell_rows; w += sigma)
+   {
+      hypre_qsort2i(neg_len, rows, w, hypre_min(w + sigma, num_sell_rows) - 1);
+   }
+
+   num_chunks = (num_sell_rows + C - 1) / C;
+   chunk_ptr  = hypre_TAlloc(HYPRE_Int, num_chunks + 1, HYPRE_MEMORY_HOST);
+   perm       = hypre_TAlloc(HYPRE_Int, num_chunks * C, HYPRE_MEMORY_HOST);
+
+   chunk_ptr[0] = 0;
+   for (c = 0; c < num_chunks; c++)
+   {
+      chunk_width = 0;
+      for (r = 0; r < C; r++)
+      {
+         k = c * C + r;
+         if (k < num_sell_rows)
+         {
+            perm[k] = rows[k];
+            chunk_width = hypre_max(chunk_width, -neg_len[k]);
+         }
+         else
+         {
+            perm[k] = -1;
+         }
+      }
+      chunk_ptr[c+1] = chunk_ptr[c] + chunk_width * C;
+   }
+
+   S_j    = hypre_TAlloc(hypre_int,     chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+   S_data = hypre_TAlloc(HYPRE_Complex, chunk_ptr[num_chunks], HYPRE_MEMORY_HOST);
+
+   /* fill the chunks column-major; padding repeats a column of the same row
+    * (or column 0 for padding slots) with a zero value */
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c, r, k, row, len, pos, chunk_width) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      chunk_width = (chunk_ptr[c+1] - chunk_ptr[c]) / C;
+      for (r = 0; r < C; r++)
+      {
+         row = perm[c * C + r];
+         len = (row < 0) ? 0 : A_i[row+1] - A_i[row];
+         for (k = 0; k < chunk_width; k++)
+         {
+            pos = chunk_ptr[c] + k * C + r;
+            if (k < len)
+            {
+               S_j[pos]    = (hypre_int) A_j[A_i[row] + k];
+               S_data[pos] = A_data[A_i[row] + k];
+            }
+            else
+            {
+               S_j[pos]    = (row < 0) ? 0 : (hypre_int) A_j[A_i[row]];
+               S_data[pos] = 0.0;
+            }
+         }
+      }
+   }
+
+   hypre_TFree(rows,    HYPRE_MEMORY_HOST);
+   hypre_TFree(neg_len, HYPRE_MEMORY_HOST);
+
+   S = hypre_CTAlloc(hypre_SELLMatrix, 1, HYPRE_MEMORY_HOST);
+
+   hypre_SELLMatrixNumRows(S)     = num_rows;
+   hypre_SELLMatrixNumSellRows(S) = num_sell_rows;
+   hypre_SELLMatrixNumChunks(S)   = num_chunks;
+   hypre_SELLMatrixSigma(S)       = sigma;
+   hypre_SELLMatrixChunkPtr(S)    = chunk_ptr;
+   hypre_SELLMatrixPerm(S)        = perm;
+   hypre_SELLMatrixJ(S)           = S_j;
+   hypre_SELLMatrixData(S)        = S_data;
+
+   S -> csr_i            = A_i;
+   S -> csr_j            = A_j;
+   S -> csr_data         = A_data;
+   S -> csr_num_nonzeros = num_nonzeros;
+
+   return S;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixDestroy
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SELLMatrixDestroy( hypre_SELLMatrix *S )
+{
+   if (S)
+   {
+      hypre_TFree(hypre_SELLMatrixChunkPtr(S), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixPerm(S),     HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixJ(S),        HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_SELLMatrixData(S),     HYPRE_MEMORY_HOST);
+      hypre_TFree(S, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SELLMatrixMatvec
+ *
+ * y = alpha*S*x + beta*b, single vector only.  b and y may be the same array.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SELLMatrixMatvec( HYPRE_Complex     alpha,
+                        hypre_SELLMatrix *S,
+                        HYPRE_Complex    *x_data,
+                        HYPRE_Complex     beta,
+                        HYPRE_Complex    *b_data,
+                        HYPRE_Complex    *y_data )
+{
+   HYPRE_Int      num_rows   = hypre_SELLMatrixNumRows(S);
+   HYPRE_Int      num_chunks = hypre_SELLMatrixNumChunks(S);
+   HYPRE_Int     *chunk_ptr  = hypre_SELLMatrixChunkPtr(S);
+   HYPRE_Int     *perm       = hypre_SELLMatrixPerm(S);
+   hypre_int     *S_j        = hypre_SELLMatrixJ(S);
+   HYPRE_Complex *S_data     = hypre_SELLMatrixData(S);
+   HYPRE_Int      all_rows   = (hypre_SELLMatrixNumSellRows(S) == num_rows);
+   HYPRE_Int      i, c, r, jj, row;
+
+   /* rows without nonzeros are not stored: take care of them first */
+   if ( !all_rows && !(beta == 1.0 && b_data == y_data) )
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(i) HYPRE_SMP_SCHEDULE
+#endif
+      for (i = 0; i < num_rows; i++)
+      {
+         y_data[i] = beta * b_data[i];
+      }
+   }
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp parallel for private(c, r, jj, row) HYPRE_SMP_SCHEDULE
+#endif
+   for (c = 0; c < num_chunks; c++)
+   {
+      HYPRE_Complex  tmp[HYPRE_SELL_CHUNK_SIZE];
+      HYPRE_Int     *perm_c = perm + c * HYPRE_SELL_CHUNK_SIZE;
+
+      for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+      {
+         tmp[r] = 0.0;
+      }
+
+      for (jj = chunk_ptr[c]; jj < chunk_ptr[c+1]; jj += HYPRE_SELL_CHUNK_SIZE)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE; r++)
+         {
+            tmp[r] += S_data[jj + r] * x_data[S_j[jj + r]];
+         }
+      }
+
+      if (all_rows)
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE && perm_c[r] >= 0; r++)
+         {
+            row = perm_c[r];
+            y_data[row] = alpha * tmp[r] + beta * b_data[row];
+         }
+      }
+      else
+      {
+         for (r = 0; r < HYPRE_SELL_CHUNK_SIZE && perm_c[r] >= 0; r++)
+         {
+            y_data[perm_c[r]] += alpha * tmp[r];
+         }
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixGetSELL
+ *
+ * Returns the SELL-C-sigma shadow of A, building it on first use or when the
+ * arrays of A have been replaced since it was built.  The CSR and ParCSR
+ * routines that (re)set the structure or change the values in place
+ * (Initialize, BigJtoJ/JtoBigJ, Copy, DropSmallEntries, Truncate, the IJ
+ * SetValues, AddToValues, SetConstantValues and Assemble routines, ...)
+ * clear it with hypre_CSRMatrixClearSELL.  Other code that writes into
+ * hypre_CSRMatrixData(A) directly must do the same.
+ *--------------------------------------------------------------------------*/
+
+hypre_SELLMatrix *
+hypre_CSRMatrixGetSELL( hypre_CSRMatrix *A )
+{
+   hypre_SELLMatrix *S = hypre_CSRMatrixSELL(A);
+
+   if (hypre_GetActualMemLocation(hypre_CSRMatrixMemoryLocation(A)) != hypre_MEMORY_HOST)
+   {
+      return NULL;
+   }
+
+   if ( S && ( S -> csr_i            != hypre_CSRMatrixI(A)    ||
+               S -> csr_j            != hypre_CSRMatrixJ(A)    ||
+               S -> csr_data         != hypre_CSRMatrixData(A) ||
+               S -> csr_num_nonzeros != hypre_CSRMatrixNumNonzeros(A) ||
+               hypre_SELLMatrixNumRows(S) != hypre_CSRMatrixNumRows(A) ) )
+   {
+      hypre_CSRMatrixClearSELL(A);
+      S = NULL;
+   }
+
+   if (!S)
+   {
+      S = hypre_SELLMatrixCreateFromCSR(A, HYPRE_SELL_SIGMA);
+      hypre_CSRMatrixSELL(A) = S;
+   }
+
+   return S;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_CSRMatrixClearSELL
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_CSRMatrixClearSELL( hypre_CSRMatrix *A )
+{
+   if (A)
+   {
+      hypre_SELLMatrixDestroy(hypre_CSRMatrixSELL(A));
+      hypre_CSRMatrixSELL(A) = NULL;
+   }
+
+   return hypre_error_flag;
+}
@@ -74,6 +74,25 @@ HYPRE_Int hypre_CSRMatrixMatvec_FF ( HYPRE_Complex alpha , hypre_CSRMatrix *A ,
 HYPRE_Int hypre_CSRMatrixMatvecDevice(HYPRE_Int trans, HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 HYPRE_Int hypre_CSRMatrixMatvecDeviceBIGINT( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b, hypre_Vector *y, HYPRE_Int offset );
 #endif
+/* csr_sell.c */
+hypre_SELLMatrix *hypre_SELLMatrixCreateFromCSR ( hypre_CSRMatrix *A , HYPRE_Int sigma );
+HYPRE_Int hypre_SELLMatrixDestroy ( hypre_SELLMatrix *S );
+HYPRE_Int hypre_SELLMatrixMatvec ( HYPRE_Complex alpha , hypre_SELLMatrix *S , HYPRE_Complex *x_data , HYPRE_Complex beta , HYPRE_Complex *b_data , HYPRE_Complex *y_data );
+hypre_SELLMatrix *hypre_CSRMatrixGetSELL ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixClearSELL ( hypre_CSRMatrix *A );
+
+/* csr_compress.c */
+HYPRE_Int hypre_CSRMatrixCompressColumns ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixDecompressColumns ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecCompressed ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTCompressed ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
+/* csr_float.c */
+HYPRE_Int hypre_CSRMatrixConvertToFloat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixConvertFromFloat ( hypre_CSRMatrix *A );
+HYPRE_Int hypre_CSRMatrixMatvecFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *b , hypre_Vector *y , HYPRE_Int offset );
+HYPRE_Int hypre_CSRMatrixMatvecTFloat ( HYPRE_Complex alpha , hypre_CSRMatrix *A , hypre_Vector *x , HYPRE_Complex beta , hypre_Vector *y );
+
 /* genpart.c */
 HYPRE_Int hypre_GeneratePartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_BigInt **part_ptr );
 HYPRE_Int hypre_GenerateLocalPartitioning ( HYPRE_BigInt length , HYPRE_Int num_procs , HYPRE_Int myid , HYPRE_BigInt **part_ptr );
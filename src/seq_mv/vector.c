@@ -96,7 +96,7 @@ hypre_SeqVectorInitialize_v2( hypre_Vector *vector, HYPRE_MemoryLocation memory_
     * when being used, and freed */
    if ( !hypre_VectorData(vector) )
    {
-      hypre_VectorData(vector) = hypre_CTAlloc(HYPRE_Complex, num_vectors*size, memory_location);
+      hypre_VectorData(vector) = hypre_CTAllocFirstTouch(HYPRE_Complex, num_vectors*size, memory_location);
    }
 
    if ( multivec_storage_method == 0 )
@@ -91,3 +91,91 @@ hypre_SStructInnerProd( hypre_SStructVector *x,
 
    return hypre_error_flag;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProdLocal
+ *
+ * Computes the contribution of the local data to <x,y>, without the global
+ * reduction.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructInnerProdLocal( hypre_SStructVector *x,
+                             hypre_SStructVector *y,
+                             HYPRE_Real          *result_ptr )
+{
+   HYPRE_Int              nparts        = hypre_SStructVectorNParts(x);
+   HYPRE_Int              x_object_type = hypre_SStructVectorObjectType(x);
+   HYPRE_Int              y_object_type = hypre_SStructVectorObjectType(y);
+   hypre_SStructPVector  *px, *py;
+   HYPRE_Real             result;
+   HYPRE_Int              part, var;
+
+   if (x_object_type != y_object_type)
+   {
+      hypre_error_in_arg(2);
+      hypre_error_in_arg(3);
+      return hypre_error_flag;
+   }
+
+   result = 0.0;
+
+   if ( (x_object_type == HYPRE_SSTRUCT) || (x_object_type == HYPRE_STRUCT) )
+   {
+      for (part = 0; part < nparts; part++)
+      {
+         px = hypre_SStructVectorPVector(x, part);
+         py = hypre_SStructVectorPVector(y, part);
+         for (var = 0; var < hypre_SStructPVectorNVars(px); var++)
+         {
+            result += hypre_StructInnerProdLocal(hypre_SStructPVectorSVector(px, var),
+                                                 hypre_SStructPVectorSVector(py, var));
+         }
+      }
+   }
+
+   else if (x_object_type == HYPRE_PARCSR)
+   {
+      hypre_ParVector  *x_par;
+      hypre_ParVector  *y_par;
+
+      hypre_SStructVectorConvert(x, &x_par);
+      hypre_SStructVectorConvert(y, &y_par);
+
+      result = hypre_SeqVectorInnerProd(hypre_ParVectorLocalVector(x_par),
+                                        hypre_ParVectorLocalVector(y_par));
+   }
+
+   *result_ptr = result;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_SStructInnerProdStart
+ *
+ * Starts the n inner products result[k] = <x[k],y[k]> as a single
+ * non-blocking reduction.  The local sums are left in local_result, which
+ * must stay valid until the request has completed (hypre_MPI_Wait).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_SStructInnerProdStart( HYPRE_Int             n,
+                             hypre_SStructVector **x,
+                             hypre_SStructVector **y,
+                             HYPRE_Real           *local_result,
+                             HYPRE_Real           *result,
+                             hypre_MPI_Request    *request )
+{
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      hypre_SStructInnerProdLocal(x[k], y[k], &local_result[k]);
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_SStructVectorComm(x[0]), request);
+
+   return hypre_error_flag;
+}
@@ -288,6 +288,20 @@ HYPRE_Int HYPRE_StructPFMGSetNumPostRelax(HYPRE_StructSolver solver,
 HYPRE_Int HYPRE_StructPFMGSetSkipRelax(HYPRE_StructSolver solver,
                                  HYPRE_Int          skip_relax);
 
+/**
+ * (Optional) Do up to \e temporal_blocking Jacobi sweeps per exchange of ghost
+ * values.  The sweeps are fused into one pass over each box that recomputes
+ * the values needed near the box boundaries, trading a few extra flops for
+ * fewer messages and better cache reuse.  The result is the same as with the
+ * regular sweeps.  Only used with the Jacobi relaxation types and
+ * variable-coefficient matrices, and on the finest level only if the grid has
+ * \e temporal_blocking times the stencil extent ghost layers (see
+ * HYPRE_StructGridSetNumGhost).  Levels with too few ghost layers use the
+ * regular sweeps.  The default is 1.
+ **/
+HYPRE_Int HYPRE_StructPFMGSetTemporalBlocking(HYPRE_StructSolver solver,
+                                        HYPRE_Int          temporal_blocking);
+
 /*
  * RE-VISIT
  **/
@@ -25,7 +25,8 @@ HYPRE_StructPCGCreate( MPI_Comm comm, HYPRE_StructSolver *solver )
          hypre_StructKrylovCreateVector,
          hypre_StructKrylovDestroyVector, hypre_StructKrylovMatvecCreate,
          hypre_StructKrylovMatvec, hypre_StructKrylovMatvecDestroy,
-         hypre_StructKrylovInnerProd, hypre_StructKrylovCopyVector,
+         hypre_StructKrylovInnerProd, hypre_StructKrylovInnerProdStart,
+         hypre_StructKrylovCopyVector,
          hypre_StructKrylovClearVector,
          hypre_StructKrylovScaleVector, hypre_StructKrylovAxpy,
          hypre_StructKrylovIdentitySetup, hypre_StructKrylovIdentity );
@@ -174,6 +175,12 @@ HYPRE_StructDiagScaleSetup( HYPRE_StructSolver solver,
                             HYPRE_StructVector y,
                             HYPRE_StructVector x      )
 {
+   if (hypre_StructMatrixCoeffField((hypre_StructMatrix *) A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Diagonal scaling needs stored coefficients, not a coefficient field");
+   }
+
    return hypre_error_flag;
 }
 
@@ -207,6 +214,13 @@ HYPRE_StructDiagScale( HYPRE_StructSolver solver,
 
    HYPRE_Int             i;
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Diagonal scaling needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /* x = D^{-1} y */
    hypre_SetIndex(stride, 1);
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
@@ -505,6 +505,13 @@ hypre_CyclicReductionSetup( void               *cyc_red_vdata,
    HYPRE_MemoryLocation    data_location = HYPRE_MEMORY_DEVICE;
 #endif
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Cyclic reduction needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -809,6 +816,13 @@ hypre_CyclicReduction( void               *cyc_red_vdata,
 
    HYPRE_Int             compute_i, fi, ci, j, l;
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Cyclic reduction needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    hypre_BeginTiming(cyc_red_data -> time_index);
 
 
@@ -287,3 +287,18 @@ hypre_PFMGRelaxSetTempVec( void               *pfmg_relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Only used by the Jacobi relaxation types
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGRelaxSetTemporalBlocking( void      *pfmg_relax_vdata,
+                                    HYPRE_Int  temporal_blocking )
+{
+   hypre_PFMGRelaxData *pfmg_relax_data = (hypre_PFMGRelaxData *)pfmg_relax_vdata;
+
+   hypre_PointRelaxSetTemporalBlocking((pfmg_relax_data -> relax_data), temporal_blocking);
+
+   return hypre_error_flag;
+}
+
@@ -73,6 +73,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Int             usr_jacobi_weight= (pfmg_data -> usr_jacobi_weight);
    HYPRE_Real            jacobi_weight    = (pfmg_data -> jacobi_weight);
    HYPRE_Int             skip_relax =       (pfmg_data -> skip_relax);
+   HYPRE_Int             temporal_blocking = (pfmg_data -> temporal_blocking);
    HYPRE_Real           *dxyz       =       (pfmg_data -> dxyz);
    HYPRE_Int             rap_type;
 
@@ -100,6 +101,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    HYPRE_Real           *mean, *deviation;
    HYPRE_Real            alpha, beta;
 
+   hypre_StructMatrix   *A_field = NULL;
    hypre_StructMatrix  **A_l;
    hypre_StructMatrix  **P_l;
    hypre_StructMatrix  **RT_l;
@@ -128,6 +130,9 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_Int             b_num_ghost[]  = {0, 0, 0, 0, 0, 0};
    HYPRE_Int             x_num_ghost[]  = {1, 1, 1, 1, 1, 1};
+   HYPRE_Int             tb_extent = 0;
+   hypre_Index          *stencil_shape;
+   HYPRE_Int             si;
 
 #if defined(HYPRE_USING_CUDA)
    HYPRE_Int             num_level_GPU = 0;
@@ -144,6 +149,25 @@ hypre_PFMGSetup( void               *pfmg_vdata,
 
    HYPRE_ANNOTATION_BEGIN("PFMG.setup");
 
+   /*-----------------------------------------------------
+    * If the coefficients of A are computed from a
+    * coefficient field, build the hierarchy from a
+    * temporary stored copy and relax on the original
+    *-----------------------------------------------------*/
+
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      if (relax_type == 2 || relax_type == 3)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Red/black relaxation needs stored coefficients");
+         HYPRE_ANNOTATION_END("PFMG.setup");
+         return hypre_error_flag;
+      }
+      A_field = A;
+      A = hypre_StructMatrixFieldCreateStored(A_field);
+   }
+
    /*-----------------------------------------------------
     * Set up coarse grids
     *-----------------------------------------------------*/
@@ -394,6 +418,24 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    r_l  = tx_l;
    e_l  = tx_l;
 
+   /* wider ghost layers for the temporally blocked Jacobi sweeps */
+   if (temporal_blocking > 1 && (relax_type == 0 || relax_type == 1))
+   {
+      stencil_shape = hypre_StructStencilShape(hypre_StructMatrixStencil(A));
+      for (si = 0; si < hypre_StructStencilSize(hypre_StructMatrixStencil(A)); si++)
+      {
+         for (d = 0; d < ndim; d++)
+         {
+            tb_extent = hypre_max(tb_extent, hypre_abs(hypre_IndexD(stencil_shape[si], d)));
+         }
+      }
+      for (d = 0; d < 2*ndim; d++)
+      {
+         x_num_ghost[d] = hypre_max(x_num_ghost[d], temporal_blocking*tb_extent);
+         b_num_ghost[d] = hypre_max(b_num_ghost[d], (temporal_blocking-1)*tb_extent);
+      }
+   }
+
    A_l[0] = hypre_StructMatrixRef(A);
    b_l[0] = hypre_StructVectorRef(b);
    x_l[0] = hypre_StructVectorRef(x);
@@ -646,6 +688,16 @@ hypre_PFMGSetup( void               *pfmg_vdata,
       hypre_SetDeviceOn();
    }
 #endif
+
+   /* switch the fine grid back to the coefficient field matrix */
+   if (A_field)
+   {
+      hypre_StructMatrixDestroy(A_l[0]);
+      hypre_StructMatrixDestroy(A);
+      A = A_field;
+      A_l[0] = hypre_StructMatrixRef(A);
+   }
+
    /* set up fine grid relaxation */
    relax_data_l[0] = hypre_PFMGRelaxCreate(comm);
    hypre_PFMGRelaxSetTol(relax_data_l[0], 0.0);
@@ -659,6 +711,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
    }
    hypre_PFMGRelaxSetType(relax_data_l[0], relax_type);
    hypre_PFMGRelaxSetTempVec(relax_data_l[0], tx_l[0]);
+   hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[0], temporal_blocking);
    hypre_PFMGRelaxSetup(relax_data_l[0], A_l[0], b_l[0], x_l[0]);
    if (num_levels > 1)
    {
@@ -679,6 +732,7 @@ hypre_PFMGSetup( void               *pfmg_vdata,
             }
             hypre_PFMGRelaxSetType(relax_data_l[l], relax_type);
             hypre_PFMGRelaxSetTempVec(relax_data_l[l], tx_l[l]);
+            hypre_PFMGRelaxSetTemporalBlocking(relax_data_l[l], temporal_blocking);
          }
       }
 
@@ -0,0 +1,815 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Stencil-generic Galerkin coarse operator for PFMG (rap_type 0).
+ *
+ * PFMG interpolation is the identity at C-points and uses the two neighbors
+ * in the coarsening direction e at F-points, with weights pa (-e entry) and
+ * pb (+e entry); R has the same structure.  For any fine stencil, the coarse
+ * stencil entry (c, v) (c along e, v the other components) is
+ *
+ *    RAP = sum_{dk=-1,0,1} R_dk * ( A(v, 2c-dk)                  [row dk]
+ *                                 + A(v, 2c-1-dk) * pb(c-1, v)   [row dk]
+ *                                 + A(v, 2c+1-dk) * pa(c, v) )   [row dk]
+ *
+ * with R_0 = 1, R_{-1} = rb, R_{+1} = ra, and row dk meaning the fine point
+ * F(ic) + dk*e.  This gives nine "slots" (dk, column) per coarse entry.
+ *
+ * When A has width 3 in direction e, which covers the 5, 9, 7, 15, 19 and
+ * 27-point stencils, the three coarse entries c = -1, 0, 1 that share the
+ * same v only involve A(v, -1:1) in the three rows and P at two points, so
+ * they are computed together in one BoxLoop that reads each coefficient of
+ * A once.  Any other stencil is handled one coarse entry at a time.
+ *
+ * Missing slots get zero weight and read data that the loop reads anyway.
+ * The kernels are generated at compile time for each combination of stored
+ * outputs and of variable, mixed or constant (constant_coefficient = 2 off-
+ * diagonal) A coefficients, so the loop bodies are straight multiply-adds
+ * along the unit-stride direction of the box.
+ *
+ * The coarse stencil is the set of entries with at least one slot, padded to
+ * the usual 9-point (2d) or 19/27-point (3d) shape when it fits, so that the
+ * next level sees one of the stencils handled by hypre_PFMGSetupInterpOp.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_ls.h"
+#include "_hypre_struct_mv.hpp"
+#include "pfmg.h"
+
+/*--------------------------------------------------------------------------
+ * Data passed to the kernels.  Slot k = 3*(dk+1) + j holds the A coefficient
+ * for row dk, where j is the column (0: C-point, 1: pb, 2: pa) for the
+ * per-entry kernel and t+1 for A(v, t) in the width-3 kernels.  A slot value
+ * is w*a[iA + ao] + cst, where cst carries a constant A coefficient.  The
+ * P offsets are for the points q = c-1 (qOffset[0]) and q = c (qOffset[1]),
+ * with c = 0 for the width-3 kernels.
+ *--------------------------------------------------------------------------*/
+
+typedef struct
+{
+   HYPRE_Int       ndim;
+   hypre_Index     loop_size;
+   hypre_Box      *P_dbox;
+   hypre_Box      *R_dbox;
+   hypre_Box      *A_dbox;
+   hypre_Box      *RAP_dbox;
+   hypre_IndexRef  cstart;
+   hypre_Index     fstart;
+   hypre_IndexRef  stridef;
+
+   HYPRE_Real     *ra, *rb;
+   HYPRE_Int       rbOffset;
+   HYPRE_Real     *pa, *pb;
+   HYPRE_Int       qOffset[2];
+
+   HYPRE_Real     *a[9];
+   HYPRE_Int       ao[9];
+   HYPRE_Real      w[9];
+   HYPRE_Real      cst[9];
+
+   HYPRE_Real     *rap[3];
+
+} hypre_PFMGGalerkinData;
+
+/*--------------------------------------------------------------------------
+ * Kernel generators.  CONST selects variable (0), mixed (1) or constant (2)
+ * A coefficients, and OUTL, OUTC and OUTU (0 or 1) select the outputs
+ * c = -1, 0, 1 of the width-3 kernel.  All are literals, so the unused
+ * parts of the loop bodies are removed by the compiler.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_PFMGGalerkinSlot(k, CONST)                              \
+   ((CONST == 0) ? (w##k * a##k[iA + ao##k]) :                        \
+    (CONST == 1) ? (w##k * a##k[iA + ao##k] + c##k) : c##k)
+
+#define hypre_PFMGGalerkinLoad(k)                                     \
+   HYPRE_Real *a##k = d -> a[k];                                      \
+   HYPRE_Int   ao##k = d -> ao[k];                                    \
+   HYPRE_Real  w##k = d -> w[k];                                      \
+   HYPRE_Real  c##k = d -> cst[k];                                    \
+   (void) a##k; (void) ao##k; (void) w##k; (void) c##k
+
+#define hypre_PFMGGalerkinLoadAll()                                   \
+   HYPRE_Real *ra = d -> ra, *rb = d -> rb;                           \
+   HYPRE_Real *pa = d -> pa, *pb = d -> pb;                           \
+   HYPRE_Int   rbOffset = d -> rbOffset;                              \
+   HYPRE_Int   qmOffset = d -> qOffset[0], q0Offset = d -> qOffset[1]; \
+   HYPRE_Real *rapL = d -> rap[0], *rapC = d -> rap[1], *rapU = d -> rap[2]; \
+   hypre_PFMGGalerkinLoad(0); hypre_PFMGGalerkinLoad(1);              \
+   hypre_PFMGGalerkinLoad(2); hypre_PFMGGalerkinLoad(3);              \
+   hypre_PFMGGalerkinLoad(4); hypre_PFMGGalerkinLoad(5);              \
+   hypre_PFMGGalerkinLoad(6); hypre_PFMGGalerkinLoad(7);              \
+   hypre_PFMGGalerkinLoad(8);                                         \
+   hypre_Index stridec;                                               \
+   hypre_SetIndex(stridec, 1)
+
+#define hypre_PFMGGalerkinLoopBegin()                                 \
+   hypre_BoxLoop4Begin(d -> ndim, d -> loop_size,                     \
+                       d -> P_dbox, d -> cstart, stridec, iP,         \
+                       d -> R_dbox, d -> cstart, stridec, iR,         \
+                       d -> A_dbox, d -> fstart, d -> stridef, iA,    \
+                       d -> RAP_dbox, d -> cstart, stridec, iAc);
+
+#define hypre_PFMGGalerkinLoopEnd()                                   \
+   hypre_BoxLoop4End(iP, iR, iA, iAc);
+
+#define DEVICE_VAR is_device_ptr(rapL,rapC,rapU,ra,rb,pa,pb,a0,a1,a2,a3,a4,a5,a6,a7,a8)
+
+/* one coarse entry, any fine stencil */
+#define hypre_PFMGGalerkinEntryKernel(name, CONST)                    \
+static void                                                           \
+name( hypre_PFMGGalerkinData *d )                                     \
+{                                                                     \
+   hypre_PFMGGalerkinLoadAll();                                       \
+   hypre_PFMGGalerkinLoopBegin()                                      \
+   {                                                                  \
+      HYPRE_Real pbv = pb[iP + qmOffset];                             \
+      HYPRE_Real pav = pa[iP + q0Offset];                             \
+                                                                      \
+      rapL[iAc] = hypre_PFMGGalerkinSlot(3, CONST)                    \
+         +        hypre_PFMGGalerkinSlot(4, CONST) * pbv              \
+         +        hypre_PFMGGalerkinSlot(5, CONST) * pav              \
+         +        rb[iR - rbOffset] * (hypre_PFMGGalerkinSlot(0, CONST) \
+                                       + hypre_PFMGGalerkinSlot(1, CONST) * pbv \
+                                       + hypre_PFMGGalerkinSlot(2, CONST) * pav) \
+         +        ra[iR] * (hypre_PFMGGalerkinSlot(6, CONST)          \
+                            + hypre_PFMGGalerkinSlot(7, CONST) * pbv  \
+                            + hypre_PFMGGalerkinSlot(8, CONST) * pav); \
+   }                                                                  \
+   hypre_PFMGGalerkinLoopEnd()                                        \
+   (void) rapC; (void) rapU;                                          \
+}
+
+/* coarse entries (-1, v), (0, v) and (1, v) for a fine stencil of width 3 */
+#define hypre_PFMGGalerkinColumnKernel(name, OUTL, OUTC, OUTU, CONST) \
+static void                                                           \
+name( hypre_PFMGGalerkinData *d )                                     \
+{                                                                     \
+   hypre_PFMGGalerkinLoadAll();                                       \
+   hypre_PFMGGalerkinLoopBegin()                                      \
+   {                                                                  \
+      if (OUTL)                                                       \
+      {                                                               \
+         HYPRE_Real pam = pa[iP + qmOffset];                          \
+         rapL[iAc] = rb[iR - rbOffset] * (hypre_PFMGGalerkinSlot(0, CONST) \
+                            + hypre_PFMGGalerkinSlot(1, CONST) * pam) \
+            +        hypre_PFMGGalerkinSlot(3, CONST) * pam;          \
+      }                                                               \
+      if (OUTC)                                                       \
+      {                                                               \
+         HYPRE_Real pbm = pb[iP + qmOffset];                          \
+         HYPRE_Real pa0 = pa[iP + q0Offset];                          \
+         rapC[iAc] = hypre_PFMGGalerkinSlot(4, CONST)                 \
+            +        hypre_PFMGGalerkinSlot(3, CONST) * pbm           \
+            +        hypre_PFMGGalerkinSlot(5, CONST) * pa0           \
+            +        rb[iR - rbOffset] * (hypre_PFMGGalerkinSlot(2, CONST) \
+                            + hypre_PFMGGalerkinSlot(1, CONST) * pbm) \
+            +        ra[iR] * (hypre_PFMGGalerkinSlot(6, CONST)       \
+                            + hypre_PFMGGalerkinSlot(7, CONST) * pa0); \
+      }                                                               \
+      if (OUTU)                                                       \
+      {                                                               \
+         HYPRE_Real pb0 = pb[iP + q0Offset];                          \
+         rapU[iAc] = ra[iR] * (hypre_PFMGGalerkinSlot(8, CONST)       \
+                            + hypre_PFMGGalerkinSlot(7, CONST) * pb0) \
+            +        hypre_PFMGGalerkinSlot(5, CONST) * pb0;          \
+      }                                                               \
+   }                                                                  \
+   hypre_PFMGGalerkinLoopEnd()                                        \
+}
+
+hypre_PFMGGalerkinEntryKernel(hypre_PFMGGalerkinEntry_0, 0)
+hypre_PFMGGalerkinEntryKernel(hypre_PFMGGalerkinEntry_1, 1)
+hypre_PFMGGalerkinEntryKernel(hypre_PFMGGalerkinEntry_2, 2)
+
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L00_0, 1, 0, 0, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0C0_0, 0, 1, 0, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LC0_0, 1, 1, 0, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_00U_0, 0, 0, 1, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L0U_0, 1, 0, 1, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0CU_0, 0, 1, 1, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LCU_0, 1, 1, 1, 0)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L00_1, 1, 0, 0, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0C0_1, 0, 1, 0, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LC0_1, 1, 1, 0, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_00U_1, 0, 0, 1, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L0U_1, 1, 0, 1, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0CU_1, 0, 1, 1, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LCU_1, 1, 1, 1, 1)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L00_2, 1, 0, 0, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0C0_2, 0, 1, 0, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LC0_2, 1, 1, 0, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_00U_2, 0, 0, 1, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_L0U_2, 1, 0, 1, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_0CU_2, 0, 1, 1, 2)
+hypre_PFMGGalerkinColumnKernel(hypre_PFMGGalerkinColumn_LCU_2, 1, 1, 1, 2)
+
+#undef DEVICE_VAR
+
+typedef void (*hypre_PFMGGalerkinKernelFcn)( hypre_PFMGGalerkinData * );
+
+static hypre_PFMGGalerkinKernelFcn hypre_PFMGGalerkinEntryKernels[3] =
+{
+   hypre_PFMGGalerkinEntry_0, hypre_PFMGGalerkinEntry_1, hypre_PFMGGalerkinEntry_2
+};
+
+/* index = (c = -1 stored) + 2*(c = 0 stored) + 4*(c = 1 stored) - 1
+ *         + 7*(A coefficient type) */
+static hypre_PFMGGalerkinKernelFcn hypre_PFMGGalerkinColumnKernels[21] =
+{
+   hypre_PFMGGalerkinColumn_L00_0, hypre_PFMGGalerkinColumn_0C0_0,
+   hypre_PFMGGalerkinColumn_LC0_0, hypre_PFMGGalerkinColumn_00U_0,
+   hypre_PFMGGalerkinColumn_L0U_0, hypre_PFMGGalerkinColumn_0CU_0,
+   hypre_PFMGGalerkinColumn_LCU_0,
+   hypre_PFMGGalerkinColumn_L00_1, hypre_PFMGGalerkinColumn_0C0_1,
+   hypre_PFMGGalerkinColumn_LC0_1, hypre_PFMGGalerkinColumn_00U_1,
+   hypre_PFMGGalerkinColumn_L0U_1, hypre_PFMGGalerkinColumn_0CU_1,
+   hypre_PFMGGalerkinColumn_LCU_1,
+   hypre_PFMGGalerkinColumn_L00_2, hypre_PFMGGalerkinColumn_0C0_2,
+   hypre_PFMGGalerkinColumn_LC0_2, hypre_PFMGGalerkinColumn_00U_2,
+   hypre_PFMGGalerkinColumn_L0U_2, hypre_PFMGGalerkinColumn_0CU_2,
+   hypre_PFMGGalerkinColumn_LCU_2
+};
+
+/*--------------------------------------------------------------------------
+ * Returns in s the fine stencil entry for slot (dk, col) of the coarse
+ * stencil entry `offset', and its rank in A_stencil (-1 if not present).
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGGalerkinSlotRank( hypre_StructStencil *A_stencil,
+                            hypre_Index          offset,
+                            HYPRE_Int            cdir,
+                            HYPRE_Int            dk,
+                            HYPRE_Int            col,
+                            hypre_Index          s )
+{
+   static const HYPRE_Int  col_shift[3] = {0, -1, 1};
+
+   hypre_CopyIndex(offset, s);
+   hypre_IndexD(s, cdir) = 2 * hypre_IndexD(offset, cdir) - dk + col_shift[col];
+
+   return hypre_StructStencilElementRank(A_stencil, s);
+}
+
+/*--------------------------------------------------------------------------
+ * Sets up new coarse grid operator structure.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_PFMGCreateGalerkinRAPOp( hypre_StructMatrix *R,
+                               hypre_StructMatrix *A,
+                               hypre_StructMatrix *P,
+                               hypre_StructGrid   *coarse_grid,
+                               HYPRE_Int           cdir        )
+{
+   hypre_StructMatrix    *RAP;
+
+   hypre_StructStencil   *A_stencil;
+   hypre_Index           *A_shape;
+   HYPRE_Int              A_stencil_size;
+   hypre_Index           *RAP_stencil_shape;
+   hypre_StructStencil   *RAP_stencil;
+   HYPRE_Int              RAP_stencil_size;
+   HYPRE_Int              RAP_num_ghost[2 * HYPRE_MAXDIM];
+
+   HYPRE_Int              ndim;
+   HYPRE_Int              width, max_width, has_corner, standard;
+   HYPRE_Int              axis[HYPRE_MAXDIM];
+   hypre_Index            index, s;
+   HYPRE_Int              lex_size, lex, rem;
+   HYPRE_Int              i, d, dk, col, keep, corner;
+
+   A_stencil      = hypre_StructMatrixStencil(A);
+   A_shape        = hypre_StructStencilShape(A_stencil);
+   A_stencil_size = hypre_StructStencilSize(A_stencil);
+   ndim           = hypre_StructStencilNDim(A_stencil);
+
+   /*-----------------------------------------------------------------------
+    * Entries are listed in the standard lexicographic ordering with
+    * direction cdir outermost.  For symmetric A, only the lower triangular
+    * part + diagonal is stored, i.e., the first half of the list.
+    *-----------------------------------------------------------------------*/
+
+   axis[0] = cdir;
+   for (d = 1; d < ndim; d++)
+   {
+      axis[d] = (cdir + ndim - d) % ndim;
+   }
+
+   /* Bound on the extent of the product stencil */
+   max_width = 1;
+   for (i = 0; i < A_stencil_size; i++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         max_width = hypre_max(max_width, hypre_abs(hypre_IndexD(A_shape[i], d)));
+      }
+      max_width = hypre_max(max_width,
+                            (hypre_abs(hypre_IndexD(A_shape[i], cdir)) + 2) / 2);
+   }
+
+   lex_size = 1;
+   for (d = 0; d < ndim; d++)
+   {
+      lex_size *= (2 * max_width + 1);
+   }
+
+   /*-----------------------------------------------------------------------
+    * Collect the entries with at least one nonzero slot
+    *-----------------------------------------------------------------------*/
+
+   RAP_stencil_shape = hypre_CTAlloc(hypre_Index, lex_size, HYPRE_MEMORY_HOST);
+   RAP_stencil_size = 0;
+   width = 1;
+   has_corner = 0;
+   for (lex = 0; lex < lex_size; lex++)
+   {
+      hypre_SetIndex(index, 0);
+      rem = lex;
+      for (d = ndim - 1; d >= 0; d--)
+      {
+         hypre_IndexD(index, axis[d]) = (rem % (2 * max_width + 1)) - max_width;
+         rem /= (2 * max_width + 1);
+      }
+
+      keep = 0;
+      for (dk = -1; (dk <= 1) && !keep; dk++)
+      {
+         for (col = 0; (col < 3) && !keep; col++)
+         {
+            keep = (hypre_PFMGGalerkinSlotRank(A_stencil, index, cdir,
+                                               dk, col, s) >= 0);
+         }
+      }
+
+      if (keep)
+      {
+         corner = 1;
+         for (d = 0; d < ndim; d++)
+         {
+            width  = hypre_max(width, hypre_abs(hypre_IndexD(index, d)));
+            corner = corner && (hypre_IndexD(index, d) != 0);
+         }
+         has_corner = has_corner || corner;
+
+         hypre_CopyIndex(index, RAP_stencil_shape[RAP_stencil_size]);
+         RAP_stencil_size++;
+      }
+   }
+
+   /*-----------------------------------------------------------------------
+    * Pad to 9 points in 2d, and to 19 (no corners) or 27 points in 3d
+    *-----------------------------------------------------------------------*/
+
+   standard = (width == 1) && (ndim > 1);
+   if (standard)
+   {
+      RAP_stencil_size = 0;
+      lex_size = (ndim == 2) ? 9 : 27;
+      for (lex = 0; lex < lex_size; lex++)
+      {
+         hypre_SetIndex(index, 0);
+         rem = lex;
+         for (d = ndim - 1; d >= 0; d--)
+         {
+            hypre_IndexD(index, axis[d]) = (rem % 3) - 1;
+            rem /= 3;
+         }
+
+         keep = 1;
+         if ((ndim == 3) && !has_corner)
+         {
+            keep = (hypre_IndexD(index, 0) * hypre_IndexD(index, 1) *
+                    hypre_IndexD(index, 2) == 0);
+         }
+
+         if (keep)
+         {
+            hypre_CopyIndex(index, RAP_stencil_shape[RAP_stencil_size]);
+            RAP_stencil_size++;
+         }
+      }
+   }
+
+   if (hypre_StructMatrixSymmetric(A))
+   {
+      RAP_stencil_size = (RAP_stencil_size + 1) / 2;
+   }
+
+   RAP_stencil = hypre_StructStencilCreate(ndim, RAP_stencil_size,
+                                           RAP_stencil_shape);
+   RAP = hypre_StructMatrixCreate(hypre_StructMatrixComm(A),
+                                  coarse_grid, RAP_stencil);
+   hypre_StructStencilDestroy(RAP_stencil);
+
+   /*-----------------------------------------------------------------------
+    * Coarse operator in symmetric iff fine operator is
+    *-----------------------------------------------------------------------*/
+   hypre_StructMatrixSymmetric(RAP) = hypre_StructMatrixSymmetric(A);
+
+   /*-----------------------------------------------------------------------
+    * Set number of ghost points - the stencil width on each boundary
+    *-----------------------------------------------------------------------*/
+   for (i = 0; i < 2 * HYPRE_MAXDIM; i++)
+   {
+      RAP_num_ghost[i] = width;
+   }
+   hypre_StructMatrixSetNumGhost(RAP, RAP_num_ghost);
+
+   return RAP;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets the A slots for the fine stencil ranks in `rank' (-1 if the entry is
+ * not in the stencil).  Slots that are missing or hold a constant
+ * coefficient get zero weight and read the same data as a variable slot in
+ * their row, so they add no memory traffic when such a slot exists.
+ *
+ * Returns the A coefficient type of the kernel to use (0: variable, 1: mixed,
+ * 2: constant), or -1 if no slot is present.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGGalerkinSetSlots( hypre_PFMGGalerkinData *d,
+                            hypre_StructMatrix     *A,
+                            HYPRE_Int               fi,
+                            HYPRE_Int               cdir,
+                            HYPRE_Int              *rank,
+                            HYPRE_Int               A_diag_rank )
+{
+   HYPRE_Int    constant_coefficient_A = hypre_StructMatrixConstantCoefficient(A);
+   HYPRE_Real  *a_diag = hypre_StructMatrixBoxData(A, fi, A_diag_rank);
+   HYPRE_Real  *a;
+   hypre_Index  index;
+   HYPRE_Int    has_var = 0, has_const = 0;
+   HYPRE_Int    k, kv;
+
+   for (k = 0; k < 9; k++)
+   {
+      hypre_SetIndex(index, 0);
+      hypre_IndexD(index, cdir) = k / 3 - 1;
+
+      d -> a[k]   = a_diag;
+      d -> ao[k]  = hypre_BoxOffsetDistance(d -> A_dbox, index);
+      d -> w[k]   = 0.0;
+      d -> cst[k] = 0.0;
+
+      if (rank[k] < 0)
+      {
+         continue;
+      }
+
+      a = hypre_StructMatrixBoxData(A, fi, rank[k]);
+      if ((constant_coefficient_A == 2) && (rank[k] != A_diag_rank))
+      {
+         d -> cst[k] = a[0];
+         has_const   = 1;
+      }
+      else
+      {
+         d -> a[k] = a;
+         d -> w[k] = 1.0;
+         has_var   = 1;
+      }
+   }
+
+   for (k = 0; k < 9; k++)
+   {
+      if (d -> w[k] == 0.0)
+      {
+         for (kv = 3 * (k / 3); kv < 3 * (k / 3) + 3; kv++)
+         {
+            if (d -> w[kv] != 0.0)
+            {
+               d -> a[k]  = d -> a[kv];
+               d -> ao[k] = d -> ao[kv];
+               break;
+            }
+         }
+      }
+   }
+
+   if (has_const)
+   {
+      return (has_var ? 1 : 2);
+   }
+
+   return (has_var ? 0 : -1);
+}
+
+/*--------------------------------------------------------------------------
+ * Sets d -> qOffset for the P points (v, c0-1) and (v, c0), where v and c0
+ * are taken from `offset'.  Returns 0 if the points are not within the
+ * ghost layer of P.
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_PFMGGalerkinSetPOffsets( hypre_PFMGGalerkinData *d,
+                               hypre_StructMatrix     *P,
+                               hypre_Index             offset,
+                               HYPRE_Int               c0,
+                               HYPRE_Int               cdir )
+{
+   HYPRE_Int   *num_ghost = hypre_StructMatrixNumGhost(P);
+   hypre_Index  index;
+   HYPRE_Int    q, dd;
+
+   hypre_CopyIndex(offset, index);
+   for (q = 0; q < 2; q++)
+   {
+      hypre_IndexD(index, cdir) = c0 - 1 + q;
+      for (dd = 0; dd < (d -> ndim); dd++)
+      {
+         if ((hypre_IndexD(index, dd) < -num_ghost[2 * dd]) ||
+             (hypre_IndexD(index, dd) >  num_ghost[2 * dd + 1]))
+         {
+            return 0;
+         }
+      }
+      d -> qOffset[q] = hypre_BoxOffsetDistance(d -> P_dbox, index);
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * Sets the stored outputs in d -> rap to zero.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_PFMGGalerkinZero( hypre_PFMGGalerkinData *d )
+{
+   HYPRE_Real  *rap;
+   hypre_Index  stridec;
+   HYPRE_Int    c;
+
+   hypre_SetIndex(stridec, 1);
+   for (c = 0; c < 3; c++)
+   {
+      rap = d -> rap[c];
+      if (rap == NULL)
+      {
+         continue;
+      }
+
+#define DEVICE_VAR is_device_ptr(rap)
+      hypre_BoxLoop1Begin(d -> ndim, d -> loop_size,
+                          d -> RAP_dbox, d -> cstart, stridec, iAc);
+      {
+         rap[iAc] = 0.0;
+      }
+      hypre_BoxLoop1End(iAc);
+#undef DEVICE_VAR
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Computes the stored coefficients of RAP.  No assumptions are made about
+ * the symmetry of A or that R = transpose(P), but the C-to-C interpolation
+ * is taken to be the identity.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PFMGBuildGalerkinRAP( hypre_StructMatrix *A,
+                            hypre_StructMatrix *P,
+                            hypre_StructMatrix *R,
+                            HYPRE_Int           cdir,
+                            hypre_Index         cindex,
+                            hypre_Index         cstride,
+                            hypre_StructMatrix *RAP     )
+{
+   hypre_StructStencil      *A_stencil;
+   hypre_Index              *A_shape;
+   HYPRE_Int                 A_stencil_size;
+   hypre_StructStencil      *RAP_stencil;
+   hypre_Index              *RAP_shape;
+   HYPRE_Int                 RAP_stencil_size;
+   HYPRE_Int                *RAP_symm_elements;
+
+   hypre_StructGrid         *fgrid;
+   HYPRE_Int                *fgrid_ids;
+   hypre_StructGrid         *cgrid;
+   hypre_BoxArray           *cgrid_boxes;
+   HYPRE_Int                *cgrid_ids;
+   hypre_Box                *cgrid_box;
+
+   HYPRE_Int                 constant_coefficient;
+
+   hypre_PFMGGalerkinData    d;
+   HYPRE_Int                *done;
+   HYPRE_Int                 rank[9];
+   HYPRE_Real               *a;
+   hypre_Index               index, s;
+   HYPRE_Int                 A_diag_rank;
+   HYPRE_Int                 width3, type, mask;
+   HYPRE_Int                 fi, ci, i, j, jc, k, c, dk, col;
+
+   A_stencil      = hypre_StructMatrixStencil(A);
+   A_shape        = hypre_StructStencilShape(A_stencil);
+   A_stencil_size = hypre_StructStencilSize(A_stencil);
+
+   RAP_stencil       = hypre_StructMatrixStencil(RAP);
+   RAP_shape         = hypre_StructStencilShape(RAP_stencil);
+   RAP_stencil_size  = hypre_StructStencilSize(RAP_stencil);
+   RAP_symm_elements = hypre_StructMatrixSymmElements(RAP);
+
+   constant_coefficient = hypre_StructMatrixConstantCoefficient(RAP);
+   hypre_assert( constant_coefficient==0 || constant_coefficient==1 );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(R) == constant_coefficient );
+   hypre_assert( hypre_StructMatrixConstantCoefficient(P) == constant_coefficient );
+
+   hypre_SetIndex(index, 0);
+   A_diag_rank = hypre_StructStencilElementRank(A_stencil, index);
+
+   /* Does A have width 3 in direction cdir? */
+   width3 = 1;
+   for (i = 0; i < A_stencil_size; i++)
+   {
+      width3 = width3 && (hypre_abs(hypre_IndexD(A_shape[i], cdir)) <= 1);
+   }
+
+   done = hypre_CTAlloc(HYPRE_Int, RAP_stencil_size, HYPRE_MEMORY_HOST);
+
+   fgrid = hypre_StructMatrixGrid(A);
+   fgrid_ids = hypre_StructGridIDs(fgrid);
+
+   cgrid = hypre_StructMatrixGrid(RAP);
+   cgrid_boxes = hypre_StructGridBoxes(cgrid);
+   cgrid_ids = hypre_StructGridIDs(cgrid);
+
+   d.ndim    = hypre_StructMatrixNDim(A);
+   d.stridef = cstride;
+
+   fi = 0;
+   hypre_ForBoxI(ci, cgrid_boxes)
+   {
+      while (fgrid_ids[fi] != cgrid_ids[ci])
+      {
+         fi++;
+      }
+
+      cgrid_box = hypre_BoxArrayBox(cgrid_boxes, ci);
+
+      d.cstart = hypre_BoxIMin(cgrid_box);
+      hypre_StructMapCoarseToFine(d.cstart, cindex, cstride, d.fstart);
+      hypre_BoxGetSize(cgrid_box, d.loop_size);
+
+      d.A_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), fi);
+      d.P_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(P), fi);
+      d.R_dbox   = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(R), fi);
+      d.RAP_dbox = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(RAP), ci);
+
+      /*-----------------------------------------------------------------
+       * Extract pointers for interpolation and restriction operators:
+       * pa/ra are weights for the f-point above the c-point,
+       * pb/rb are weights for the f-point below the c-point
+       *-----------------------------------------------------------------*/
+
+      hypre_SetIndex(index, 0);
+      hypre_IndexD(index, cdir) = -1;
+      d.pa = hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+      d.ra = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+
+      hypre_IndexD(index, cdir) = 1;
+      d.pb = hypre_StructMatrixExtractPointerByIndex(P, fi, index);
+      d.rb = hypre_StructMatrixExtractPointerByIndex(R, fi, index);
+      d.rbOffset = hypre_BoxOffsetDistance(d.R_dbox, index);
+
+      for (j = 0; j < RAP_stencil_size; j++)
+      {
+         done[j] = 0;
+      }
+
+      for (j = 0; j < RAP_stencil_size; j++)
+      {
+         if ((RAP_symm_elements[j] >= 0) || done[j])
+         {
+            continue;
+         }
+
+         /*--------------------------------------------------------------
+          * Constant coefficients: everything lives at index 0
+          *--------------------------------------------------------------*/
+
+         if (constant_coefficient == 1)
+         {
+            HYPRE_Real  row_value, value = 0.0;
+
+            for (dk = -1; dk <= 1; dk++)
+            {
+               row_value = 0.0;
+               for (col = 0; col < 3; col++)
+               {
+                  k = hypre_PFMGGalerkinSlotRank(A_stencil, RAP_shape[j], cdir,
+                                                 dk, col, s);
+                  if (k >= 0)
+                  {
+                     a = hypre_StructMatrixBoxData(A, fi, k);
+                     row_value += (col == 0) ? a[0] :
+                                  (col == 1) ? a[0] * d.pb[0] : a[0] * d.pa[0];
+                  }
+               }
+               value += (dk < 0) ? d.rb[0] * row_value :
+                        (dk > 0) ? d.ra[0] * row_value : row_value;
+            }
+            hypre_StructMatrixExtractPointerByIndex(RAP, ci, RAP_shape[j])[0] = value;
+
+            continue;
+         }
+
+         if (width3)
+         {
+            /*-----------------------------------------------------------
+             * Entries (-1, v), (0, v) and (1, v) together
+             *-----------------------------------------------------------*/
+
+            hypre_CopyIndex(RAP_shape[j], index);
+            mask = 0;
+            for (c = -1; c <= 1; c++)
+            {
+               hypre_IndexD(index, cdir) = c;
+               jc = hypre_StructStencilElementRank(RAP_stencil, index);
+               d.rap[c + 1] = NULL;
+               if ((jc >= 0) && (RAP_symm_elements[jc] < 0))
+               {
+                  d.rap[c + 1] = hypre_StructMatrixExtractPointerByIndex(RAP, ci, index);
+                  done[jc] = 1;
+                  mask |= (1 << (c + 1));
+               }
+            }
+
+            for (k = 0; k < 9; k++)
+            {
+               hypre_IndexD(index, cdir) = k % 3 - 1;
+               rank[k] = hypre_StructStencilElementRank(A_stencil, index);
+            }
+
+            type = hypre_PFMGGalerkinSetSlots(&d, A, fi, cdir, rank, A_diag_rank);
+            if (type < 0)
+            {
+               hypre_PFMGGalerkinZero(&d);
+            }
+            else if (!hypre_PFMGGalerkinSetPOffsets(&d, P, RAP_shape[j], 0, cdir))
+            {
+               break;
+            }
+            else
+            {
+               (hypre_PFMGGalerkinColumnKernels[mask - 1 + 7 * type])(&d);
+            }
+         }
+         else
+         {
+            /*-----------------------------------------------------------
+             * One entry at a time
+             *-----------------------------------------------------------*/
+
+            d.rap[0] = hypre_StructMatrixExtractPointerByIndex(RAP, ci, RAP_shape[j]);
+            d.rap[1] = NULL;
+            d.rap[2] = NULL;
+            done[j]  = 1;
+
+            for (k = 0; k < 9; k++)
+            {
+               rank[k] = hypre_PFMGGalerkinSlotRank(A_stencil, RAP_shape[j], cdir,
+                                                    k / 3 - 1, k % 3, s);
+            }
+
+            type = hypre_PFMGGalerkinSetSlots(&d, A, fi, cdir, rank, A_diag_rank);
+            if (type < 0)
+            {
+               hypre_PFMGGalerkinZero(&d);
+            }
+            else if (!hypre_PFMGGalerkinSetPOffsets(&d, P, RAP_shape[j],
+                                                    hypre_IndexD(RAP_shape[j], cdir),
+                                                    cdir))
+            {
+               break;
+            }
+            else
+            {
+               (hypre_PFMGGalerkinEntryKernels[type])(&d);
+            }
+         }
+      }
+
+      if (j < RAP_stencil_size)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Interpolation ghost layer too thin for Galerkin product");
+         break;
+      }
+   } /* end ForBoxI */
+
+   hypre_TFree(done, HYPRE_MEMORY_HOST);
+
+   return hypre_error_flag;
+}
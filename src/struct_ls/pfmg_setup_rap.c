@@ -16,9 +16,8 @@
  *
  *   The parameter rap_type controls which lower level routines are
  *   used.
- *      rap_type = 0   Use optimized code for computing Galerkin operators
- *                     for special, common stencil patterns: 5 & 9 pt in
- *                     2d and 7, 19 & 27 in 3d.
+ *      rap_type = 0   Use the stencil-generic Galerkin code with kernels
+ *                     specialized for the PFMG interpolation pattern.
  *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
  *                     only with 5pt in 2d and 7pt in 3d.
  *      rap_type = 2   General purpose Galerkin code.
@@ -41,16 +40,7 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
 
    if (rap_type == 0)
    {
-      switch (hypre_StructStencilNDim(stencil))
-      {
-         case 2:
-            RAP = hypre_PFMG2CreateRAPOp(R ,A, P, coarse_grid, cdir);
-            break;
-
-         case 3:
-            RAP = hypre_PFMG3CreateRAPOp(R ,A, P, coarse_grid, cdir);
-            break;
-      }
+      RAP = hypre_PFMGCreateGalerkinRAPOp(R, A, P, coarse_grid, cdir);
    }
 
    else if (rap_type == 1)
@@ -96,9 +86,8 @@ hypre_PFMGCreateRAPOp( hypre_StructMatrix *R,
  *
  *   The parameter rap_type controls which lower level routines are
  *   used.
- *      rap_type = 0   Use optimized code for computing Galerkin operators
- *                     for special, common stencil patterns: 5 & 9 pt in
- *                     2d and 7, 19 & 27 in 3d.
+ *      rap_type = 0   Use the stencil-generic Galerkin code with kernels
+ *                     specialized for the PFMG interpolation pattern.
  *      rap_type = 1   Use PARFLOW formula for coarse grid operator. Used
  *                     only with 5pt in 2d and 7pt in 3d.
  *      rap_type = 2   General purpose Galerkin code.
@@ -142,37 +131,7 @@ hypre_PFMGSetupRAPOp( hypre_StructMatrix *R,
 
    if (rap_type == 0)
    {
-      switch (hypre_StructStencilNDim(stencil))
-      {
-         case 2:
-            /*--------------------------------------------------------------------
-             *    Set lower triangular (+ diagonal) coefficients
-             *--------------------------------------------------------------------*/
-            hypre_PFMG2BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
-             *--------------------------------------------------------------------*/
-            if(!hypre_StructMatrixSymmetric(A))
-               hypre_PFMG2BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            break;
-
-         case 3:
-
-            /*--------------------------------------------------------------------
-             *    Set lower triangular (+ diagonal) coefficients
-             *--------------------------------------------------------------------*/
-            hypre_PFMG3BuildRAPSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            /*--------------------------------------------------------------------
-             *    For non-symmetric A, set upper triangular coefficients as well
-             *--------------------------------------------------------------------*/
-            if(!hypre_StructMatrixSymmetric(A))
-               hypre_PFMG3BuildRAPNoSym(A, P, R, cdir, cindex, cstride, Ac_tmp);
-
-            break;
-      }
+      hypre_PFMGBuildGalerkinRAP(A, P, R, cdir, cindex, cstride, Ac_tmp);
    }
 
    else if (rap_type == 1)
@@ -43,6 +43,13 @@ typedef struct
 
    hypre_ComputePkg      **compute_pkgs;
 
+   /* temporal blocking of the Jacobi sweeps */
+   HYPRE_Int               temporal_blocking;
+   HYPRE_Int               tb_extent;          /* 0 when blocking is not used */
+   hypre_BoxArrayArray   **tb_regions;
+   hypre_CommPkg         **tb_x_comm_pkgs;
+   hypre_CommPkg         **tb_b_comm_pkgs;
+
    /* log info (always logged) */
    HYPRE_Int               num_iterations;
    HYPRE_Int               time_index;
@@ -83,6 +90,11 @@ hypre_PointRelaxCreate( MPI_Comm  comm )
    (relax_data -> x)                = NULL;
    (relax_data -> t)                = NULL;
    (relax_data -> compute_pkgs)     = NULL;
+   (relax_data -> temporal_blocking) = 0;
+   (relax_data -> tb_extent)        = 0;
+   (relax_data -> tb_regions)       = NULL;
+   (relax_data -> tb_x_comm_pkgs)   = NULL;
+   (relax_data -> tb_b_comm_pkgs)   = NULL;
 
    hypre_SetIndex3(stride, 1, 1, 1);
    hypre_SetIndex3(indices[0], 0, 0, 0);
@@ -123,6 +135,7 @@ hypre_PointRelaxDestroy( void *relax_vdata )
       hypre_StructVectorDestroy(relax_data -> x);
       hypre_StructVectorDestroy(relax_data -> t);
       hypre_TFree(relax_data -> compute_pkgs, HYPRE_MEMORY_HOST);
+      hypre_PointRelaxBlockedDestroy(relax_vdata);
 
       hypre_FinalizeTiming(relax_data -> time_index);
       hypre_TFree(relax_data, HYPRE_MEMORY_HOST);
@@ -300,6 +313,12 @@ hypre_PointRelaxSetup( void               *relax_vdata,
    (relax_data -> flops) = (HYPRE_BigInt)scale * (hypre_StructMatrixGlobalSize(A) +
                                     hypre_StructVectorGlobalSize(x));
 
+   /*-----------------------------------------------------
+    * Set up the temporally blocked sweeps
+    *-----------------------------------------------------*/
+
+   hypre_PointRelaxBlockedSetup(relax_vdata, A, b, x);
+
    return hypre_error_flag;
 }
 
@@ -354,7 +373,7 @@ hypre_PointRelax( void               *relax_vdata,
    HYPRE_Int              constant_coefficient;
 
    HYPRE_Int              iter, p, compute_i, i, j;
-   HYPRE_Int              pointset;
+   HYPRE_Int              pointset, num_sweeps;
 
    HYPRE_Real             bsumsq, rsumsq;
 
@@ -387,7 +406,31 @@ hypre_PointRelax( void               *relax_vdata,
    }
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(x, 0);
+   if (constant_coefficient || hypre_StructMatrixCoeffField(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
+
+   /*----------------------------------------------------------
+    * Do temporally blocked Jacobi iterations
+    *----------------------------------------------------------*/
+
+   if ((relax_data -> tb_extent) > 0 && tol <= 0.0)
+   {
+      hypre_StructVectorClearBoundGhostValues(t, 1);
+
+      for (iter = 0; iter < max_iter; iter += num_sweeps)
+      {
+         num_sweeps = hypre_min((relax_data -> temporal_blocking), (max_iter - iter));
+         hypre_PointRelaxBlocked(relax_vdata, A, b, x, num_sweeps,
+                                 (zero_guess && iter == 0));
+      }
+      (relax_data -> num_iterations) = max_iter;
+
+      hypre_IncFLOPCount(relax_data -> flops);
+      hypre_EndTiming(relax_data -> time_index);
+      return hypre_error_flag;
+   }
 
    rsumsq = 0.0;
    if ( tol>0.0 )
@@ -455,8 +498,16 @@ hypre_PointRelax( void               *relax_vdata,
                start  = hypre_BoxIMin(compute_box);
                hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 
+               /* coefficients computed from a coefficient field */
+               if (hypre_StructMatrixCoeffField(A))
+               {
+                  hypre_PointRelax_coreField(relax_vdata, A, compute_box,
+                                             bp, NULL, xp, i,
+                                             b_data_box, NULL, x_data_box,
+                                             stride, 1);
+               }
                /* all matrix coefficients are constant */
-               if ( constant_coefficient==1 )
+               else if ( constant_coefficient==1 )
                {
                   Ai = hypre_CCBoxIndexRank( A_data_box, start );
                   AAp0 = 1/Ap[Ai];
@@ -566,7 +617,15 @@ hypre_PointRelax( void               *relax_vdata,
             {
                compute_box = hypre_BoxArrayBox(compute_box_a, j);
 
-               if ( constant_coefficient==1 || constant_coefficient==2 )
+               if (hypre_StructMatrixCoeffField(A))
+               {
+                  /* also divides by the diagonal */
+                  hypre_PointRelax_coreField(relax_vdata, A, compute_box,
+                                             bp, xp, tp, i,
+                                             b_data_box, x_data_box, t_data_box,
+                                             stride, 0);
+               }
+               else if ( constant_coefficient==1 || constant_coefficient==2 )
                {
                   hypre_PointRelax_core12(
                      relax_vdata, A, constant_coefficient,
@@ -586,11 +645,11 @@ hypre_PointRelax( void               *relax_vdata,
                      );
                }
 
-               Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
-
-               if ( constant_coefficient==0 || constant_coefficient==2 )
+               if ( (constant_coefficient==0 || constant_coefficient==2) &&
+                    !hypre_StructMatrixCoeffField(A) )
                   /* divide by the variable diagonal */
                {
+                  Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
                   start  = hypre_BoxIMin(compute_box);
                   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
 #define DEVICE_VAR is_device_ptr(tp,Ap)
@@ -906,6 +965,125 @@ hypre_PointRelax_core0( void               *relax_vdata,
 }
 
 
+/* for a matrix with a coefficient field, the coefficients are computed on
+   the fly: t = (b - (A - D) x) / D, or t = b / D if zero_guess is set (x is
+   not used then) */
+HYPRE_Int
+hypre_PointRelax_coreField( void               *relax_vdata,
+                            hypre_StructMatrix *A,
+                            hypre_Box          *compute_box,
+                            HYPRE_Real         *bp,
+                            HYPRE_Real         *xp,
+                            HYPRE_Real         *tp,
+                            HYPRE_Int           boxarray_id,
+                            hypre_Box          *b_data_box,
+                            hypre_Box          *x_data_box,
+                            hypre_Box          *t_data_box,
+                            hypre_IndexRef      stride,
+                            HYPRE_Int           zero_guess )
+{
+   hypre_StructVector    *field   = hypre_StructMatrixCoeffField(A);
+   HYPRE_Real            *weights = hypre_StructMatrixCoeffWeights(A);
+   HYPRE_Int              ndim    = hypre_StructMatrixNDim(A);
+
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+
+   hypre_Box             *k_data_box;
+   HYPRE_Real            *kp;
+   HYPRE_Real             w[2*HYPRE_MAXDIM];
+   HYPRE_Int              xoff[2*HYPRE_MAXDIM];
+   HYPRE_Int              koff[2*HYPRE_MAXDIM];
+   HYPRE_Real             wc;
+   HYPRE_Int              nentries;
+
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   HYPRE_Int              si;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+
+   k_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(field), boxarray_id);
+   kp = hypre_StructVectorBoxData(field, boxarray_id);
+
+   /* off-diagonal entries */
+   nentries = 0;
+   wc = 0.0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      if (hypre_IndexEqual(stencil_shape[si], 0, ndim))
+      {
+         wc = weights[si];
+      }
+      else
+      {
+         w[nentries]    = weights[si];
+         koff[nentries] = hypre_BoxOffsetDistance(k_data_box, stencil_shape[si]);
+         if (!zero_guess)
+         {
+            xoff[nentries] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+         }
+         nentries++;
+      }
+   }
+
+   start  = hypre_BoxIMin(compute_box);
+   hypre_BoxGetStrideSize(compute_box, stride, loop_size);
+
+   if (zero_guess)
+   {
+#define DEVICE_VAR is_device_ptr(tp,bp,kp)
+      hypre_BoxLoop3Begin(ndim, loop_size,
+                          k_data_box, start, stride, ki,
+                          b_data_box, start, stride, bi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Real kc   = kp[ki];
+         HYPRE_Real diag = wc;
+         HYPRE_Int  sk;
+
+         for (sk = 0; sk < nentries; sk++)
+         {
+            diag -= hypre_StructFieldCoeff(w[sk], kc, kp[ki + koff[sk]]);
+         }
+         tp[ti] = bp[bi] / diag;
+      }
+      hypre_BoxLoop3End(ki, bi, ti);
+#undef DEVICE_VAR
+   }
+   else
+   {
+#define DEVICE_VAR is_device_ptr(tp,bp,xp,kp)
+      hypre_BoxLoop4Begin(ndim, loop_size,
+                          k_data_box, start, stride, ki,
+                          b_data_box, start, stride, bi,
+                          x_data_box, start, stride, xi,
+                          t_data_box, start, stride, ti);
+      {
+         HYPRE_Real kc   = kp[ki];
+         HYPRE_Real diag = wc;
+         HYPRE_Real sum  = bp[bi];
+         HYPRE_Real a;
+         HYPRE_Int  sk;
+
+         for (sk = 0; sk < nentries; sk++)
+         {
+            a     = hypre_StructFieldCoeff(w[sk], kc, kp[ki + koff[sk]]);
+            diag -= a;
+            sum  -= a * xp[xi + xoff[sk]];
+         }
+         tp[ti] = sum / diag;
+      }
+      hypre_BoxLoop4End(ki, bi, xi, ti);
+#undef DEVICE_VAR
+   }
+
+   return hypre_error_flag;
+}
+
 /* for constant_coefficient==1 or 2, all offdiagonal coefficients constant over space ...*/
 HYPRE_Int
 hypre_PointRelax_core12( void               *relax_vdata,
@@ -1200,6 +1378,431 @@ hypre_PointRelax_core12( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Temporally blocked Jacobi
+ *
+ * With temporal_blocking = k > 1, up to k Jacobi sweeps are done after a
+ * single exchange of k*e ghost layers of x, where e is the stencil extent.
+ * Sweep s of n is done on the boxes grown by (n-1-s)*e (clipped to the
+ * grid), so the ghost values needed by the next sweep are computed
+ * redundantly instead of communicated.  This needs k*e ghost layers in x
+ * and t, and (k-1)*e valid ghost layers in A and b.
+ *
+ * Within a box, the sweeps proceed as a wavefront along the last dimension:
+ * sweep s works on the plane e*s behind sweep 0, so a plane is updated n
+ * times while it is still in cache.  The sweeps alternate between x and t.
+ *
+ * Only used for one pointset covering all points, with variable
+ * coefficients and no convergence test; the result is the same as with the
+ * regular sweeps.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxBlockedDestroy( void *relax_vdata )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+   HYPRE_Int             k = (relax_data -> temporal_blocking);
+   HYPRE_Int             r;
+
+   if (relax_data -> tb_regions)
+   {
+      for (r = 0; r < k; r++)
+      {
+         hypre_BoxArrayArrayDestroy(relax_data -> tb_regions[r]);
+         hypre_CommPkgDestroy(relax_data -> tb_x_comm_pkgs[r]);
+         if (relax_data -> tb_b_comm_pkgs[r])
+         {
+            hypre_CommPkgDestroy(relax_data -> tb_b_comm_pkgs[r]);
+         }
+      }
+      hypre_TFree(relax_data -> tb_regions, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> tb_x_comm_pkgs, HYPRE_MEMORY_HOST);
+      hypre_TFree(relax_data -> tb_b_comm_pkgs, HYPRE_MEMORY_HOST);
+   }
+   (relax_data -> tb_extent) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxBlockedSetup( void               *relax_vdata,
+                              hypre_StructMatrix *A,
+                              hypre_StructVector *b,
+                              hypre_StructVector *x           )
+{
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Int              k         = (relax_data -> temporal_blocking);
+   hypre_StructVector    *t         = (relax_data -> t);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   hypre_StructGrid      *grid      = hypre_StructMatrixGrid(A);
+   hypre_BoxArray        *boxes     = hypre_StructGridBoxes(grid);
+   hypre_BoxManager      *boxman    = hypre_StructGridBoxMan(grid);
+   hypre_StructStencil   *stencil   = hypre_StructMatrixStencil(A);
+   hypre_Index           *stencil_shape = hypre_StructStencilShape(stencil);
+   HYPRE_Int              stencil_size  = hypre_StructStencilSize(stencil);
+   HYPRE_Int             *x_num_ghost = hypre_StructVectorNumGhost(x);
+   HYPRE_Int             *t_num_ghost = hypre_StructVectorNumGhost(t);
+   HYPRE_Int             *b_num_ghost = hypre_StructVectorNumGhost(b);
+   HYPRE_Int             *A_num_ghost = hypre_StructMatrixNumGhost(A);
+
+   hypre_BoxManEntry    **entries;
+   hypre_CommInfo        *comm_info;
+   hypre_BoxArray        *region;
+   hypre_Box             *grow_box;
+   hypre_Box             *entry_box;
+   hypre_Box             *periodic_box;
+   hypre_IndexRef         pshift;
+   HYPRE_Int              num_ghost[2*HYPRE_MAXDIM];
+   HYPRE_Int              num_entries;
+   HYPRE_Int              e, r, i, j, p, d, si;
+
+   hypre_PointRelaxBlockedDestroy(relax_vdata);
+
+   if (k < 2)
+   {
+      return hypre_error_flag;
+   }
+
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_error_flag;
+#endif
+
+   /* Jacobi on all points with variable coefficients only */
+   if ((relax_data -> num_pointsets) != 1 ||
+       (relax_data -> pointset_sizes[0]) != 1 ||
+       !hypre_IndexEqual((relax_data -> pointset_strides[0]), 1, ndim) ||
+       !hypre_IndexEqual((relax_data -> pointset_indices[0][0]), 0, ndim) ||
+       hypre_StructMatrixConstantCoefficient(A) != 0 ||
+       hypre_StructMatrixCoeffField(A))
+   {
+      return hypre_error_flag;
+   }
+
+   /* stencil extent */
+   e = 0;
+   for (si = 0; si < stencil_size; si++)
+   {
+      for (d = 0; d < ndim; d++)
+      {
+         e = hypre_max(e, hypre_abs(hypre_IndexD(stencil_shape[si], d)));
+      }
+   }
+   if (e == 0)
+   {
+      return hypre_error_flag;
+   }
+
+   /* the ghost layers must be wide enough, and not wrap around a period */
+   for (d = 0; d < 2*ndim; d++)
+   {
+      if (x_num_ghost[d] < k*e || t_num_ghost[d] < k*e ||
+          b_num_ghost[d] < (k-1)*e || A_num_ghost[d] < (k-1)*e ||
+          hypre_IndexD(hypre_StructGridMaxDistance(grid), d/2) < k*e ||
+          (hypre_IndexD(hypre_StructGridPeriodic(grid), d/2) &&
+           hypre_IndexD(hypre_StructGridPeriodic(grid), d/2) < k*e))
+      {
+         return hypre_error_flag;
+      }
+   }
+
+   /*----------------------------------------------------------
+    * Grown boxes, clipped to the grid, for each radius r
+    *----------------------------------------------------------*/
+
+   (relax_data -> tb_regions)     = hypre_CTAlloc(hypre_BoxArrayArray *, k, HYPRE_MEMORY_HOST);
+   (relax_data -> tb_x_comm_pkgs) = hypre_CTAlloc(hypre_CommPkg *, k, HYPRE_MEMORY_HOST);
+   (relax_data -> tb_b_comm_pkgs) = hypre_CTAlloc(hypre_CommPkg *, k, HYPRE_MEMORY_HOST);
+
+   grow_box     = hypre_BoxCreate(ndim);
+   entry_box    = hypre_BoxCreate(ndim);
+   periodic_box = hypre_BoxCreate(ndim);
+   for (r = 0; r < k; r++)
+   {
+      (relax_data -> tb_regions[r]) =
+         hypre_BoxArrayArrayCreate(hypre_BoxArraySize(boxes), ndim);
+
+      hypre_ForBoxI(i, boxes)
+      {
+         region = hypre_BoxArrayArrayBoxArray(relax_data -> tb_regions[r], i);
+
+         hypre_CopyBox(hypre_BoxArrayBox(boxes, i), grow_box);
+         hypre_BoxGrowByValue(grow_box, r*e);
+
+         /* include the periodic images of the grid boxes */
+         for (p = 0; p < hypre_StructGridNumPeriods(grid); p++)
+         {
+            pshift = hypre_StructGridPShift(grid, p);
+            hypre_CopyBox(grow_box, periodic_box);
+            hypre_BoxShiftPos(periodic_box, pshift);
+            hypre_BoxManIntersect(boxman, hypre_BoxIMin(periodic_box),
+                                  hypre_BoxIMax(periodic_box), &entries, &num_entries);
+            for (j = 0; j < num_entries; j++)
+            {
+               hypre_BoxManEntryGetExtents(entries[j], hypre_BoxIMin(entry_box),
+                                           hypre_BoxIMax(entry_box));
+               hypre_BoxShiftNeg(entry_box, pshift);
+               hypre_IntersectBoxes(entry_box, grow_box, entry_box);
+               if (hypre_BoxVolume(entry_box))
+               {
+                  hypre_AppendBox(entry_box, region);
+               }
+            }
+            hypre_TFree(entries, HYPRE_MEMORY_HOST);
+         }
+      }
+   }
+   hypre_BoxDestroy(grow_box);
+   hypre_BoxDestroy(entry_box);
+   hypre_BoxDestroy(periodic_box);
+
+   /*----------------------------------------------------------
+    * Exchanges of n*e layers of x and (n-1)*e layers of b
+    *----------------------------------------------------------*/
+
+   for (r = 0; r < k; r++)
+   {
+      for (d = 0; d < 2*HYPRE_MAXDIM; d++)
+      {
+         num_ghost[d] = (d < 2*ndim) ? (r+1)*e : 0;
+      }
+      hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+      hypre_CommPkgCreate(comm_info, hypre_StructVectorDataSpace(x),
+                          hypre_StructVectorDataSpace(x), 1, NULL, 0,
+                          hypre_StructVectorComm(x), &(relax_data -> tb_x_comm_pkgs[r]));
+      hypre_CommInfoDestroy(comm_info);
+
+      if (r > 0)
+      {
+         for (d = 0; d < 2*ndim; d++)
+         {
+            num_ghost[d] = r*e;
+         }
+         hypre_CreateCommInfoFromNumGhost(grid, num_ghost, &comm_info);
+         hypre_CommPkgCreate(comm_info, hypre_StructVectorDataSpace(b),
+                             hypre_StructVectorDataSpace(b), 1, NULL, 0,
+                             hypre_StructVectorComm(b), &(relax_data -> tb_b_comm_pkgs[r]));
+         hypre_CommInfoDestroy(comm_info);
+      }
+   }
+
+   (relax_data -> tb_extent) = e;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * Does num_sweeps <= temporal_blocking Jacobi sweeps
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxBlocked( void               *relax_vdata,
+                         hypre_StructMatrix *A,
+                         hypre_StructVector *b,
+                         hypre_StructVector *x,
+                         HYPRE_Int           num_sweeps,
+                         HYPRE_Int           zero_guess  )
+{
+   hypre_PointRelaxData  *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   HYPRE_Real             weight    = (relax_data -> weight);
+   HYPRE_Real             weightc   = 1 - weight;
+   hypre_StructVector    *t         = (relax_data -> t);
+   HYPRE_Int              diag_rank = (relax_data -> diag_rank);
+   HYPRE_Int              e         = (relax_data -> tb_extent);
+   HYPRE_Int              ndim      = hypre_StructMatrixNDim(A);
+   HYPRE_Int              nd        = ndim - 1;
+   hypre_BoxArray        *boxes     = hypre_StructGridBoxes(hypre_StructMatrixGrid(A));
+
+   hypre_CommHandle      *x_handle = NULL;
+   hypre_CommHandle      *b_handle = NULL;
+
+   hypre_BoxArray        *region;
+   hypre_Box             *rbox;
+   hypre_Box             *slice;
+   hypre_Box             *A_data_box;
+   hypre_Box             *b_data_box;
+   hypre_Box             *x_data_box;
+   hypre_Box             *t_data_box;
+   hypre_Box             *src_data_box;
+   hypre_Box             *dst_data_box;
+   hypre_IndexRef         start;
+   hypre_Index            loop_size;
+   hypre_Index            stride;
+
+   HYPRE_Real            *Ap, *bp, *xp, *tp, *srcp, *dstp;
+   HYPRE_Int              final_in_t, dst_is_t;
+   HYPRE_Int              plo, phi, w, p, s, i, j;
+
+   /*----------------------------------------------------------
+    * Exchange the ghost layers of x and b
+    *----------------------------------------------------------*/
+
+   if (!zero_guess)
+   {
+      hypre_InitializeCommunication(relax_data -> tb_x_comm_pkgs[num_sweeps-1],
+                                    hypre_StructVectorData(x), hypre_StructVectorData(x),
+                                    0, 0, &x_handle);
+   }
+   if (num_sweeps > 1)
+   {
+      hypre_InitializeCommunication(relax_data -> tb_b_comm_pkgs[num_sweeps-1],
+                                    hypre_StructVectorData(b), hypre_StructVectorData(b),
+                                    0, 0, &b_handle);
+   }
+   if (x_handle)
+   {
+      hypre_FinalizeCommunication(x_handle);
+   }
+   if (b_handle)
+   {
+      hypre_FinalizeCommunication(b_handle);
+   }
+
+   /* the last sweep writes x, unless x is also read by the first sweep,
+      in which case it writes t and each plane is copied to x behind it */
+   final_in_t = (!zero_guess && (num_sweeps % 2));
+
+   hypre_SetIndex(stride, 1);
+   slice = hypre_BoxCreate(ndim);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      b_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(b), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      t_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(t), i);
+
+      Ap = hypre_StructMatrixBoxData(A, i, diag_rank);
+      bp = hypre_StructVectorBoxData(b, i);
+      xp = hypre_StructVectorBoxData(x, i);
+      tp = hypre_StructVectorBoxData(t, i);
+
+      /* range of planes of the first sweep */
+      region = hypre_BoxArrayArrayBoxArray(relax_data -> tb_regions[num_sweeps-1], i);
+      plo = 0;
+      phi = -1;
+      hypre_ForBoxI(j, region)
+      {
+         rbox = hypre_BoxArrayBox(region, j);
+         if (j == 0 || hypre_BoxIMinD(rbox, nd) < plo)
+         {
+            plo = hypre_BoxIMinD(rbox, nd);
+         }
+         if (j == 0 || hypre_BoxIMaxD(rbox, nd) > phi)
+         {
+            phi = hypre_BoxIMaxD(rbox, nd);
+         }
+      }
+
+      for (w = plo; w <= phi + num_sweeps*e; w++)
+      {
+         for (s = 0; s < num_sweeps; s++)
+         {
+            p = w - s*e;
+            region = hypre_BoxArrayArrayBoxArray(relax_data -> tb_regions[num_sweeps-1-s], i);
+
+            dst_is_t = ((num_sweeps-1-s) % 2 == 0) ? final_in_t : !final_in_t;
+            if (dst_is_t)
+            {
+               dstp = tp; dst_data_box = t_data_box;
+               srcp = xp; src_data_box = x_data_box;
+            }
+            else
+            {
+               dstp = xp; dst_data_box = x_data_box;
+               srcp = tp; src_data_box = t_data_box;
+            }
+
+            hypre_ForBoxI(j, region)
+            {
+               rbox = hypre_BoxArrayBox(region, j);
+               if (p < hypre_BoxIMinD(rbox, nd) || p > hypre_BoxIMaxD(rbox, nd))
+               {
+                  continue;
+               }
+               hypre_CopyBox(rbox, slice);
+               hypre_BoxIMinD(slice, nd) = p;
+               hypre_BoxIMaxD(slice, nd) = p;
+               start = hypre_BoxIMin(slice);
+               hypre_BoxGetSize(slice, loop_size);
+
+               if (s == 0 && zero_guess)
+               {
+#define DEVICE_VAR is_device_ptr(dstp,bp,Ap)
+                  hypre_BoxLoop3Begin(ndim, loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      b_data_box, start, stride, bi,
+                                      dst_data_box, start, stride, di);
+                  {
+                     HYPRE_Real val = bp[bi] / Ap[Ai];
+
+                     dstp[di] = (weight != 1.0) ? weight * val : val;
+                  }
+                  hypre_BoxLoop3End(Ai, bi, di);
+#undef DEVICE_VAR
+               }
+               else
+               {
+                  /* dst = b - (A - D) src */
+                  hypre_PointRelax_core0(relax_vdata, A, 0, slice, bp, srcp, dstp, i,
+                                         A_data_box, b_data_box, src_data_box,
+                                         dst_data_box, stride);
+
+#define DEVICE_VAR is_device_ptr(dstp,srcp,Ap)
+                  hypre_BoxLoop3Begin(ndim, loop_size,
+                                      A_data_box, start, stride, Ai,
+                                      src_data_box, start, stride, ri,
+                                      dst_data_box, start, stride, di);
+                  {
+                     HYPRE_Real val = dstp[di] / Ap[Ai];
+
+                     dstp[di] = (weight != 1.0) ? weight * val + weightc * srcp[ri] : val;
+                  }
+                  hypre_BoxLoop3End(Ai, ri, di);
+#undef DEVICE_VAR
+               }
+            }
+         }
+
+         /* last sweep into t: copy the planes to x once they are no
+            longer read */
+         p = w - num_sweeps*e;
+         region = hypre_BoxArrayArrayBoxArray(relax_data -> tb_regions[0], i);
+         hypre_ForBoxI(j, region)
+         {
+            rbox = hypre_BoxArrayBox(region, j);
+            if (!final_in_t || p < hypre_BoxIMinD(rbox, nd) || p > hypre_BoxIMaxD(rbox, nd))
+            {
+               continue;
+            }
+            hypre_CopyBox(rbox, slice);
+            hypre_BoxIMinD(slice, nd) = p;
+            hypre_BoxIMaxD(slice, nd) = p;
+            start = hypre_BoxIMin(slice);
+            hypre_BoxGetSize(slice, loop_size);
+
+#define DEVICE_VAR is_device_ptr(xp,tp)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                x_data_box, start, stride, xi,
+                                t_data_box, start, stride, ti);
+            {
+               xp[xi] = tp[ti];
+            }
+            hypre_BoxLoop2End(xi, ti);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   hypre_BoxDestroy(slice);
+
+   return hypre_error_flag;
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
@@ -1411,6 +2014,23 @@ hypre_PointRelaxSetTempVec( void               *relax_vdata,
    return hypre_error_flag;
 }
 
+/*--------------------------------------------------------------------------
+ * Sets the number of Jacobi sweeps done per exchange of ghost values.  Takes
+ * effect in hypre_PointRelaxSetup.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_PointRelaxSetTemporalBlocking( void      *relax_vdata,
+                                     HYPRE_Int  temporal_blocking )
+{
+   hypre_PointRelaxData *relax_data = (hypre_PointRelaxData *)relax_vdata;
+
+   hypre_PointRelaxBlockedDestroy(relax_vdata);
+   (relax_data -> temporal_blocking) = temporal_blocking;
+
+   return hypre_error_flag;
+}
+
 
 
 /*--------------------------------------------------------------------------
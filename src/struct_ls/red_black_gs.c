@@ -84,6 +84,13 @@ hypre_RedBlackGSSetup( void               *relax_vdata,
    hypre_Index            diag_index;
    hypre_ComputeInfo     *compute_info;
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Red/black relaxation needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Find the matrix diagonal
     *----------------------------------------------------------*/
@@ -165,6 +172,13 @@ hypre_RedBlackGS( void               *relax_vdata,
    HYPRE_Int              compute_i, i, j;
    HYPRE_Int              ni, nj, nk;
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Red/black relaxation needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /*----------------------------------------------------------
     * Initialize some things and deal with special cases
     *----------------------------------------------------------*/
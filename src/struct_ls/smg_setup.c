@@ -89,6 +89,14 @@ hypre_SMGSetup( void               *smg_vdata,
    HYPRE_Int             max_box_size  = 0;
    HYPRE_Int             device_level  = (smg_data -> devicelevel);
 #endif
+
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SMG needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Set up coarsening direction
     *-----------------------------------------------------*/
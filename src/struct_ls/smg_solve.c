@@ -84,6 +84,13 @@ hypre_SMGSolve( void               *smg_vdata,
    char                  filename[255];
 #endif
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SMG needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
+
    /*-----------------------------------------------------
     * Initialize some things and deal with special cases
     *-----------------------------------------------------*/
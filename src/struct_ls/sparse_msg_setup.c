@@ -115,6 +115,12 @@ hypre_SparseMSGSetup( void               *smsg_vdata,
    char                  filename[255];
 #endif
 
+   if (hypre_StructMatrixCoeffField(A))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "SparseMSG needs stored coefficients, not a coefficient field");
+      return hypre_error_flag;
+   }
 
    /*-----------------------------------------------------
     * Set up coarse grids
@@ -378,6 +378,17 @@ HYPRE_Int  HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix  matrix,
    return hypre_StructMatrixSetConstantEntries( matrix, nentries, entries );
 }
 
+/*--------------------------------------------------------------------------
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+HYPRE_StructMatrixSetCoeffField( HYPRE_StructMatrix  matrix,
+                                 HYPRE_StructVector  field,
+                                 HYPRE_Complex      *weights )
+{
+   return hypre_StructMatrixSetCoeffField( matrix, field, weights );
+}
+
 /*--------------------------------------------------------------------------
  *--------------------------------------------------------------------------*/
 
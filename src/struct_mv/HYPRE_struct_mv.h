@@ -345,6 +345,31 @@ HYPRE_Int HYPRE_StructMatrixSetConstantEntries( HYPRE_StructMatrix matrix,
                                                 HYPRE_Int          nentries,
                                                 HYPRE_Int         *entries );
 
+/**
+ * Compute the matrix coefficients on the fly from a cell-centered coefficient
+ * field instead of storing them.  The stencil must consist of the center and
+ * nearest-neighbor entries, and \e weights holds one weight \f$w_s\f$ per
+ * stencil entry.  The coefficient coupling grid point \f$i\f$ to its neighbor
+ * \f$i+s\f$ is \f$w_s\f$ times the harmonic mean of \e field at the two points,
+ * and the diagonal coefficient is \f$w_0\f$ minus the sum of the off-diagonal
+ * coefficients of the row.  Outside of the grid, the field is extended by its
+ * nearest value, and couplings to points outside of the grid are dropped.  For
+ * example, negative weights \f$-1/h_d^2\f$ and \f$w_0 = 0\f$ give the usual
+ * discretization of \f$-\nabla \cdot (k \nabla u)\f$ with Dirichlet boundary
+ * conditions.
+ *
+ * This must be called before HYPRE_StructMatrixInitialize, and the field must
+ * be on the same grid as the matrix.  The matrix keeps a reference to \e field;
+ * HYPRE_StructMatrixAssemble must be called after its values are set or
+ * changed.  The coefficients cannot be set or accessed individually.  Presently
+ * supported by matvecs, the Jacobi solver, PFMG with Jacobi relaxation, and
+ * Krylov solvers using these.  The other struct solvers and preconditioners
+ * return an error when given such a matrix.
+ **/
+HYPRE_Int HYPRE_StructMatrixSetCoeffField(HYPRE_StructMatrix  matrix,
+                                          HYPRE_StructVector  field,
+                                          HYPRE_Complex      *weights);
+
 /**
  * Set the ghost layer in the matrix 
  **/
@@ -1213,6 +1213,16 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* buffers and persistent requests that are reused by the exchanges after
+    * the first one (host buffers only) */
+   HYPRE_Int           busy;         /* an exchange is using them */
+   HYPRE_Complex     **send_buffers;
+   HYPRE_Complex     **recv_buffers;
+   HYPRE_Int           num_requests; /* 0 until the requests are created */
+   hypre_MPI_Request  *requests;
+   hypre_MPI_Status   *status;
+   HYPRE_Int           tag;          /* tag of the persistent requests */
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -1238,6 +1248,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* buffers and requests belong to comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -1329,6 +1342,14 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgBusy(comm_pkg)            (comm_pkg -> busy)
+#define hypre_CommPkgSendBuffers(comm_pkg)     (comm_pkg -> send_buffers)
+#define hypre_CommPkgRecvBuffers(comm_pkg)     (comm_pkg -> recv_buffers)
+#define hypre_CommPkgNumRequests(comm_pkg)     (comm_pkg -> num_requests)
+#define hypre_CommPkgRequests(comm_pkg)        (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)          (comm_pkg -> status)
+#define hypre_CommPkgTag(comm_pkg)             (comm_pkg -> tag)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -1342,6 +1363,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
@@ -1474,6 +1496,12 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   struct hypre_StructVector_struct
+                        *coeff_field;               /* If not NULL, coefficients are
+                                                       computed from this field and
+                                                       not stored */
+   HYPRE_Complex        *coeff_weights;             /* Stencil weights for coeff_field */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -1501,6 +1529,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffField(matrix)          ((matrix) -> coeff_field)
+#define hypre_StructMatrixCoeffWeights(matrix)        ((matrix) -> coeff_weights)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
@@ -1520,6 +1550,15 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/*--------------------------------------------------------------------------
+ * Off-diagonal coefficient of a matrix with a coefficient field: the
+ * stencil weight w times the harmonic mean of the field values ka and kb
+ * at the two points it couples
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructFieldCoeff(w, ka, kb) \
+( ((ka) + (kb)) != 0.0 ? (w) * (2.0 * (ka) * (kb) / ((ka) + (kb))) : 0.0 )
+
 #endif
 /******************************************************************************
  * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
@@ -1749,6 +1788,7 @@ HYPRE_Int HYPRE_StructMatrixSetNumGhost ( HYPRE_StructMatrix matrix , HYPRE_Int
 HYPRE_Int HYPRE_StructMatrixGetGrid ( HYPRE_StructMatrix matrix , HYPRE_StructGrid *grid );
 HYPRE_Int HYPRE_StructMatrixSetSymmetric ( HYPRE_StructMatrix matrix , HYPRE_Int symmetric );
 HYPRE_Int HYPRE_StructMatrixSetConstantEntries ( HYPRE_StructMatrix matrix , HYPRE_Int nentries , HYPRE_Int *entries );
+HYPRE_Int HYPRE_StructMatrixSetCoeffField ( HYPRE_StructMatrix matrix , HYPRE_StructVector field , HYPRE_Complex *weights );
 HYPRE_Int HYPRE_StructMatrixPrint ( const char *filename , HYPRE_StructMatrix matrix , HYPRE_Int all );
 HYPRE_Int HYPRE_StructMatrixMatvec ( HYPRE_Complex alpha , HYPRE_StructMatrix A , HYPRE_StructVector x , HYPRE_Complex beta , HYPRE_StructVector y );
 HYPRE_Int HYPRE_StructMatrixClearBoundary( HYPRE_StructMatrix matrix );
@@ -1821,7 +1861,9 @@ HYPRE_Int hypre_StructGridGetMaxBoxSize(hypre_StructGrid *grid);
 HYPRE_Int hypre_StructGridSetDataLocation( HYPRE_StructGrid grid, HYPRE_Int data_location );
 #endif
 /* struct_innerprod.c */
+HYPRE_Real hypre_StructInnerProdLocal ( hypre_StructVector *x , hypre_StructVector *y );
 HYPRE_Real hypre_StructInnerProd ( hypre_StructVector *x , hypre_StructVector *y );
+HYPRE_Int hypre_StructInnerProdStart ( HYPRE_Int n , hypre_StructVector **x , hypre_StructVector **y , HYPRE_Real *local_result , HYPRE_Real *result , hypre_MPI_Request *request );
 
 /* struct_io.c */
 HYPRE_Int hypre_PrintBoxArrayData ( FILE *file , hypre_BoxArray *box_array , hypre_BoxArray *data_space , HYPRE_Int num_values , HYPRE_Int dim , HYPRE_Complex *data );
@@ -1853,6 +1895,13 @@ HYPRE_Int hypre_StructMatrixMigrate ( hypre_StructMatrix *from_matrix , hypre_St
 hypre_StructMatrix *hypre_StructMatrixRead ( MPI_Comm comm , const char *filename , HYPRE_Int *num_ghost );
 HYPRE_Int hypre_StructMatrixClearBoundary( hypre_StructMatrix *matrix);
 
+/* struct_matrix_field.c */
+HYPRE_Int hypre_StructMatrixSetCoeffField ( hypre_StructMatrix *matrix , hypre_StructVector *field , HYPRE_Complex *weights );
+HYPRE_Int hypre_StructMatrixFieldInitializeShell ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatrixFieldAssemble ( hypre_StructMatrix *matrix );
+hypre_StructMatrix *hypre_StructMatrixFieldCreateStored ( hypre_StructMatrix *matrix );
+HYPRE_Int hypre_StructMatvecField ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+
 /* struct_matrix_mask.c */
 hypre_StructMatrix *hypre_StructMatrixCreateMask ( hypre_StructMatrix *matrix , HYPRE_Int num_stencil_indices , HYPRE_Int *stencil_indices );
 
@@ -1866,6 +1915,12 @@ HYPRE_Int hypre_StructMatvecCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A ,
 HYPRE_Int hypre_StructMatvecDestroy ( void *matvec_vdata );
 HYPRE_Int hypre_StructMatvec ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , HYPRE_Complex beta , hypre_StructVector *y );
 
+/* struct_matvec_fixed.c */
+HYPRE_Int hypre_StructMatvecFixedSize ( hypre_StructMatrix *A );
+HYPRE_Int hypre_StructMatvecFixedCC0 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFixedCC1 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+HYPRE_Int hypre_StructMatvecFixedCC2 ( HYPRE_Complex alpha , hypre_StructMatrix *A , hypre_StructVector *x , hypre_StructVector *y , hypre_BoxArrayArray *compute_box_aa , hypre_IndexRef stride );
+
 /* struct_scale.c */
 HYPRE_Int hypre_StructScale ( HYPRE_Complex alpha , hypre_StructVector *y );
 
@@ -2486,6 +2541,18 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 
 /*--------------------------------------------------------------------------
  * BoxLoop macros:
+ *
+ * A loop is split into blocks that are distributed over the threads.  By
+ * default, a block is a range of rows (all indices but the first), with one
+ * block per thread.  If tile sizes are set in the hypre handle (see
+ * hypre_HandleBoxLoopTile), the loop is split into bricks of at most the tile
+ * size in each dimension instead (a tile size of 0 means no splitting in that
+ * dimension), as long as there are at least as many bricks as threads.  The
+ * bricks are handed out to the threads in a round-robin fashion, or on demand
+ * if hypre_HandleBoxLoopSchedule is set.  Tiling is on as soon as one tile
+ * size is positive.  The loop body sees the same indices either way, but the
+ * points are visited in a different order, and hypre_BoxLoopBlock() returns
+ * the index of the current brick rather than that of the thread.
  *--------------------------------------------------------------------------*/
 
 #ifndef HYPRE_NEWBOXLOOP_HEADER
@@ -2498,9 +2565,11 @@ hypre__J = hypre__thread;  i1 = i2 = 0; \
 #else
 #define Pragma(x) _Pragma(HYPRE_XSTR(x))
 #endif
-#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#define OMP1 Pragma(omp parallel private(HYPRE_BOX_PRIVATE,hypre__block) HYPRE_BOX_REDUCTION)
+#define OMP1_ATOMIC Pragma(omp atomic capture)
 #else
 #define OMP1
+#define OMP1_ATOMIC
 #endif
 
 typedef struct hypre_Boxloop_struct
@@ -2511,24 +2580,160 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int bsize0,bsize1,bsize2;
 } hypre_Boxloop;
 
+#define zypre_BoxLoopTileDeclare() \
+HYPRE_Int  hypre__tiled, hypre__dynamic, hypre__next, hypre__num_tiles;\
+HYPRE_Int  hypre__tsize[HYPRE_MAXDIM], hypre__ntiles[HYPRE_MAXDIM]
+
+/* Declared inside of the parallel region, so private */
+#define zypre_BoxLoopTileDeclareBlock() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM+1], hypre__hi[HYPRE_MAXDIM+1]
+
+#define zypre_BoxLoopTileDeclareK(k) \
+HYPRE_Int  hypre__tinc##k[HYPRE_MAXDIM+1]
+
+/* Call after zypre_BoxLoopInit */
+#define zypre_BoxLoopTileInit() \
+hypre__tiled = 0;\
+hypre__next = 0;\
+hypre__dynamic = hypre_HandleBoxLoopSchedule(hypre_handle());\
+hypre__num_tiles = 0;\
+for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   if (hypre_HandleBoxLoopTile(hypre_handle())[hypre__d] > 0)\
+   {\
+      hypre__num_tiles = 1;\
+   }\
+}\
+if (hypre__num_tiles > 0)\
+{\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__tsize[hypre__d] = hypre_HandleBoxLoopTile(hypre_handle())[hypre__d];\
+      if (hypre__tsize[hypre__d] < 1 || hypre__tsize[hypre__d] > hypre__n[hypre__d])\
+      {\
+         hypre__tsize[hypre__d] = hypre_max(hypre__n[hypre__d], 1);\
+      }\
+      hypre__ntiles[hypre__d] = (hypre_max(hypre__n[hypre__d], 0) +\
+                                 hypre__tsize[hypre__d] - 1) / hypre__tsize[hypre__d];\
+      hypre__num_tiles *= hypre__ntiles[hypre__d];\
+   }\
+   if (hypre__num_tiles > 1 && hypre__num_tiles >= hypre_NumThreads())\
+   {\
+      hypre__tiled = 1;\
+      hypre__num_blocks = hypre__num_tiles;\
+   }\
+}
+
+#define zypre_BoxLoopTileFirst() \
+if (hypre__tiled && hypre__dynamic)\
+{\
+   OMP1_ATOMIC\
+   hypre__block = hypre__next++;\
+}\
+else\
+{\
+   hypre__block = hypre_GetThreadNum();\
+}
+
+#define zypre_BoxLoopTileNext() \
+if (hypre__tiled && hypre__dynamic)\
+{\
+   OMP1_ATOMIC\
+   hypre__block = hypre__next++;\
+}\
+else\
+{\
+   hypre__block += hypre_NumActiveThreads();\
+}
+
+/* Sets the bounds of the block in each dimension, the first row, and the end
+   of the rows (hypre__IN) */
+#define zypre_BoxLoopTileSet() \
+if (hypre__tiled)\
+{\
+   /* brick number, first dimension fastest */\
+   hypre__J  = hypre__block;\
+   hypre__JN = 1;\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__lo[hypre__d] = (hypre__J % hypre__ntiles[hypre__d]) * hypre__tsize[hypre__d];\
+      hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__tsize[hypre__d],\
+                                      hypre__n[hypre__d]);\
+      hypre__i[hypre__d]  = hypre__lo[hypre__d];\
+      hypre__J /= hypre__ntiles[hypre__d];\
+      if (hypre__d > 0)\
+      {\
+         hypre__JN *= hypre__hi[hypre__d] - hypre__lo[hypre__d];\
+      }\
+   }\
+   hypre__IN = hypre__hi[0];\
+}\
+else\
+{\
+   /* range of rows */\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__lo[hypre__d] = 0;\
+      hypre__hi[hypre__d] = hypre__n[hypre__d];\
+   }\
+   zypre_BoxLoopSet();\
+}\
+hypre__lo[hypre__ndim] = 0;\
+hypre__hi[hypre__ndim] = 2;\
+hypre__i[hypre__ndim]  = 0
+
+/* Like zypre_BoxLoopSetK, but the increments depend on the block extents */
+#define zypre_BoxLoopTileSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0]*hypre__sk##k[0];\
+hypre__tinc##k[0] = 0;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
+   hypre__tinc##k[hypre__d] = hypre__tinc##k[hypre__d-1] + hypre__sk##k[hypre__d] -\
+      (hypre__hi[hypre__d-1] - hypre__lo[hypre__d-1])*hypre__sk##k[hypre__d-1];\
+}\
+hypre__tinc##k[hypre__ndim] = 0
+
+#define zypre_BoxLoopTileInc1() \
+hypre__d = 1;\
+while ((hypre__i[hypre__d]+2) > hypre__hi[hypre__d])\
+{\
+   hypre__d++;\
+}
+
+#define zypre_BoxLoopTileInc2() \
+hypre__i[hypre__d]++;\
+while (hypre__d > 1)\
+{\
+   hypre__d--;\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+}
+
 #define zypre_newBoxLoop0Begin(ndim, loop_size)                               \
 {                                                                             \
    zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
-      zypre_BoxLoopSet();                                                     \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
+   {                                                                          \
+      zypre_BoxLoopTileSet();                                                 \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop0End()                                                \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -2538,26 +2743,34 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int i1;                                                              \
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1;                                                           \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop1End(i1)                                              \
             i1 += hypre__i0inc1;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -2570,30 +2783,39 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop2End(i1, i2)                                          \
             i1 += hypre__i0inc1;                                              \
             i2 += hypre__i0inc2;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -2608,21 +2830,29 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2, i3;                                                   \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileDeclareK(3);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
+      zypre_BoxLoopTileSetK(3, i3);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop3End(i1, i2, i3)                                      \
@@ -2630,12 +2860,14 @@ typedef struct hypre_Boxloop_struct
             i2 += hypre__i0inc2;                                              \
             i3 += hypre__i0inc3;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         i3 += hypre__tinc3[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -2651,23 +2883,32 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
    zypre_BoxLoopDeclareK(4);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
    zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2, i3, i4;                                               \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
-      zypre_BoxLoopSetK(4, i4);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileDeclareK(3);                                           \
+      zypre_BoxLoopTileDeclareK(4);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
+      zypre_BoxLoopTileSetK(3, i3);                                           \
+      zypre_BoxLoopTileSetK(4, i4);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop4End(i1, i2, i3, i4)                                  \
@@ -2676,13 +2917,15 @@ typedef struct hypre_Boxloop_struct
             i3 += hypre__i0inc3;                                              \
             i4 += hypre__i0inc4;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         i4 += hypre__ikinc4[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         i3 += hypre__tinc3[hypre__d];                                        \
+         i4 += hypre__tinc4[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -2693,19 +2936,26 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BasicBoxLoopInitK(1, stride1);                                       \
    zypre_BasicBoxLoopInitK(2, stride2);                                       \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 
@@ -13,6 +13,18 @@
 
 /*--------------------------------------------------------------------------
  * BoxLoop macros:
+ *
+ * A loop is split into blocks that are distributed over the threads.  By
+ * default, a block is a range of rows (all indices but the first), with one
+ * block per thread.  If tile sizes are set in the hypre handle (see
+ * hypre_HandleBoxLoopTile), the loop is split into bricks of at most the tile
+ * size in each dimension instead (a tile size of 0 means no splitting in that
+ * dimension), as long as there are at least as many bricks as threads.  The
+ * bricks are handed out to the threads in a round-robin fashion, or on demand
+ * if hypre_HandleBoxLoopSchedule is set.  Tiling is on as soon as one tile
+ * size is positive.  The loop body sees the same indices either way, but the
+ * points are visited in a different order, and hypre_BoxLoopBlock() returns
+ * the index of the current brick rather than that of the thread.
  *--------------------------------------------------------------------------*/
 
 #ifndef HYPRE_NEWBOXLOOP_HEADER
@@ -25,9 +37,11 @@
 #else
 #define Pragma(x) _Pragma(HYPRE_XSTR(x))
 #endif
-#define OMP1 Pragma(omp parallel for private(HYPRE_BOX_PRIVATE) HYPRE_BOX_REDUCTION HYPRE_SMP_SCHEDULE)
+#define OMP1 Pragma(omp parallel private(HYPRE_BOX_PRIVATE,hypre__block) HYPRE_BOX_REDUCTION)
+#define OMP1_ATOMIC Pragma(omp atomic capture)
 #else
 #define OMP1
+#define OMP1_ATOMIC
 #endif
 
 typedef struct hypre_Boxloop_struct
@@ -38,24 +52,160 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int bsize0,bsize1,bsize2;
 } hypre_Boxloop;
 
+#define zypre_BoxLoopTileDeclare() \
+HYPRE_Int  hypre__tiled, hypre__dynamic, hypre__next, hypre__num_tiles;\
+HYPRE_Int  hypre__tsize[HYPRE_MAXDIM], hypre__ntiles[HYPRE_MAXDIM]
+
+/* Declared inside of the parallel region, so private */
+#define zypre_BoxLoopTileDeclareBlock() \
+HYPRE_Int  hypre__lo[HYPRE_MAXDIM+1], hypre__hi[HYPRE_MAXDIM+1]
+
+#define zypre_BoxLoopTileDeclareK(k) \
+HYPRE_Int  hypre__tinc##k[HYPRE_MAXDIM+1]
+
+/* Call after zypre_BoxLoopInit */
+#define zypre_BoxLoopTileInit() \
+hypre__tiled = 0;\
+hypre__next = 0;\
+hypre__dynamic = hypre_HandleBoxLoopSchedule(hypre_handle());\
+hypre__num_tiles = 0;\
+for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   if (hypre_HandleBoxLoopTile(hypre_handle())[hypre__d] > 0)\
+   {\
+      hypre__num_tiles = 1;\
+   }\
+}\
+if (hypre__num_tiles > 0)\
+{\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__tsize[hypre__d] = hypre_HandleBoxLoopTile(hypre_handle())[hypre__d];\
+      if (hypre__tsize[hypre__d] < 1 || hypre__tsize[hypre__d] > hypre__n[hypre__d])\
+      {\
+         hypre__tsize[hypre__d] = hypre_max(hypre__n[hypre__d], 1);\
+      }\
+      hypre__ntiles[hypre__d] = (hypre_max(hypre__n[hypre__d], 0) +\
+                                 hypre__tsize[hypre__d] - 1) / hypre__tsize[hypre__d];\
+      hypre__num_tiles *= hypre__ntiles[hypre__d];\
+   }\
+   if (hypre__num_tiles > 1 && hypre__num_tiles >= hypre_NumThreads())\
+   {\
+      hypre__tiled = 1;\
+      hypre__num_blocks = hypre__num_tiles;\
+   }\
+}
+
+#define zypre_BoxLoopTileFirst() \
+if (hypre__tiled && hypre__dynamic)\
+{\
+   OMP1_ATOMIC\
+   hypre__block = hypre__next++;\
+}\
+else\
+{\
+   hypre__block = hypre_GetThreadNum();\
+}
+
+#define zypre_BoxLoopTileNext() \
+if (hypre__tiled && hypre__dynamic)\
+{\
+   OMP1_ATOMIC\
+   hypre__block = hypre__next++;\
+}\
+else\
+{\
+   hypre__block += hypre_NumActiveThreads();\
+}
+
+/* Sets the bounds of the block in each dimension, the first row, and the end
+   of the rows (hypre__IN) */
+#define zypre_BoxLoopTileSet() \
+if (hypre__tiled)\
+{\
+   /* brick number, first dimension fastest */\
+   hypre__J  = hypre__block;\
+   hypre__JN = 1;\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__lo[hypre__d] = (hypre__J % hypre__ntiles[hypre__d]) * hypre__tsize[hypre__d];\
+      hypre__hi[hypre__d] = hypre_min(hypre__lo[hypre__d] + hypre__tsize[hypre__d],\
+                                      hypre__n[hypre__d]);\
+      hypre__i[hypre__d]  = hypre__lo[hypre__d];\
+      hypre__J /= hypre__ntiles[hypre__d];\
+      if (hypre__d > 0)\
+      {\
+         hypre__JN *= hypre__hi[hypre__d] - hypre__lo[hypre__d];\
+      }\
+   }\
+   hypre__IN = hypre__hi[0];\
+}\
+else\
+{\
+   /* range of rows */\
+   for (hypre__d = 0; hypre__d < hypre__ndim; hypre__d++)\
+   {\
+      hypre__lo[hypre__d] = 0;\
+      hypre__hi[hypre__d] = hypre__n[hypre__d];\
+   }\
+   zypre_BoxLoopSet();\
+}\
+hypre__lo[hypre__ndim] = 0;\
+hypre__hi[hypre__ndim] = 2;\
+hypre__i[hypre__ndim]  = 0
+
+/* Like zypre_BoxLoopSetK, but the increments depend on the block extents */
+#define zypre_BoxLoopTileSetK(k, ik) \
+ik = hypre__ikstart##k + hypre__lo[0]*hypre__sk##k[0];\
+hypre__tinc##k[0] = 0;\
+for (hypre__d = 1; hypre__d < hypre__ndim; hypre__d++)\
+{\
+   ik += hypre__i[hypre__d]*hypre__sk##k[hypre__d];\
+   hypre__tinc##k[hypre__d] = hypre__tinc##k[hypre__d-1] + hypre__sk##k[hypre__d] -\
+      (hypre__hi[hypre__d-1] - hypre__lo[hypre__d-1])*hypre__sk##k[hypre__d-1];\
+}\
+hypre__tinc##k[hypre__ndim] = 0
+
+#define zypre_BoxLoopTileInc1() \
+hypre__d = 1;\
+while ((hypre__i[hypre__d]+2) > hypre__hi[hypre__d])\
+{\
+   hypre__d++;\
+}
+
+#define zypre_BoxLoopTileInc2() \
+hypre__i[hypre__d]++;\
+while (hypre__d > 1)\
+{\
+   hypre__d--;\
+   hypre__i[hypre__d] = hypre__lo[hypre__d];\
+}
+
 #define zypre_newBoxLoop0Begin(ndim, loop_size)                               \
 {                                                                             \
    zypre_BoxLoopDeclare();                                                    \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
    {                                                                          \
-      zypre_BoxLoopSet();                                                     \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
+   {                                                                          \
+      zypre_BoxLoopTileSet();                                                 \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop0End()                                                \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -65,26 +215,34 @@ typedef struct hypre_Boxloop_struct
    HYPRE_Int i1;                                                              \
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1;                                                           \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop1End(i1)                                              \
             i1 += hypre__i0inc1;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -97,30 +255,39 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop2End(i1, i2)                                          \
             i1 += hypre__i0inc1;                                              \
             i2 += hypre__i0inc2;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -135,21 +302,29 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2, i3;                                                   \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileDeclareK(3);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
+      zypre_BoxLoopTileSetK(3, i3);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop3End(i1, i2, i3)                                      \
@@ -157,12 +332,14 @@ typedef struct hypre_Boxloop_struct
             i2 += hypre__i0inc2;                                              \
             i3 += hypre__i0inc3;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         i3 += hypre__tinc3[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -178,23 +355,32 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclareK(2);                                                  \
    zypre_BoxLoopDeclareK(3);                                                  \
    zypre_BoxLoopDeclareK(4);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BoxLoopInitK(1, dbox1, start1, stride1, i1);                         \
    zypre_BoxLoopInitK(2, dbox2, start2, stride2, i2);                         \
    zypre_BoxLoopInitK(3, dbox3, start3, stride3, i3);                         \
    zypre_BoxLoopInitK(4, dbox4, start4, stride4, i4);                         \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2, i3, i4;                                               \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
-      zypre_BoxLoopSetK(3, i3);                                               \
-      zypre_BoxLoopSetK(4, i4);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileDeclareK(3);                                           \
+      zypre_BoxLoopTileDeclareK(4);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
+      zypre_BoxLoopTileSetK(3, i3);                                           \
+      zypre_BoxLoopTileSetK(4, i4);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 #define zypre_newBoxLoop4End(i1, i2, i3, i4)                                  \
@@ -203,13 +389,15 @@ typedef struct hypre_Boxloop_struct
             i3 += hypre__i0inc3;                                              \
             i4 += hypre__i0inc4;                                              \
          }                                                                    \
-         zypre_BoxLoopInc1();                                                 \
-         i1 += hypre__ikinc1[hypre__d];                                       \
-         i2 += hypre__ikinc2[hypre__d];                                       \
-         i3 += hypre__ikinc3[hypre__d];                                       \
-         i4 += hypre__ikinc4[hypre__d];                                       \
-         zypre_BoxLoopInc2();                                                 \
+         zypre_BoxLoopTileInc1();                                             \
+         i1 += hypre__tinc1[hypre__d];                                        \
+         i2 += hypre__tinc2[hypre__d];                                        \
+         i3 += hypre__tinc3[hypre__d];                                        \
+         i4 += hypre__tinc4[hypre__d];                                        \
+         zypre_BoxLoopTileInc2();                                             \
       }                                                                       \
+      zypre_BoxLoopTileNext();                                                \
+   }                                                                          \
    }                                                                          \
 }
 
@@ -220,19 +408,26 @@ typedef struct hypre_Boxloop_struct
    zypre_BoxLoopDeclare();                                                    \
    zypre_BoxLoopDeclareK(1);                                                  \
    zypre_BoxLoopDeclareK(2);                                                  \
+   zypre_BoxLoopTileDeclare();                                                \
    zypre_BoxLoopInit(ndim, loop_size);                                        \
    zypre_BasicBoxLoopInitK(1, stride1);                                       \
    zypre_BasicBoxLoopInitK(2, stride2);                                       \
+   zypre_BoxLoopTileInit();                                                   \
    OMP1                                                                       \
-   for (hypre__block = 0; hypre__block < hypre__num_blocks; hypre__block++)   \
+   {                                                                          \
+   zypre_BoxLoopTileDeclareBlock();                                           \
+   zypre_BoxLoopTileFirst();                                                  \
+   while (hypre__block < hypre__num_blocks)                                   \
    {                                                                          \
       HYPRE_Int i1, i2;                                                       \
-      zypre_BoxLoopSet();                                                     \
-      zypre_BoxLoopSetK(1, i1);                                               \
-      zypre_BoxLoopSetK(2, i2);                                               \
+      zypre_BoxLoopTileDeclareK(1);                                           \
+      zypre_BoxLoopTileDeclareK(2);                                           \
+      zypre_BoxLoopTileSet();                                                 \
+      zypre_BoxLoopTileSetK(1, i1);                                           \
+      zypre_BoxLoopTileSetK(2, i2);                                           \
       for (hypre__J = 0; hypre__J < hypre__JN; hypre__J++)                    \
       {                                                                       \
-         for (hypre__I = 0; hypre__I < hypre__IN; hypre__I++)                 \
+         for (hypre__I = hypre__lo[0]; hypre__I < hypre__IN; hypre__I++)      \
          {
 
 
@@ -808,34 +808,8 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 
    HYPRE_Int            i, j, d, ll;
    HYPRE_Int            size;
+   HYPRE_Int            persistent;
 
-   /*--------------------------------------------------------------------
-    * allocate requests and status
-    *--------------------------------------------------------------------*/
-
-   num_requests = num_sends + num_recvs;
-   requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
-   status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
-
-   /*--------------------------------------------------------------------
-    * allocate buffers
-    *--------------------------------------------------------------------*/
-
-   /* allocate send buffers */
-   send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
-   if (num_sends > 0)
-   {
-      size = hypre_CommPkgSendBufsize(comm_pkg);
-      send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_sends; i++)
-      {
-         comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         send_buffers[i] = send_buffers[i-1] + size;
-      }
-   }
-
-   /* Prepare send buffers: allocate device buffer */
    HYPRE_Int alloc_dev_buffer = 0;
    /* In the case of running on device and cannot access host memory from device */
 #if (defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
@@ -848,6 +822,80 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
 #endif
 #endif
 
+   /*--------------------------------------------------------------------
+    * After the first communication the buffer sizes no longer change, so
+    * the host buffers, requests, and status are kept in comm_pkg and reused
+    * by later exchanges (unless one is already in progress on comm_pkg)
+    *--------------------------------------------------------------------*/
+
+   num_requests = num_sends + num_recvs;
+   persistent = ( !hypre_CommPkgFirstComm(comm_pkg) && !alloc_dev_buffer &&
+                  !hypre_CommPkgBusy(comm_pkg) && (num_requests > 0) );
+
+   if (persistent && (hypre_CommPkgRequests(comm_pkg) != NULL))
+   {
+      requests     = hypre_CommPkgRequests(comm_pkg);
+      status       = hypre_CommPkgStatus(comm_pkg);
+      send_buffers = hypre_CommPkgSendBuffers(comm_pkg);
+      recv_buffers = hypre_CommPkgRecvBuffers(comm_pkg);
+   }
+   else
+   {
+      /*-----------------------------------------------------------------
+       * allocate requests and status
+       *-----------------------------------------------------------------*/
+
+      requests = hypre_CTAlloc(hypre_MPI_Request,  num_requests, HYPRE_MEMORY_HOST);
+      status   = hypre_CTAlloc(hypre_MPI_Status,  num_requests, HYPRE_MEMORY_HOST);
+
+      /*-----------------------------------------------------------------
+       * allocate buffers
+       *-----------------------------------------------------------------*/
+
+      /* allocate send buffers */
+      send_buffers = hypre_TAlloc(HYPRE_Complex *,  num_sends, HYPRE_MEMORY_HOST);
+      if (num_sends > 0)
+      {
+         size = hypre_CommPkgSendBufsize(comm_pkg);
+         send_buffers[0] =  hypre_CTAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            send_buffers[i] = send_buffers[i-1] + size;
+         }
+      }
+
+      /* allocate recv buffers */
+      recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
+      if (num_recvs > 0)
+      {
+         size = hypre_CommPkgRecvBufsize(comm_pkg);
+         recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
+         for (i = 1; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
+            size = hypre_CommTypeBufsize(comm_type);
+            recv_buffers[i] = recv_buffers[i-1] + size;
+         }
+      }
+
+      if (persistent)
+      {
+         hypre_CommPkgRequests(comm_pkg)    = requests;
+         hypre_CommPkgStatus(comm_pkg)      = status;
+         hypre_CommPkgSendBuffers(comm_pkg) = send_buffers;
+         hypre_CommPkgRecvBuffers(comm_pkg) = recv_buffers;
+      }
+   }
+
+   if (persistent)
+   {
+      hypre_CommPkgBusy(comm_pkg) = 1;
+   }
+
+   /* Prepare send buffers: allocate device buffer */
+
 #if (defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
    if (alloc_dev_buffer)
    {
@@ -877,20 +925,6 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
       send_buffers_data = send_buffers;
    }
 
-   /* allocate recv buffers */
-   recv_buffers = hypre_TAlloc(HYPRE_Complex *,  num_recvs, HYPRE_MEMORY_HOST);
-   if (num_recvs > 0)
-   {
-      size = hypre_CommPkgRecvBufsize(comm_pkg);
-      recv_buffers[0] =  hypre_TAlloc(HYPRE_Complex,  size, HYPRE_MEMORY_HOST);
-      for (i = 1; i < num_recvs; i++)
-      {
-         comm_type = hypre_CommPkgRecvType(comm_pkg, i-1);
-         size = hypre_CommTypeBufsize(comm_type);
-         recv_buffers[i] = recv_buffers[i-1] + size;
-      }
-   }
-
    /* Prepare recv buffers */
 #if (defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP))
    if (alloc_dev_buffer)
@@ -1022,34 +1056,72 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
     * post receives and initiate sends
     *--------------------------------------------------------------------*/
 
-   j = 0;
-   for(i = 0; i < num_recvs; i++)
+   if (persistent)
    {
-      comm_type = hypre_CommPkgRecvType(comm_pkg, i);
-      hypre_MPI_Irecv(recv_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      /* create the persistent requests once (again if the tag changes) */
+      if ( (hypre_CommPkgNumRequests(comm_pkg) == 0) ||
+           (hypre_CommPkgTag(comm_pkg) != tag) )
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         for (j = 0; j < hypre_CommPkgNumRequests(comm_pkg); j++)
+         {
+            hypre_MPI_Request_free(&requests[j]);
+         }
+
+         j = 0;
+         for(i = 0; i < num_recvs; i++)
+         {
+            comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+            hypre_MPI_Recv_init(recv_buffers[i],
+                                hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                                hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                                tag, comm, &requests[j++]);
+         }
+         for(i = 0; i < num_sends; i++)
+         {
+            comm_type = hypre_CommPkgSendType(comm_pkg, i);
+            hypre_MPI_Send_init(send_buffers[i],
+                                hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                                hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                                tag, comm, &requests[j++]);
+         }
+
+         hypre_CommPkgNumRequests(comm_pkg) = num_requests;
+         hypre_CommPkgTag(comm_pkg)         = tag;
       }
-   }
 
-   for(i = 0; i < num_sends; i++)
+      hypre_MPI_Startall(num_requests, requests);
+   }
+   else
    {
-      comm_type = hypre_CommPkgSendType(comm_pkg, i);
-      hypre_MPI_Isend(send_buffers[i],
-                      hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
-                      hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
-                      tag, comm, &requests[j++]);
-      if ( hypre_CommPkgFirstComm(comm_pkg) )
+      j = 0;
+      for(i = 0; i < num_recvs; i++)
       {
-         size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
-         hypre_CommTypeBufsize(comm_type)   -= size;
-         hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         comm_type = hypre_CommPkgRecvType(comm_pkg, i);
+         hypre_MPI_Irecv(recv_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgRecvBufsize(comm_pkg) -= size;
+         }
+      }
+
+      for(i = 0; i < num_sends; i++)
+      {
+         comm_type = hypre_CommPkgSendType(comm_pkg, i);
+         hypre_MPI_Isend(send_buffers[i],
+                         hypre_CommTypeBufsize(comm_type)*sizeof(HYPRE_Complex),
+                         hypre_MPI_BYTE, hypre_CommTypeProc(comm_type),
+                         tag, comm, &requests[j++]);
+         if ( hypre_CommPkgFirstComm(comm_pkg) )
+         {
+            size = hypre_CommPrefixSize(hypre_CommTypeNumEntries(comm_type));
+            hypre_CommTypeBufsize(comm_type)   -= size;
+            hypre_CommPkgSendBufsize(comm_pkg) -= size;
+         }
       }
    }
 
@@ -1095,6 +1167,7 @@ hypre_InitializeCommunication( hypre_CommPkg     *comm_pkg,
    hypre_CommHandleSendBuffers(comm_handle) = send_buffers;
    hypre_CommHandleRecvBuffers(comm_handle) = recv_buffers;
    hypre_CommHandleAction(comm_handle)      = action;
+   hypre_CommHandlePersistent(comm_handle)  = persistent;
    hypre_CommHandleSendBuffersDevice(comm_handle) = send_buffers_data;
    hypre_CommHandleRecvBuffersDevice(comm_handle) = recv_buffers_data;
 
@@ -1298,9 +1371,18 @@ hypre_FinalizeCommunication( hypre_CommHandle *comm_handle )
    hypre_CommPkgFirstComm(comm_pkg) = 0;
 
    /*--------------------------------------------------------------------
-    * Free up communication handle
+    * Free up communication handle (buffers and requests stay in comm_pkg
+    * if they are persistent)
     *--------------------------------------------------------------------*/
 
+   if (hypre_CommHandlePersistent(comm_handle))
+   {
+      hypre_CommPkgBusy(comm_pkg) = 0;
+      hypre_TFree(comm_handle, HYPRE_MEMORY_HOST);
+
+      return hypre_error_flag;
+   }
+
    hypre_TFree(hypre_CommHandleRequests(comm_handle), HYPRE_MEMORY_HOST);
    hypre_TFree(hypre_CommHandleStatus(comm_handle), HYPRE_MEMORY_HOST);
    if (num_sends > 0)
@@ -1462,6 +1544,30 @@ hypre_CommPkgDestroy( hypre_CommPkg *comm_pkg )
 
       hypre_TFree(hypre_CommPkgIdentityOrder(comm_pkg), HYPRE_MEMORY_HOST);
 
+      /* persistent buffers and requests */
+      for (i = 0; i < hypre_CommPkgNumRequests(comm_pkg); i++)
+      {
+         hypre_MPI_Request_free(&hypre_CommPkgRequests(comm_pkg)[i]);
+      }
+      hypre_TFree(hypre_CommPkgRequests(comm_pkg), HYPRE_MEMORY_HOST);
+      hypre_TFree(hypre_CommPkgStatus(comm_pkg), HYPRE_MEMORY_HOST);
+      if (hypre_CommPkgSendBuffers(comm_pkg) != NULL)
+      {
+         if (hypre_CommPkgNumSends(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgSendBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgSendBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+      if (hypre_CommPkgRecvBuffers(comm_pkg) != NULL)
+      {
+         if (hypre_CommPkgNumRecvs(comm_pkg) > 0)
+         {
+            hypre_TFree(hypre_CommPkgRecvBuffers(comm_pkg)[0], HYPRE_MEMORY_HOST);
+         }
+         hypre_TFree(hypre_CommPkgRecvBuffers(comm_pkg), HYPRE_MEMORY_HOST);
+      }
+
       hypre_TFree(comm_pkg, HYPRE_MEMORY_HOST);
    }
 
@@ -113,6 +113,16 @@ typedef struct hypre_CommPkg_struct
    hypre_Index       identity_dir;
    HYPRE_Int        *identity_order;
 
+   /* buffers and persistent requests that are reused by the exchanges after
+    * the first one (host buffers only) */
+   HYPRE_Int           busy;         /* an exchange is using them */
+   HYPRE_Complex     **send_buffers;
+   HYPRE_Complex     **recv_buffers;
+   HYPRE_Int           num_requests; /* 0 until the requests are created */
+   hypre_MPI_Request  *requests;
+   hypre_MPI_Status   *status;
+   HYPRE_Int           tag;          /* tag of the persistent requests */
+
 } hypre_CommPkg;
 
 /*--------------------------------------------------------------------------
@@ -138,6 +148,9 @@ typedef struct hypre_CommHandle_struct
    /* set = 0, add = 1 */
    HYPRE_Int       action;
 
+   /* buffers and requests belong to comm_pkg */
+   HYPRE_Int       persistent;
+
 } hypre_CommHandle;
 
 /*--------------------------------------------------------------------------
@@ -229,6 +242,14 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommPkgIdentityDir(comm_pkg)     (comm_pkg -> identity_dir)
 #define hypre_CommPkgIdentityOrder(comm_pkg)   (comm_pkg -> identity_order)
 
+#define hypre_CommPkgBusy(comm_pkg)            (comm_pkg -> busy)
+#define hypre_CommPkgSendBuffers(comm_pkg)     (comm_pkg -> send_buffers)
+#define hypre_CommPkgRecvBuffers(comm_pkg)     (comm_pkg -> recv_buffers)
+#define hypre_CommPkgNumRequests(comm_pkg)     (comm_pkg -> num_requests)
+#define hypre_CommPkgRequests(comm_pkg)        (comm_pkg -> requests)
+#define hypre_CommPkgStatus(comm_pkg)          (comm_pkg -> status)
+#define hypre_CommPkgTag(comm_pkg)             (comm_pkg -> tag)
+
 /*--------------------------------------------------------------------------
  * Accessor macros: hypre_CommHandle
  *--------------------------------------------------------------------------*/
@@ -242,6 +263,7 @@ typedef struct hypre_CommHandle_struct
 #define hypre_CommHandleSendBuffers(comm_handle) (comm_handle -> send_buffers)
 #define hypre_CommHandleRecvBuffers(comm_handle) (comm_handle -> recv_buffers)
 #define hypre_CommHandleAction(comm_handle)      (comm_handle -> action)
+#define hypre_CommHandlePersistent(comm_handle)  (comm_handle -> persistent)
 #define hypre_CommHandleSendBuffersDevice(comm_handle)    (comm_handle -> send_buffers_data)
 #define hypre_CommHandleRecvBuffersDevice(comm_handle)    (comm_handle -> recv_buffers_data)
 
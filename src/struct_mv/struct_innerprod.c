@@ -15,16 +15,15 @@
 #include "_hypre_struct_mv.hpp"
 
 /*--------------------------------------------------------------------------
- * hypre_StructInnerProd
+ * hypre_StructInnerProdLocal
+ *
+ * Returns the contribution of the local boxes to <x,y>.
  *--------------------------------------------------------------------------*/
 
 HYPRE_Real
-hypre_StructInnerProd( hypre_StructVector *x,
-                       hypre_StructVector *y )
+hypre_StructInnerProdLocal( hypre_StructVector *x,
+                            hypre_StructVector *y )
 {
-   HYPRE_Real       final_innerprod_result;
-   HYPRE_Real       process_result;
-
    hypre_Box       *x_data_box;
    hypre_Box       *y_data_box;
 
@@ -96,7 +95,21 @@ hypre_StructInnerProd( hypre_StructVector *x,
       local_result += (HYPRE_Real) box_sum;
    }
 
-   process_result = (HYPRE_Real) local_result;
+   return local_result;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProd
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Real
+hypre_StructInnerProd( hypre_StructVector *x,
+                       hypre_StructVector *y )
+{
+   HYPRE_Real       final_innerprod_result;
+   HYPRE_Real       process_result;
+
+   process_result = hypre_StructInnerProdLocal(x, y);
 
    hypre_MPI_Allreduce(&process_result, &final_innerprod_result, 1,
                        HYPRE_MPI_REAL, hypre_MPI_SUM, hypre_StructVectorComm(x));
@@ -105,3 +118,34 @@ hypre_StructInnerProd( hypre_StructVector *x,
 
    return final_innerprod_result;
 }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructInnerProdStart
+ *
+ * Starts the n inner products result[k] = <x[k],y[k]> as a single
+ * non-blocking reduction.  The local sums are left in local_result, which
+ * must stay valid until the request has completed (hypre_MPI_Wait).
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructInnerProdStart( HYPRE_Int            n,
+                            hypre_StructVector **x,
+                            hypre_StructVector **y,
+                            HYPRE_Real          *local_result,
+                            HYPRE_Real          *result,
+                            hypre_MPI_Request   *request )
+{
+   HYPRE_Int  k;
+
+   for (k = 0; k < n; k++)
+   {
+      local_result[k] = hypre_StructInnerProdLocal(x[k], y[k]);
+   }
+
+   hypre_MPI_Iallreduce(local_result, result, n, HYPRE_MPI_REAL,
+                        hypre_MPI_SUM, hypre_StructVectorComm(x[0]), request);
+
+   hypre_IncFLOPCount(2*n*hypre_StructVectorGlobalSize(x[0]));
+
+   return hypre_error_flag;
+}
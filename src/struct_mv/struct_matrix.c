@@ -115,6 +115,8 @@ hypre_StructMatrixDestroy( hypre_StructMatrix *matrix )
          hypre_StructStencilDestroy(hypre_StructMatrixUserStencil(matrix));
          hypre_StructStencilDestroy(hypre_StructMatrixStencil(matrix));
          hypre_StructGridDestroy(hypre_StructMatrixGrid(matrix));
+         hypre_StructVectorDestroy(hypre_StructMatrixCoeffField(matrix));
+         hypre_TFree(hypre_StructMatrixCoeffWeights(matrix), HYPRE_MEMORY_HOST);
          hypre_TFree(matrix, HYPRE_MEMORY_HOST);
       }
    }
@@ -429,6 +431,15 @@ hypre_StructMatrixInitializeShell( hypre_StructMatrix *matrix )
 
    hypre_StructMatrixGlobalSize(matrix) = hypre_StructGridGlobalSize(grid) * stencil_size;
 
+   /*-----------------------------------------------------------------------
+    * No coefficients are stored if they come from a coefficient field
+    *-----------------------------------------------------------------------*/
+
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      hypre_StructMatrixFieldInitializeShell(matrix);
+   }
+
    /*-----------------------------------------------------------------------
     * Return
     *-----------------------------------------------------------------------*/
@@ -578,6 +589,13 @@ hypre_StructMatrixSetValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficients computed from a coefficient field cannot be accessed");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -731,6 +749,13 @@ hypre_StructMatrixSetBoxValues( hypre_StructMatrix *matrix,
     * Initialize some things
     *-----------------------------------------------------------------------*/
 
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficients computed from a coefficient field cannot be accessed");
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
    symm_elements        = hypre_StructMatrixSymmElements(matrix);
 
@@ -917,6 +942,13 @@ hypre_StructMatrixSetConstantValues( hypre_StructMatrix *matrix,
 
    HYPRE_Int           i, s;
 
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficients computed from a coefficient field cannot be accessed");
+      return hypre_error_flag;
+   }
+
    boxes = hypre_StructGridBoxes(hypre_StructMatrixGrid(matrix));
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
@@ -1265,6 +1297,11 @@ hypre_StructMatrixAssemble( hypre_StructMatrix *matrix )
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient( matrix );
 
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      return hypre_StructMatrixFieldAssemble(matrix);
+   }
+
    /*-----------------------------------------------------------------------
     * Set ghost zones along the domain boundary to the identity to enable code
     * simplifications elsewhere in hypre (e.g., CyclicReduction).
@@ -1641,6 +1678,18 @@ hypre_StructMatrixPrint( const char         *filename,
    HYPRE_Int             center_rank;
    HYPRE_Int             myid;
 
+   hypre_StructMatrix   *stored;
+
+   /* print the coefficients computed from a coefficient field */
+   if (hypre_StructMatrixCoeffField(matrix))
+   {
+      stored = hypre_StructMatrixFieldCreateStored(matrix);
+      hypre_StructMatrixPrint(filename, stored, all);
+      hypre_StructMatrixDestroy(stored);
+
+      return hypre_error_flag;
+   }
+
    constant_coefficient = hypre_StructMatrixConstantCoefficient(matrix);
 
    /*----------------------------------------
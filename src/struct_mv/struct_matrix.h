@@ -53,6 +53,12 @@ typedef struct hypre_StructMatrix_struct
 
    hypre_CommPkg        *comm_pkg;                  /* Info on how to update ghost data */
 
+   struct hypre_StructVector_struct
+                        *coeff_field;               /* If not NULL, coefficients are
+                                                       computed from this field and
+                                                       not stored */
+   HYPRE_Complex        *coeff_weights;             /* Stencil weights for coeff_field */
+
    HYPRE_Int             ref_count;
 
 } hypre_StructMatrix;
@@ -80,6 +86,8 @@ typedef struct hypre_StructMatrix_struct
 #define hypre_StructMatrixNumGhost(matrix)            ((matrix) -> num_ghost)
 #define hypre_StructMatrixGlobalSize(matrix)          ((matrix) -> global_size)
 #define hypre_StructMatrixCommPkg(matrix)             ((matrix) -> comm_pkg)
+#define hypre_StructMatrixCoeffField(matrix)          ((matrix) -> coeff_field)
+#define hypre_StructMatrixCoeffWeights(matrix)        ((matrix) -> coeff_weights)
 #define hypre_StructMatrixRefCount(matrix)            ((matrix) -> ref_count)
 
 #define hypre_StructMatrixNDim(matrix) \
@@ -99,4 +107,13 @@ hypre_BoxArrayBox(hypre_StructMatrixDataSpace(matrix), b)
 (hypre_StructMatrixBoxData(matrix, b, s) + \
  hypre_CCBoxIndexRank(hypre_StructMatrixBox(matrix, b), index))
 
+/*--------------------------------------------------------------------------
+ * Off-diagonal coefficient of a matrix with a coefficient field: the
+ * stencil weight w times the harmonic mean of the field values ka and kb
+ * at the two points it couples
+ *--------------------------------------------------------------------------*/
+
+#define hypre_StructFieldCoeff(w, ka, kb) \
+( ((ka) + (kb)) != 0.0 ? (w) * (2.0 * (ka) * (kb) / ((ka) + (kb))) : 0.0 )
+
 #endif
@@ -0,0 +1,530 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Structured matrices with coefficients computed from a coefficient field
+ *
+ * Instead of storing a value for each stencil entry at each grid point, the
+ * matrix stores one constant weight w_s per stencil entry and references a
+ * cell-centered coefficient field k (for example, a diffusivity).  The
+ * stencil must consist of the center and nearest-neighbor entries.  The
+ * off-diagonal coefficient coupling the points i and i+s is
+ *
+ *    a_s(i) = w_s * 2 k(i) k(i+s) / (k(i) + k(i+s)),
+ *
+ * and the diagonal coefficient is a_0(i) = w_0 - sum_{s != 0} a_s(i).
+ * Outside of the grid, k is extended by its value at the nearest grid point,
+ * and the couplings to points outside of the grid are dropped after they
+ * have been added to the diagonal.  For w_s = -c_s and w_0 = 0, this is the
+ * usual finite volume discretization of -div(k grad u) with Dirichlet
+ * boundary conditions.
+ *
+ * The coefficients are computed on the fly in the matvec and in PointRelax.
+ * hypre_StructMatrixFieldCreateStored returns a regular copy of the matrix
+ * for code that needs stored coefficients, e.g., to set up a coarse grid
+ * operator.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+#include "_hypre_struct_mv.hpp"
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixSetCoeffField
+ *
+ * Must be called before the matrix is initialized.  The field must live on
+ * the grid of the matrix and have at least one ghost layer.  The weights are
+ * given in the order of the entries of the user stencil; with symmetric
+ * storage, the weights of the transposed entries are ignored.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixSetCoeffField( hypre_StructMatrix *matrix,
+                                 hypre_StructVector *field,
+                                 HYPRE_Complex      *weights )
+{
+   HYPRE_Int             ndim         = hypre_StructMatrixNDim(matrix);
+   hypre_StructStencil  *user_stencil = hypre_StructMatrixUserStencil(matrix);
+   hypre_Index          *shape        = hypre_StructStencilShape(user_stencil);
+   HYPRE_Int             size         = hypre_StructStencilSize(user_stencil);
+   HYPRE_Int            *num_ghost    = hypre_StructVectorNumGhost(field);
+
+   HYPRE_Int             s, d, dist, has_center;
+
+   has_center = 0;
+   for (s = 0; s < size; s++)
+   {
+      dist = 0;
+      for (d = 0; d < ndim; d++)
+      {
+         dist += hypre_abs(hypre_IndexD(shape[s], d));
+      }
+      if (dist > 1)
+      {
+         hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                           "Coefficient fields need a nearest-neighbor stencil");
+         return hypre_error_flag;
+      }
+      if (dist == 0)
+      {
+         has_center = 1;
+      }
+   }
+   if (!has_center)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficient fields need a stencil with a center entry");
+      return hypre_error_flag;
+   }
+   if (hypre_StructMatrixConstantCoefficient(matrix))
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC,
+                        "Coefficient fields and constant entries cannot be combined");
+      return hypre_error_flag;
+   }
+   if (hypre_StructGridNumBoxes(hypre_StructVectorGrid(field)) !=
+       hypre_StructGridNumBoxes(hypre_StructMatrixGrid(matrix)))
+   {
+      hypre_error_in_arg(2);
+      return hypre_error_flag;
+   }
+   for (d = 0; d < 2*ndim; d++)
+   {
+      if (num_ghost[d] < 1)
+      {
+         hypre_error_in_arg(2);
+         return hypre_error_flag;
+      }
+   }
+
+   hypre_StructVectorDestroy(hypre_StructMatrixCoeffField(matrix));
+   hypre_TFree(hypre_StructMatrixCoeffWeights(matrix), HYPRE_MEMORY_HOST);
+
+   /* room for the weights of the symmetrized stencil */
+   hypre_StructMatrixCoeffField(matrix)   = hypre_StructVectorRef(field);
+   hypre_StructMatrixCoeffWeights(matrix) = hypre_CTAlloc(HYPRE_Complex, 2*size,
+                                                          HYPRE_MEMORY_HOST);
+   for (s = 0; s < size; s++)
+   {
+      hypre_StructMatrixCoeffWeights(matrix)[s] = weights[s];
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixFieldInitializeShell
+ *
+ * Called at the end of hypre_StructMatrixInitializeShell: extends the
+ * weights to the (possibly symmetrized) stencil and drops the storage for
+ * the coefficients.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixFieldInitializeShell( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int      *symm_elements = hypre_StructMatrixSymmElements(matrix);
+   HYPRE_Int       stencil_size  = hypre_StructStencilSize(hypre_StructMatrixStencil(matrix));
+   HYPRE_Complex  *weights       = hypre_StructMatrixCoeffWeights(matrix);
+   HYPRE_Int       s;
+
+   for (s = 0; s < stencil_size; s++)
+   {
+      if (symm_elements[s] >= 0)
+      {
+         weights[s] = weights[symm_elements[s]];
+      }
+   }
+
+   hypre_StructMatrixDataSize(matrix)      = 0;
+   hypre_StructMatrixDataConstSize(matrix) = 0;
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixFieldAssemble
+ *
+ * Called by hypre_StructMatrixAssemble in place of the exchange of the
+ * coefficients: fills the ghost layer of the coefficient field, by
+ * extension along the domain boundary and by communication elsewhere.  Must
+ * be called again whenever the values of the field change.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatrixFieldAssemble( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int              ndim    = hypre_StructMatrixNDim(matrix);
+   hypre_StructGrid      *grid    = hypre_StructMatrixGrid(matrix);
+   hypre_StructStencil   *stencil = hypre_StructMatrixStencil(matrix);
+   hypre_StructVector    *field   = hypre_StructMatrixCoeffField(matrix);
+
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   hypre_BoxArray        *boxes;
+   hypre_BoxArray        *boundary;
+   hypre_Box             *k_data_box;
+   hypre_Box             *bbox;
+   HYPRE_Complex         *kp;
+   HYPRE_Int              koff;
+   hypre_Index            loop_size;
+   hypre_IndexRef         start;
+   hypre_Index            stride;
+
+   hypre_CommInfo        *comm_info;
+   hypre_CommPkg         *comm_pkg;
+   hypre_CommHandle      *comm_handle;
+
+   HYPRE_Int              i, j, si;
+
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   boxes         = hypre_StructGridBoxes(grid);
+   hypre_SetIndex(stride, 1);
+
+   /*-----------------------------------------------------------------------
+    * Copy the field values next to the domain boundary into the ghost layer
+    *-----------------------------------------------------------------------*/
+
+   hypre_ForBoxI(i, boxes)
+   {
+      k_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(field), i);
+      kp = hypre_StructVectorBoxData(field, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (hypre_IndexEqual(stencil_shape[si], 0, ndim))
+         {
+            continue;
+         }
+
+         boundary = hypre_BoxArrayCreate(0, ndim);
+         hypre_GeneralBoxBoundaryIntersect(hypre_BoxArrayBox(boxes, i), grid,
+                                           stencil_shape[si], boundary);
+         koff = hypre_BoxOffsetDistance(k_data_box, stencil_shape[si]);
+
+         hypre_ForBoxI(j, boundary)
+         {
+            bbox  = hypre_BoxArrayBox(boundary, j);
+            start = hypre_BoxIMin(bbox);
+            hypre_BoxGetSize(bbox, loop_size);
+
+#define DEVICE_VAR is_device_ptr(kp)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                k_data_box, start, stride, ki);
+            {
+               kp[ki + koff] = kp[ki];
+            }
+            hypre_BoxLoop1End(ki);
+#undef DEVICE_VAR
+         }
+         hypre_BoxArrayDestroy(boundary);
+      }
+   }
+
+   /* the boundary ghost values are no longer zero */
+   hypre_StructVectorBGhostNotClear(field) = 1;
+
+   /*-----------------------------------------------------------------------
+    * Get the field values from neighboring boxes
+    *-----------------------------------------------------------------------*/
+
+   hypre_CreateCommInfoFromStencil(grid, stencil, &comm_info);
+   hypre_CommPkgCreate(comm_info,
+                       hypre_StructVectorDataSpace(field),
+                       hypre_StructVectorDataSpace(field),
+                       1, NULL, 0, hypre_StructMatrixComm(matrix), &comm_pkg);
+   hypre_CommInfoDestroy(comm_info);
+
+   hypre_InitializeCommunication(comm_pkg,
+                                 hypre_StructVectorData(field),
+                                 hypre_StructVectorData(field), 0, 0,
+                                 &comm_handle);
+   hypre_FinalizeCommunication(comm_handle);
+   hypre_CommPkgDestroy(comm_pkg);
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatrixFieldCreateStored
+ *
+ * Returns a new, assembled matrix with the same grid, stencil and symmetry
+ * as matrix, whose coefficients are stored.
+ *--------------------------------------------------------------------------*/
+
+hypre_StructMatrix *
+hypre_StructMatrixFieldCreateStored( hypre_StructMatrix *matrix )
+{
+   HYPRE_Int              ndim    = hypre_StructMatrixNDim(matrix);
+   hypre_StructGrid      *grid    = hypre_StructMatrixGrid(matrix);
+   hypre_StructVector    *field   = hypre_StructMatrixCoeffField(matrix);
+   HYPRE_Complex         *weights = hypre_StructMatrixCoeffWeights(matrix);
+
+   hypre_StructMatrix    *stored;
+   hypre_StructStencil   *stencil;
+   hypre_Index           *stencil_shape;
+   HYPRE_Int              stencil_size;
+   HYPRE_Int             *symm_elements;
+   HYPRE_Int              center_rank;
+   hypre_Index            center_index;
+
+   hypre_BoxArray        *boxes;
+   hypre_Box             *box;
+   hypre_Box             *A_data_box;
+   hypre_Box             *k_data_box;
+   HYPRE_Complex         *Ap, *Adp, *kp;
+   HYPRE_Complex          w, wc;
+   HYPRE_Int              koff;
+   hypre_BoxArray        *boundary;
+   hypre_Box             *bbox;
+   hypre_Index            loop_size;
+   hypre_IndexRef         start;
+   hypre_Index            stride;
+
+   HYPRE_Int              i, j, d, si;
+
+   stored = hypre_StructMatrixCreate(hypre_StructMatrixComm(matrix), grid,
+                                     hypre_StructMatrixUserStencil(matrix));
+   hypre_StructMatrixSymmetric(stored) = hypre_StructMatrixSymmetric(matrix);
+   hypre_StructMatrixInitialize(stored);
+
+   stencil       = hypre_StructMatrixStencil(stored);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   symm_elements = hypre_StructMatrixSymmElements(stored);
+
+   hypre_SetIndex(center_index, 0);
+   center_rank = hypre_StructStencilElementRank(stencil, center_index);
+   wc = weights[center_rank];
+
+   boxes = hypre_StructGridBoxes(grid);
+   hypre_SetIndex(stride, 1);
+
+   hypre_ForBoxI(i, boxes)
+   {
+      box        = hypre_BoxArrayBox(boxes, i);
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(stored), i);
+      k_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(field), i);
+      kp  = hypre_StructVectorBoxData(field, i);
+      Adp = hypre_StructMatrixBoxData(stored, i, center_rank);
+
+      start = hypre_BoxIMin(box);
+      hypre_BoxGetSize(box, loop_size);
+
+#define DEVICE_VAR is_device_ptr(Adp)
+      hypre_BoxLoop1Begin(ndim, loop_size,
+                          A_data_box, start, stride, Ai);
+      {
+         Adp[Ai] = wc;
+      }
+      hypre_BoxLoop1End(Ai);
+#undef DEVICE_VAR
+
+      /* the diagonal gets all of the couplings, stored or not */
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (si == center_rank)
+         {
+            continue;
+         }
+
+         w    = weights[si];
+         koff = hypre_BoxOffsetDistance(k_data_box, stencil_shape[si]);
+         if (symm_elements[si] < 0)
+         {
+            Ap = hypre_StructMatrixBoxData(stored, i, si);
+#define DEVICE_VAR is_device_ptr(Ap,Adp,kp)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                k_data_box, start, stride, ki);
+            {
+               HYPRE_Complex a = hypre_StructFieldCoeff(w, kp[ki], kp[ki + koff]);
+
+               Ap[Ai]   = a;
+               Adp[Ai] -= a;
+            }
+            hypre_BoxLoop2End(Ai, ki);
+#undef DEVICE_VAR
+         }
+         else
+         {
+#define DEVICE_VAR is_device_ptr(Adp,kp)
+            hypre_BoxLoop2Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai,
+                                k_data_box, start, stride, ki);
+            {
+               Adp[Ai] -= hypre_StructFieldCoeff(w, kp[ki], kp[ki + koff]);
+            }
+            hypre_BoxLoop2End(Ai, ki);
+#undef DEVICE_VAR
+         }
+      }
+   }
+
+   /* drop the couplings to outside of the grid, except across periodic
+      boundaries (hypre_StructMatrixClearBoundary does not see those) */
+   hypre_ForBoxI(i, boxes)
+   {
+      box        = hypre_BoxArrayBox(boxes, i);
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(stored), i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (si == center_rank || symm_elements[si] >= 0)
+         {
+            continue;
+         }
+         for (d = 0; d < ndim; d++)
+         {
+            if (hypre_IndexD(stencil_shape[si], d) != 0)
+            {
+               break;
+            }
+         }
+         if (hypre_IndexD(hypre_StructGridPeriodic(grid), d) != 0)
+         {
+            continue;
+         }
+
+         boundary = hypre_BoxArrayCreate(0, ndim);
+         hypre_GeneralBoxBoundaryIntersect(box, grid, stencil_shape[si], boundary);
+         Ap = hypre_StructMatrixBoxData(stored, i, si);
+
+         hypre_ForBoxI(j, boundary)
+         {
+            bbox  = hypre_BoxArrayBox(boundary, j);
+            start = hypre_BoxIMin(bbox);
+            hypre_BoxGetSize(bbox, loop_size);
+
+#define DEVICE_VAR is_device_ptr(Ap)
+            hypre_BoxLoop1Begin(ndim, loop_size,
+                                A_data_box, start, stride, Ai);
+            {
+               Ap[Ai] = 0.0;
+            }
+            hypre_BoxLoop1End(Ai);
+#undef DEVICE_VAR
+         }
+         hypre_BoxArrayDestroy(boundary);
+      }
+   }
+
+   hypre_StructMatrixAssemble(stored);
+
+   return stored;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecField
+ * core of struct matvec computation for a matrix with a coefficient field:
+ * y = alpha*(y + A*x), where the boundary ghost values of x are zero
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecField( HYPRE_Complex        alpha,
+                         hypre_StructMatrix  *A,
+                         hypre_StructVector  *x,
+                         hypre_StructVector  *y,
+                         hypre_BoxArrayArray *compute_box_aa,
+                         hypre_IndexRef       stride )
+{
+   hypre_StructVector      *field   = hypre_StructMatrixCoeffField(A);
+   HYPRE_Complex           *weights = hypre_StructMatrixCoeffWeights(A);
+
+   HYPRE_Int                i, j, si, nentries;
+   HYPRE_Complex            w[2*HYPRE_MAXDIM];
+   HYPRE_Int                xoff[2*HYPRE_MAXDIM];
+   HYPRE_Int                koff[2*HYPRE_MAXDIM];
+   HYPRE_Complex            wc;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *k_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *kp;
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      k_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(field), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      kp = hypre_StructVectorBoxData(field, i);
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      /* off-diagonal entries */
+      nentries = 0;
+      wc = 0.0;
+      for (si = 0; si < stencil_size; si++)
+      {
+         if (hypre_IndexEqual(stencil_shape[si], 0, ndim))
+         {
+            wc = weights[si];
+         }
+         else
+         {
+            w[nentries]    = weights[si];
+            xoff[nentries] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+            koff[nentries] = hypre_BoxOffsetDistance(k_data_box, stencil_shape[si]);
+            nentries++;
+         }
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+#define DEVICE_VAR is_device_ptr(yp,xp,kp)
+         hypre_BoxLoop3Begin(ndim, loop_size,
+                             k_data_box, start, stride, ki,
+                             x_data_box, start, stride, xi,
+                             y_data_box, start, stride, yi);
+         {
+            HYPRE_Complex kc   = kp[ki];
+            HYPRE_Complex diag = wc;
+            HYPRE_Complex sum  = 0.0;
+            HYPRE_Complex a;
+            HYPRE_Int     sk;
+
+            for (sk = 0; sk < nentries; sk++)
+            {
+               a     = hypre_StructFieldCoeff(w[sk], kc, kp[ki + koff[sk]]);
+               diag -= a;
+               sum  += a * xp[xi + xoff[sk]];
+            }
+            yp[yi] = alpha * (yp[yi] + diag * xp[xi] + sum);
+         }
+         hypre_BoxLoop3End(ki, xi, yi);
+#undef DEVICE_VAR
+      }
+   }
+
+   return hypre_error_flag;
+}
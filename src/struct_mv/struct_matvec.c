@@ -115,6 +115,7 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
    hypre_IndexRef           stride;
 
    HYPRE_Int                constant_coefficient;
+   HYPRE_Int                fixed_size;
 
    HYPRE_Complex            temp;
    HYPRE_Int                compute_i, i;
@@ -126,7 +127,13 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
     *-----------------------------------------------------------------------*/
 
    constant_coefficient = hypre_StructMatrixConstantCoefficient(A);
-   if (constant_coefficient) hypre_StructVectorClearBoundGhostValues(x, 0);
+   if (constant_coefficient || hypre_StructMatrixCoeffField(A))
+   {
+      hypre_StructVectorClearBoundGhostValues(x, 0);
+   }
+
+   /* use the single-sweep kernels of struct_matvec_fixed.c if possible */
+   fixed_size = hypre_StructMatvecFixedSize(A);
 
    compute_pkg = (matvec_data -> compute_pkg);
 
@@ -252,17 +259,42 @@ hypre_StructMatvecCompute( void               *matvec_vdata,
       {
          case 0:
          {
-            hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            if (hypre_StructMatrixCoeffField(A))
+            {
+               hypre_StructMatvecField( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else if (fixed_size)
+            {
+               hypre_StructMatvecFixedCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC0( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 1:
          {
-            hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            if (fixed_size)
+            {
+               hypre_StructMatvecFixedCC1( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC1( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
          case 2:
          {
-            hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
+            if (fixed_size)
+            {
+               hypre_StructMatvecFixedCC2( alpha, A, x, y, compute_box_aa, stride );
+            }
+            else
+            {
+               hypre_StructMatvecCC2( alpha, A, x, y, compute_box_aa, stride );
+            }
             break;
          }
       }
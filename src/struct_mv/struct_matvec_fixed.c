@@ -0,0 +1,379 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Structured matrix-vector multiply kernels for fixed stencil sizes
+ *
+ * hypre_StructMatvecCC0/CC1/CC2 handle any stencil by sweeping each box once
+ * per group of MAX_DEPTH stencil entries, so that y (and most of x) is read
+ * and written several times per point, and CC0 needs one more sweep to scale
+ * by alpha.  For the common 5, 7, 9, 19 and 27-point stencils, the kernels
+ * below are instantiated at compile time from the same loop template and do
+ * all of y += A*x in a single sweep: the sum over the stencil is fully
+ * unrolled and kept in a register, and alpha is applied before y is stored.
+ * The inner loop of the BoxLoop runs along the x-dimension with unit stride
+ * and is left to the compiler to vectorize.
+ *
+ * The products are still added in groups of MAX_DEPTH, in the same order as
+ * in the generic kernels, so the results are the same bit for bit.  Matrices
+ * with symmetric storage need no special treatment, since the data indices
+ * of the entries that are not stored point to their transposes.
+ *
+ *****************************************************************************/
+
+#include "_hypre_struct_mv.h"
+#include "_hypre_struct_mv.hpp"
+
+/* must match the group size of the generic kernels in struct_matvec.c */
+#ifdef MAX_DEPTH
+#undef MAX_DEPTH
+#endif
+#define MAX_DEPTH 7
+
+#define hypre_StructMatvecFixedMaxSize 27
+
+/*--------------------------------------------------------------------------
+ * Sums of stencil products.  T(k) is the product for stencil entry k, and
+ * hypre_SMVSumN(T, v) adds the products of an N-point stencil to v, one
+ * group of (up to) MAX_DEPTH entries at a time.
+ *--------------------------------------------------------------------------*/
+
+#define hypre_SMVTermVar(k)   Ap[k][Ai] * xp[xi + xoff[k]]
+#define hypre_SMVTermConst(k) AAp[k] * xp[xi + xoff[k]]
+
+#define hypre_SMVGroup2(T, k) T(k) + T(k+1)
+#define hypre_SMVGroup5(T, k) hypre_SMVGroup2(T, k) + T(k+2) + T(k+3) + T(k+4)
+#define hypre_SMVGroup6(T, k) hypre_SMVGroup5(T, k) + T(k+5)
+#define hypre_SMVGroup7(T, k) hypre_SMVGroup6(T, k) + T(k+6)
+
+#define hypre_SMVSum5(T, v)  v += hypre_SMVGroup5(T, 0)
+#define hypre_SMVSum7(T, v)  v += hypre_SMVGroup7(T, 0)
+#define hypre_SMVSum9(T, v)  v += hypre_SMVGroup7(T, 0);  \
+                             v += hypre_SMVGroup2(T, 7)
+#define hypre_SMVSum19(T, v) v += hypre_SMVGroup7(T, 0);  \
+                             v += hypre_SMVGroup7(T, 7);  \
+                             v += hypre_SMVGroup5(T, 14)
+#define hypre_SMVSum27(T, v) v += hypre_SMVGroup7(T, 0);  \
+                             v += hypre_SMVGroup7(T, 7);  \
+                             v += hypre_SMVGroup7(T, 14); \
+                             v += hypre_SMVGroup6(T, 21)
+
+/*--------------------------------------------------------------------------
+ * Loop templates for the three constant_coefficient cases.  They expect
+ * Ap, AAp, xoff, xp, yp, alpha and the BoxLoop arguments to be set up as in
+ * the kernels below.
+ *--------------------------------------------------------------------------*/
+
+/* y = alpha*(y + A*x), all coefficients variable */
+#define hypre_StructMatvecFixedLoopCC0(N)                                    \
+   hypre_BoxLoop3Begin(ndim, loop_size,                                      \
+                       A_data_box, start, stride, Ai,                        \
+                       x_data_box, start, stride, xi,                        \
+                       y_data_box, start, stride, yi);                       \
+   {                                                                         \
+      HYPRE_Complex yval = yp[yi];                                           \
+      hypre_SMVSum##N(hypre_SMVTermVar, yval);                               \
+      yp[yi] = yval * alpha;                                                 \
+   }                                                                         \
+   hypre_BoxLoop3End(Ai, xi, yi)
+
+/* y += (alpha*A)*x, all coefficients constant */
+#define hypre_StructMatvecFixedLoopCC1(N)                                    \
+   hypre_BoxLoop2Begin(ndim, loop_size,                                      \
+                       x_data_box, start, stride, xi,                        \
+                       y_data_box, start, stride, yi);                       \
+   {                                                                         \
+      HYPRE_Complex yval = yp[yi];                                           \
+      hypre_SMVSum##N(hypre_SMVTermConst, yval);                             \
+      yp[yi] = yval;                                                         \
+   }                                                                         \
+   hypre_BoxLoop2End(xi, yi)
+
+/* y = alpha*(y + A*x), constant off-diagonals and variable diagonal */
+#define hypre_StructMatvecFixedLoopCC2(N)                                    \
+   hypre_BoxLoop3Begin(ndim, loop_size,                                      \
+                       A_data_box, start, stride, Ai,                        \
+                       x_data_box, start, stride, xi,                        \
+                       y_data_box, start, stride, yi);                       \
+   {                                                                         \
+      HYPRE_Complex yval = yp[yi];                                           \
+      hypre_SMVSum##N(hypre_SMVTermConst, yval);                             \
+      yp[yi] = alpha * (yval + Apc[Ai] * xp[xi + xoffc]);                    \
+   }                                                                         \
+   hypre_BoxLoop3End(Ai, xi, yi)
+
+#define hypre_StructMatvecFixedSwitch(CC)                                    \
+   switch (stencil_size)                                                     \
+   {                                                                         \
+      case 5:  hypre_StructMatvecFixedLoop##CC(5);  break;                   \
+      case 7:  hypre_StructMatvecFixedLoop##CC(7);  break;                   \
+      case 9:  hypre_StructMatvecFixedLoop##CC(9);  break;                   \
+      case 19: hypre_StructMatvecFixedLoop##CC(19); break;                   \
+      case 27: hypre_StructMatvecFixedLoop##CC(27); break;                   \
+   }
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedSize
+ *
+ * Returns the stencil size of A if there is a fixed-size kernel for it,
+ * and 0 otherwise.  The kernels are only built for the host.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedSize( hypre_StructMatrix *A )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return 0;
+#else
+   HYPRE_Int stencil_size = hypre_StructStencilSize(hypre_StructMatrixStencil(A));
+
+   switch (stencil_size)
+   {
+      case 5:
+      case 7:
+      case 9:
+      case 19:
+      case 27:
+         return stencil_size;
+   }
+
+   return 0;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedCC0
+ * fixed-size version of hypre_StructMatvecCC0 (all coefficients variable)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedCC0( HYPRE_Complex        alpha,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa,
+                            hypre_IndexRef       stride )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_StructMatvecCC0(alpha, A, x, y, compute_box_aa, stride);
+#else
+   HYPRE_Int                i, j, si;
+   HYPRE_Complex           *Ap[hypre_StructMatvecFixedMaxSize];
+   HYPRE_Int                xoff[hypre_StructMatvecFixedMaxSize];
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         Ap[si]   = hypre_StructMatrixBoxData(A, i, si);
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         hypre_StructMatvecFixedSwitch(CC0);
+      }
+   }
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedCC1
+ * fixed-size version of hypre_StructMatvecCC1 (all coefficients constant)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedCC1( HYPRE_Complex        alpha,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa,
+                            hypre_IndexRef       stride )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_StructMatvecCC1(alpha, A, x, y, compute_box_aa, stride);
+#else
+   HYPRE_Int                i, j, si;
+   HYPRE_Complex            AAp[hypre_StructMatvecFixedMaxSize];
+   HYPRE_Int                xoff[hypre_StructMatvecFixedMaxSize];
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      for (si = 0; si < stencil_size; si++)
+      {
+         AAp[si]  = hypre_StructMatrixBoxData(A, i, si)[0] * alpha;
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         hypre_StructMatvecFixedSwitch(CC1);
+      }
+   }
+
+   return hypre_error_flag;
+#endif
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_StructMatvecFixedCC2
+ * fixed-size version of hypre_StructMatvecCC2 (constant off-diagonal
+ * coefficients, variable diagonal)
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_StructMatvecFixedCC2( HYPRE_Complex        alpha,
+                            hypre_StructMatrix  *A,
+                            hypre_StructVector  *x,
+                            hypre_StructVector  *y,
+                            hypre_BoxArrayArray *compute_box_aa,
+                            hypre_IndexRef       stride )
+{
+#if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
+   return hypre_StructMatvecCC2(alpha, A, x, y, compute_box_aa, stride);
+#else
+   HYPRE_Int                i, j, si;
+   HYPRE_Complex            AAp[hypre_StructMatvecFixedMaxSize];
+   HYPRE_Int                xoff[hypre_StructMatvecFixedMaxSize];
+   HYPRE_Complex           *Apc;
+   HYPRE_Int                xoffc;
+   HYPRE_Int                si_center;
+   hypre_Index              center_index;
+   HYPRE_Int                Ai_CC;
+   hypre_BoxArray          *compute_box_a;
+   hypre_Box               *compute_box;
+
+   hypre_Box               *A_data_box;
+   hypre_Box               *x_data_box;
+   hypre_Box               *y_data_box;
+   hypre_StructStencil     *stencil;
+   hypre_Index             *stencil_shape;
+   HYPRE_Int                stencil_size;
+
+   HYPRE_Complex           *xp;
+   HYPRE_Complex           *yp;
+   hypre_Index              loop_size;
+   hypre_IndexRef           start;
+   HYPRE_Int                ndim;
+
+   stencil       = hypre_StructMatrixStencil(A);
+   stencil_shape = hypre_StructStencilShape(stencil);
+   stencil_size  = hypre_StructStencilSize(stencil);
+   ndim          = hypre_StructVectorNDim(x);
+
+   hypre_SetIndex(center_index, 0);
+   si_center = hypre_StructStencilElementRank(stencil, center_index);
+
+   hypre_ForBoxArrayI(i, compute_box_aa)
+   {
+      compute_box_a = hypre_BoxArrayArrayBoxArray(compute_box_aa, i);
+
+      A_data_box = hypre_BoxArrayBox(hypre_StructMatrixDataSpace(A), i);
+      x_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(x), i);
+      y_data_box = hypre_BoxArrayBox(hypre_StructVectorDataSpace(y), i);
+
+      xp = hypre_StructVectorBoxData(x, i);
+      yp = hypre_StructVectorBoxData(y, i);
+
+      /* the diagonal is added last, as in hypre_StructMatvecCC2 */
+      for (si = 0; si < stencil_size; si++)
+      {
+         xoff[si] = hypre_BoxOffsetDistance(x_data_box, stencil_shape[si]);
+      }
+      Apc   = hypre_StructMatrixBoxData(A, i, si_center);
+      xoffc = xoff[si_center];
+
+      hypre_ForBoxI(j, compute_box_a)
+      {
+         compute_box = hypre_BoxArrayBox(compute_box_a, j);
+
+         hypre_BoxGetSize(compute_box, loop_size);
+         start = hypre_BoxIMin(compute_box);
+
+         Ai_CC = hypre_CCBoxIndexRank(A_data_box, start);
+         for (si = 0; si < stencil_size; si++)
+         {
+            AAp[si] = hypre_StructMatrixBoxData(A, i, si)[Ai_CC];
+         }
+         AAp[si_center] = 0.0;
+
+         hypre_StructMatvecFixedSwitch(CC2);
+      }
+   }
+
+   return hypre_error_flag;
+#endif
+}
@@ -24,6 +24,21 @@ diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 tail -17 ${TNAME}.out.2 | head -6 > ${TNAME}.testdata.temp
 diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
 
+#=============================================================================
+# IJ: SELL-C-sigma matvec diffs it against the CSR matvec
+#=============================================================================
+
+tail -17 ${TNAME}.out.13 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
+#=============================================================================
+# IJ: re-assembly with an off-proc assembly plan diffs it against the plain one
+#=============================================================================
+
+tail -17 ${TNAME}.out.8 | head -6 > ${TNAME}.testdata
+tail -17 ${TNAME}.out.17 | head -6 > ${TNAME}.testdata.temp
+diff ${TNAME}.testdata ${TNAME}.testdata.temp >&2
+
 #=============================================================================
 # compare with baseline case
 #=============================================================================
@@ -42,6 +57,11 @@ FILES="\
  ${TNAME}.out.10\
  ${TNAME}.out.11\
  ${TNAME}.out.12\
+ ${TNAME}.out.13\
+ ${TNAME}.out.14\
+ ${TNAME}.out.15\
+ ${TNAME}.out.16\
+ ${TNAME}.out.17\
 "
 
 for i in $FILES
@@ -163,6 +163,17 @@ FILES="\
  ${TNAME}.out.322\
  ${TNAME}.out.323\
  ${TNAME}.out.324\
+ ${TNAME}.out.326\
+ ${TNAME}.out.327\
+ ${TNAME}.out.328\
+ ${TNAME}.out.329\
+ ${TNAME}.out.330\
+ ${TNAME}.out.331\
+ ${TNAME}.out.332\
+ ${TNAME}.out.333\
+ ${TNAME}.out.334\
+ ${TNAME}.out.335\
+ ${TNAME}.out.336\
 "
 
 for i in $FILES
@@ -171,6 +182,27 @@ do
   tail -3 $i
 done >> ${TNAME}.out
 
+FILES="\
+ ${TNAME}.out.325\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -9 $i
+done >> ${TNAME}.out
+
+FILES="\
+ ${TNAME}.out.337\
+ ${TNAME}.out.338\
+"
+
+for i in $FILES
+do
+  echo "# Output file: $i"
+  tail -6 $i
+done >> ${TNAME}.out
+
 # Make sure that the output files are reasonable
 CHECK_LINE="Complexity"
 OUT_COUNT=`grep "$CHECK_LINE" ${TNAME}.out | wc -l`
@@ -97,6 +97,8 @@ main( hypre_int argc,
    HYPRE_Int           check_constant = 0;
    HYPRE_Int           off_proc = 0;
    HYPRE_Int           chunk = 0;
+   HYPRE_Int           coo = 0;
+   HYPRE_Int           offproc_plan = 0;
    HYPRE_Int           omp_flag = 0;
    HYPRE_Int           build_matrix_type;
    HYPRE_Int           build_matrix_arg_index;
@@ -114,11 +116,12 @@ main( hypre_int argc,
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type = 1;
    HYPRE_Int           recompute_res = 0;   /* What should be the default here? */
+   HYPRE_Int           pipelined = 0;
    HYPRE_Int           ioutdat;
    HYPRE_Int           poutdat;
    HYPRE_Int           debug_flag;
    HYPRE_Int           ierr = 0;
-   HYPRE_Int           i,j;
+   HYPRE_Int           i,j,k;
    HYPRE_Int           max_levels = 25;
    HYPRE_Int           num_iterations;
    HYPRE_Int           pcg_num_its, dscg_num_its;
@@ -142,6 +145,7 @@ main( hypre_int argc,
    HYPRE_ParVector     *interp_vecs = NULL;
    HYPRE_ParVector     residual = NULL;
    HYPRE_ParVector     x0_save = NULL;
+   HYPRE_ParVector     x0_resetup = NULL;
 
    HYPRE_Solver        amg_solver;
    HYPRE_Solver        pcg_solver;
@@ -212,6 +216,16 @@ main( hypre_int argc,
    HYPRE_Int      relax_up = -1;
    HYPRE_Int      relax_down = -1;
    HYPRE_Int      relax_order = 0;
+   HYPRE_Int      relax_overlap = 0;
+   HYPRE_Int      mixed_level = 0;
+   HYPRE_Int      compress_cols = 0;
+   HYPRE_Int      fused_cycle = 0;
+   HYPRE_Int      cycle_min_rows = 0;
+   HYPRE_Int      num_rhs = 1;
+   HYPRE_Real    *rhs_res_norms = NULL;
+   HYPRE_Int      rhs_num_matching = 0;
+   HYPRE_Int      num_resetups = 0;
+   HYPRE_Real     resetup_aniso = 1.0;
    HYPRE_Int      level_w = -1;
    HYPRE_Int      level_ow = -1;
    /* HYPRE_Int    smooth_lev; */
@@ -224,6 +238,8 @@ main( hypre_int argc,
    /* redundant coarse grid solve */
    HYPRE_Int      seq_threshold = 0;
    HYPRE_Int      redundant = 0;
+   HYPRE_Int      agglom_threshold = 0;
+   HYPRE_Int      agglom_factor = 8;
    /* additive versions */
    HYPRE_Int    additive = -1;
    HYPRE_Int    mult_add = -1;
@@ -257,6 +273,12 @@ main( hypre_int argc,
    HYPRE_Int  cheby_scale = 1;
    HYPRE_Real cheby_fraction = .3;
 
+   HYPRE_Int  fsai_algo_type = 1;
+   HYPRE_Int  fsai_max_steps = 3;
+   HYPRE_Int  fsai_max_step_size = 5;
+   HYPRE_Real fsai_kap_tolerance = 1.0e-3;
+   HYPRE_Int  fsai_eig_max_iters = 5;
+
    /* for CGC BM Aug 25, 2006 */
    HYPRE_Int      cgcits = 1;
    /* for coordinate plotting BM Oct 24, 2006 */
@@ -287,6 +309,7 @@ main( hypre_int argc,
    /* parameters for COGMRES */
    HYPRE_Int    cgs = 1;
    HYPRE_Int    unroll = 0;
+   HYPRE_Int    s_step = 1;
    /* parameters for LGMRES */
    HYPRE_Int    aug_dim;
    /* parameters for GSMG */
@@ -380,6 +403,8 @@ main( hypre_int argc,
    HYPRE_Int ilu_max_row_nnz = 1000;
    HYPRE_Int ilu_schur_max_iter = 3;
    HYPRE_Real ilu_nsh_droptol = 1.0e-02;
+   HYPRE_Int ilu_reordering = 1;
+   HYPRE_Int ilu_level_sched = 0;
    /* end hypre ILU options */
 
    HYPRE_Real     *nongalerk_tol = NULL;
@@ -407,6 +432,9 @@ main( hypre_int argc,
    HYPRE_ExecutionPolicy default_exec_policy = HYPRE_EXEC_HOST;
 #endif
    HYPRE_MemoryLocation memory_location = HYPRE_MEMORY_DEVICE;
+   HYPRE_Int spmv_use_sell = 0;
+   HYPRE_Int exchange_nbx = 0;
+   HYPRE_Int comm_neighbor_coll = 0;
 
    /* CUB Allocator */
    hypre_uint mempool_bin_growth   = 8,
@@ -543,6 +571,21 @@ main( hypre_int argc,
          arg_index++;
          chunk = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-coo") == 0 )
+      {
+         arg_index++;
+         coo = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-coo_plan") == 0 )
+      {
+         arg_index++;
+         coo = 2;
+      }
+      else if ( strcmp(argv[arg_index], "-offproc_plan") == 0 )
+      {
+         arg_index++;
+         offproc_plan = 1;
+      }
       else if ( strcmp(argv[arg_index], "-off_proc") == 0 )
       {
          arg_index++;
@@ -625,6 +668,21 @@ main( hypre_int argc,
          build_rhs_type      = 5;
          build_rhs_arg_index = arg_index;
       }
+      else if ( strcmp(argv[arg_index], "-num_rhs") == 0 )
+      {
+         arg_index++;
+         num_rhs = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup") == 0 )
+      {
+         arg_index++;
+         num_resetups = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-resetup_aniso") == 0 )
+      {
+         arg_index++;
+         resetup_aniso = atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-srcfromfile") == 0 )
       {
          arg_index++;
@@ -1082,6 +1140,16 @@ main( hypre_int argc,
          arg_index++;
          ilu_nsh_droptol = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-ilu_reordering") == 0 )
+      {                /* local reordering */
+         arg_index++;
+         ilu_reordering = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-ilu_level_sched") == 0 )
+      {                /* level scheduled triangular solves */
+         arg_index++;
+         ilu_level_sched = 1;
+      }
       /* end ilu options */
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
       else if ( strcmp(argv[arg_index], "-exec_host") == 0 )
@@ -1101,6 +1169,21 @@ main( hypre_int argc,
          spgemm_use_cusparse = atoi(argv[arg_index++]);
       }
 #endif
+      else if ( strcmp(argv[arg_index], "-spmv_sell") == 0 )
+      {
+         arg_index++;
+         spmv_use_sell = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-exchange_nbx") == 0 )
+      {
+         arg_index++;
+         exchange_nbx = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-neighbor_coll") == 0 )
+      {
+         arg_index++;
+         comm_neighbor_coll = 1;
+      }
       else if ( strcmp(argv[arg_index], "-mempool_growth") == 0 )
       {
          arg_index++;
@@ -1218,6 +1301,11 @@ main( hypre_int argc,
          arg_index++;
          unroll = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-sstep") == 0 )
+      {
+         arg_index++;
+         s_step = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-check_residual") == 0 )
       {
          arg_index++;
@@ -1285,6 +1373,16 @@ main( hypre_int argc,
          arg_index++;
          redundant  = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-agglom_th") == 0 )
+      {
+         arg_index++;
+         agglom_threshold = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-agglom_factor") == 0 )
+      {
+         arg_index++;
+         agglom_factor = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cutf") == 0 )
       {
          arg_index++;
@@ -1305,6 +1403,31 @@ main( hypre_int argc,
          arg_index++;
          relax_order = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-rlx_overlap") == 0 )
+      {
+         arg_index++;
+         relax_overlap = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-mixed_level") == 0 )
+      {
+         arg_index++;
+         mixed_level = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-compress_cols") == 0 )
+      {
+         arg_index++;
+         compress_cols = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-fused_cycle") == 0 )
+      {
+         arg_index++;
+         fused_cycle = 1;
+      }
+      else if ( strcmp(argv[arg_index], "-cycle_min_rows") == 0 )
+      {
+         arg_index++;
+         cycle_min_rows = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-cf") == 0 )
       {
          arg_index++;
@@ -1430,6 +1553,11 @@ main( hypre_int argc,
          arg_index++;
          recompute_res = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-pipelined") == 0 )
+      {
+         arg_index++;
+         pipelined = 1;
+      }
       else if ( strcmp(argv[arg_index], "-iout") == 0 )
       {
          arg_index++;
@@ -1558,6 +1686,31 @@ main( hypre_int argc,
          arg_index++;
          cheby_fraction = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-fsai_algo") == 0 )
+      {
+         arg_index++;
+         fsai_algo_type = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fsai_max_steps") == 0 )
+      {
+         arg_index++;
+         fsai_max_steps = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fsai_step_size") == 0 )
+      {
+         arg_index++;
+         fsai_max_step_size = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fsai_kap_tol") == 0 )
+      {
+         arg_index++;
+         fsai_kap_tolerance = atof(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-fsai_eig_iters") == 0 )
+      {
+         arg_index++;
+         fsai_eig_max_iters = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-additive") == 0 )
       {
          arg_index++;
@@ -1734,6 +1887,10 @@ main( hypre_int argc,
          hypre_printf("  -exact_size            : inserts immediately into ParCSR structure\n");
          hypre_printf("  -storage_low           : allocates not enough storage for aux struct\n");
          hypre_printf("  -concrete_parcsr       : use parcsr matrix type as concrete type\n");
+         hypre_printf("  -coo                   : with -test_ij, assemble from COO triplets\n");
+         hypre_printf("  -coo_plan              : same, then update the values with the assembly plan\n");
+         hypre_printf("  -offproc_plan          : with -test_ij, subtract and add back the values after\n");
+         hypre_printf("                           assembly, with an assembly plan for off-proc values\n");
          hypre_printf("\n");
          hypre_printf("  -rhsfromfile           : ");
          hypre_printf("rhs read from multiple files (IJ format)\n");
@@ -1749,6 +1906,14 @@ main( hypre_int argc,
          hypre_printf("  -rhsisone              : rhs is vector with unit components (default)\n");
          hypre_printf("  -xisone                : solution of all ones\n");
          hypre_printf("  -rhszero               : rhs is zero vector\n");
+         hypre_printf("  -num_rhs <val>         : solve for val right-hand sides at once with\n");
+         hypre_printf("                         :    BoomerAMG (solver 0); the first is the rhs\n");
+         hypre_printf("                         :    above, the others are random\n");
+         hypre_printf("  -resetup <val>         : redo the BoomerAMG (solver 0) setup val times\n");
+         hypre_printf("                         :    as numeric-only resetups (setup type 2)\n");
+         hypre_printf("  -resetup_aniso <val>   : before the resetups, scale the couplings between\n");
+         hypre_printf("                         :    consecutive rows by val (keeping the row sums),\n");
+         hypre_printf("                         :    and compare with a full setup after the solve\n");
          hypre_printf("\n");
          hypre_printf("  -dt <val>              : specify finite backward Euler time step\n");
          hypre_printf("                         :    -rhsfromfile, -rhsfromonefile, -rhsrand,\n");
@@ -1846,6 +2011,7 @@ main( hypre_int argc,
          hypre_printf("       4=Hybrid backward Gauss-Seidel  \n");
          hypre_printf("       6=Hybrid symmetric Gauss-Seidel  \n");
          hypre_printf("       8= symmetric L1-Gauss-Seidel  \n");
+         hypre_printf("       12=FSAI  \n");
          hypre_printf("       13= forward L1-Gauss-Seidel  \n");
          hypre_printf("       14= backward L1-Gauss-Seidel  \n");
          hypre_printf("       15=CG  \n");
@@ -1861,8 +2027,20 @@ main( hypre_int argc,
          hypre_printf("  -rlx_coarse  <val>       : set relaxation type for coarsest grid\n");
          hypre_printf("  -rlx_down    <val>       : set relaxation type for down cycle\n");
          hypre_printf("  -rlx_up      <val>       : set relaxation type for up cycle\n");
+         hypre_printf("  -rlx_overlap             : relax interior rows during halo exchange\n");
+         hypre_printf("  -mixed_level <val>       : single-precision matrices from this level on\n");
+         hypre_printf("  -compress_cols           : compressed column indices in the AMG solve phase\n");
+         hypre_printf("  -fused_cycle             : fused residual and restriction in the AMG cycle\n");
+         hypre_printf("  -cycle_min_rows <val>    : min. local rows per OpenMP thread in the AMG cycle\n");
+         hypre_printf("  -agglom_th <val>         : agglomerate levels with fewer rows per process\n");
+         hypre_printf("  -agglom_factor <val>     : number of processes agglomerated onto one\n");
          hypre_printf("  -cheby_order  <val> : set order (1-4) for Chebyshev poly. smoother (default is 2)\n");
          hypre_printf("  -cheby_fraction <val> : fraction of the spectrum for Chebyshev poly. smoother (default is .3)\n");
+         hypre_printf("  -fsai_algo <val>         : FSAI smoother (rlx 12) pattern, 0=lower part of A, 1=adaptive\n");
+         hypre_printf("  -fsai_max_steps <val>    : max. adaptive FSAI pattern steps (default is 3)\n");
+         hypre_printf("  -fsai_step_size <val>    : max. entries added per adaptive FSAI step (default is 5)\n");
+         hypre_printf("  -fsai_kap_tol <val>      : adaptive FSAI Kaporin decrease tolerance (default is 1e-3)\n");
+         hypre_printf("  -fsai_eig_iters <val>    : power iterations for the FSAI weight (default is 5)\n");
          hypre_printf("  -nodal  <val>            : nodal system type\n");
          hypre_printf("       0 = Unknown approach \n");
          hypre_printf("       1 = Frobenius norm  \n");
@@ -1903,6 +2081,8 @@ main( hypre_int argc,
 
          hypre_printf("  -w   <val>             : set Jacobi relax weight = val\n");
          hypre_printf("  -k   <val>             : dimension Krylov space for GMRES\n");
+         hypre_printf("  -pipelined             : pipelined (communication-hiding) PCG and GMRES\n");
+         hypre_printf("  -sstep <val>           : block size of s-step COGMRES (default 1)\n");
          hypre_printf("  -aug   <val>           : number of augmentation vectors for LGMRES (-k indicates total approx space size)\n");
 
          hypre_printf("  -mxl  <val>            : maximum number of levels (AMG, ParaSAILS)\n");
@@ -1935,6 +2115,10 @@ main( hypre_int argc,
          hypre_printf("\n");
          hypre_printf("  -print                 : print out the system\n");
          hypre_printf("\n");
+         hypre_printf("  -spmv_sell             : use SELL-C-sigma storage in the host matvec\n");
+         hypre_printf("  -exchange_nbx          : use NBX (Issend + Ibarrier) for sparse data exchanges\n");
+         hypre_printf("  -neighbor_coll         : use neighborhood collectives in the matvec communication\n");
+         hypre_printf("\n");
          /* begin lobpcg */
 
          hypre_printf("LOBPCG options:\n");
@@ -2044,6 +2228,8 @@ main( hypre_int argc,
          hypre_printf("  -ilu_max_row_nnz   <val>         : set max. num of nonzeros to keep per row = val \n");
          hypre_printf("  -ilu_schur_max_iter   <val>      : set max. num of iteration for GMRES/NSH Schur = val \n");
          hypre_printf("  -ilu_nsh_droptol   <val>         : set drop tolerance threshold for NSH = val \n");
+         hypre_printf("  -ilu_reordering   <val>          : local reordering, 0=none, 1=RCM (default), 2=multicolor \n");
+         hypre_printf("  -ilu_level_sched                 : use level scheduled (threaded) triangular solves \n");
          /* end ILU options */
       }
 
@@ -2078,6 +2264,9 @@ main( hypre_int argc,
                             mempool_max_bin, mempool_max_cached_bytes );
 
    hypre_HandleMemoryLocation(hypre_handle())    = memory_location;
+   HYPRE_SetSpMVUseSELL(spmv_use_sell);
+   HYPRE_SetExchangeNBX(exchange_nbx);
+   HYPRE_SetCommNeighborColl(comm_neighbor_coll);
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle()) = default_exec_policy;
    hypre_HandleSpgemmUseCusparse(hypre_handle()) = spgemm_use_cusparse;
@@ -2320,7 +2509,10 @@ main( hypre_int argc,
          ierr = HYPRE_IJMatrixSetRowSizes ( ij_A, (const HYPRE_Int *) row_sizes );
       }
 
-      ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
+      if (!coo)
+      {
+         ierr += HYPRE_IJMatrixInitialize_v2( ij_A, memory_location );
+      }
 
       if (omp_flag)
       {
@@ -2345,7 +2537,40 @@ main( hypre_int argc,
          hypre_TMemcpy(data,     data_h,     HYPRE_Real,   mx_size*num_rows, memory_location, HYPRE_MEMORY_HOST);
       }
 
-      if (chunk)
+      if (coo)
+      {
+         /* expand the row numbers to one per entry */
+         HYPRE_BigInt *coo_rows = hypre_TAlloc(HYPRE_BigInt, mx_size*num_rows, HYPRE_MEMORY_HOST);
+
+         j_indx = 0;
+         for (i = 0; i < num_rows; i++)
+         {
+            for (j = 0; j < num_cols_h[i]; j++)
+            {
+               coo_rows[j_indx++] = row_nums_h[i];
+            }
+         }
+         if (coo == 2)
+         {
+            /* assemble with shifted values first, then restore them */
+            HYPRE_Real *coo_data = hypre_TAlloc(HYPRE_Real, j_indx, HYPRE_MEMORY_HOST);
+
+            for (i = 0; i < j_indx; i++)
+            {
+               coo_data[i] = data_h[i] + 1.0;
+            }
+            ierr += HYPRE_IJMatrixSetAssemblyPlan(ij_A, 1);
+            ierr += HYPRE_IJMatrixAssembleCOO(ij_A, j_indx, (const HYPRE_BigInt *) coo_rows,
+                                              (const HYPRE_BigInt *) col_nums_h,
+                                              (const HYPRE_Real *) coo_data);
+            hypre_TFree(coo_data, HYPRE_MEMORY_HOST);
+         }
+         ierr += HYPRE_IJMatrixAssembleCOO(ij_A, j_indx, (const HYPRE_BigInt *) coo_rows,
+                                           (const HYPRE_BigInt *) col_nums_h,
+                                           (const HYPRE_Real *) data_h);
+         hypre_TFree(coo_rows, HYPRE_MEMORY_HOST);
+      }
+      else if (chunk)
       {
          if (add)
          {
@@ -2380,17 +2605,6 @@ main( hypre_int argc,
             j_indx += num_cols_h[i];
          }
       }
-      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
-      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
-      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
-      {
-         hypre_TFree(col_nums, memory_location);
-         hypre_TFree(data,     memory_location);
-         hypre_TFree(row_nums, memory_location);
-         hypre_TFree(num_cols, memory_location);
-      }
 
       if (sparsity_known == 1)
       {
@@ -2404,6 +2618,41 @@ main( hypre_int argc,
 
       ierr += HYPRE_IJMatrixAssemble( ij_A );
 
+      if (offproc_plan)
+      {
+         /* subtract all values from the assembled matrix and add them back;
+            the second assembly exchanges the off-processor values with the
+            assembly plan recorded by the first one */
+         ierr += HYPRE_IJMatrixSetAssemblyPlan(ij_A, 1);
+         for (k = 0; k < 2; k++)
+         {
+            for (i = 0; i < j_indx; i++)
+            {
+               data_h[i] = -data_h[i];
+            }
+            if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+            {
+               hypre_TMemcpy(data, data_h, HYPRE_Real, j_indx, memory_location, HYPRE_MEMORY_HOST);
+            }
+            ierr += HYPRE_IJMatrixAddToValues(ij_A, num_rows, num_cols, row_nums,
+                                              (const HYPRE_BigInt *) col_nums,
+                                              (const HYPRE_Real *) data);
+            ierr += HYPRE_IJMatrixAssemble(ij_A);
+         }
+      }
+
+      hypre_TFree(num_cols_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(row_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(col_nums_h, HYPRE_MEMORY_HOST);
+      hypre_TFree(data_h,     HYPRE_MEMORY_HOST);
+      if (hypre_GetActualMemLocation(memory_location) != hypre_MEMORY_HOST)
+      {
+         hypre_TFree(col_nums, memory_location);
+         hypre_TFree(data,     memory_location);
+         hypre_TFree(row_nums, memory_location);
+         hypre_TFree(num_cols, memory_location);
+      }
+
       hypre_EndTiming(time_index);
       hypre_PrintTiming("IJ Matrix Setup", hypre_MPI_COMM_WORLD);
       hypre_FinalizeTiming(time_index);
@@ -3293,6 +3542,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
+      HYPRE_BoomerAMGSetAgglomFactor(amg_solver, agglom_factor);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -3324,9 +3575,19 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyOrder(amg_solver, cheby_order);
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
+      HYPRE_BoomerAMGSetFSAIAlgoType(amg_solver, fsai_algo_type);
+      HYPRE_BoomerAMGSetFSAIMaxSteps(amg_solver, fsai_max_steps);
+      HYPRE_BoomerAMGSetFSAIMaxStepSize(amg_solver, fsai_max_step_size);
+      HYPRE_BoomerAMGSetFSAIKapTolerance(amg_solver, fsai_kap_tolerance);
+      HYPRE_BoomerAMGSetFSAIEigMaxIters(amg_solver, fsai_eig_max_iters);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
+      HYPRE_BoomerAMGSetRelaxOverlap(amg_solver, relax_overlap);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mixed_level);
+      HYPRE_BoomerAMGSetCompressColumns(amg_solver, compress_cols);
+      HYPRE_BoomerAMGSetFusedCycle(amg_solver, fused_cycle);
+      HYPRE_BoomerAMGSetCycleMinRowsPerThread(amg_solver, cycle_min_rows);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
       HYPRE_BoomerAMGSetMaxLevels(amg_solver, max_levels);
@@ -3427,6 +3688,67 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
+      if (num_resetups > 0)
+      {
+         time_index = hypre_InitializeTiming("BoomerAMG Resetup");
+         hypre_BeginTiming(time_index);
+
+         if (resetup_aniso != 1.0)
+         {
+            /* change the values of A, but not its sparsity pattern: scale the
+               couplings between consecutive rows and keep the row sums */
+            hypre_ParCSRMatrix *A_par  = (hypre_ParCSRMatrix *) parcsr_A;
+            hypre_CSRMatrix    *A_diag = hypre_ParCSRMatrixDiag(A_par);
+            hypre_CSRMatrix    *A_offd = hypre_ParCSRMatrixOffd(A_par);
+            HYPRE_Int          *A_diag_i = hypre_CSRMatrixI(A_diag);
+            HYPRE_Int          *A_diag_j = hypre_CSRMatrixJ(A_diag);
+            HYPRE_Real         *A_diag_data = hypre_CSRMatrixData(A_diag);
+            HYPRE_Int          *A_offd_i = hypre_CSRMatrixI(A_offd);
+            HYPRE_Int          *A_offd_j = hypre_CSRMatrixJ(A_offd);
+            HYPRE_Real         *A_offd_data = hypre_CSRMatrixData(A_offd);
+            HYPRE_BigInt       *col_map_offd = hypre_ParCSRMatrixColMapOffd(A_par);
+            HYPRE_BigInt        row_start = hypre_ParCSRMatrixFirstRowIndex(A_par);
+            HYPRE_BigInt        col_start = hypre_ParCSRMatrixFirstColDiag(A_par);
+            HYPRE_BigInt        dist;
+            HYPRE_Real          shift;
+
+            for (i = 0; i < hypre_CSRMatrixNumRows(A_diag); i++)
+            {
+               shift = 0.0;
+               for (k = A_diag_i[i]+1; k < A_diag_i[i+1]; k++)
+               {
+                  dist = col_start + A_diag_j[k] - row_start - i;
+                  if (dist == 1 || dist == -1)
+                  {
+                     shift += (resetup_aniso - 1.0) * A_diag_data[k];
+                     A_diag_data[k] *= resetup_aniso;
+                  }
+               }
+               for (k = A_offd_i[i]; k < A_offd_i[i+1]; k++)
+               {
+                  dist = col_map_offd[A_offd_j[k]] - row_start - i;
+                  if (dist == 1 || dist == -1)
+                  {
+                     shift += (resetup_aniso - 1.0) * A_offd_data[k];
+                     A_offd_data[k] *= resetup_aniso;
+                  }
+               }
+               A_diag_data[A_diag_i[i]] -= shift;
+            }
+         }
+
+         HYPRE_BoomerAMGSetSetupType(amg_solver, 2);
+         for (j = 0; j < num_resetups; j++)
+         {
+            HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+         }
+
+         hypre_EndTiming(time_index);
+         hypre_PrintTiming("Resetup phase times", hypre_MPI_COMM_WORLD);
+         hypre_FinalizeTiming(time_index);
+         hypre_ClearTiming();
+      }
+
       time_index = hypre_InitializeTiming("BoomerAMG Solve");
       hypre_BeginTiming(time_index);
 
@@ -3436,7 +3758,136 @@ main( hypre_int argc,
 
       //cudaProfilerStart();
 
-      HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+      if (num_rhs > 1)
+      {
+         /* multivectors whose first column is b and x */
+         HYPRE_ParVector  bm, xm, tmp, xs, rs;
+         HYPRE_Complex   *bm_data, *xm_data, *b_data, *x_data, *tmp_data;
+         HYPRE_Complex   *xs_data, *rs_data;
+         HYPRE_Real       nrm, diff_nrm;
+         HYPRE_Int        local_size, j, k;
+
+         local_size = hypre_VectorSize(hypre_ParVectorLocalVector((hypre_ParVector *) b));
+         b_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) b));
+         x_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) x));
+
+         bm = (HYPRE_ParVector) hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                                           hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                                                           hypre_ParVectorPartitioning((hypre_ParVector *) b),
+                                                           num_rhs);
+         hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) bm, 0);
+         hypre_ParVectorInitialize((hypre_ParVector *) bm);
+         xm = (HYPRE_ParVector) hypre_ParMultiVectorCreate(hypre_MPI_COMM_WORLD,
+                                                           hypre_ParVectorGlobalSize((hypre_ParVector *) x),
+                                                           hypre_ParVectorPartitioning((hypre_ParVector *) x),
+                                                           num_rhs);
+         hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) xm, 0);
+         hypre_ParVectorInitialize((hypre_ParVector *) xm);
+         bm_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) bm));
+         xm_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) xm));
+
+         HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                               hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                               hypre_ParVectorPartitioning((hypre_ParVector *) b), &tmp);
+         hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) tmp, 0);
+         HYPRE_ParVectorInitialize(tmp);
+         tmp_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) tmp));
+
+         for (j = 0; j < num_rhs; j++)
+         {
+            if (j > 0)
+            {
+               HYPRE_ParVectorSetRandomValues(tmp, 22775 + j);
+            }
+            for (k = 0; k < local_size; k++)
+            {
+               bm_data[j*local_size + k] = j ? tmp_data[k] : b_data[k];
+               xm_data[j*local_size + k] = x_data[k];
+            }
+         }
+
+         HYPRE_BoomerAMGMultiSolve(amg_solver, parcsr_A, bm, xm);
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+
+         /* Check each column: compute its relative residual, and compare it
+            with a single-vector solve from the same initial guess that runs
+            for the same number of cycles */
+         HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                               hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                               hypre_ParVectorPartitioning((hypre_ParVector *) b), &xs);
+         hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) xs, 0);
+         HYPRE_ParVectorInitialize(xs);
+         xs_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) xs));
+         HYPRE_ParVectorCreate(hypre_MPI_COMM_WORLD,
+                               hypre_ParVectorGlobalSize((hypre_ParVector *) b),
+                               hypre_ParVectorPartitioning((hypre_ParVector *) b), &rs);
+         hypre_ParVectorSetPartitioningOwner((hypre_ParVector *) rs, 0);
+         HYPRE_ParVectorInitialize(rs);
+         rs_data = hypre_VectorData(hypre_ParVectorLocalVector((hypre_ParVector *) rs));
+
+         rhs_res_norms = hypre_CTAlloc(HYPRE_Real, num_rhs, HYPRE_MEMORY_HOST);
+         rhs_num_matching = 0;
+
+         HYPRE_BoomerAMGSetPrintLevel(amg_solver, 0);
+         HYPRE_BoomerAMGSetTol(amg_solver, 0.0);
+         HYPRE_BoomerAMGSetMaxIter(amg_solver, num_iterations);
+
+         for (j = 0; j < num_rhs; j++)
+         {
+            for (k = 0; k < local_size; k++)
+            {
+               tmp_data[k] = bm_data[j*local_size + k];
+               xs_data[k]  = xm_data[j*local_size + k];
+               rs_data[k]  = tmp_data[k];
+            }
+            HYPRE_ParCSRMatrixMatvec(-1.0, parcsr_A, xs, 1.0, rs);
+            HYPRE_ParVectorInnerProd(rs, rs, &diff_nrm);
+            HYPRE_ParVectorInnerProd(tmp, tmp, &nrm);
+            rhs_res_norms[j] = nrm > 0.0 ? sqrt(diff_nrm / nrm) : sqrt(diff_nrm);
+
+            for (k = 0; k < local_size; k++)
+            {
+               xs_data[k] = x_data[k];
+            }
+            HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, tmp, xs);
+            for (k = 0; k < local_size; k++)
+            {
+               rs_data[k] = xs_data[k] - xm_data[j*local_size + k];
+            }
+            HYPRE_ParVectorInnerProd(rs, rs, &diff_nrm);
+            HYPRE_ParVectorInnerProd(xs, xs, &nrm);
+            if (sqrt(diff_nrm) <= 1.0e-10 * sqrt(nrm))
+            {
+               rhs_num_matching++;
+            }
+         }
+
+         HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3);
+         HYPRE_BoomerAMGSetTol(amg_solver, tol);
+         HYPRE_BoomerAMGSetMaxIter(amg_solver, mg_max_iter);
+
+         for (k = 0; k < local_size; k++)
+         {
+            x_data[k] = xm_data[k];
+         }
+
+         HYPRE_ParVectorDestroy(xs);
+         HYPRE_ParVectorDestroy(rs);
+         HYPRE_ParVectorDestroy(tmp);
+         HYPRE_ParVectorDestroy(bm);
+         HYPRE_ParVectorDestroy(xm);
+      }
+      else
+      {
+         if (num_resetups > 0 && resetup_aniso != 1.0)
+         {
+            /* save the initial guess for the full setup comparison */
+            x0_resetup = hypre_ParVectorCloneDeep_v2(x, hypre_ParVectorMemoryLocation(x));
+         }
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+      }
 
       //cudaProfilerStop();
 
@@ -3453,8 +3904,11 @@ main( hypre_int argc,
       hypre_FinalizeTiming(time_index);
       hypre_ClearTiming();
 
-      HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
-      HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+      if (num_rhs <= 1)
+      {
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &final_res_norm);
+      }
 
       if (myid == 0)
       {
@@ -3464,6 +3918,48 @@ main( hypre_int argc,
          hypre_printf("\n");
       }
 
+      if (num_rhs > 1)
+      {
+         if (myid == 0)
+         {
+            for (j = 0; j < num_rhs; j++)
+            {
+               hypre_printf("Column %d Relative Residual Norm = %e\n", j, rhs_res_norms[j]);
+            }
+            hypre_printf("Columns matching single-RHS solves = %d\n", rhs_num_matching);
+            hypre_printf("\n");
+         }
+         hypre_TFree(rhs_res_norms, HYPRE_MEMORY_HOST);
+      }
+
+      if (x0_resetup)
+      {
+         /* compare the resetup with a full setup for the new values of A,
+            solving from the same initial guess */
+         HYPRE_Int  full_num_iterations;
+         HYPRE_Real full_res_norm;
+
+         hypre_ParVectorCopy(x0_resetup, x);
+         HYPRE_ParVectorDestroy(x0_resetup);
+         x0_resetup = NULL;
+
+         HYPRE_BoomerAMGSetPrintLevel(amg_solver, 0);
+         HYPRE_BoomerAMGSetSetupType(amg_solver, 1);
+         HYPRE_BoomerAMGSetup(amg_solver, parcsr_A, b, x);
+         HYPRE_BoomerAMGSolve(amg_solver, parcsr_A, b, x);
+         HYPRE_BoomerAMGSetPrintLevel(amg_solver, 3);
+
+         HYPRE_BoomerAMGGetNumIterations(amg_solver, &full_num_iterations);
+         HYPRE_BoomerAMGGetFinalRelativeResidualNorm(amg_solver, &full_res_norm);
+
+         if (myid == 0)
+         {
+            hypre_printf("Full setup Iterations = %d\n", full_num_iterations);
+            hypre_printf("Full setup Final Relative Residual Norm = %e\n", full_res_norm);
+            hypre_printf("\n");
+         }
+      }
+
 #if SECOND_TIME
       /* run a second time to check for memory leaks */
       HYPRE_ParVectorSetRandomValues(x, 775);
@@ -3558,6 +4054,8 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetTol(amg_solver, tol);
       HYPRE_BoomerAMGSetStrongThreshold(amg_solver, strong_threshold);
       HYPRE_BoomerAMGSetSeqThreshold(amg_solver, seq_threshold);
+      HYPRE_BoomerAMGSetAgglomThreshold(amg_solver, agglom_threshold);
+      HYPRE_BoomerAMGSetAgglomFactor(amg_solver, agglom_factor);
       HYPRE_BoomerAMGSetRedundant(amg_solver, redundant);
       HYPRE_BoomerAMGSetMaxCoarseSize(amg_solver, coarse_threshold);
       HYPRE_BoomerAMGSetMinCoarseSize(amg_solver, min_coarse_size);
@@ -3584,9 +4082,19 @@ main( hypre_int argc,
       HYPRE_BoomerAMGSetChebyOrder(amg_solver, cheby_order);
       HYPRE_BoomerAMGSetChebyFraction(amg_solver, cheby_fraction);
       HYPRE_BoomerAMGSetChebyEigEst(amg_solver, cheby_eig_est);
+      HYPRE_BoomerAMGSetFSAIAlgoType(amg_solver, fsai_algo_type);
+      HYPRE_BoomerAMGSetFSAIMaxSteps(amg_solver, fsai_max_steps);
+      HYPRE_BoomerAMGSetFSAIMaxStepSize(amg_solver, fsai_max_step_size);
+      HYPRE_BoomerAMGSetFSAIKapTolerance(amg_solver, fsai_kap_tolerance);
+      HYPRE_BoomerAMGSetFSAIEigMaxIters(amg_solver, fsai_eig_max_iters);
       HYPRE_BoomerAMGSetChebyVariant(amg_solver, cheby_variant);
       HYPRE_BoomerAMGSetChebyScale(amg_solver, cheby_scale);
       HYPRE_BoomerAMGSetRelaxOrder(amg_solver, relax_order);
+      HYPRE_BoomerAMGSetRelaxOverlap(amg_solver, relax_overlap);
+      HYPRE_BoomerAMGSetMixedPrecisionLevel(amg_solver, mixed_level);
+      HYPRE_BoomerAMGSetCompressColumns(amg_solver, compress_cols);
+      HYPRE_BoomerAMGSetFusedCycle(amg_solver, fused_cycle);
+      HYPRE_BoomerAMGSetCycleMinRowsPerThread(amg_solver, cycle_min_rows);
       HYPRE_BoomerAMGSetRelaxWt(amg_solver, relax_wt);
       HYPRE_BoomerAMGSetOuterWt(amg_solver, outer_wt);
       if (level_w > -1)
@@ -3709,6 +4217,7 @@ main( hypre_int argc,
       HYPRE_PCGSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_PCGSetAbsoluteTol(pcg_solver, atol);
       HYPRE_PCGSetRecomputeResidual(pcg_solver, recompute_res);
+      HYPRE_PCGSetPipelined(pcg_solver, pipelined);
 
       if (solver_id == 1)
       {
@@ -3729,6 +4238,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -3759,9 +4270,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -3896,6 +4417,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetIsolatedFPoints(pcg_precond, num_isolated_fpt, isolated_fpt_index);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -3924,9 +4447,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetAddRelaxType(pcg_precond, add_relax_type);
          HYPRE_BoomerAMGSetAddRelaxWt(pcg_precond, add_relax_wt);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
@@ -4392,6 +4925,11 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetSmoothNumLevels(pcg_precond, smooth_num_levels);
             HYPRE_BoomerAMGSetSmoothNumSweeps(pcg_precond, smooth_num_sweeps);
             HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+            HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+            HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+            HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+            HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+            HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
             HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
             HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
             HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -4499,6 +5037,11 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
             HYPRE_BoomerAMGSetSchwarzRlxWeight(pcg_precond, schwarz_rlx_weight);
             HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+            HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+            HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+            HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+            HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+            HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
             HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
             HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
             HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -4774,6 +5317,11 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetSmoothNumLevels(pcg_precond, smooth_num_levels);
             HYPRE_BoomerAMGSetSmoothNumSweeps(pcg_precond, smooth_num_sweeps);
             HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+            HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+            HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+            HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+            HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+            HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
             HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
             HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
             HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -4886,6 +5434,11 @@ main( hypre_int argc,
             HYPRE_BoomerAMGSetDomainType(pcg_precond, domain_type);
             HYPRE_BoomerAMGSetSchwarzRlxWeight(pcg_precond, schwarz_rlx_weight);
             HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+            HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+            HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+            HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+            HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+            HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
             HYPRE_BoomerAMGSetMaxLevels(pcg_precond, max_levels);
             HYPRE_BoomerAMGSetMaxRowSum(pcg_precond, max_row_sum);
             HYPRE_BoomerAMGSetDebugFlag(pcg_precond, debug_flag);
@@ -5122,6 +5675,7 @@ main( hypre_int argc,
       HYPRE_GMRESSetLogging(pcg_solver, 1);
       HYPRE_GMRESSetPrintLevel(pcg_solver, ioutdat);
       HYPRE_GMRESSetRelChange(pcg_solver, rel_change);
+      HYPRE_GMRESSetPipelined(pcg_solver, pipelined);
 
       if (solver_id == 3)
       {
@@ -5153,6 +5707,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5183,9 +5739,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5317,6 +5883,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5347,9 +5915,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5454,6 +6032,8 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
+         HYPRE_ILUSetLevelScheduling(pcg_precond, ilu_level_sched);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -5608,6 +6188,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5638,9 +6220,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -5794,6 +6386,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -5824,9 +6418,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -6006,6 +6610,8 @@ main( hypre_int argc,
          HYPRE_ILUCreate(&pcg_precond);
          HYPRE_ILUSetType(pcg_precond, ilu_type);
          HYPRE_ILUSetLevelOfFill(pcg_precond, ilu_lfil);
+         HYPRE_ILUSetLocalReordering(pcg_precond, ilu_reordering);
+         HYPRE_ILUSetLevelScheduling(pcg_precond, ilu_level_sched);
          /* set print level */
          HYPRE_ILUSetPrintLevel(pcg_precond, 1);
          /* set max iterations */
@@ -6161,6 +6767,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6191,9 +6799,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -6486,6 +7104,7 @@ main( hypre_int argc,
       HYPRE_COGMRESSetKDim(pcg_solver, k_dim);
       HYPRE_COGMRESSetUnroll(pcg_solver, unroll);
       HYPRE_COGMRESSetCGS(pcg_solver, cgs);
+      HYPRE_COGMRESSetSStep(pcg_solver, s_step);
       HYPRE_COGMRESSetMaxIter(pcg_solver, max_iter);
       HYPRE_COGMRESSetTol(pcg_solver, tol);
       HYPRE_COGMRESSetAbsoluteTol(pcg_solver, atol);
@@ -6510,6 +7129,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6540,9 +7161,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -6825,6 +7456,8 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetMeasureType(pcg_precond, measure_type);
          HYPRE_BoomerAMGSetStrongThreshold(pcg_precond, strong_threshold);
          HYPRE_BoomerAMGSetSeqThreshold(pcg_precond, seq_threshold);
+         HYPRE_BoomerAMGSetAgglomThreshold(pcg_precond, agglom_threshold);
+         HYPRE_BoomerAMGSetAgglomFactor(pcg_precond, agglom_factor);
          HYPRE_BoomerAMGSetRedundant(pcg_precond, redundant);
          HYPRE_BoomerAMGSetMaxCoarseSize(pcg_precond, coarse_threshold);
          HYPRE_BoomerAMGSetMinCoarseSize(pcg_precond, min_coarse_size);
@@ -6850,9 +7483,19 @@ main( hypre_int argc,
          HYPRE_BoomerAMGSetChebyOrder(pcg_precond, cheby_order);
          HYPRE_BoomerAMGSetChebyFraction(pcg_precond, cheby_fraction);
          HYPRE_BoomerAMGSetChebyEigEst(pcg_precond, cheby_eig_est);
+         HYPRE_BoomerAMGSetFSAIAlgoType(pcg_precond, fsai_algo_type);
+         HYPRE_BoomerAMGSetFSAIMaxSteps(pcg_precond, fsai_max_steps);
+         HYPRE_BoomerAMGSetFSAIMaxStepSize(pcg_precond, fsai_max_step_size);
+         HYPRE_BoomerAMGSetFSAIKapTolerance(pcg_precond, fsai_kap_tolerance);
+         HYPRE_BoomerAMGSetFSAIEigMaxIters(pcg_precond, fsai_eig_max_iters);
          HYPRE_BoomerAMGSetChebyVariant(pcg_precond, cheby_variant);
          HYPRE_BoomerAMGSetChebyScale(pcg_precond, cheby_scale);
          HYPRE_BoomerAMGSetRelaxOrder(pcg_precond, relax_order);
+         HYPRE_BoomerAMGSetRelaxOverlap(pcg_precond, relax_overlap);
+         HYPRE_BoomerAMGSetMixedPrecisionLevel(pcg_precond, mixed_level);
+         HYPRE_BoomerAMGSetCompressColumns(pcg_precond, compress_cols);
+         HYPRE_BoomerAMGSetFusedCycle(pcg_precond, fused_cycle);
+         HYPRE_BoomerAMGSetCycleMinRowsPerThread(pcg_precond, cycle_min_rows);
          HYPRE_BoomerAMGSetRelaxWt(pcg_precond, relax_wt);
          HYPRE_BoomerAMGSetOuterWt(pcg_precond, outer_wt);
          if (level_w > -1)
@@ -7148,6 +7791,8 @@ main( hypre_int argc,
       HYPRE_ILUSetType(ilu_solver, ilu_type);
       /* set level of fill */
       HYPRE_ILUSetLevelOfFill(ilu_solver, ilu_lfil);
+      HYPRE_ILUSetLocalReordering(ilu_solver, ilu_reordering);
+      HYPRE_ILUSetLevelScheduling(ilu_solver, ilu_level_sched);
       /* set print level */
       HYPRE_ILUSetPrintLevel(ilu_solver, 2);
       /* set max iterations */
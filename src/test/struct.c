@@ -51,6 +51,10 @@ HYPRE_Int AddValuesVector( hypre_StructGrid  *gridvector,
                            HYPRE_Int          *period,
                            HYPRE_Real         value  )  ;
 
+HYPRE_Int AddValuesField( hypre_StructGrid   *gridfield,
+                          hypre_StructVector *field,
+                          HYPRE_Real          kvalue );
+
 /*--------------------------------------------------------------------------
  * Test driver for structured matrix interface (structured storage)
  *--------------------------------------------------------------------------*/
@@ -72,6 +76,7 @@ main( hypre_int argc,
    HYPRE_Int           px, py, pz;
    HYPRE_Real          cx, cy, cz;
    HYPRE_Real          conx, cony, conz;
+   HYPRE_Real          kfield;
    HYPRE_Int           solver_id;
    HYPRE_Int           solver_type;
    HYPRE_Int           recompute_res;
@@ -85,6 +90,8 @@ main( hypre_int argc,
    HYPRE_StructMatrix  A;
    HYPRE_StructVector  b;
    HYPRE_StructVector  x;
+   HYPRE_StructVector  K;
+   HYPRE_Real         *kweights;
 
    HYPRE_StructSolver  solver;
    HYPRE_StructSolver  precond;
@@ -100,6 +107,9 @@ main( hypre_int argc,
    HYPRE_Int           n_pre, n_post;
    HYPRE_Int           nblocks ;
    HYPRE_Int           skip;
+   HYPRE_Int           tblock;
+   HYPRE_Int           boxloop_tile[3];
+   HYPRE_Int           boxloop_schedule;
    HYPRE_Int           sym;
    HYPRE_Int           rap;
    HYPRE_Int           relax;
@@ -198,6 +208,11 @@ main( hypre_int argc,
    dim = 3;
 
    skip  = 0;
+   tblock = 1;
+   boxloop_tile[0] = 0;
+   boxloop_tile[1] = 0;
+   boxloop_tile[2] = 0;
+   boxloop_schedule = 0;
    sym  = 1;
    rap = 0;
    relax = 1;
@@ -223,6 +238,7 @@ main( hypre_int argc,
    conx = 0.0;
    cony = 0.0;
    conz = 0.0;
+   kfield = 0.0;
 
    n_pre  = 1;
    n_post = 1;
@@ -310,6 +326,11 @@ main( hypre_int argc,
          cy = atof(argv[arg_index++]);
          cz = atof(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-kfield") == 0 )
+      {
+         arg_index++;
+         kfield = atof(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-convect") == 0 )
       {
          arg_index++;
@@ -389,6 +410,28 @@ main( hypre_int argc,
          arg_index++;
          skip = atoi(argv[arg_index++]);
       }
+      else if ( strcmp(argv[arg_index], "-tblock") == 0 )
+      {
+         arg_index++;
+         tblock = atoi(argv[arg_index++]);
+         /* enough ghost layers for tblock sweeps with a unit stencil */
+         for (i = 0; i < 6; i++)
+         {
+            num_ghost[i] = hypre_max(num_ghost[i], tblock);
+         }
+      }
+      else if ( strcmp(argv[arg_index], "-tile") == 0 )
+      {
+         arg_index++;
+         boxloop_tile[0] = atoi(argv[arg_index++]);
+         boxloop_tile[1] = atoi(argv[arg_index++]);
+         boxloop_tile[2] = atoi(argv[arg_index++]);
+      }
+      else if ( strcmp(argv[arg_index], "-tilesched") == 0 )
+      {
+         arg_index++;
+         boxloop_schedule = atoi(argv[arg_index++]);
+      }
       else if ( strcmp(argv[arg_index], "-jump") == 0 )
       {
          arg_index++;
@@ -577,7 +620,14 @@ main( hypre_int argc,
       hypre_printf("                        3 - R/B Gauss-Seidel (nonsymmetric)\n");
       hypre_printf("  -w <jacobi weight>  : jacobi weight\n");
       hypre_printf("  -skip <s>           : skip levels in PFMG (0 or 1)\n");
+      hypre_printf("  -tblock <k>         : Jacobi sweeps per ghost exchange in PFMG\n");
+      hypre_printf("  -tile <tx> <ty> <tz>: split box loops into tiles of this size\n");
+      hypre_printf("                        (host builds, 0 = no splitting)\n");
+      hypre_printf("  -tilesched <s>      : hand out tiles statically (0) or on demand (1)\n");
       hypre_printf("  -sym <s>            : symmetric storage (1) or not (0)\n");
+      hypre_printf("  -kfield <k>         : compute the coefficients on the fly from a\n");
+      hypre_printf("                        diffusion coefficient that is k for x >= 0\n");
+      hypre_printf("                        and 1 elsewhere (PFMG and Jacobi solvers)\n");
       hypre_printf("  -jump <num>         : num levels to jump in SparseMSG\n");
       hypre_printf("  -solver_type <ID>   : solver type for Hybrid\n");
       hypre_printf("                        1 - PCG (default)\n");
@@ -663,6 +713,24 @@ main( hypre_int argc,
       sym = 0;
    }
 
+   HYPRE_SetBoxLoopTile(3, boxloop_tile);
+   HYPRE_SetBoxLoopSchedule(boxloop_schedule);
+
+   /* solvers that only use matvecs and Jacobi sweeps on the fine grid */
+   if (kfield > 0.0 &&
+       (!(solver_id == 1 || solver_id == 8 ||
+          (solver_id > 10 && solver_id < 70 && (solver_id / 10) != 2 &&
+           ((solver_id % 10) == 1 || (solver_id % 10) == 7 || (solver_id % 10) == 9))) ||
+        relax == 2 || relax == 3))
+   {
+      if (myid == 0)
+      {
+         hypre_printf("Error: -kfield needs a PFMG (Jacobi relaxation), Jacobi or\n");
+         hypre_printf("       unpreconditioned solver\n");
+      }
+      exit(1);
+   }
+
    /*-----------------------------------------------------------
     * Print driver parameters
     *-----------------------------------------------------------*/
@@ -1063,20 +1131,59 @@ main( hypre_int argc,
          }
 
          HYPRE_StructMatrixSetSymmetric(A, sym);
-         HYPRE_StructMatrixInitialize(A);
 
-         /*-----------------------------------------------------------
-          * Fill in the matrix elements
-          *-----------------------------------------------------------*/
+         if (kfield > 0.0)
+         {
+            /*--------------------------------------------------------
+             * The coefficients are computed from a diffusion
+             * coefficient field and are not stored
+             *--------------------------------------------------------*/
 
-         AddValuesMatrix(A,grid,cx,cy,cz,conx,cony,conz);
+            HYPRE_StructVectorCreate(hypre_MPI_COMM_WORLD, grid, &K);
+            HYPRE_StructVectorInitialize(K);
+            AddValuesField(grid, K, kfield);
+            HYPRE_StructVectorAssemble(K);
 
-         /* Zero out stencils reaching to real boundary */
-         /* But in constant coefficient case, no special stencils! */
+            kweights = hypre_CTAlloc(HYPRE_Real, (2-sym)*dim + 1, HYPRE_MEMORY_HOST);
+            for (s = 0; s < (2-sym)*dim + 1; s++)
+            {
+               kweights[s] = 0.0;
+               if (offsets[s][0] != 0)
+               {
+                  kweights[s] = -cx;
+               }
+               else if (dim > 1 && offsets[s][1] != 0)
+               {
+                  kweights[s] = -cy;
+               }
+               else if (dim > 2 && offsets[s][2] != 0)
+               {
+                  kweights[s] = -cz;
+               }
+            }
+            HYPRE_StructMatrixSetCoeffField(A, K, kweights);
+            hypre_TFree(kweights, HYPRE_MEMORY_HOST);
+            HYPRE_StructVectorDestroy(K);
 
-         if ( constant_coefficient == 0 )
+            HYPRE_StructMatrixInitialize(A);
+         }
+         else
          {
-            SetStencilBndry(A,grid,periodic);
+            HYPRE_StructMatrixInitialize(A);
+
+            /*-----------------------------------------------------------
+             * Fill in the matrix elements
+             *-----------------------------------------------------------*/
+
+            AddValuesMatrix(A,grid,cx,cy,cz,conx,cony,conz);
+
+            /* Zero out stencils reaching to real boundary */
+            /* But in constant coefficient case, no special stencils! */
+
+            if ( constant_coefficient == 0 )
+            {
+               SetStencilBndry(A,grid,periodic);
+            }
          }
          HYPRE_StructMatrixAssemble(A);
          /*-----------------------------------------------------------
@@ -1423,6 +1530,7 @@ main( hypre_int argc,
          HYPRE_StructPFMGSetNumPreRelax(solver, n_pre);
          HYPRE_StructPFMGSetNumPostRelax(solver, n_post);
          HYPRE_StructPFMGSetSkipRelax(solver, skip);
+         HYPRE_StructPFMGSetTemporalBlocking(solver, tblock);
          /*HYPRE_StructPFMGSetDxyz(solver, dxyz);*/
          HYPRE_StructPFMGSetPrintLevel(solver, 1);
          HYPRE_StructPFMGSetLogging(solver, 1);
@@ -1601,6 +1709,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -1766,6 +1875,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2000,6 +2110,7 @@ main( hypre_int argc,
                HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
                HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
                HYPRE_StructPFMGSetSkipRelax(precond, skip);
+               HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
                /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
                HYPRE_StructPFMGSetPrintLevel(precond, 0);
                HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2245,6 +2356,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2369,6 +2481,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2520,6 +2633,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2671,6 +2785,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2769,6 +2884,7 @@ main( hypre_int argc,
             HYPRE_StructPFMGSetNumPreRelax(precond, n_pre);
             HYPRE_StructPFMGSetNumPostRelax(precond, n_post);
             HYPRE_StructPFMGSetSkipRelax(precond, skip);
+            HYPRE_StructPFMGSetTemporalBlocking(precond, tblock);
             /*HYPRE_StructPFMGSetDxyz(precond, dxyz);*/
             HYPRE_StructPFMGSetPrintLevel(precond, 0);
             HYPRE_StructPFMGSetLogging(precond, 0);
@@ -2897,6 +3013,52 @@ main( hypre_int argc,
    return (0);
 }
 
+/*-------------------------------------------------------------------------
+ * set a diffusion coefficient field: kvalue for x >= 0 and 1 elsewhere.
+ *-------------------------------------------------------------------------*/
+
+HYPRE_Int
+AddValuesField( hypre_StructGrid   *gridfield,
+                hypre_StructVector *field,
+                HYPRE_Real          kvalue )
+{
+   hypre_BoxArray     *gridboxes;
+   hypre_Box          *box;
+   hypre_IndexRef      ilower;
+   hypre_IndexRef      iupper;
+   HYPRE_Real         *values;
+   HYPRE_Int           ib, i, volume;
+   hypre_Index         loop_size;
+
+   gridboxes = hypre_StructGridBoxes(gridfield);
+
+   hypre_ForBoxI(ib, gridboxes)
+   {
+      box    = hypre_BoxArrayBox(gridboxes, ib);
+      volume = hypre_BoxVolume(box);
+      ilower = hypre_BoxIMin(box);
+      iupper = hypre_BoxIMax(box);
+      hypre_BoxGetSize(box, loop_size);
+
+      values = hypre_CTAlloc(HYPRE_Real, volume, HYPRE_MEMORY_HOST);
+
+      /* the first index varies fastest */
+      for (i = 0; i < volume; i++)
+      {
+         values[i] = 1.0;
+         if (hypre_IndexD(ilower, 0) + (i % hypre_IndexD(loop_size, 0)) >= 0)
+         {
+            values[i] = kvalue;
+         }
+      }
+
+      HYPRE_StructVectorSetBoxValues(field, ilower, iupper, values);
+      hypre_TFree(values, HYPRE_MEMORY_HOST);
+   }
+
+   return hypre_error_flag;
+}
+
 /*-------------------------------------------------------------------------
  * add constant values to a vector. Need to pass the initialized vector, grid,
  * period of grid and the constant value.
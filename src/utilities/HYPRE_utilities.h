@@ -116,6 +116,35 @@ typedef HYPRE_Int MPI_Comm;
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
 
+/*--------------------------------------------------------------------------
+ * HYPRE performance options
+ *--------------------------------------------------------------------------*/
+
+/* Use (1) or not (0, default) a SELL-C-sigma copy of the CSR matrices in
+   the host matvec.  The copy is built on first use and rebuilt after the
+   matrix values are changed through the IJ interface. */
+HYPRE_Int HYPRE_SetSpMVUseSELL(HYPRE_Int use_sell);
+
+/* Use (1) or not (0, default) the NBX algorithm (Issend + Ibarrier) for the
+   sparse data exchanges that discover communication partners.  Requires
+   MPI-3; ignored otherwise. */
+HYPRE_Int HYPRE_SetExchangeNBX(HYPRE_Int use_nbx);
+
+/* Use (1) or not (0, default) MPI neighborhood collectives for the ParCSR
+   matvec communication.  Applies to communication packages created after
+   the call.  Requires MPI-3; ignored otherwise. */
+HYPRE_Int HYPRE_SetCommNeighborColl(HYPRE_Int use_neighbor_coll);
+
+/* Tile sizes of the host BoxLoops of the Struct and SStruct interfaces in
+   the first ndim (at most 3) dimensions.  A size of 0 (default) means no
+   tiling in that dimension; tiling is used as soon as one size is
+   positive. */
+HYPRE_Int HYPRE_SetBoxLoopTile(HYPRE_Int ndim, HYPRE_Int *tile);
+
+/* Hand out the BoxLoop tiles to the threads round-robin (0, default) or on
+   demand (1). */
+HYPRE_Int HYPRE_SetBoxLoopSchedule(HYPRE_Int schedule);
+
 /*--------------------------------------------------------------------------
  * HYPRE error user functions
  *--------------------------------------------------------------------------*/
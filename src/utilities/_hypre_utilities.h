@@ -219,6 +219,7 @@ extern "C" {
 #define MPI_Wtime           hypre_MPI_Wtime
 #define MPI_Wtick           hypre_MPI_Wtick
 #define MPI_Barrier         hypre_MPI_Barrier
+#define MPI_Ibarrier        hypre_MPI_Ibarrier
 #define MPI_Comm_create     hypre_MPI_Comm_create
 #define MPI_Comm_dup        hypre_MPI_Comm_dup
 #define MPI_Comm_f2c        hypre_MPI_Comm_f2c
@@ -247,6 +248,7 @@ extern "C" {
 #define MPI_Send_init       hypre_MPI_Send_init
 #define MPI_Recv_init       hypre_MPI_Recv_init
 #define MPI_Irsend          hypre_MPI_Irsend
+#define MPI_Issend          hypre_MPI_Issend
 #define MPI_Startall        hypre_MPI_Startall
 #define MPI_Probe           hypre_MPI_Probe
 #define MPI_Iprobe          hypre_MPI_Iprobe
@@ -256,6 +258,7 @@ extern "C" {
 #define MPI_Waitall         hypre_MPI_Waitall
 #define MPI_Waitany         hypre_MPI_Waitany
 #define MPI_Allreduce       hypre_MPI_Allreduce
+#define MPI_Iallreduce      hypre_MPI_Iallreduce
 #define MPI_Reduce          hypre_MPI_Reduce
 #define MPI_Scan            hypre_MPI_Scan
 #define MPI_Request_free    hypre_MPI_Request_free
@@ -267,6 +270,8 @@ extern "C" {
 #define MPI_Type_free       hypre_MPI_Type_free
 #define MPI_Op_free         hypre_MPI_Op_free
 #define MPI_Op_create       hypre_MPI_Op_create
+#define MPI_Dist_graph_create_adjacent hypre_MPI_Dist_graph_create_adjacent
+#define MPI_Ineighbor_alltoallv hypre_MPI_Ineighbor_alltoallv
 #define MPI_User_function   hypre_MPI_User_function
 #define MPI_Info_create     hypre_MPI_Info_create
 
@@ -391,6 +396,7 @@ HYPRE_Int hypre_MPI_Abort( hypre_MPI_Comm comm , HYPRE_Int errorcode );
 HYPRE_Real hypre_MPI_Wtime( void );
 HYPRE_Real hypre_MPI_Wtick( void );
 HYPRE_Int hypre_MPI_Barrier( hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Ibarrier( hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Comm_create( hypre_MPI_Comm comm , hypre_MPI_Group group , hypre_MPI_Comm *newcomm );
 HYPRE_Int hypre_MPI_Comm_dup( hypre_MPI_Comm comm , hypre_MPI_Comm *newcomm );
 hypre_MPI_Comm hypre_MPI_Comm_f2c( hypre_int comm );
@@ -418,6 +424,7 @@ HYPRE_Int hypre_MPI_Irecv( void *buf , HYPRE_Int count , hypre_MPI_Datatype data
 HYPRE_Int hypre_MPI_Send_init( void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , HYPRE_Int dest , HYPRE_Int tag , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Recv_init( void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , HYPRE_Int dest , HYPRE_Int tag , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Irsend( void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , HYPRE_Int dest , HYPRE_Int tag , hypre_MPI_Comm comm , hypre_MPI_Request *request );
+HYPRE_Int hypre_MPI_Issend( void *buf , HYPRE_Int count , hypre_MPI_Datatype datatype , HYPRE_Int dest , HYPRE_Int tag , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Startall( HYPRE_Int count , hypre_MPI_Request *array_of_requests );
 HYPRE_Int hypre_MPI_Probe( HYPRE_Int source , HYPRE_Int tag , hypre_MPI_Comm comm , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Iprobe( HYPRE_Int source , HYPRE_Int tag , hypre_MPI_Comm comm , HYPRE_Int *flag , hypre_MPI_Status *status );
@@ -427,6 +434,7 @@ HYPRE_Int hypre_MPI_Wait( hypre_MPI_Request *request , hypre_MPI_Status *status
 HYPRE_Int hypre_MPI_Waitall( HYPRE_Int count , hypre_MPI_Request *array_of_requests , hypre_MPI_Status *array_of_statuses );
 HYPRE_Int hypre_MPI_Waitany( HYPRE_Int count , hypre_MPI_Request *array_of_requests , HYPRE_Int *index , hypre_MPI_Status *status );
 HYPRE_Int hypre_MPI_Allreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
+HYPRE_Int hypre_MPI_Iallreduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 HYPRE_Int hypre_MPI_Reduce( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , HYPRE_Int root , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Scan( void *sendbuf , void *recvbuf , HYPRE_Int count , hypre_MPI_Datatype datatype , hypre_MPI_Op op , hypre_MPI_Comm comm );
 HYPRE_Int hypre_MPI_Request_free( hypre_MPI_Request *request );
@@ -438,6 +446,8 @@ HYPRE_Int hypre_MPI_Type_commit( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Type_free( hypre_MPI_Datatype *datatype );
 HYPRE_Int hypre_MPI_Op_free( hypre_MPI_Op *op );
 HYPRE_Int hypre_MPI_Op_create( hypre_MPI_User_function *function , hypre_int commute , hypre_MPI_Op *op );
+HYPRE_Int hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm comm , HYPRE_Int indegree , HYPRE_Int *sources , HYPRE_Int outdegree , HYPRE_Int *destinations , HYPRE_Int reorder , hypre_MPI_Comm *comm_dist_graph );
+HYPRE_Int hypre_MPI_Ineighbor_alltoallv( void *sendbuf , hypre_int *sendcounts , hypre_int *sdispls , hypre_MPI_Datatype sendtype , void *recvbuf , hypre_int *recvcounts , hypre_int *rdispls , hypre_MPI_Datatype recvtype , hypre_MPI_Comm comm , hypre_MPI_Request *request );
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type(hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm);
 HYPRE_Int hypre_MPI_Info_create(hypre_MPI_Info *info);
@@ -670,6 +680,16 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 }                                                                                                                                     \
 )
 
+#define hypre_CTAllocFirstTouch(type, count, location)                                                                                \
+(                                                                                                                                     \
+{                                                                                                                                     \
+   void *ptr = hypre_CAllocFirstTouch((size_t)(count), (size_t)sizeof(type), location);                                               \
+   hypre_MemoryTrackerInsert( hypre_memory_tracker_t("calloc", ptr, sizeof(type)*(count), hypre_GetActualMemLocation(location),       \
+                              __FILE__, __func__, __LINE__) );                                                                        \
+   (type *) ptr;                                                                                                                      \
+}                                                                                                                                     \
+)
+
 #define hypre_TReAlloc(ptr, type, count, location)                                      \
 (                                                                                       \
 {                                                                                       \
@@ -726,6 +746,9 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 #define hypre_CTAlloc(type, count, location) \
 ( (type *) hypre_CAlloc((size_t)(count), (size_t)sizeof(type), location) )
 
+#define hypre_CTAllocFirstTouch(type, count, location) \
+( (type *) hypre_CAllocFirstTouch((size_t)(count), (size_t)sizeof(type), location) )
+
 #define hypre_TReAlloc(ptr, type, count, location) \
 ( (type *) hypre_ReAlloc((char *)ptr, (size_t)(sizeof(type) * (count)), location) )
 
@@ -743,6 +766,14 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* work arrays from the scoped host arena (see hypre_memory_arena.c); they are
+   released by hypre_HostArenaPop and must not be passed to hypre_TFree */
+#define hypre_ArenaTAlloc(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count))) )
+
+#define hypre_ArenaCTAlloc(type, count) \
+( (type *) hypre_HostArenaCAlloc((size_t)(count), (size_t)sizeof(type)) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -753,6 +784,7 @@ void * hypre_Memset(void *ptr, HYPRE_Int value, size_t num, HYPRE_MemoryLocation
 void   hypre_MemPrefetch(void *ptr, size_t size, HYPRE_MemoryLocation location);
 void * hypre_MAlloc(size_t size, HYPRE_MemoryLocation location);
 void * hypre_CAlloc( size_t count, size_t elt_size, HYPRE_MemoryLocation location);
+void * hypre_CAllocFirstTouch( size_t count, size_t elt_size, HYPRE_MemoryLocation location);
 void   hypre_Free(void *ptr, HYPRE_MemoryLocation location);
 void   hypre_Memcpy(void *dst, void *src, size_t size, HYPRE_MemoryLocation loc_dst, HYPRE_MemoryLocation loc_src);
 void * hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location);
@@ -768,6 +800,13 @@ HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory
 HYPRE_Int hypre_PrintMemoryTracker();
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
+/* hypre_memory_arena.c */
+HYPRE_Int hypre_HostArenaPush( void );
+HYPRE_Int hypre_HostArenaPop( void );
+void * hypre_HostArenaMAlloc( size_t size );
+void * hypre_HostArenaCAlloc( size_t count, size_t elt_size );
+HYPRE_Int hypre_HostArenaDestroy( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
@@ -1130,6 +1169,7 @@ typedef struct
 HYPRE_Int hypre_CreateBinaryTree(HYPRE_Int, HYPRE_Int, hypre_BinaryTree*);
 HYPRE_Int hypre_DestroyBinaryTree(hypre_BinaryTree*);
 HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list, void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size, HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size, HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
+HYPRE_Int hypre_DataExchangeListNBX(HYPRE_Int num_contacts, HYPRE_Int *contact_proc_list, void *contact_send_buf, HYPRE_Int *contact_send_buf_starts, HYPRE_Int contact_obj_size, HYPRE_Int response_obj_size, hypre_DataExchangeResponse *response_obj, HYPRE_Int max_response_size, HYPRE_Int rnum, MPI_Comm comm, void **p_response_recv_buf, HYPRE_Int **p_response_recv_buf_starts);
 
 #endif /* end of header */
 
@@ -1196,6 +1236,16 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV: use the SELL-C-sigma shadow of CSR matrices */
+   HYPRE_Int              spmv_use_sell;
+   /* sparse data exchange: use NBX in hypre_DataExchangeList */
+   HYPRE_Int              exchange_nbx;
+   /* ParCSR matvec communication: use MPI-3 neighborhood collectives */
+   HYPRE_Int              comm_neighbor_coll;
+   /* host BoxLoops: tile sizes per dimension (0 = no tiling) and tile
+      scheduling over threads (0 = static, 1 = dynamic) */
+   HYPRE_Int              boxloop_tile[3];
+   HYPRE_Int              boxloop_schedule;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -1205,6 +1255,11 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSELL(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleExchangeNBX(hypre_handle)                    ((hypre_handle) -> exchange_nbx)
+#define hypre_HandleCommNeighborColl(hypre_handle)               ((hypre_handle) -> comm_neighbor_coll)
+#define hypre_HandleBoxLoopTile(hypre_handle)                    ((hypre_handle) -> boxloop_tile)
+#define hypre_HandleBoxLoopSchedule(hypre_handle)                ((hypre_handle) -> boxloop_schedule)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
@@ -1278,6 +1333,11 @@ hypre_Handle* hypre_HandleCreate();
 HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
+HYPRE_Int HYPRE_SetSpMVUseSELL(HYPRE_Int use_sell);
+HYPRE_Int HYPRE_SetExchangeNBX(HYPRE_Int use_nbx);
+HYPRE_Int HYPRE_SetCommNeighborColl(HYPRE_Int use_neighbor_coll);
+HYPRE_Int HYPRE_SetBoxLoopTile(HYPRE_Int ndim, HYPRE_Int *tile);
+HYPRE_Int HYPRE_SetBoxLoopSchedule(HYPRE_Int schedule);
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
 
 /* hypre_qsort.c */
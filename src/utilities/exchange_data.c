@@ -183,6 +183,17 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts,
    const HYPRE_Int response_tag = 1002*rnum;
    const HYPRE_Int term_tag =  1004*rnum;  
    const HYPRE_Int post_tag = 1006*rnum;
+
+#if !defined(HYPRE_SEQUENTIAL) && MPI_VERSION >= 3
+   if (hypre_HandleExchangeNBX(hypre_handle()))
+   {
+      return hypre_DataExchangeListNBX(num_contacts, contact_proc_list, contact_send_buf,
+                                       contact_send_buf_starts, contact_obj_size,
+                                       response_obj_size, response_obj, max_response_size,
+                                       rnum, comm, p_response_recv_buf,
+                                       p_response_recv_buf_starts);
+   }
+#endif
    
    hypre_MPI_Comm_size(comm, &num_procs );
    hypre_MPI_Comm_rank(comm, &myid );
@@ -575,3 +586,200 @@ HYPRE_Int hypre_DataExchangeList(HYPRE_Int num_contacts,
 
    return hypre_error_flag;
 }
+
+/*---------------------------------------------------
+ * hypre_DataExchangeListNBX()
+ * Same interface and semantics as hypre_DataExchangeList, but
+ * termination is detected with the NBX algorithm (Hoefler et al.):
+ * contacts are sent with synchronous sends, and once all of them
+ * have been matched the processor enters a non-blocking barrier,
+ * answering incoming contacts until the barrier completes.  This
+ * replaces the binary-tree termination sweep (and its O(log P)
+ * rounds of point-to-point messages) by a single MPI-3 collective.
+ *
+ * Responses are sent with their exact size, so max_response_size
+ * is only used as the initial size of the response buffer handed
+ * to fill_response; no extra "post" messages are needed.  As for
+ * the tree version, two consecutive exchanges on the same
+ * communicator must use different rnums.
+ *----------------------------------------------------*/
+
+HYPRE_Int hypre_DataExchangeListNBX(HYPRE_Int num_contacts,
+                                    HYPRE_Int *contact_proc_list,
+                                    void *contact_send_buf,
+                                    HYPRE_Int *contact_send_buf_starts,
+                                    HYPRE_Int contact_obj_size,
+                                    HYPRE_Int response_obj_size,
+                                    hypre_DataExchangeResponse *response_obj,
+                                    HYPRE_Int max_response_size,
+                                    HYPRE_Int rnum, MPI_Comm comm,
+                                    void **p_response_recv_buf,
+                                    HYPRE_Int **p_response_recv_buf_starts)
+{
+   HYPRE_Int  i, size, proc;
+   HYPRE_Int  contact_flag, sends_complete, barrier_active, terminate;
+   HYPRE_Int  contact_size, recv_contact_buf_size = 0;
+   HYPRE_Int  response_message_size = 0;
+   HYPRE_Int  response_recv_buf_size, total_size;
+   HYPRE_Int  overhead;
+
+   void      *start_ptr;
+   void      *recv_contact_buf = NULL;
+   void      *send_response_buf;
+   char      *response_recv_buf;
+   HYPRE_Int *response_recv_buf_starts;
+
+   char              **response_send_bufs = NULL;
+   hypre_MPI_Request  *response_send_requests = NULL;
+   HYPRE_Int           num_response_sends = 0, response_send_storage = 0;
+
+   hypre_MPI_Request  *contact_requests = NULL;
+   hypre_MPI_Request   barrier_request;
+   hypre_MPI_Status    status;
+
+   const HYPRE_Int contact_tag  = 1008*rnum;
+   const HYPRE_Int response_tag = 1010*rnum;
+
+   /* if the response_obj_size or contact_obj_size is 0, set to sizeof(HYPRE_Int) */
+   if (!response_obj_size) response_obj_size = sizeof(HYPRE_Int);
+   if (!contact_obj_size) contact_obj_size = sizeof(HYPRE_Int);
+
+   /* fill_response may grow the buffer by storage+overhead */
+   overhead = ceil((HYPRE_Real) sizeof(HYPRE_Int)/response_obj_size);
+   response_obj->send_response_overhead = overhead;
+   response_obj->send_response_storage = max_response_size;
+   send_response_buf = hypre_CTAlloc(char, (max_response_size+overhead)*response_obj_size,
+                                     HYPRE_MEMORY_HOST);
+
+   /*-------------SEND CONTACTS (SYNCHRONOUS MODE)---------------*/
+
+   if (num_contacts > 0)
+   {
+      contact_requests = hypre_CTAlloc(hypre_MPI_Request, num_contacts, HYPRE_MEMORY_HOST);
+   }
+   start_ptr = contact_send_buf;
+   for (i = 0; i < num_contacts; i++)
+   {
+      size = contact_send_buf_starts[i+1] - contact_send_buf_starts[i];
+      hypre_MPI_Issend(start_ptr, size*contact_obj_size, hypre_MPI_BYTE,
+                       contact_proc_list[i], contact_tag, comm, &contact_requests[i]);
+      start_ptr = (void *) ((char *) start_ptr + size*contact_obj_size);
+   }
+
+   /*---------PROBE LOOP-----------------------------------------*/
+
+   sends_complete = (num_contacts == 0);
+   barrier_active = 0;
+   terminate = 0;
+
+   while (!terminate)
+   {
+      hypre_MPI_Iprobe(hypre_MPI_ANY_SOURCE, contact_tag, comm, &contact_flag, &status);
+
+      if (contact_flag)
+      {
+         proc = status.hypre_MPI_SOURCE;
+         hypre_MPI_Get_count(&status, hypre_MPI_BYTE, &contact_size);
+         contact_size = contact_size/contact_obj_size;
+
+         if (contact_size > recv_contact_buf_size)
+         {
+            recv_contact_buf = hypre_TReAlloc((char*)recv_contact_buf, char,
+                                              contact_obj_size*contact_size, HYPRE_MEMORY_HOST);
+            recv_contact_buf_size = contact_size;
+         }
+         hypre_MPI_Recv(recv_contact_buf, contact_size*contact_obj_size, hypre_MPI_BYTE,
+                        proc, contact_tag, comm, &status);
+
+         response_obj->fill_response(recv_contact_buf, contact_size, proc,
+                                     response_obj, comm, &send_response_buf,
+                                     &response_message_size);
+
+         /* the contacting processor only posts its receive after the barrier,
+            so the response goes out of a private buffer with a non-blocking send */
+         if (num_response_sends == response_send_storage)
+         {
+            response_send_storage += 20;
+            response_send_bufs = hypre_TReAlloc(response_send_bufs, char *,
+                                                response_send_storage, HYPRE_MEMORY_HOST);
+            response_send_requests = hypre_TReAlloc(response_send_requests, hypre_MPI_Request,
+                                                    response_send_storage, HYPRE_MEMORY_HOST);
+         }
+         size = response_message_size*response_obj_size;
+         response_send_bufs[num_response_sends] = hypre_TAlloc(char, size, HYPRE_MEMORY_HOST);
+         hypre_TMemcpy(response_send_bufs[num_response_sends], send_response_buf, char, size,
+                       HYPRE_MEMORY_HOST, HYPRE_MEMORY_HOST);
+         hypre_MPI_Isend(response_send_bufs[num_response_sends], size, hypre_MPI_BYTE,
+                         proc, response_tag, comm, &response_send_requests[num_response_sends]);
+         num_response_sends++;
+      }
+      else if (barrier_active)
+      {
+         hypre_MPI_Test(&barrier_request, &terminate, &status);
+      }
+      else
+      {
+         if (!sends_complete)
+         {
+            hypre_MPI_Testall(num_contacts, contact_requests, &sends_complete,
+                              hypre_MPI_STATUSES_IGNORE);
+         }
+         if (sends_complete)
+         {
+            /* all of my contacts have been received */
+            hypre_MPI_Ibarrier(comm, &barrier_request);
+            barrier_active = 1;
+         }
+      }
+   }
+
+   /*-----------------RECEIVE RESPONSES-----------------------------*/
+
+   /* every contact has been answered (or its answer is in flight), so the
+      responses can be received with their exact sizes in contact order */
+   response_recv_buf_starts = hypre_CTAlloc(HYPRE_Int, num_contacts+1, HYPRE_MEMORY_HOST);
+   response_recv_buf_size = hypre_max(num_contacts*max_response_size, 1);
+   response_recv_buf = hypre_TAlloc(char, response_recv_buf_size*response_obj_size,
+                                    HYPRE_MEMORY_HOST);
+   total_size = 0;
+   for (i = 0; i < num_contacts; i++)
+   {
+      hypre_MPI_Probe(contact_proc_list[i], response_tag, comm, &status);
+      hypre_MPI_Get_count(&status, hypre_MPI_BYTE, &size);
+      response_message_size = size/response_obj_size;
+      if (total_size + response_message_size > response_recv_buf_size)
+      {
+         response_recv_buf_size = hypre_max(2*response_recv_buf_size,
+                                            total_size + response_message_size);
+         response_recv_buf = hypre_TReAlloc(response_recv_buf, char,
+                                            response_recv_buf_size*response_obj_size,
+                                            HYPRE_MEMORY_HOST);
+      }
+      hypre_MPI_Recv(response_recv_buf + total_size*response_obj_size, size, hypre_MPI_BYTE,
+                     contact_proc_list[i], response_tag, comm, &status);
+      total_size += response_message_size;
+      response_recv_buf_starts[i+1] = total_size;
+   }
+
+   /*--------------CLEAN UP------------------- */
+
+   if (num_response_sends)
+   {
+      hypre_MPI_Waitall(num_response_sends, response_send_requests, hypre_MPI_STATUSES_IGNORE);
+      for (i = 0; i < num_response_sends; i++)
+      {
+         hypre_TFree(response_send_bufs[i], HYPRE_MEMORY_HOST);
+      }
+   }
+   hypre_TFree(response_send_bufs, HYPRE_MEMORY_HOST);
+   hypre_TFree(response_send_requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(contact_requests, HYPRE_MEMORY_HOST);
+   hypre_TFree(recv_contact_buf, HYPRE_MEMORY_HOST);
+   hypre_TFree(send_response_buf, HYPRE_MEMORY_HOST);
+
+   /* output  */
+   *p_response_recv_buf = (void *) response_recv_buf;
+   *p_response_recv_buf_starts = response_recv_buf_starts;
+
+   return hypre_error_flag;
+}
@@ -37,6 +37,13 @@ hypre_HandleCreate()
    hypre_Handle *hypre_handle_ = hypre_CTAlloc(hypre_Handle, 1, HYPRE_MEMORY_HOST);
 
    hypre_HandleMemoryLocation(hypre_handle_) = HYPRE_MEMORY_DEVICE;
+   hypre_HandleSpMVUseSELL(hypre_handle_) = 0;
+   hypre_HandleExchangeNBX(hypre_handle_) = 0;
+   hypre_HandleCommNeighborColl(hypre_handle_) = 0;
+   hypre_HandleBoxLoopTile(hypre_handle_)[0] = 0;
+   hypre_HandleBoxLoopTile(hypre_handle_)[1] = 0;
+   hypre_HandleBoxLoopTile(hypre_handle_)[2] = 0;
+   hypre_HandleBoxLoopSchedule(hypre_handle_) = 0;
 
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_HandleDefaultExecPolicy(hypre_handle_) = HYPRE_EXEC_HOST;
@@ -200,6 +207,8 @@ HYPRE_Finalize()
 {
    hypre_HandleDestroy(_hypre_handle);
 
+   hypre_HostArenaDestroy();
+
    /*
 #if defined(HYPRE_USING_KOKKOS)
    Kokkos::finalize ();
@@ -215,3 +224,87 @@ HYPRE_Finalize()
    return hypre_error_flag;
 }
 
+
+/******************************************************************************
+ *
+ * hypre host SpMV: use (1) or not (0) the SELL-C-sigma copy of CSR matrices
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetSpMVUseSELL( HYPRE_Int use_sell )
+{
+   hypre_HandleSpMVUseSELL(hypre_handle()) = use_sell;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre sparse data exchange: use (1) or not (0) the NBX algorithm
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetExchangeNBX( HYPRE_Int use_nbx )
+{
+   hypre_HandleExchangeNBX(hypre_handle()) = use_nbx;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre ParCSR communication: use (1) or not (0) neighborhood collectives
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetCommNeighborColl( HYPRE_Int use_neighbor_coll )
+{
+   hypre_HandleCommNeighborColl(hypre_handle()) = use_neighbor_coll;
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre host BoxLoops: tile sizes in the first ndim dimensions (0: no tiling
+ * in that dimension)
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetBoxLoopTile( HYPRE_Int  ndim,
+                      HYPRE_Int *tile )
+{
+   HYPRE_Int d;
+
+   if (ndim < 0 || ndim > 3)
+   {
+      hypre_error_in_arg(1);
+      return hypre_error_flag;
+   }
+
+   for (d = 0; d < 3; d++)
+   {
+      hypre_HandleBoxLoopTile(hypre_handle())[d] = (d < ndim) ? tile[d] : 0;
+   }
+
+   return hypre_error_flag;
+}
+
+/******************************************************************************
+ *
+ * hypre host BoxLoops: hand out the tiles to the threads round-robin (0) or
+ * on demand (1)
+ *
+ *****************************************************************************/
+
+HYPRE_Int
+HYPRE_SetBoxLoopSchedule( HYPRE_Int schedule )
+{
+   hypre_HandleBoxLoopSchedule(hypre_handle()) = schedule;
+
+   return hypre_error_flag;
+}
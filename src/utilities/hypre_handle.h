@@ -27,6 +27,16 @@ typedef struct
    HYPRE_MemoryLocation   memory_location;
    HYPRE_ExecutionPolicy  default_exec_policy;
    HYPRE_ExecutionPolicy  struct_exec_policy;
+   /* host SpMV: use the SELL-C-sigma shadow of CSR matrices */
+   HYPRE_Int              spmv_use_sell;
+   /* sparse data exchange: use NBX in hypre_DataExchangeList */
+   HYPRE_Int              exchange_nbx;
+   /* ParCSR matvec communication: use MPI-3 neighborhood collectives */
+   HYPRE_Int              comm_neighbor_coll;
+   /* host BoxLoops: tile sizes per dimension (0 = no tiling) and tile
+      scheduling over threads (0 = static, 1 = dynamic) */
+   HYPRE_Int              boxloop_tile[3];
+   HYPRE_Int              boxloop_schedule;
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
    hypre_CudaData        *cuda_data;
 #endif
@@ -36,6 +46,11 @@ typedef struct
 #define hypre_HandleMemoryLocation(hypre_handle)                 ((hypre_handle) -> memory_location)
 #define hypre_HandleDefaultExecPolicy(hypre_handle)              ((hypre_handle) -> default_exec_policy)
 #define hypre_HandleStructExecPolicy(hypre_handle)               ((hypre_handle) -> struct_exec_policy)
+#define hypre_HandleSpMVUseSELL(hypre_handle)                    ((hypre_handle) -> spmv_use_sell)
+#define hypre_HandleExchangeNBX(hypre_handle)                    ((hypre_handle) -> exchange_nbx)
+#define hypre_HandleCommNeighborColl(hypre_handle)               ((hypre_handle) -> comm_neighbor_coll)
+#define hypre_HandleBoxLoopTile(hypre_handle)                    ((hypre_handle) -> boxloop_tile)
+#define hypre_HandleBoxLoopSchedule(hypre_handle)                ((hypre_handle) -> boxloop_schedule)
 #define hypre_HandleCudaData(hypre_handle)                       ((hypre_handle) -> cuda_data)
 
 #define hypre_HandleCurandGenerator(hypre_handle)                hypre_CudaDataCurandGenerator(hypre_HandleCudaData(hypre_handle))
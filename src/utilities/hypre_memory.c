@@ -613,6 +613,52 @@ hypre_CAlloc( size_t count, size_t elt_size, HYPRE_MemoryLocation location)
    return hypre_MAlloc_core(count * elt_size, 1, hypre_GetActualMemLocation(location));
 }
 
+/*--------------------------------------------------------------------------*
+ * hypre_CAllocFirstTouch
+ *
+ * Same as hypre_CAlloc, but with several OpenMP threads host memory is zeroed
+ * by the threads themselves, each on its block of the simple thread partition
+ * of [0, count) (computed in size_t, so count may exceed the HYPRE_Int
+ * range).  With the first-touch page placement policy, the pages then
+ * live on the NUMA node of the thread that works on them in statically
+ * scheduled loops over vector entries or rows, or over the nonzeros of the
+ * load-balanced CSR partition (hypre_CSRMatrixGetLoadBalancedPartitionBegin).
+ * Small arrays, and calls from inside a parallel region, use hypre_CAlloc.
+ *--------------------------------------------------------------------------*/
+
+#define HYPRE_FIRST_TOUCH_MIN_BYTES 65536
+
+void *
+hypre_CAllocFirstTouch( size_t count, size_t elt_size, HYPRE_MemoryLocation location)
+{
+#ifdef HYPRE_USING_OPENMP
+   if ( hypre_GetActualMemLocation(location) == hypre_MEMORY_HOST &&
+        hypre_NumThreads() > 1 && !omp_in_parallel() &&
+        count * elt_size >= HYPRE_FIRST_TOUCH_MIN_BYTES )
+   {
+      char *ptr = (char *) hypre_MAlloc_core(count * elt_size, 0, hypre_MEMORY_HOST);
+
+#pragma omp parallel
+      {
+         /* hypre_GetSimpleThreadPartition of [0, count) */
+         size_t num_threads  = (size_t) hypre_NumActiveThreads();
+         size_t n_per_thread = (count + num_threads - 1) / num_threads;
+         size_t begin = hypre_min(n_per_thread * (size_t) hypre_GetThreadNum(), count);
+         size_t end   = hypre_min(begin + n_per_thread, count);
+
+         if (end > begin)
+         {
+            memset(ptr + begin * elt_size, 0, (end - begin) * elt_size);
+         }
+      }
+
+      return (void *) ptr;
+   }
+#endif
+
+   return hypre_CAlloc(count, elt_size, location);
+}
+
 /*--------------------------------------------------------------------------
  * hypre_Free
  *--------------------------------------------------------------------------*/
@@ -205,6 +205,16 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 }                                                                                                                                     \
 )
 
+#define hypre_CTAllocFirstTouch(type, count, location)                                                                                \
+(                                                                                                                                     \
+{                                                                                                                                     \
+   void *ptr = hypre_CAllocFirstTouch((size_t)(count), (size_t)sizeof(type), location);                                               \
+   hypre_MemoryTrackerInsert( hypre_memory_tracker_t("calloc", ptr, sizeof(type)*(count), hypre_GetActualMemLocation(location),       \
+                              __FILE__, __func__, __LINE__) );                                                                        \
+   (type *) ptr;                                                                                                                      \
+}                                                                                                                                     \
+)
+
 #define hypre_TReAlloc(ptr, type, count, location)                                      \
 (                                                                                       \
 {                                                                                       \
@@ -261,6 +271,9 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 #define hypre_CTAlloc(type, count, location) \
 ( (type *) hypre_CAlloc((size_t)(count), (size_t)sizeof(type), location) )
 
+#define hypre_CTAllocFirstTouch(type, count, location) \
+( (type *) hypre_CAllocFirstTouch((size_t)(count), (size_t)sizeof(type), location) )
+
 #define hypre_TReAlloc(ptr, type, count, location) \
 ( (type *) hypre_ReAlloc((char *)ptr, (size_t)(sizeof(type) * (count)), location) )
 
@@ -278,6 +291,14 @@ static inline void hypre_MemoryTrackerInsert(struct hypre_memory_tracker_t const
 
 #endif /* #ifdef HYPRE_USING_MEMORY_TRACKER */
 
+/* work arrays from the scoped host arena (see hypre_memory_arena.c); they are
+   released by hypre_HostArenaPop and must not be passed to hypre_TFree */
+#define hypre_ArenaTAlloc(type, count) \
+( (type *) hypre_HostArenaMAlloc((size_t)(sizeof(type) * (count))) )
+
+#define hypre_ArenaCTAlloc(type, count) \
+( (type *) hypre_HostArenaCAlloc((size_t)(count), (size_t)sizeof(type)) )
+
 
 /*--------------------------------------------------------------------------
  * Prototypes
@@ -288,6 +309,7 @@ void * hypre_Memset(void *ptr, HYPRE_Int value, size_t num, HYPRE_MemoryLocation
 void   hypre_MemPrefetch(void *ptr, size_t size, HYPRE_MemoryLocation location);
 void * hypre_MAlloc(size_t size, HYPRE_MemoryLocation location);
 void * hypre_CAlloc( size_t count, size_t elt_size, HYPRE_MemoryLocation location);
+void * hypre_CAllocFirstTouch( size_t count, size_t elt_size, HYPRE_MemoryLocation location);
 void   hypre_Free(void *ptr, HYPRE_MemoryLocation location);
 void   hypre_Memcpy(void *dst, void *src, size_t size, HYPRE_MemoryLocation loc_dst, HYPRE_MemoryLocation loc_src);
 void * hypre_ReAlloc(void *ptr, size_t size, HYPRE_MemoryLocation location);
@@ -303,6 +325,13 @@ HYPRE_Int hypre_GetPointerLocation(const void *ptr, hypre_MemoryLocation *memory
 HYPRE_Int hypre_PrintMemoryTracker();
 HYPRE_Int hypre_SetCubMemPoolSize( hypre_uint bin_growth, hypre_uint min_bin, hypre_uint max_bin, size_t max_cached_bytes );
 
+/* hypre_memory_arena.c */
+HYPRE_Int hypre_HostArenaPush( void );
+HYPRE_Int hypre_HostArenaPop( void );
+void * hypre_HostArenaMAlloc( size_t size );
+void * hypre_HostArenaCAlloc( size_t count, size_t elt_size );
+HYPRE_Int hypre_HostArenaDestroy( void );
+
 /* memory_dmalloc.c */
 HYPRE_Int hypre_InitMemoryDebugDML( HYPRE_Int id );
 HYPRE_Int hypre_FinalizeMemoryDebugDML( void );
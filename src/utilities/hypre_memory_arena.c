@@ -0,0 +1,359 @@
+/******************************************************************************
+ * Copyright 1998-2019 Lawrence Livermore National Security, LLC and other
+ * HYPRE Project Developers. See the top-level COPYRIGHT file for details.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ ******************************************************************************/
+
+/******************************************************************************
+ *
+ * Scoped host arena for short-lived work arrays
+ *
+ * A scope is opened with hypre_HostArenaPush and closed with
+ * hypre_HostArenaPop.  Everything obtained with hypre_ArenaTAlloc or
+ * hypre_ArenaCTAlloc in between is released as a unit by the Pop; there is
+ * no per-array free.  Each thread allocates from its own list of chunks, so
+ * allocation inside OpenMP regions needs no locking.  The chunks are kept
+ * from one nested scope to the next, so the inner scopes of a setup do not go
+ * back to malloc or touch new pages; when the outermost scope is closed, each
+ * thread keeps a single chunk and the others are returned to the system.
+ * Push and Pop must be called outside of parallel regions; they mark and
+ * release the chunks of all threads.  The scope depth is shared by all
+ * threads and updated atomically.
+ *
+ *****************************************************************************/
+
+#include "_hypre_utilities.h"
+
+#define HYPRE_HOST_ARENA_MAX_THREADS 1024
+#define HYPRE_HOST_ARENA_MAX_DEPTH   16
+#define HYPRE_HOST_ARENA_CHUNK_SIZE  ((size_t) 1 << 20)
+#define HYPRE_HOST_ARENA_ALIGNMENT   ((size_t) 64)
+
+typedef struct hypre_HostArenaChunk_struct
+{
+   struct hypre_HostArenaChunk_struct *next;
+   size_t                              size;  /* usable bytes */
+   size_t                              used;
+   char                               *data;  /* aligned start of the chunk */
+
+} hypre_HostArenaChunk;
+
+typedef struct
+{
+   hypre_HostArenaChunk *head;
+   hypre_HostArenaChunk *current;              /* NULL: nothing used yet */
+
+   /* position at each open scope; a NULL chunk means "before head" */
+   hypre_HostArenaChunk *mark_chunk[HYPRE_HOST_ARENA_MAX_DEPTH];
+   size_t                mark_used[HYPRE_HOST_ARENA_MAX_DEPTH];
+
+} hypre_HostArena;
+
+static hypre_HostArena *hypre_host_arenas[HYPRE_HOST_ARENA_MAX_THREADS];
+static HYPRE_Int        hypre_host_arena_depth = 0;
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaGetDepth
+ *--------------------------------------------------------------------------*/
+
+static HYPRE_Int
+hypre_HostArenaGetDepth( void )
+{
+   HYPRE_Int depth;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic read
+#endif
+   depth = hypre_host_arena_depth;
+
+   return depth;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaChunkCreate
+ *--------------------------------------------------------------------------*/
+
+static hypre_HostArenaChunk *
+hypre_HostArenaChunkCreate( size_t size )
+{
+   hypre_HostArenaChunk *chunk;
+   size_t                offset;
+
+   chunk = (hypre_HostArenaChunk *)
+      hypre_MAlloc(sizeof(hypre_HostArenaChunk) + size + HYPRE_HOST_ARENA_ALIGNMENT,
+                   HYPRE_MEMORY_HOST);
+   if (!chunk)
+   {
+      return NULL;
+   }
+
+   offset = (size_t) ((char *) chunk + sizeof(hypre_HostArenaChunk)) % HYPRE_HOST_ARENA_ALIGNMENT;
+
+   chunk->next = NULL;
+   chunk->size = size;
+   chunk->used = 0;
+   chunk->data = (char *) chunk + sizeof(hypre_HostArenaChunk) +
+                 (offset ? HYPRE_HOST_ARENA_ALIGNMENT - offset : 0);
+
+   return chunk;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaTrim
+ *
+ * Keeps the first chunk of the default size of each thread and returns the
+ * others to the system.  No scope may be open.
+ *--------------------------------------------------------------------------*/
+
+static void
+hypre_HostArenaTrim( void )
+{
+   hypre_HostArena      *arena;
+   hypre_HostArenaChunk *chunk, *next, *keep;
+   HYPRE_Int             t;
+
+   for (t = 0; t < HYPRE_HOST_ARENA_MAX_THREADS; t++)
+   {
+      arena = hypre_host_arenas[t];
+      if (arena)
+      {
+         keep = NULL;
+         for (chunk = arena->head; chunk; chunk = next)
+         {
+            next = chunk->next;
+            if (!keep && chunk->size == HYPRE_HOST_ARENA_CHUNK_SIZE)
+            {
+               keep = chunk;
+            }
+            else
+            {
+               hypre_Free(chunk, HYPRE_MEMORY_HOST);
+            }
+         }
+         if (keep)
+         {
+            keep->next = NULL;
+            keep->used = 0;
+         }
+         arena->head    = keep;
+         arena->current = NULL;
+      }
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaPush
+ *
+ * Opens a scope.  Must be called outside of parallel regions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaPush( void )
+{
+   hypre_HostArena *arena;
+   HYPRE_Int        depth;
+   HYPRE_Int        t;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic capture
+#endif
+   depth = hypre_host_arena_depth++;
+
+   if (depth >= HYPRE_HOST_ARENA_MAX_DEPTH)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic update
+#endif
+      hypre_host_arena_depth--;
+
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Too many nested host arena scopes\n");
+      return hypre_error_flag;
+   }
+
+   for (t = 0; t < HYPRE_HOST_ARENA_MAX_THREADS; t++)
+   {
+      arena = hypre_host_arenas[t];
+      if (arena)
+      {
+         arena->mark_chunk[depth] = arena->current;
+         arena->mark_used[depth]  = arena->current ? arena->current->used : 0;
+      }
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaPop
+ *
+ * Closes the innermost scope and releases everything allocated in it by all
+ * threads.  Closing the outermost scope also trims the arena.  Must be called
+ * outside of parallel regions.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaPop( void )
+{
+   hypre_HostArena *arena;
+   HYPRE_Int        depth;
+   HYPRE_Int        t;
+
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic capture
+#endif
+   depth = --hypre_host_arena_depth;
+
+   if (depth < 0)
+   {
+#ifdef HYPRE_USING_OPENMP
+#pragma omp atomic update
+#endif
+      hypre_host_arena_depth++;
+
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "No host arena scope to close\n");
+      return hypre_error_flag;
+   }
+
+   for (t = 0; t < HYPRE_HOST_ARENA_MAX_THREADS; t++)
+   {
+      arena = hypre_host_arenas[t];
+      if (arena)
+      {
+         arena->current = arena->mark_chunk[depth];
+         if (arena->current)
+         {
+            arena->current->used = arena->mark_used[depth];
+         }
+      }
+   }
+
+   if (depth == 0)
+   {
+      hypre_HostArenaTrim();
+   }
+
+   return hypre_error_flag;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaMAlloc
+ *
+ * Returns size bytes from the arena of the calling thread, aligned to
+ * HYPRE_HOST_ARENA_ALIGNMENT.  A scope must be open.
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostArenaMAlloc( size_t size )
+{
+   HYPRE_Int             t = hypre_GetThreadNum();
+   hypre_HostArena      *arena;
+   hypre_HostArenaChunk *chunk, *next;
+   void                 *ptr;
+
+   if (hypre_HostArenaGetDepth() == 0 || t >= HYPRE_HOST_ARENA_MAX_THREADS)
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Host arena allocation outside of a scope\n");
+      return NULL;
+   }
+
+   arena = hypre_host_arenas[t];
+   if (!arena)
+   {
+      /* created inside a scope: all of its marks are "before head" */
+      arena = (hypre_HostArena *) hypre_CAlloc(1, sizeof(hypre_HostArena), HYPRE_MEMORY_HOST);
+      hypre_host_arenas[t] = arena;
+   }
+
+   size = (size + HYPRE_HOST_ARENA_ALIGNMENT - 1) / HYPRE_HOST_ARENA_ALIGNMENT *
+          HYPRE_HOST_ARENA_ALIGNMENT;
+
+   chunk = arena->current;
+   if (!chunk || chunk->used + size > chunk->size)
+   {
+      /* move on to the next chunk, or insert a new one if it is too small */
+      next = chunk ? chunk->next : arena->head;
+      if (!next || next->size < size)
+      {
+         next = hypre_HostArenaChunkCreate(hypre_max(size, HYPRE_HOST_ARENA_CHUNK_SIZE));
+         if (!next)
+         {
+            hypre_error_w_msg(HYPRE_ERROR_MEMORY, "Out of memory in the host arena\n");
+            return NULL;
+         }
+         if (chunk)
+         {
+            next->next  = chunk->next;
+            chunk->next = next;
+         }
+         else
+         {
+            next->next  = arena->head;
+            arena->head = next;
+         }
+      }
+      next->used = 0;
+      arena->current = chunk = next;
+   }
+
+   ptr = chunk->data + chunk->used;
+   chunk->used += size;
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaCAlloc
+ *--------------------------------------------------------------------------*/
+
+void *
+hypre_HostArenaCAlloc( size_t count,
+                       size_t elt_size )
+{
+   size_t  size = count * elt_size;
+   void   *ptr  = hypre_HostArenaMAlloc(size);
+
+   if (ptr)
+   {
+      memset(ptr, 0, size);
+   }
+
+   return ptr;
+}
+
+/*--------------------------------------------------------------------------
+ * hypre_HostArenaDestroy
+ *
+ * Returns the chunks of all threads to the system.  No scope may be open.
+ *--------------------------------------------------------------------------*/
+
+HYPRE_Int
+hypre_HostArenaDestroy( void )
+{
+   hypre_HostArena      *arena;
+   hypre_HostArenaChunk *chunk, *next;
+   HYPRE_Int             t;
+
+   if (hypre_HostArenaGetDepth())
+   {
+      hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Host arena destroyed with an open scope\n");
+      return hypre_error_flag;
+   }
+
+   for (t = 0; t < HYPRE_HOST_ARENA_MAX_THREADS; t++)
+   {
+      arena = hypre_host_arenas[t];
+      if (arena)
+      {
+         for (chunk = arena->head; chunk; chunk = next)
+         {
+            next = chunk->next;
+            hypre_Free(chunk, HYPRE_MEMORY_HOST);
+         }
+         hypre_Free(arena, HYPRE_MEMORY_HOST);
+         hypre_host_arenas[t] = NULL;
+      }
+   }
+
+   return hypre_error_flag;
+}
@@ -68,6 +68,14 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return(0);
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -406,6 +414,18 @@ hypre_MPI_Irsend( void               *buf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Startall( HYPRE_Int          count,
                     hypre_MPI_Request *array_of_requests )
@@ -553,6 +573,20 @@ hypre_MPI_Allreduce( void              *sendbuf,
    return 0;
 }
 
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+   hypre_MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+   *request = hypre_MPI_REQUEST_NULL;
+   return 0;
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -646,6 +680,35 @@ hypre_MPI_Op_free( hypre_MPI_Op *op )
    return(0);
 }
 
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+   *comm_dist_graph = comm;
+   return(0);
+}
+
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+   *request = hypre_MPI_REQUEST_NULL;
+   return(0);
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
 {
@@ -707,6 +770,19 @@ hypre_MPI_Barrier( hypre_MPI_Comm comm )
    return (HYPRE_Int) MPI_Barrier(comm);
 }
 
+/* Falls back to a blocking barrier for MPI libraries older than MPI-3 */
+HYPRE_Int
+hypre_MPI_Ibarrier( hypre_MPI_Comm     comm,
+                    hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Ibarrier(comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Barrier(comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Comm_create( hypre_MPI_Comm   comm,
                        hypre_MPI_Group  group,
@@ -1082,6 +1158,19 @@ hypre_MPI_Irsend( void               *buf,
                                  (hypre_int)dest, (hypre_int)tag, comm, request);
 }
 
+HYPRE_Int
+hypre_MPI_Issend( void               *buf,
+                  HYPRE_Int           count,
+                  hypre_MPI_Datatype  datatype,
+                  HYPRE_Int           dest,
+                  HYPRE_Int           tag,
+                  hypre_MPI_Comm      comm,
+                  hypre_MPI_Request  *request )
+{
+   return (HYPRE_Int) MPI_Issend(buf, (hypre_int)count, datatype,
+                                 (hypre_int)dest, (hypre_int)tag, comm, request);
+}
+
 HYPRE_Int
 hypre_MPI_Startall( HYPRE_Int          count,
                     hypre_MPI_Request *array_of_requests )
@@ -1181,6 +1270,26 @@ hypre_MPI_Allreduce( void              *sendbuf,
                                     datatype, op, comm);
 }
 
+/* Falls back to a blocking reduction for MPI libraries older than MPI-3 */
+HYPRE_Int
+hypre_MPI_Iallreduce( void              *sendbuf,
+                      void              *recvbuf,
+                      HYPRE_Int          count,
+                      hypre_MPI_Datatype datatype,
+                      hypre_MPI_Op       op,
+                      hypre_MPI_Comm     comm,
+                      hypre_MPI_Request *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Iallreduce(sendbuf, recvbuf, (hypre_int)count,
+                                     datatype, op, comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   return (HYPRE_Int) MPI_Allreduce(sendbuf, recvbuf, (hypre_int)count,
+                                    datatype, op, comm);
+#endif
+}
+
 HYPRE_Int
 hypre_MPI_Reduce( void               *sendbuf,
                   void               *recvbuf,
@@ -1303,6 +1412,81 @@ hypre_MPI_Op_create( hypre_MPI_User_function *function, hypre_int commute, hypre
    return (HYPRE_Int) MPI_Op_create(function, commute, op);
 }
 
+/* The neighborhood collectives need MPI-3; callers check MPI_VERSION first */
+HYPRE_Int
+hypre_MPI_Dist_graph_create_adjacent( hypre_MPI_Comm  comm,
+                                      HYPRE_Int       indegree,
+                                      HYPRE_Int      *sources,
+                                      HYPRE_Int       outdegree,
+                                      HYPRE_Int      *destinations,
+                                      HYPRE_Int       reorder,
+                                      hypre_MPI_Comm *comm_dist_graph )
+{
+#if MPI_VERSION >= 3
+   hypre_int *mpi_sources, *mpi_destinations, *mpi_weights;
+   HYPRE_Int  num_weights = hypre_max(hypre_max(indegree, outdegree), 1);
+   HYPRE_Int  i;
+   HYPRE_Int  ierr;
+
+   /* Unit weights sized by the degrees are passed instead of MPI_UNWEIGHTED,
+    * whose sentinel pointer compilers flag as a read past a zero-size
+    * object.  Every process passes weights, as MPI requires. */
+   mpi_sources = hypre_TAlloc(hypre_int, indegree + outdegree + num_weights,
+                              HYPRE_MEMORY_HOST);
+   mpi_destinations = mpi_sources + indegree;
+   mpi_weights = mpi_destinations + outdegree;
+   for (i = 0; i < indegree; i++)
+   {
+      mpi_sources[i] = (hypre_int) sources[i];
+   }
+   for (i = 0; i < outdegree; i++)
+   {
+      mpi_destinations[i] = (hypre_int) destinations[i];
+   }
+   for (i = 0; i < num_weights; i++)
+   {
+      mpi_weights[i] = 1;
+   }
+   ierr = (HYPRE_Int) MPI_Dist_graph_create_adjacent(comm, (hypre_int)indegree, mpi_sources,
+                                                     mpi_weights, (hypre_int)outdegree,
+                                                     mpi_destinations, mpi_weights,
+                                                     MPI_INFO_NULL, (hypre_int)reorder,
+                                                     comm_dist_graph);
+   hypre_TFree(mpi_sources, HYPRE_MEMORY_HOST);
+
+   return ierr;
+#else
+   *comm_dist_graph = MPI_COMM_NULL;
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Distributed graph communicators require MPI-3\n");
+   return hypre_error_flag;
+#endif
+}
+
+/* The counts and displacements are hypre_int since they must stay valid until
+ * the request completes */
+HYPRE_Int
+hypre_MPI_Ineighbor_alltoallv( void               *sendbuf,
+                               hypre_int          *sendcounts,
+                               hypre_int          *sdispls,
+                               hypre_MPI_Datatype  sendtype,
+                               void               *recvbuf,
+                               hypre_int          *recvcounts,
+                               hypre_int          *rdispls,
+                               hypre_MPI_Datatype  recvtype,
+                               hypre_MPI_Comm      comm,
+                               hypre_MPI_Request  *request )
+{
+#if MPI_VERSION >= 3
+   return (HYPRE_Int) MPI_Ineighbor_alltoallv(sendbuf, sendcounts, sdispls, sendtype,
+                                              recvbuf, recvcounts, rdispls, recvtype,
+                                              comm, request);
+#else
+   *request = MPI_REQUEST_NULL;
+   hypre_error_w_msg(HYPRE_ERROR_GENERIC, "Neighborhood collectives require MPI-3\n");
+   return hypre_error_flag;
+#endif
+}
+
 #if defined(HYPRE_USING_CUDA) || defined(HYPRE_USING_DEVICE_OPENMP)
 HYPRE_Int
 hypre_MPI_Comm_split_type( hypre_MPI_Comm comm, HYPRE_Int split_type, HYPRE_Int key, hypre_MPI_Info info, hypre_MPI_Comm *newcomm )
@@ -37,6 +37,11 @@ hypre_Handle* hypre_HandleCreate();
 HYPRE_Int hypre_HandleDestroy(hypre_Handle *hypre_handle_);
 HYPRE_Int HYPRE_Init();
 HYPRE_Int HYPRE_Finalize();
+HYPRE_Int HYPRE_SetSpMVUseSELL(HYPRE_Int use_sell);
+HYPRE_Int HYPRE_SetExchangeNBX(HYPRE_Int use_nbx);
+HYPRE_Int HYPRE_SetCommNeighborColl(HYPRE_Int use_neighbor_coll);
+HYPRE_Int HYPRE_SetBoxLoopTile(HYPRE_Int ndim, HYPRE_Int *tile);
+HYPRE_Int HYPRE_SetBoxLoopSchedule(HYPRE_Int schedule);
 HYPRE_Int hypre_SetDevice(HYPRE_Int use_device, hypre_Handle *hypre_handle_);
 
 /* hypre_qsort.c */